@@ -30,6 +30,7 @@
 
 #include "custom_csv_formater.hpp"
 #include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -805,6 +806,74 @@ struct generator_discrete_custom : public generator_type
     rocrand_discrete_distribution discrete_distribution;
 };
 
+template<typename Engine>
+struct generator_binomial : public generator_type
+{
+    typedef unsigned int data_type;
+
+    std::string name()
+    {
+        std::stringstream stream;
+        stream << std::fixed << std::setprecision(2) << p;
+        return "binomial(n=" + std::to_string(n) + ",p=" + stream.str() + ")";
+    }
+
+    __device__
+    data_type
+        operator()(Engine* state)
+    {
+        return rocrand_binomial(state, n, p);
+    }
+
+    unsigned int n;
+    double       p;
+};
+
+template<typename Engine>
+struct generator_discrete_binomial : public generator_type
+{
+    typedef unsigned int data_type;
+
+    std::string name()
+    {
+        std::stringstream stream;
+        stream << std::fixed << std::setprecision(2) << p;
+        return "discrete-binomial(n=" + std::to_string(n) + ",p=" + stream.str() + ")";
+    }
+
+    void create()
+    {
+        // Builds the table of the probability mass function for this parameter set
+        std::vector<double> probabilities(n + 1);
+        for(unsigned int k = 0; k <= n; k++)
+        {
+            probabilities[k] = std::exp(std::lgamma(n + 1.0) - std::lgamma(k + 1.0)
+                                        - std::lgamma(n - k + 1.0) + k * std::log(p)
+                                        + (n - k) * std::log1p(-p));
+        }
+        ROCRAND_CHECK(rocrand_create_discrete_distribution(probabilities.data(),
+                                                           probabilities.size(),
+                                                           0,
+                                                           &discrete_distribution));
+    }
+
+    void destroy()
+    {
+        ROCRAND_CHECK(rocrand_destroy_discrete_distribution(discrete_distribution));
+    }
+
+    __device__
+    data_type
+        operator()(Engine* state)
+    {
+        return rocrand_discrete(state, discrete_distribution);
+    }
+
+    rocrand_discrete_distribution discrete_distribution;
+    unsigned int                  n;
+    double                        p;
+};
+
 struct benchmark_context
 {
     size_t              size;
@@ -813,6 +882,8 @@ struct benchmark_context
     size_t              blocks;
     size_t              threads;
     std::vector<double> lambdas;
+    std::vector<size_t> binomial_trials;
+    double              binomial_p;
 };
 
 template<typename Engine, typename Generator>
@@ -905,7 +976,11 @@ void add_benchmarks(const benchmark_context&                      ctx,
     constexpr bool is_64_bits = std::is_same<Engine, rocrand_state_scrambled_sobol64>::value
                                 || std::is_same<Engine, rocrand_state_sobol64>::value
                                 || std::is_same<Engine, rocrand_state_threefry2x64_20>::value
-                                || std::is_same<Engine, rocrand_state_threefry4x64_20>::value;
+                                || std::is_same<Engine, rocrand_state_threefry4x64_20>::value
+                                || std::is_same<Engine, rocrand_state_philox4x64_10>::value
+                                || std::is_same<Engine, rocrand_state_xoshiro256pp>::value
+                                || std::is_same<Engine, rocrand_state_xoroshiro128ss>::value
+                                || std::is_same<Engine, rocrand_state_pcg64_dxsm>::value;
 
     const std::string name = engine_name(engine_type);
 
@@ -940,6 +1015,22 @@ void add_benchmarks(const benchmark_context&                      ctx,
     }
 
     add_benchmark<Engine>(ctx, stream, benchmarks, name, generator_discrete_custom<Engine>());
+
+    for(size_t i = 0; i < ctx.binomial_trials.size(); i++)
+    {
+        generator_binomial<Engine> gen_binomial;
+        gen_binomial.n = ctx.binomial_trials[i];
+        gen_binomial.p = ctx.binomial_p;
+        add_benchmark<Engine>(ctx, stream, benchmarks, name, gen_binomial);
+    }
+
+    for(size_t i = 0; i < ctx.binomial_trials.size(); i++)
+    {
+        generator_discrete_binomial<Engine> gen_discrete_binomial;
+        gen_discrete_binomial.n = ctx.binomial_trials[i];
+        gen_discrete_binomial.p = ctx.binomial_p;
+        add_benchmark<Engine>(ctx, stream, benchmarks, name, gen_discrete_binomial);
+    }
 }
 
 int main(int argc, char* argv[])
@@ -968,6 +1059,15 @@ int main(int argc, char* argv[])
         "lambda",
         {10.0},
         "space-separated list of lambdas of Poisson distribution");
+    parser.set_optional<std::vector<size_t>>(
+        "binomial-trials",
+        "binomial-trials",
+        {20, 1000},
+        "space-separated list of numbers of trials of binomial distribution");
+    parser.set_optional<double>("binomial-p",
+                                "binomial-p",
+                                0.3,
+                                "success probability of binomial distribution");
     parser.run_and_exit_if_error();
 
     hipStream_t stream;
@@ -984,6 +1084,9 @@ int main(int argc, char* argv[])
     ctx.threads    = parser.get<size_t>("threads");
     ctx.lambdas    = parser.get<std::vector<double>>("lambda");
 
+    ctx.binomial_trials = parser.get<std::vector<size_t>>("binomial-trials");
+    ctx.binomial_p      = parser.get<double>("binomial-p");
+
     benchmark::AddCustomContext("size", std::to_string(ctx.size));
     benchmark::AddCustomContext("dimensions", std::to_string(ctx.dimensions));
     benchmark::AddCustomContext("trials", std::to_string(ctx.trials));
@@ -1001,6 +1104,10 @@ int main(int argc, char* argv[])
                                                 stream,
                                                 benchmarks,
                                                 ROCRAND_RNG_PSEUDO_PHILOX4_32_10);
+    add_benchmarks<rocrand_state_philox4x64_10>(ctx,
+                                                stream,
+                                                benchmarks,
+                                                ROCRAND_RNG_PSEUDO_PHILOX4_64_10);
     add_benchmarks<rocrand_state_scrambled_sobol32>(ctx,
                                                     stream,
                                                     benchmarks,
@@ -1028,6 +1135,19 @@ int main(int argc, char* argv[])
                                                   benchmarks,
                                                   ROCRAND_RNG_PSEUDO_THREEFRY4_64_20);
     add_benchmarks<rocrand_state_xorwow>(ctx, stream, benchmarks, ROCRAND_RNG_PSEUDO_XORWOW);
+    add_benchmarks<rocrand_state_xoshiro256pp>(ctx,
+                                               stream,
+                                               benchmarks,
+                                               ROCRAND_RNG_PSEUDO_XOSHIRO256PP);
+    add_benchmarks<rocrand_state_xoroshiro128ss>(ctx,
+                                                 stream,
+                                                 benchmarks,
+                                                 ROCRAND_RNG_PSEUDO_XOROSHIRO128SS);
+    add_benchmarks<rocrand_state_pcg64_dxsm>(ctx,
+                                             stream,
+                                             benchmarks,
+                                             ROCRAND_RNG_PSEUDO_PCG64_DXSM);
+    add_benchmarks<rocrand_state_squares>(ctx, stream, benchmarks, ROCRAND_RNG_PSEUDO_SQUARES);
 
     // Use manual timing
     for(auto& b : benchmarks)
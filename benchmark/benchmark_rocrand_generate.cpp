@@ -332,8 +332,13 @@ const std::vector<std::string> all_engines = {
     "mrg32k3a",
     "mtgp32",
     "philox",
+    "philox4x64",
     "lfsr113",
     "mt19937",
+    "xoshiro256pp",
+    "xoroshiro128ss",
+    "pcg64_dxsm",
+    "squares",
     "threefry2x32",
     "threefry2x64",
     "threefry4x32",
@@ -476,6 +481,8 @@ int main(int argc, char* argv[])
             rng_type = ROCRAND_RNG_PSEUDO_MRG32K3A;
         else if(engine == "philox")
             rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_32_10;
+        else if(engine == "philox4x64")
+            rng_type = ROCRAND_RNG_PSEUDO_PHILOX4_64_10;
         else if(engine == "threefry2x32")
             rng_type = ROCRAND_RNG_PSEUDO_THREEFRY2_32_20;
         else if(engine == "threefry2x64")
@@ -498,6 +505,14 @@ int main(int argc, char* argv[])
             rng_type = ROCRAND_RNG_PSEUDO_LFSR113;
         else if(engine == "mt19937")
             rng_type = ROCRAND_RNG_PSEUDO_MT19937;
+        else if(engine == "xoshiro256pp")
+            rng_type = ROCRAND_RNG_PSEUDO_XOSHIRO256PP;
+        else if(engine == "xoroshiro128ss")
+            rng_type = ROCRAND_RNG_PSEUDO_XOROSHIRO128SS;
+        else if(engine == "pcg64_dxsm")
+            rng_type = ROCRAND_RNG_PSEUDO_PCG64_DXSM;
+        else if(engine == "squares")
+            rng_type = ROCRAND_RNG_PSEUDO_SQUARES;
         else
         {
             std::cout << "Wrong engine name" << std::endl;
@@ -128,6 +128,54 @@ void run_benchmark(benchmark::State&      state,
     }
 }
 
+// Measures the initialization of the generator (e.g. skipping ahead of its engines)
+// after setting the offset.
+void run_init_benchmark(benchmark::State& state,
+                        const size_t      offset,
+                        const rng_type_t  rng_type,
+                        const bool        benchmark_host,
+                        hipStream_t       stream)
+{
+    rocrand_generator generator;
+    if(benchmark_host)
+    {
+        ROCRAND_CHECK(rocrand_create_generator_host(&generator, rng_type));
+    }
+    else
+    {
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    }
+    ROCRAND_CHECK(rocrand_set_stream(generator, stream));
+
+    // Warm-up
+    ROCRAND_CHECK(rocrand_set_offset(generator, offset));
+    ROCRAND_CHECK(rocrand_initialize_generator(generator));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipEvent_t start, stop;
+    HIP_CHECK(hipEventCreate(&start));
+    HIP_CHECK(hipEventCreate(&stop));
+    for(auto _ : state)
+    {
+        // Setting the offset resets the generator
+        ROCRAND_CHECK(rocrand_set_offset(generator, offset));
+
+        HIP_CHECK(hipEventRecord(start, stream));
+        ROCRAND_CHECK(rocrand_initialize_generator(generator));
+        HIP_CHECK(hipEventRecord(stop, stream));
+        HIP_CHECK(hipEventSynchronize(stop));
+
+        float elapsed = 0.0f;
+        HIP_CHECK(hipEventElapsedTime(&elapsed, start, stop));
+
+        state.SetIterationTime(elapsed / 1000.f);
+    }
+
+    HIP_CHECK(hipEventDestroy(stop));
+    HIP_CHECK(hipEventDestroy(start));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
 int main(int argc, char* argv[])
 {
 
@@ -159,6 +207,15 @@ int main(int argc, char* argv[])
         "lambda",
         {10.0},
         "space-separated list of lambdas of Poisson distribution");
+    parser.set_optional<std::vector<size_t>>(
+        "binomial-trials",
+        "binomial-trials",
+        {20, 1000},
+        "space-separated list of numbers of trials of binomial distribution");
+    parser.set_optional<double>("binomial-p",
+                                "binomial-p",
+                                0.3,
+                                "success probability of binomial and geometric distributions");
     parser.set_optional<bool>("host",
                               "host",
                               false,
@@ -177,6 +234,8 @@ int main(int argc, char* argv[])
     const size_t              dimensions      = parser.get<size_t>("dimensions");
     const size_t              offset          = parser.get<size_t>("offset");
     const std::vector<double> poisson_lambdas = parser.get<std::vector<double>>("lambda");
+    const std::vector<size_t> binomial_trials = parser.get<std::vector<size_t>>("binomial-trials");
+    const double              binomial_p      = parser.get<double>("binomial-p");
     const bool                benchmark_host  = parser.get<bool>("host");
 
     benchmark::AddCustomContext("size", std::to_string(size));
@@ -192,15 +251,25 @@ int main(int argc, char* argv[])
                                                      ROCRAND_RNG_PSEUDO_MTGP32,
                                                      ROCRAND_RNG_PSEUDO_MT19937,
                                                      ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                                     ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
                                                      ROCRAND_RNG_PSEUDO_THREEFRY2_32_20,
                                                      ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
                                                      ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
                                                      ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
                                                      ROCRAND_RNG_PSEUDO_XORWOW,
+                                                     ROCRAND_RNG_PSEUDO_XOSHIRO256PP,
+                                                     ROCRAND_RNG_PSEUDO_XOROSHIRO128SS,
+                                                     ROCRAND_RNG_PSEUDO_PCG64_DXSM,
+                                                     ROCRAND_RNG_PSEUDO_SQUARES,
                                                      ROCRAND_RNG_QUASI_SOBOL32,
                                                      ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32,
                                                      ROCRAND_RNG_QUASI_SOBOL64,
                                                      ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64};
+    if(benchmark_host)
+    {
+        // ARS is only available as a host generator
+        benchmarked_engine_types.push_back(ROCRAND_RNG_PSEUDO_ARS);
+    }
 
     const std::map<rocrand_ordering, std::string> ordering_name_map{
         {ROCRAND_ORDERING_PSEUDO_DEFAULT, "default"},
@@ -208,6 +277,7 @@ int main(int argc, char* argv[])
         {   ROCRAND_ORDERING_PSEUDO_BEST,    "best"},
         {ROCRAND_ORDERING_PSEUDO_DYNAMIC, "dynamic"},
         { ROCRAND_ORDERING_PSEUDO_SEEDED,  "seeded"},
+        {ROCRAND_ORDERING_PSEUDO_PORTABLE, "portable"},
         { ROCRAND_ORDERING_QUASI_DEFAULT, "default"},
     };
 
@@ -217,15 +287,21 @@ int main(int argc, char* argv[])
             {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC}},
         {         ROCRAND_RNG_PSEUDO_MT19937, {ROCRAND_ORDERING_PSEUDO_DEFAULT}},
         {          ROCRAND_RNG_PSEUDO_XORWOW,
-            {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC} },
+            {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC,
+             ROCRAND_ORDERING_PSEUDO_PORTABLE}},
         {        ROCRAND_RNG_PSEUDO_MRG31K3P,
-            {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC}},
+            {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC,
+             ROCRAND_ORDERING_PSEUDO_PORTABLE}},
         {        ROCRAND_RNG_PSEUDO_MRG32K3A,
-            {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC}},
+            {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC,
+             ROCRAND_ORDERING_PSEUDO_PORTABLE}},
         {   ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
             {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC}},
-        {         ROCRAND_RNG_PSEUDO_LFSR113,
+        {   ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
             {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC}},
+        {         ROCRAND_RNG_PSEUDO_LFSR113,
+            {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC,
+             ROCRAND_ORDERING_PSEUDO_PORTABLE}},
         { ROCRAND_RNG_PSEUDO_THREEFRY2_32_20,
             {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC}},
         { ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
@@ -234,6 +310,15 @@ int main(int argc, char* argv[])
             {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC}},
         { ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
             {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC}},
+        {    ROCRAND_RNG_PSEUDO_XOSHIRO256PP,
+            {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC}},
+        {  ROCRAND_RNG_PSEUDO_XOROSHIRO128SS,
+            {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC}},
+        {      ROCRAND_RNG_PSEUDO_PCG64_DXSM,
+            {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC}},
+        {         ROCRAND_RNG_PSEUDO_SQUARES,
+            {ROCRAND_ORDERING_PSEUDO_DEFAULT, ROCRAND_ORDERING_PSEUDO_DYNAMIC}},
+        {             ROCRAND_RNG_PSEUDO_ARS, {ROCRAND_ORDERING_PSEUDO_DEFAULT}},
         {          ROCRAND_RNG_QUASI_SOBOL32,  {ROCRAND_ORDERING_QUASI_DEFAULT}},
         {ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32,  {ROCRAND_ORDERING_QUASI_DEFAULT}},
         {          ROCRAND_RNG_QUASI_SOBOL64,  {ROCRAND_ORDERING_QUASI_DEFAULT}},
@@ -463,6 +548,73 @@ int main(int argc, char* argv[])
                     benchmark_host,
                     stream));
             }
+
+            for(auto binomial_n : binomial_trials)
+            {
+                const std::string binomial_dis_name = std::string("binomial(n=")
+                                                      + std::to_string(binomial_n)
+                                                      + ",p=" + std::to_string(binomial_p) + ")>";
+                benchmarks.emplace_back(benchmark::RegisterBenchmark(
+                    (name_engine_prefix + binomial_dis_name).c_str(),
+                    &run_benchmark<unsigned int>,
+                    [binomial_n, binomial_p](rocrand_generator gen,
+                                             unsigned int*     data,
+                                             size_t            size_gen)
+                    {
+                        return rocrand_generate_binomial(gen,
+                                                         data,
+                                                         size_gen,
+                                                         binomial_n,
+                                                         binomial_p);
+                    },
+                    size,
+                    byte_size,
+                    trials,
+                    dimensions,
+                    offset,
+                    engine_type,
+                    ordering,
+                    benchmark_host,
+                    stream));
+            }
+
+            const std::string geometric_dis_name
+                = std::string("geometric(p=") + std::to_string(binomial_p) + ")>";
+            benchmarks.emplace_back(benchmark::RegisterBenchmark(
+                (name_engine_prefix + geometric_dis_name).c_str(),
+                &run_benchmark<unsigned int>,
+                [binomial_p](rocrand_generator gen, unsigned int* data, size_t size_gen)
+                { return rocrand_generate_geometric(gen, data, size_gen, binomial_p); },
+                size,
+                byte_size,
+                trials,
+                dimensions,
+                offset,
+                engine_type,
+                ordering,
+                benchmark_host,
+                stream));
+        }
+    }
+
+    // Cost of skipping ahead of the engines as a function of the offset
+    const std::string init_benchmark_name_prefix = "device_initialize";
+    for(const rocrand_rng_type engine_type :
+        {ROCRAND_RNG_PSEUDO_XORWOW, ROCRAND_RNG_PSEUDO_LFSR113})
+    {
+        for(const unsigned int offset_log2 : {0, 16, 32, 48, 62})
+        {
+            const size_t init_offset = offset_log2 == 0 ? 0 : (size_t{1} << offset_log2) + 12345;
+            benchmarks.emplace_back(
+                benchmark::RegisterBenchmark((init_benchmark_name_prefix + "<"
+                                              + engine_name(engine_type) + ",offset=2^"
+                                              + std::to_string(offset_log2) + ">")
+                                                 .c_str(),
+                                             &run_init_benchmark,
+                                             init_offset,
+                                             engine_type,
+                                             benchmark_host,
+                                             stream));
         }
     }
 
@@ -862,6 +862,7 @@ const std::vector<std::string> all_engines = {"xorwow",
                                               "mtgp32",
                                               // "mt19937",
                                               "philox",
+                                              "philox4x64",
                                               "threefry2x32",
                                               "threefry2x64",
                                               "threefry4x32",
@@ -870,7 +871,11 @@ const std::vector<std::string> all_engines = {"xorwow",
                                               "scrambled_sobol32",
                                               "sobol64",
                                               "scrambled_sobol64",
-                                              "lfsr113"};
+                                              "lfsr113",
+                                              "xoshiro256pp",
+                                              "xoroshiro128ss",
+                                              "pcg64_dxsm",
+                                              "squares"};
 
 const std::vector<std::string> all_distributions = {
     "uniform-uint",
@@ -1042,6 +1047,26 @@ int main(int argc, char *argv[])
             {
                 run_benchmarks<rocrand_state_threefry4x64_20>(parser, distribution, engine, stream);
             }
+            else if(engine == "philox4x64")
+            {
+                run_benchmarks<rocrand_state_philox4x64_10>(parser, distribution, engine, stream);
+            }
+            else if(engine == "xoshiro256pp")
+            {
+                run_benchmarks<rocrand_state_xoshiro256pp>(parser, distribution, engine, stream);
+            }
+            else if(engine == "xoroshiro128ss")
+            {
+                run_benchmarks<rocrand_state_xoroshiro128ss>(parser, distribution, engine, stream);
+            }
+            else if(engine == "pcg64_dxsm")
+            {
+                run_benchmarks<rocrand_state_pcg64_dxsm>(parser, distribution, engine, stream);
+            }
+            else if(engine == "squares")
+            {
+                run_benchmarks<rocrand_state_squares>(parser, distribution, engine, stream);
+            }
         }
         std::cout << std::endl;
     }
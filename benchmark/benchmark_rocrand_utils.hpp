@@ -71,6 +71,12 @@ inline std::string engine_name(const rocrand_rng_type rng_type)
         case ROCRAND_RNG_PSEUDO_THREEFRY2_64_20:  return "threefry2_64_20";
         case ROCRAND_RNG_PSEUDO_THREEFRY4_32_20:  return "threefry4_32_20";
         case ROCRAND_RNG_PSEUDO_THREEFRY4_64_20:  return "threefry4_64_20";
+        case ROCRAND_RNG_PSEUDO_PHILOX4_64_10:    return "philox4_64_10";
+        case ROCRAND_RNG_PSEUDO_XOSHIRO256PP:     return "xoshiro256pp";
+        case ROCRAND_RNG_PSEUDO_XOROSHIRO128SS:   return "xoroshiro128ss";
+        case ROCRAND_RNG_PSEUDO_PCG64_DXSM:       return "pcg64_dxsm";
+        case ROCRAND_RNG_PSEUDO_SQUARES:          return "squares";
+        case ROCRAND_RNG_PSEUDO_ARS:              return "ars";
         case ROCRAND_RNG_QUASI_SOBOL32:           return "sobol32";
         case ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32: return "scrambled_sobol32";
         case ROCRAND_RNG_QUASI_SOBOL64:           return "sobol64";
@@ -23,6 +23,60 @@
 #include "cmdparser.hpp"
 #include "rng/xorwow.hpp"
 
+void add_device_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                           const benchmark_config&                       config)
+{
+    benchmark_tuning::add_all_benchmarks_for_generator<
+        benchmark_tuning::lfsr113_generator_template>(benchmarks, config);
+    benchmark_tuning::add_all_benchmarks_for_generator<
+        benchmark_tuning::mrg31k3p_generator_template>(benchmarks, config);
+    benchmark_tuning::add_all_benchmarks_for_generator<
+        benchmark_tuning::mrg32k3a_generator_template>(benchmarks, config);
+    benchmark_tuning::add_all_benchmarks_for_generator<
+        benchmark_tuning::mt19937_generator_template>(benchmarks, config);
+    benchmark_tuning::add_all_benchmarks_for_generator<benchmark_tuning::mtgp32_generator_template>(
+        benchmarks,
+        config);
+    benchmark_tuning::add_all_benchmarks_for_generator<
+        benchmark_tuning::pcg64_dxsm_generator_template>(benchmarks, config);
+    benchmark_tuning::add_all_benchmarks_for_generator<
+        benchmark_tuning::philox4x32_10_generator_template>(benchmarks, config);
+    benchmark_tuning::add_all_benchmarks_for_generator<
+        benchmark_tuning::squares_generator_template>(benchmarks, config);
+    benchmark_tuning::add_all_benchmarks_for_generator<
+        benchmark_tuning::philox4x64_10_generator_template>(benchmarks, config);
+    benchmark_tuning::add_all_benchmarks_for_generator<
+        benchmark_tuning::threefry2x32_20_generator_template>(benchmarks, config);
+    benchmark_tuning::add_all_benchmarks_for_generator<
+        benchmark_tuning::threefry2x64_20_generator_template>(benchmarks, config);
+    benchmark_tuning::add_all_benchmarks_for_generator<
+        benchmark_tuning::threefry4x32_20_generator_template>(benchmarks, config);
+    benchmark_tuning::add_all_benchmarks_for_generator<
+        benchmark_tuning::threefry4x64_20_generator_template>(benchmarks, config);
+    benchmark_tuning::add_all_benchmarks_for_generator<benchmark_tuning::xorwow_generator_template>(
+        benchmarks,
+        config);
+    benchmark_tuning::add_all_benchmarks_for_generator<
+        benchmark_tuning::xoshiro256pp_generator_template>(benchmarks, config);
+    benchmark_tuning::add_all_benchmarks_for_generator<
+        benchmark_tuning::xoroshiro128ss_generator_template>(benchmarks, config);
+}
+
+void add_host_benchmarks(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                         const benchmark_config&                       config)
+{
+    benchmark_tuning::add_host_benchmarks_for_generator<
+        benchmark_tuning::lfsr113_host_generator_template>(benchmarks, config);
+    benchmark_tuning::add_host_benchmarks_for_generator<
+        benchmark_tuning::mrg31k3p_host_generator_template>(benchmarks, config);
+    benchmark_tuning::add_host_benchmarks_for_generator<
+        benchmark_tuning::mrg32k3a_host_generator_template>(benchmarks, config);
+    benchmark_tuning::add_host_benchmarks_for_generator<
+        benchmark_tuning::squares_host_generator_template>(benchmarks, config);
+    benchmark_tuning::add_host_benchmarks_for_generator<
+        benchmark_tuning::xorwow_host_generator_template>(benchmarks, config);
+}
+
 int main(int argc, char** argv)
 {
     constexpr std::size_t default_bytes  = 1024 * 1024 * 512;
@@ -38,6 +92,11 @@ int main(int argc, char** argv)
                                 "lambda",
                                 default_lambda,
                                 "lambda value to be used in the Poisson distribution");
+    parser.set_optional<bool>("host",
+                              "host",
+                              false,
+                              "sweep the number of blocks of host generators instead of the "
+                              "configs of device generators");
     parser.run_and_exit_if_error();
 
     const benchmark_config config{
@@ -51,30 +110,14 @@ int main(int argc, char** argv)
     add_common_benchmark_rocrand_info();
 
     std::vector<benchmark::internal::Benchmark*> benchmarks;
-    benchmark_tuning::add_all_benchmarks_for_generator<
-        benchmark_tuning::lfsr113_generator_template>(benchmarks, config);
-    benchmark_tuning::add_all_benchmarks_for_generator<
-        benchmark_tuning::mrg31k3p_generator_template>(benchmarks, config);
-    benchmark_tuning::add_all_benchmarks_for_generator<
-        benchmark_tuning::mrg32k3a_generator_template>(benchmarks, config);
-    benchmark_tuning::add_all_benchmarks_for_generator<
-        benchmark_tuning::mt19937_generator_template>(benchmarks, config);
-    benchmark_tuning::add_all_benchmarks_for_generator<benchmark_tuning::mtgp32_generator_template>(
-        benchmarks,
-        config);
-    benchmark_tuning::add_all_benchmarks_for_generator<
-        benchmark_tuning::philox4x32_10_generator_template>(benchmarks, config);
-    benchmark_tuning::add_all_benchmarks_for_generator<
-        benchmark_tuning::threefry2x32_20_generator_template>(benchmarks, config);
-    benchmark_tuning::add_all_benchmarks_for_generator<
-        benchmark_tuning::threefry2x64_20_generator_template>(benchmarks, config);
-    benchmark_tuning::add_all_benchmarks_for_generator<
-        benchmark_tuning::threefry4x32_20_generator_template>(benchmarks, config);
-    benchmark_tuning::add_all_benchmarks_for_generator<
-        benchmark_tuning::threefry4x64_20_generator_template>(benchmarks, config);
-    benchmark_tuning::add_all_benchmarks_for_generator<benchmark_tuning::xorwow_generator_template>(
-        benchmarks,
-        config);
+    if(parser.get<bool>("host"))
+    {
+        add_host_benchmarks(benchmarks, config);
+    }
+    else
+    {
+        add_device_benchmarks(benchmarks, config);
+    }
 
     // Use manual timing
     for(auto& b : benchmarks)
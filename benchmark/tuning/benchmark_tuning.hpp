@@ -21,9 +21,12 @@
 #ifndef ROCRAND_BENCHMARK_TUNING_HPP_
 #define ROCRAND_BENCHMARK_TUNING_HPP_
 
+#include <chrono>
+#include <string>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 #include "hip/hip_runtime.h"
@@ -120,6 +123,44 @@ void run_benchmark(benchmark::State& state, const benchmark_config& config)
     HIP_CHECK(hipFree(data));
 }
 
+/// @brief Runs the googlebenchmark for the specified host generator and output type, generating
+/// uniformly distributed values with \p blocks blocks (0 keeps the number of blocks that is
+/// selected automatically, see \ref rocrand_set_host_launch_blocks).
+/// @tparam T The generated value type.
+/// @tparam Generator The type of the host rocRAND generator to use for the RNG.
+/// @param state Benchmarking state.
+/// @param config Benchmark config, controlling e.g. the size of the generated random array.
+/// @param blocks The number of blocks launched on the host.
+template<class T, class Generator>
+void run_host_benchmark(benchmark::State&       state,
+                        const benchmark_config& config,
+                        const unsigned int      blocks)
+{
+    const std::size_t size = config.bytes / sizeof(T);
+
+    std::vector<T> data(size);
+
+    Generator generator;
+    if(blocks != 0)
+    {
+        ROCRAND_CHECK(generator.set_host_launch_blocks(blocks));
+    }
+
+    // Warm-up
+    ROCRAND_CHECK(generator.generate(data.data(), size));
+
+    for(auto _ : state)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        ROCRAND_CHECK(generator.generate(data.data(), size));
+        const auto stop = std::chrono::steady_clock::now();
+
+        state.SetIterationTime(std::chrono::duration<double>(stop - start).count());
+    }
+    state.SetBytesProcessed(state.iterations() * size * sizeof(T));
+    state.SetItemsProcessed(state.iterations() * size);
+}
+
 /// @brief Helper class to instantiate all benchmarks with the specified \ref GeneratorTemplate.
 template<template<class ConfigProvider> class GeneratorTemplate>
 class generator_benchmark_factory
@@ -175,6 +216,16 @@ public:
                 distribution_input_t<GeneratorTemplate>,
                 rocrand_impl::host::log_normal_distribution_max_input_width<rng_type, T>>;
             add_benchmarks_impl<T, log_normal_distribution_t>();
+
+            if constexpr(!std::is_same_v<T, half>)
+            {
+                // The rejection-based distributions are not implemented for half.
+                using input_t = distribution_input_t<GeneratorTemplate>;
+                add_benchmarks_impl<T,
+                                    rocrand_impl::host::exponential_distribution<T, input_t>>();
+                add_benchmarks_impl<T, rocrand_impl::host::gamma_distribution<T, input_t>>();
+                add_benchmarks_impl<T, rocrand_impl::host::beta_distribution<T, input_t>>();
+            }
         }
     }
 
@@ -264,6 +315,37 @@ void add_all_benchmarks_for_generator(std::vector<benchmark::internal::Benchmark
     benchmark_factory.template add_benchmarks<double>();
 }
 
+/// @brief Instantiate the benchmarks of the number of blocks launched by the host generator of
+/// the specified \ref GeneratorTemplate, with the default configs. The threads of the blocks are
+/// the ones of the default configs, only the number of blocks is swept.
+/// @param benchmarks The list of benchmarks the new benchmarks are appended to.
+/// @param config Benchmark config, controlling e.g. the size of the generated random array.
+template<template<class ConfigProvider> class GeneratorTemplate>
+void add_host_benchmarks_for_generator(std::vector<benchmark::internal::Benchmark*>& benchmarks,
+                                       const benchmark_config&                       config)
+{
+    constexpr rocrand_rng_type rng_type
+        = rocrand_impl::host::gen_template_type_v<GeneratorTemplate>;
+    using Generator = GeneratorTemplate<rocrand_impl::host::default_config_provider<rng_type>>;
+
+    const auto add_benchmarks = [&](const auto tag)
+    {
+        using T = std::decay_t<decltype(tag)>;
+        for(const unsigned int blocks : host_block_options)
+        {
+            const std::string benchmark_name = engine_name(rng_type) + "_host_uniform_"
+                                               + type_name<T>{}() + "_b" + std::to_string(blocks);
+            benchmarks.push_back(benchmark::RegisterBenchmark(
+                benchmark_name.c_str(),
+                [config, blocks](auto& state)
+                { run_host_benchmark<T, Generator>(state, config, blocks); }));
+        }
+    };
+    add_benchmarks(static_cast<unsigned int>(0));
+    add_benchmarks(0.0f);
+    add_benchmarks(0.0);
+}
+
 } // namespace benchmark_tuning
 
 #endif // ROCRAND_BENCHMARK_TUNING_HPP_
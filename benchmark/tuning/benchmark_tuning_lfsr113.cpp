@@ -27,4 +27,7 @@ namespace benchmark_tuning
 template void add_all_benchmarks_for_generator<lfsr113_generator_template>(
     std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
 
+template void add_host_benchmarks_for_generator<lfsr113_host_generator_template>(
+    std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
+
 } // namespace benchmark_tuning
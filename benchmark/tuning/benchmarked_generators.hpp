@@ -52,15 +52,27 @@ class mrg_generator_template;
 template<class System, class ConfigProvider>
 class mtgp32_generator_template;
 
+template<class System, class ConfigProvider>
+class pcg64_dxsm_generator_template;
+
 template<class System, class ConfigProvider>
 class philox4x32_10_generator_template;
 
+template<class System, class ConfigProvider>
+class squares_generator_template;
+
+template<class System, class ConfigProvider>
+class philox4x64_10_generator_template;
+
 template<class System, class Engine, class ConfigProvider>
 class threefry_generator_template;
 
 template<class System, class ConfigProvider>
 class xorwow_generator_template;
 
+template<class System, class Engine, class ConfigProvider>
+class xoshiro_generator_template;
+
 template<class DeviceEngine>
 struct threefry_device_engine;
 
@@ -75,6 +87,8 @@ class threefry2x32_20_engine;
 class threefry2x64_20_engine;
 class threefry4x32_20_engine;
 class threefry4x64_20_engine;
+class xoshiro256pp_engine;
+class xoroshiro128ss_engine;
 } // namespace rocrand_device
 
 namespace benchmark_tuning
@@ -111,11 +125,26 @@ using mt19937_generator_template
     = rocrand_impl::host::mt19937_generator_template<rocrand_impl::system::device_system,
                                                      ConfigProvider>;
 
+template<class ConfigProvider>
+using pcg64_dxsm_generator_template
+    = rocrand_impl::host::pcg64_dxsm_generator_template<rocrand_impl::system::device_system,
+                                                        ConfigProvider>;
+
+template<class ConfigProvider>
+using squares_generator_template
+    = rocrand_impl::host::squares_generator_template<rocrand_impl::system::device_system,
+                                                     ConfigProvider>;
+
 template<class ConfigProvider>
 using philox4x32_10_generator_template
     = rocrand_impl::host::philox4x32_10_generator_template<rocrand_impl::system::device_system,
                                                            ConfigProvider>;
 
+template<class ConfigProvider>
+using philox4x64_10_generator_template
+    = rocrand_impl::host::philox4x64_10_generator_template<rocrand_impl::system::device_system,
+                                                           ConfigProvider>;
+
 template<class ConfigProvider>
 using threefry2x32_20_generator_template = rocrand_impl::host::threefry_generator_template<
     rocrand_impl::system::device_system,
@@ -145,6 +174,48 @@ using xorwow_generator_template
     = rocrand_impl::host::xorwow_generator_template<rocrand_impl::system::device_system,
                                                     ConfigProvider>;
 
+template<class ConfigProvider>
+using xoshiro256pp_generator_template
+    = rocrand_impl::host::xoshiro_generator_template<rocrand_impl::system::device_system,
+                                                     rocrand_device::xoshiro256pp_engine,
+                                                     ConfigProvider>;
+
+template<class ConfigProvider>
+using xoroshiro128ss_generator_template
+    = rocrand_impl::host::xoshiro_generator_template<rocrand_impl::system::device_system,
+                                                     rocrand_device::xoroshiro128ss_engine,
+                                                     ConfigProvider>;
+
+// Host generators whose values do not depend on the number of blocks. Only the number of
+// blocks is swept for these, see add_host_benchmarks_for_generator
+
+template<class ConfigProvider>
+using lfsr113_host_generator_template = rocrand_impl::host::lfsr113_generator_template<
+    rocrand_impl::system::host_system<false>,
+    ConfigProvider>;
+
+template<class ConfigProvider>
+using mrg31k3p_host_generator_template = rocrand_impl::host::mrg_generator_template<
+    rocrand_impl::system::host_system<false>,
+    rocrand_device::mrg31k3p_engine,
+    ConfigProvider>;
+
+template<class ConfigProvider>
+using mrg32k3a_host_generator_template = rocrand_impl::host::mrg_generator_template<
+    rocrand_impl::system::host_system<false>,
+    rocrand_device::mrg32k3a_engine,
+    ConfigProvider>;
+
+template<class ConfigProvider>
+using squares_host_generator_template = rocrand_impl::host::squares_generator_template<
+    rocrand_impl::system::host_system<false>,
+    ConfigProvider>;
+
+template<class ConfigProvider>
+using xorwow_host_generator_template = rocrand_impl::host::xorwow_generator_template<
+    rocrand_impl::system::host_system<false>,
+    ConfigProvider>;
+
 template<>
 struct output_type_supported<unsigned long long, lfsr113_generator_template>
     : public std::false_type
@@ -210,6 +281,18 @@ struct config_filter<mt19937_generator_template, T>
     }
 };
 
+template<>
+struct distribution_input<pcg64_dxsm_generator_template>
+{
+    using type = unsigned long long;
+};
+
+template<>
+struct distribution_input<philox4x64_10_generator_template>
+{
+    using type = unsigned long long;
+};
+
 template<>
 struct distribution_input<threefry2x64_20_generator_template>
 {
@@ -222,6 +305,18 @@ struct distribution_input<threefry4x64_20_generator_template>
     using type = unsigned long long;
 };
 
+template<>
+struct distribution_input<xoshiro256pp_generator_template>
+{
+    using type = unsigned long long;
+};
+
+template<>
+struct distribution_input<xoroshiro128ss_generator_template>
+{
+    using type = unsigned long long;
+};
+
 extern template void add_all_benchmarks_for_generator<lfsr113_generator_template>(
     std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
 
@@ -237,9 +332,18 @@ extern template void add_all_benchmarks_for_generator<mt19937_generator_template
 extern template void add_all_benchmarks_for_generator<mtgp32_generator_template>(
     std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
 
+extern template void add_all_benchmarks_for_generator<pcg64_dxsm_generator_template>(
+    std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
+
 extern template void add_all_benchmarks_for_generator<philox4x32_10_generator_template>(
     std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
 
+extern template void add_all_benchmarks_for_generator<squares_generator_template>(
+    std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
+
+extern template void add_all_benchmarks_for_generator<philox4x64_10_generator_template>(
+    std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
+
 extern template void add_all_benchmarks_for_generator<threefry2x32_20_generator_template>(
     std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
 
@@ -255,6 +359,27 @@ extern template void add_all_benchmarks_for_generator<threefry4x64_20_generator_
 extern template void add_all_benchmarks_for_generator<xorwow_generator_template>(
     std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
 
+extern template void add_all_benchmarks_for_generator<xoshiro256pp_generator_template>(
+    std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
+
+extern template void add_all_benchmarks_for_generator<xoroshiro128ss_generator_template>(
+    std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
+
+extern template void add_host_benchmarks_for_generator<lfsr113_host_generator_template>(
+    std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
+
+extern template void add_host_benchmarks_for_generator<mrg31k3p_host_generator_template>(
+    std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
+
+extern template void add_host_benchmarks_for_generator<mrg32k3a_host_generator_template>(
+    std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
+
+extern template void add_host_benchmarks_for_generator<squares_host_generator_template>(
+    std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
+
+extern template void add_host_benchmarks_for_generator<xorwow_host_generator_template>(
+    std::vector<benchmark::internal::Benchmark*>& benchmarks, const benchmark_config& config);
+
 } // namespace benchmark_tuning
 
 #endif
@@ -136,6 +136,33 @@ struct distribution_name<rocrand_impl::host::log_normal_distribution<T, U, I>>
     }
 };
 
+template<class T, class U>
+struct distribution_name<rocrand_impl::host::exponential_distribution<T, U>>
+{
+    std::string operator()()
+    {
+        return "exponential_" + type_name<T>{}();
+    }
+};
+
+template<class T, class U>
+struct distribution_name<rocrand_impl::host::gamma_distribution<T, U>>
+{
+    std::string operator()()
+    {
+        return "gamma_" + type_name<T>{}();
+    }
+};
+
+template<class T, class U>
+struct distribution_name<rocrand_impl::host::beta_distribution<T, U>>
+{
+    std::string operator()()
+    {
+        return "beta_" + type_name<T>{}();
+    }
+};
+
 template<>
 struct distribution_name<
     rocrand_impl::host::poisson_distribution<rocrand_impl::host::DISCRETE_METHOD_ALIAS>>
@@ -194,6 +221,40 @@ struct default_distribution<rocrand_impl::host::log_normal_distribution<T, U, I>
     }
 };
 
+template<class T, class U>
+struct default_distribution<rocrand_impl::host::exponential_distribution<T, U>>
+{
+    auto operator()(const benchmark_config& /*config*/)
+    {
+        const T lambda = 1;
+        return rocrand_impl::host::exponential_distribution<T, U>(lambda);
+    }
+};
+
+template<class T, class U>
+struct default_distribution<rocrand_impl::host::gamma_distribution<T, U>>
+{
+    auto operator()(const benchmark_config& /*config*/)
+    {
+        // Shapes below 1 take an additional power, so both paths are benchmarked by
+        // the gamma and beta distributions.
+        const T shape = 2;
+        const T scale = 1;
+        return rocrand_impl::host::gamma_distribution<T, U>(shape, scale);
+    }
+};
+
+template<class T, class U>
+struct default_distribution<rocrand_impl::host::beta_distribution<T, U>>
+{
+    auto operator()(const benchmark_config& /*config*/)
+    {
+        const T alpha = 0.5;
+        const T beta  = 2;
+        return rocrand_impl::host::beta_distribution<T, U>(alpha, beta);
+    }
+};
+
 template<>
 struct default_distribution<
     rocrand_impl::host::poisson_distribution<rocrand_impl::host::DISCRETE_METHOD_ALIAS>>
@@ -97,6 +97,16 @@ enum rocrand_rng_type
     = 410, ///< ThreeFry 32 bit state size 4 pseudorandom generator
     ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
     = 411, ///< ThreeFry 64 bit state size 4 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+    = 412, ///< PHILOX-4x64-10 pseudorandom generator
+    ROCRAND_RNG_PSEUDO_XOSHIRO256PP
+    = 413, ///< xoshiro256++ pseudorandom generator
+    ROCRAND_RNG_PSEUDO_XOROSHIRO128SS
+    = 414, ///< xoroshiro128** pseudorandom generator
+    ROCRAND_RNG_PSEUDO_PCG64_DXSM
+    = 415, ///< PCG64 DXSM pseudorandom generator (NumPy's PCG64DXSM)
+    ROCRAND_RNG_PSEUDO_SQUARES          = 416, ///< Squares counter-based pseudorandom generator
+    ROCRAND_RNG_PSEUDO_ARS              = 417, ///< ARS-5 pseudorandom generator (host only)
     ROCRAND_RNG_QUASI_DEFAULT           = 500, ///< Default quasirandom generator
     ROCRAND_RNG_QUASI_SOBOL32           = 501, ///< Sobol32 quasirandom generator
     ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 = 502, ///< Scrambled Sobol32 quasirandom generator
@@ -118,6 +128,10 @@ enum rocrand_ordering
     ROCRAND_ORDERING_PSEUDO_LEGACY  = 103, ///< Legacy ordering for pseudorandom results
     ROCRAND_ORDERING_PSEUDO_DYNAMIC
     = 104, ///< Adjust to the device executing the generator. The global memory usage may be higher than with the other orderings.
+    ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE
+    = 105, ///< Consecutive blocks of values are taken from consecutive subsequences, see rocrand_set_subsequence_length().
+    ROCRAND_ORDERING_PSEUDO_PORTABLE
+    = 106, ///< The same results as ROCRAND_ORDERING_PSEUDO_DEFAULT on every device, but the kernels are launched with the configuration tuned for the device.
     ROCRAND_ORDERING_QUASI_DEFAULT = 201 ///< n-dimensional ordering for quasirandom results
 };
 /// \cond DO_NOT_DOCUMENT
@@ -138,6 +152,59 @@ enum rocrand_direction_vector_set
 typedef enum rocrand_direction_vector_set rocrand_direction_vector_set;
 /// \endcond
 
+/**
+ * \brief rocRAND quasirandom output layout
+ */
+enum rocrand_quasi_random_layout
+{
+    ROCRAND_QUASI_RANDOM_LAYOUT_DIMENSION_MAJOR
+    = 600, ///< All points of the first dimension, followed by all points of the second dimension, etc.
+    ROCRAND_QUASI_RANDOM_LAYOUT_POINT_MAJOR
+    = 601, ///< All dimensions of the first point, followed by all dimensions of the second point, etc.
+};
+/// \cond DO_NOT_DOCUMENT
+typedef enum rocrand_quasi_random_layout rocrand_quasi_random_layout;
+/// \endcond
+
+/**
+ * \brief Distribution of a request of rocrand_generate_fused()
+ */
+enum rocrand_fused_distribution
+{
+    ROCRAND_FUSED_UNIFORM_UINT
+    = 700, ///< 32-bit unsigned integers, the values of rocrand_generate()
+    ROCRAND_FUSED_UNIFORM_FLOAT
+    = 701, ///< Uniformly distributed floats, the values of rocrand_generate_uniform()
+    ROCRAND_FUSED_UNIFORM_DOUBLE
+    = 702, ///< Uniformly distributed doubles, the values of rocrand_generate_uniform_double()
+    ROCRAND_FUSED_NORMAL_FLOAT
+    = 703, ///< Normally distributed floats, the values of rocrand_generate_normal()
+    ROCRAND_FUSED_NORMAL_DOUBLE
+    = 704, ///< Normally distributed doubles, the values of rocrand_generate_normal_double()
+    ROCRAND_FUSED_LOG_NORMAL_FLOAT
+    = 705, ///< Log-normally distributed floats, the values of rocrand_generate_log_normal()
+    ROCRAND_FUSED_LOG_NORMAL_DOUBLE
+    = 706, ///< Log-normally distributed doubles, the values of rocrand_generate_log_normal_double()
+};
+/// \cond DO_NOT_DOCUMENT
+typedef enum rocrand_fused_distribution rocrand_fused_distribution;
+/// \endcond
+
+/**
+ * \brief Request of rocrand_generate_fused()
+ */
+struct rocrand_fused_request
+{
+    rocrand_fused_distribution distribution; ///< Distribution of the values
+    void* output_data; ///< Pointer to memory to store the values, of the type of the distribution
+    size_t n; ///< Number of values to generate
+    double mean; ///< Mean of the normal and log-normal distributions, otherwise ignored
+    double stddev; ///< Standard deviation of the normal and log-normal distributions, otherwise ignored
+};
+/// \cond DO_NOT_DOCUMENT
+typedef struct rocrand_fused_request rocrand_fused_request;
+/// \endcond
+
 // Host API function
 
 /**
@@ -157,11 +224,19 @@ typedef enum rocrand_direction_vector_set rocrand_direction_vector_set;
  * - ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
  * - ROCRAND_RNG_PSEUDO_THREEFRY4_32_20
  * - ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+ * - ROCRAND_RNG_PSEUDO_XOSHIRO256PP
+ * - ROCRAND_RNG_PSEUDO_XOROSHIRO128SS
+ * - ROCRAND_RNG_PSEUDO_PCG64_DXSM
+ * - ROCRAND_RNG_PSEUDO_SQUARES
  * - ROCRAND_RNG_QUASI_SOBOL32
  * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
  * - ROCRAND_RNG_QUASI_SOBOL64
  * - ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64
  *
+ * ROCRAND_RNG_PSEUDO_ARS is only available as a host generator,
+ * see rocrand_create_generator_host().
+ *
  * \param generator Pointer to generator
  * \param rng_type Type of generator to create
  *
@@ -183,7 +258,9 @@ rocrand_create_generator(rocrand_generator * generator, rocrand_rng_type rng_typ
  * and returns it in \p generator. This generator is executed on the host rather than
  * on a device, and it is enqueued on the stream associated with the generator.
  *
- * All generators are supported.
+ * All generators are supported. ROCRAND_RNG_PSEUDO_ARS is only supported by host
+ * generators: it uses AES-NI or VAES instructions when the CPU supports them and
+ * a portable implementation with identical results otherwise.
  *
  * \param generator Pointer to generator
  * \param rng_type Type of generator to create
@@ -270,6 +347,153 @@ rocrand_status ROCRANDAPI rocrand_generate_long_long(rocrand_generator       gen
                                                      unsigned long long int* output_data,
                                                      size_t                  n);
 
+/**
+ * \brief Generates uniformly distributed 32-bit unsigned integers at an index range.
+ *
+ * Generates the 32-bit values at indices <tt>[first_index, first_index + n)</tt> of the
+ * sequence of the generator's seed and saves them to \p output_data. For generators of
+ * 32-bit values, these are the values rocrand_generate() produces after
+ * <tt>rocrand_set_offset(generator, first_index)</tt>. Generators of 64-bit values give
+ * two 32-bit values for every 64-bit value, the lower half first, so they match the
+ * values after <tt>rocrand_set_offset(generator, first_index / 2)</tt>.
+ *
+ * The offset and the state of the generator are neither used nor changed, so any
+ * part of the sequence can be generated again at any time. The call only reads the
+ * settings of the generator and may be made concurrently from several threads with
+ * the same generator. The work is enqueued on the stream of the generator.
+ *
+ * Supported by the counter-based generators:
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+ * - ROCRAND_RNG_PSEUDO_THREEFRY2_32_20
+ * - ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+ * - ROCRAND_RNG_PSEUDO_THREEFRY4_32_20
+ * - ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
+ * - ROCRAND_RNG_PSEUDO_SQUARES
+ * - ROCRAND_RNG_PSEUDO_ARS
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store generated numbers
+ * \param first_index Index of the first value to generate
+ * \param n Number of 32-bit unsigned integers to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support random access \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_range(rocrand_generator  generator,
+                                                 unsigned int*      output_data,
+                                                 unsigned long long first_index,
+                                                 size_t             n);
+
+/**
+ * \brief Generates uniformly distributed 32-bit unsigned integers for many seeds.
+ *
+ * Generates \p n values for each of the \p batch_size seeds in \p seeds with a single
+ * kernel launch. The values of seed \p i are saved <tt>i * pitch_bytes</tt> bytes after
+ * \p output_data and are the same as the ones rocrand_generate() saves there with a
+ * generator of the same type and ordering after <tt>rocrand_set_seed(generator, seeds[i])</tt>
+ * and <tt>rocrand_set_offset(generator, offsets[i])</tt>. \p pitch_bytes must be a multiple
+ * of <tt>sizeof(unsigned int)</tt>.
+ *
+ * \p seeds and \p offsets must be accessible by the generator in the same way as
+ * \p output_data, i.e. in device memory for device generators. The seed, offset and
+ * state of \p generator are neither used nor changed, only its ordering and stream.
+ *
+ * Supported by:
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_32_10
+ * - ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+ * - ROCRAND_RNG_PSEUDO_THREEFRY2_32_20
+ * - ROCRAND_RNG_PSEUDO_THREEFRY2_64_20
+ * - ROCRAND_RNG_PSEUDO_THREEFRY4_32_20
+ * - ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
+ * - ROCRAND_RNG_PSEUDO_MRG31K3P
+ * - ROCRAND_RNG_PSEUDO_MRG32K3A
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store generated numbers
+ * \param n Number of 32-bit unsigned integers to generate for each seed
+ * \param pitch_bytes Distance between the values of consecutive seeds, in bytes
+ * \param seeds Seeds of the sequences
+ * \param offsets Offsets of the sequences, or NULL to start all sequences at offset 0
+ * \param batch_size Number of seeds
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the sequences overlap, \p pitch_bytes is not a multiple
+ * of the size of the values or \p seeds is NULL \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support batched generation \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_batched(rocrand_generator         generator,
+                                                   unsigned int*             output_data,
+                                                   size_t                    n,
+                                                   size_t                    pitch_bytes,
+                                                   const unsigned long long* seeds,
+                                                   const unsigned long long* offsets,
+                                                   size_t                    batch_size);
+
+/**
+ * \brief Generates uniformly distributed 32-bit unsigned integers to a 2-D array.
+ *
+ * Generates <tt>width * height</tt> 32-bit unsigned integers and saves them to the rows of the
+ * 2-D array at \p output_data. Row \p r starts <tt>r * pitch_bytes</tt> bytes after
+ * \p output_data. The values are the same as the ones rocrand_generate() saves to a
+ * dense array, and the generator continues after them in the same way.
+ *
+ * Supported by ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_XORWOW,
+ * ROCRAND_RNG_PSEUDO_MRG31K3P and ROCRAND_RNG_PSEUDO_MRG32K3A.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to the first row of the array
+ * \param pitch_bytes Distance between the starts of consecutive rows, in bytes
+ * \param width Number of values in each row
+ * \param height Number of rows
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the rows overlap or \p pitch_bytes is not a multiple
+ * of the size of the values \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support 2-D output \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_2d(rocrand_generator generator,
+                                              unsigned int*     output_data,
+                                              size_t            pitch_bytes,
+                                              size_t            width,
+                                              size_t            height);
+
+/**
+ * \brief Generates uniformly distributed 32-bit unsigned integers to every \p stride -th element.
+ *
+ * Generates \p n 32-bit unsigned integers and saves value \p i to <tt>output_data[i * stride]</tt>,
+ * for example to one member of an array of structures. The values are the same as the
+ * ones rocrand_generate() saves to a dense array.
+ *
+ * Supported by ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_XORWOW,
+ * ROCRAND_RNG_PSEUDO_MRG31K3P and ROCRAND_RNG_PSEUDO_MRG32K3A.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store the first value
+ * \param stride Distance between consecutive values, in elements
+ * \param n Number of values to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stride is 0 and \p n is greater than 1 \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support strided output \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_strided(rocrand_generator generator,
+                                                   unsigned int*     output_data,
+                                                   size_t            stride,
+                                                   size_t            n);
+
 /**
 * \brief Generates uniformly distributed 8-bit unsigned integers.
 *
@@ -390,6 +614,126 @@ rocrand_status ROCRANDAPI
 rocrand_generate_uniform_half(rocrand_generator generator,
                               half * output_data, size_t n);
 
+/**
+ * \brief Generates uniformly distributed \p float values to a 2-D array.
+ *
+ * Generates <tt>width * height</tt> uniformly distributed 32-bit floating-point values
+ * and saves them to the rows of the 2-D array at \p output_data. Row \p r starts
+ * <tt>r * pitch_bytes</tt> bytes after \p output_data. The values are the same as the
+ * ones rocrand_generate_uniform() saves to a dense array, and the generator continues
+ * after them in the same way.
+ *
+ * Supported by ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_XORWOW,
+ * ROCRAND_RNG_PSEUDO_MRG31K3P and ROCRAND_RNG_PSEUDO_MRG32K3A.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to the first row of the array
+ * \param pitch_bytes Distance between the starts of consecutive rows, in bytes
+ * \param width Number of values in each row
+ * \param height Number of rows
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the rows overlap or \p pitch_bytes is not a multiple
+ * of the size of the values \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support 2-D output \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_uniform_2d(rocrand_generator generator,
+                                                      float*            output_data,
+                                                      size_t            pitch_bytes,
+                                                      size_t            width,
+                                                      size_t            height);
+
+/**
+ * \brief Generates uniformly distributed \p double values to a 2-D array.
+ *
+ * Generates <tt>width * height</tt> uniformly distributed 64-bit double-precision
+ * floating-point values and saves them to the rows of the 2-D array at \p output_data.
+ * Row \p r starts <tt>r * pitch_bytes</tt> bytes after \p output_data. The values are the
+ * same as the ones rocrand_generate_uniform_double() saves to a dense array, and the
+ * generator continues after them in the same way.
+ *
+ * Supported by ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_XORWOW,
+ * ROCRAND_RNG_PSEUDO_MRG31K3P and ROCRAND_RNG_PSEUDO_MRG32K3A.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to the first row of the array
+ * \param pitch_bytes Distance between the starts of consecutive rows, in bytes
+ * \param width Number of values in each row
+ * \param height Number of rows
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the rows overlap or \p pitch_bytes is not a multiple
+ * of the size of the values \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support 2-D output \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_uniform_double_2d(rocrand_generator generator,
+                                                             double*           output_data,
+                                                             size_t            pitch_bytes,
+                                                             size_t            width,
+                                                             size_t            height);
+
+/**
+ * \brief Generates uniformly distributed \p float values to every \p stride -th element.
+ *
+ * Generates \p n uniformly distributed 32-bit floating-point values and saves value \p i
+ * to <tt>output_data[i * stride]</tt>, for example to one member of an array of
+ * structures. The values are the same as the ones rocrand_generate_uniform() saves to a
+ * dense array.
+ *
+ * Supported by ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_XORWOW,
+ * ROCRAND_RNG_PSEUDO_MRG31K3P and ROCRAND_RNG_PSEUDO_MRG32K3A.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store the first value
+ * \param stride Distance between consecutive values, in elements
+ * \param n Number of values to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stride is 0 and \p n is greater than 1 \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support strided output \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_uniform_strided(rocrand_generator generator,
+                                                           float*            output_data,
+                                                           size_t            stride,
+                                                           size_t            n);
+
+/**
+ * \brief Generates uniformly distributed \p double values to every \p stride -th element.
+ *
+ * Generates \p n uniformly distributed 64-bit double-precision floating-point values and
+ * saves value \p i to <tt>output_data[i * stride]</tt>, for example to one member of an
+ * array of structures. The values are the same as the ones
+ * rocrand_generate_uniform_double() saves to a dense array.
+ *
+ * Supported by ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_XORWOW,
+ * ROCRAND_RNG_PSEUDO_MRG31K3P and ROCRAND_RNG_PSEUDO_MRG32K3A.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store the first value
+ * \param stride Distance between consecutive values, in elements
+ * \param n Number of values to generate
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stride is 0 and \p n is greater than 1 \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support strided output \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_uniform_double_strided(rocrand_generator generator,
+                                                                  double*           output_data,
+                                                                  size_t            stride,
+                                                                  size_t            n);
+
 /**
  * \brief Generates normally distributed \p float values.
  *
@@ -438,6 +782,185 @@ rocrand_generate_normal_double(rocrand_generator generator,
                                double * output_data, size_t n,
                                double mean, double stddev);
 
+/**
+ * \brief Generates normally distributed \p float values for many seeds.
+ *
+ * Generates \p n normally distributed 32-bit floating-point values for each of the
+ * \p batch_size seeds in \p seeds with a single kernel launch. The values of seed \p i
+ * are saved <tt>i * pitch_bytes</tt> bytes after \p output_data and are the same as the ones
+ * rocrand_generate_normal() saves there with a generator of the same type and ordering
+ * after <tt>rocrand_set_seed(generator, seeds[i])</tt> and
+ * <tt>rocrand_set_offset(generator, offsets[i])</tt>. \p pitch_bytes must be a multiple of
+ * <tt>sizeof(float)</tt>.
+ *
+ * \p seeds and \p offsets must be accessible by the generator in the same way as
+ * \p output_data. The seed, offset and state of \p generator are neither used nor
+ * changed. See rocrand_generate_batched() for the supported generators.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store generated numbers
+ * \param n Number of <tt>float</tt>s to generate for each seed
+ * \param pitch_bytes Distance between the values of consecutive seeds, in bytes
+ * \param seeds Seeds of the sequences
+ * \param offsets Offsets of the sequences, or NULL to start all sequences at offset 0
+ * \param batch_size Number of seeds
+ * \param mean Mean value of normal distribution
+ * \param stddev Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the sequences overlap, \p pitch_bytes is not a multiple
+ * of the size of the values or \p seeds is NULL \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support batched generation \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_normal_batched(rocrand_generator         generator,
+                                                          float*                    output_data,
+                                                          size_t                    n,
+                                                          size_t                    pitch_bytes,
+                                                          const unsigned long long* seeds,
+                                                          const unsigned long long* offsets,
+                                                          size_t                    batch_size,
+                                                          float                     mean,
+                                                          float                     stddev);
+
+/**
+ * \brief Generates normally distributed \p float values to a 2-D array.
+ *
+ * Generates <tt>width * height</tt> normally distributed 32-bit floating-point values and
+ * saves them to the rows of the 2-D array at \p output_data. Row \p r starts
+ * <tt>r * pitch_bytes</tt> bytes after \p output_data. The values are the same as the
+ * ones rocrand_generate_normal() saves to a dense array, and the generator continues
+ * after them in the same way.
+ *
+ * Supported by ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_XORWOW,
+ * ROCRAND_RNG_PSEUDO_MRG31K3P and ROCRAND_RNG_PSEUDO_MRG32K3A.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to the first row of the array
+ * \param pitch_bytes Distance between the starts of consecutive rows, in bytes
+ * \param width Number of values in each row
+ * \param height Number of rows
+ * \param mean Mean value of normal distribution
+ * \param stddev Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the rows overlap or \p pitch_bytes is not a multiple
+ * of the size of the values \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support 2-D output \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_normal_2d(rocrand_generator generator,
+                                                     float*            output_data,
+                                                     size_t            pitch_bytes,
+                                                     size_t            width,
+                                                     size_t            height,
+                                                     float             mean,
+                                                     float             stddev);
+
+/**
+ * \brief Generates normally distributed \p double values to a 2-D array.
+ *
+ * Generates <tt>width * height</tt> normally distributed 64-bit double-precision
+ * floating-point values and saves them to the rows of the 2-D array at \p output_data.
+ * Row \p r starts <tt>r * pitch_bytes</tt> bytes after \p output_data. The values are the
+ * same as the ones rocrand_generate_normal_double() saves to a dense array, and the
+ * generator continues after them in the same way.
+ *
+ * Supported by ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_XORWOW,
+ * ROCRAND_RNG_PSEUDO_MRG31K3P and ROCRAND_RNG_PSEUDO_MRG32K3A.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to the first row of the array
+ * \param pitch_bytes Distance between the starts of consecutive rows, in bytes
+ * \param width Number of values in each row
+ * \param height Number of rows
+ * \param mean Mean value of normal distribution
+ * \param stddev Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if the rows overlap or \p pitch_bytes is not a multiple
+ * of the size of the values \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support 2-D output \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_normal_double_2d(rocrand_generator generator,
+                                                            double*           output_data,
+                                                            size_t            pitch_bytes,
+                                                            size_t            width,
+                                                            size_t            height,
+                                                            double            mean,
+                                                            double            stddev);
+
+/**
+ * \brief Generates normally distributed \p float values to every \p stride -th element.
+ *
+ * Generates \p n normally distributed 32-bit floating-point values and saves value \p i
+ * to <tt>output_data[i * stride]</tt>, for example to one member of an array of
+ * structures. The values are the same as the ones rocrand_generate_normal() saves to a
+ * dense array.
+ *
+ * Supported by ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_XORWOW,
+ * ROCRAND_RNG_PSEUDO_MRG31K3P and ROCRAND_RNG_PSEUDO_MRG32K3A.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store the first value
+ * \param stride Distance between consecutive values, in elements
+ * \param n Number of values to generate
+ * \param mean Mean value of normal distribution
+ * \param stddev Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stride is 0 and \p n is greater than 1 \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support strided output \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_normal_strided(rocrand_generator generator,
+                                                          float*            output_data,
+                                                          size_t            stride,
+                                                          size_t            n,
+                                                          float             mean,
+                                                          float             stddev);
+
+/**
+ * \brief Generates normally distributed \p double values to every \p stride -th element.
+ *
+ * Generates \p n normally distributed 64-bit double-precision floating-point values and
+ * saves value \p i to <tt>output_data[i * stride]</tt>, for example to one member of an
+ * array of structures. The values are the same as the ones
+ * rocrand_generate_normal_double() saves to a dense array.
+ *
+ * Supported by ROCRAND_RNG_PSEUDO_PHILOX4_32_10, ROCRAND_RNG_PSEUDO_XORWOW,
+ * ROCRAND_RNG_PSEUDO_MRG31K3P and ROCRAND_RNG_PSEUDO_MRG32K3A.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store the first value
+ * \param stride Distance between consecutive values, in elements
+ * \param n Number of values to generate
+ * \param mean Mean value of normal distribution
+ * \param stddev Standard deviation value of normal distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p stride is 0 and \p n is greater than 1 \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support strided output \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_normal_double_strided(rocrand_generator generator,
+                                                                 double*           output_data,
+                                                                 size_t            stride,
+                                                                 size_t            n,
+                                                                 double            mean,
+                                                                 double            stddev);
+
 /**
 * \brief Generates normally distributed \p half values.
 *
@@ -558,6 +1081,318 @@ rocrand_generate_poisson(rocrand_generator generator,
                          unsigned int * output_data, size_t n,
                          double lambda);
 
+/**
+ * \brief Generates binomially distributed 32-bit unsigned integers.
+ *
+ * Generates \p n binomially distributed 32-bit unsigned integers, the number
+ * of successes in \p trials independent trials with success probability \p p,
+ * and saves them to \p output_data.
+ *
+ * Pseudo-random generators use the BTRD rejection method when
+ * <tt>trials * min(p, 1 - p)</tt> is at least 10 and inversion otherwise,
+ * rejected values are generated again like those of rocrand_generate_gamma().
+ * Quasi-random generators use inversion of a single value per output.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store generated numbers
+ * \param n Number of 32-bit unsigned integers to generate
+ * \param trials Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p p is not in [0, 1] \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_binomial(rocrand_generator generator,
+                                                    unsigned int*     output_data,
+                                                    size_t            n,
+                                                    unsigned int      trials,
+                                                    double            p);
+
+/**
+ * \brief Generates geometrically distributed 32-bit unsigned integers.
+ *
+ * Generates \p n geometrically distributed 32-bit unsigned integers, the number
+ * of independent trials with success probability \p p up to and including the
+ * first success, and saves them to \p output_data. The values are at least 1,
+ * values that do not fit into 32 bits are saturated.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store generated numbers
+ * \param n Number of 32-bit unsigned integers to generate
+ * \param p Success probability of the geometric distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p p is not in (0, 1] \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_geometric(rocrand_generator generator,
+                                                     unsigned int*     output_data,
+                                                     size_t            n,
+                                                     double            p);
+
+/**
+ * \brief Generates exponentially distributed \p float values.
+ *
+ * Generates \p n exponentially distributed 32-bit floating-point values
+ * with rate \p lambda (mean <tt>1 / lambda</tt>) and saves them to \p output_data.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store generated numbers
+ * \param n Number of <tt>float</tt>s to generate
+ * \param lambda Rate of the exponential distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lambda is non-positive \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_exponential(rocrand_generator generator,
+                                                       float*            output_data,
+                                                       size_t            n,
+                                                       float             lambda);
+
+/**
+ * \brief Generates exponentially distributed \p double values.
+ *
+ * Generates \p n exponentially distributed 64-bit double-precision floating-point
+ * values with rate \p lambda (mean <tt>1 / lambda</tt>) and saves them to \p output_data.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store generated numbers
+ * \param n Number of <tt>double</tt>s to generate
+ * \param lambda Rate of the exponential distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p lambda is non-positive \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_exponential_double(rocrand_generator generator,
+                                                              double*           output_data,
+                                                              size_t            n,
+                                                              double            lambda);
+
+/**
+ * \brief Generates gamma-distributed \p float values.
+ *
+ * Generates \p n gamma-distributed 32-bit floating-point values with shape
+ * \p shape and scale \p scale (mean <tt>shape * scale</tt>) and saves them to
+ * \p output_data.
+ *
+ * The values are generated by the rejection method of Marsaglia and Tsang, or
+ * algorithm GS of Ahrens and Dieter if \p shape is less than 1. The first
+ * attempt of every value uses two values of the generator. If it is rejected,
+ * the further attempts use a stream of values derived from these two values,
+ * so the results do not depend on the launch configuration and the generation
+ * is asynchronous like that of the other distributions.
+ *
+ * Quasi-random generators are not supported, because rejection sampling
+ * does not preserve the low discrepancy of the sequence.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store generated numbers
+ * \param n Number of <tt>float</tt>s to generate
+ * \param shape Shape of the gamma distribution
+ * \param scale Scale of the gamma distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p shape or \p scale is not positive \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is quasi-random \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_gamma(
+    rocrand_generator generator, float* output_data, size_t n, float shape, float scale);
+
+/**
+ * \brief Generates gamma-distributed \p double values.
+ *
+ * Generates \p n gamma-distributed 64-bit double-precision floating-point
+ * values with shape \p shape and scale \p scale (mean <tt>shape * scale</tt>)
+ * and saves them to \p output_data, see rocrand_generate_gamma().
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store generated numbers
+ * \param n Number of <tt>double</tt>s to generate
+ * \param shape Shape of the gamma distribution
+ * \param scale Scale of the gamma distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p shape or \p scale is not positive \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is quasi-random \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_gamma_double(
+    rocrand_generator generator, double* output_data, size_t n, double shape, double scale);
+
+/**
+ * \brief Generates beta-distributed \p float values.
+ *
+ * Generates \p n beta-distributed 32-bit floating-point values with shapes
+ * \p alpha and \p beta (mean <tt>alpha / (alpha + beta)</tt>) and saves them to
+ * \p output_data.
+ *
+ * The values are generated by the rejection methods BB and BC of Cheng, the
+ * rejected attempts are made again like those of rocrand_generate_gamma().
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store generated numbers
+ * \param n Number of <tt>float</tt>s to generate
+ * \param alpha First shape of the beta distribution
+ * \param beta Second shape of the beta distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p alpha or \p beta is not positive \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is quasi-random \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_beta(
+    rocrand_generator generator, float* output_data, size_t n, float alpha, float beta);
+
+/**
+ * \brief Generates beta-distributed \p double values.
+ *
+ * Generates \p n beta-distributed 64-bit double-precision floating-point
+ * values with shapes \p alpha and \p beta (mean <tt>alpha / (alpha + beta)</tt>)
+ * and saves them to \p output_data, see rocrand_generate_beta().
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store generated numbers
+ * \param n Number of <tt>double</tt>s to generate
+ * \param alpha First shape of the beta distribution
+ * \param beta Second shape of the beta distribution
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p alpha or \p beta is not positive \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is quasi-random \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_beta_double(
+    rocrand_generator generator, double* output_data, size_t n, double alpha, double beta);
+
+/**
+ * \brief Generates increments of Wiener paths using a Brownian bridge.
+ *
+ * Generates the increments of <tt>n / dimensions</tt> Wiener paths with
+ * \p dimensions equally spaced time steps of length \p time_step, where
+ * \p dimensions is the number of dimensions of the quasi-random generator.
+ * Each path is constructed from one point of the sequence by a Brownian
+ * bridge: the first dimension determines the end point of the path and every
+ * next dimension fills in the midpoint of the widest remaining interval, so
+ * the best distributed dimensions drive the coarse structure of the paths.
+ *
+ * The normally distributed values driving the bridge are not stored, the
+ * result is the same as generating them with rocrand_generate_normal()
+ * (mean 0, standard deviation 1), constructing the bridge and taking the
+ * differences of consecutive points of the paths.
+ *
+ * Increment \p s of path \p p is stored to <tt>output_data[s * (n / dimensions) + p]</tt>,
+ * or to <tt>output_data[p * dimensions + s]</tt> if the layout of the generator is
+ * ROCRAND_QUASI_RANDOM_LAYOUT_POINT_MAJOR (see rocrand_set_quasi_random_layout()).
+ *
+ * Supported only by ROCRAND_RNG_QUASI_SOBOL32, ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32,
+ * ROCRAND_RNG_QUASI_SOBOL64 and ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64.
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store generated numbers
+ * \param n Number of <tt>float</tt>s to generate
+ * \param time_step Length of a time step of the paths
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p time_step is not positive or NaN \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a Sobol generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_brownian_bridge(rocrand_generator generator,
+                                                           float*            output_data,
+                                                           size_t            n,
+                                                           float             time_step);
+
+/**
+ * \brief Generates increments of Wiener paths using a Brownian bridge.
+ *
+ * Generates the increments of <tt>n / dimensions</tt> Wiener paths as 64-bit
+ * double-precision floating-point values, see rocrand_generate_brownian_bridge().
+ *
+ * \param generator Generator to use
+ * \param output_data Pointer to memory to store generated numbers
+ * \param n Number of <tt>double</tt>s to generate
+ * \param time_step Length of a time step of the paths
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_LENGTH_NOT_MULTIPLE if \p n is not a multiple of the dimension
+ * of used quasi-random generator \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p time_step is not positive or NaN \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a Sobol generator \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_brownian_bridge_double(rocrand_generator generator,
+                                                                  double*           output_data,
+                                                                  size_t            n,
+                                                                  double            time_step);
+
+/**
+ * \brief Generates the values of several distributions with one kernel launch.
+ *
+ * Generates the values of the \p count requests of \p requests. The values are the same
+ * as the ones generated by calling the function named by the distribution of every request,
+ * e.g. rocrand_generate_uniform() and rocrand_generate_normal(), in the order of the requests,
+ * and the generator continues after them in the same way. Every engine of the generator is
+ * loaded and stored only once for all requests, instead of once per request. Up to 8
+ * requests are generated by one launch, more requests take more launches.
+ *
+ * \p requests is in host memory, the \p output_data of the requests must be accessible by
+ * the generator in the same way as the output of rocrand_generate(). Requests whose
+ * \p output_data is NULL or \p n is 0 are skipped.
+ *
+ * Supported by ROCRAND_RNG_PSEUDO_XORWOW, ROCRAND_RNG_PSEUDO_MRG31K3P,
+ * ROCRAND_RNG_PSEUDO_MRG32K3A and ROCRAND_RNG_PSEUDO_LFSR113. With
+ * ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE the requests are generated one after another.
+ *
+ * \param generator Generator to use
+ * \param requests Requests to generate
+ * \param count Number of requests
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p requests is NULL and \p count is not 0, or the
+ *   distribution of a request is not a rocrand_fused_distribution \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support fused generation \n
+ * - ROCRAND_STATUS_SUCCESS if random numbers were successfully generated \n
+ */
+rocrand_status ROCRANDAPI rocrand_generate_fused(rocrand_generator            generator,
+                                                 const rocrand_fused_request* requests,
+                                                 size_t                       count);
+
 /**
  * \brief Initializes the generator's state on GPU or host.
  *
@@ -688,6 +1523,8 @@ rocrand_set_offset(rocrand_generator generator, unsigned long long offset);
  * - ROCRAND_ORDERING_PSEUDO_BEST
  * - ROCRAND_ORDERING_PSEUDO_SEEDED
  * - ROCRAND_ORDERING_PSEUDO_DYNAMIC
+ * - ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE
+ * - ROCRAND_ORDERING_PSEUDO_PORTABLE
  *
  * For quasirandom sequences there is only one ordering, ROCRAND_ORDERING_QUASI_DEFAULT.
  *
@@ -699,6 +1536,65 @@ rocrand_set_offset(rocrand_generator generator, unsigned long long offset);
  */
 rocrand_status ROCRANDAPI rocrand_set_ordering(rocrand_generator generator, rocrand_ordering order);
 
+/**
+ * \brief Sets the number of values per subsequence of the subsequence ordering.
+ *
+ * With ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE the sequence of a generator is made of
+ * blocks of \p length values: value \p j of block \p i is value \p j of subsequence
+ * \p i of the seed. For example, when every path of a simulation uses \p length values,
+ * path \p i always uses subsequence \p i, regardless of the device, the launch
+ * configuration and whether a host or device generator is used.
+ *
+ * Distributions that use more than one value per output take the values of an output
+ * from the same subsequence, so output \p j of block \p i is the same as the
+ * output \p j of a sequence that starts at subsequence \p i.
+ *
+ * The default length is 2^20 values.
+ *
+ * - This operation resets the generator's internal state.
+ * - This operation does not change the generator's seed, offset or ordering.
+ *
+ * Supported by MRG31k3p and MRG32k3a generators.
+ *
+ * \param generator Pseudo-random number generator
+ * \param length Number of values taken from every subsequence
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator does not support the subsequence ordering \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p length is zero \n
+ * - ROCRAND_STATUS_SUCCESS if the length was set successfully \n
+ */
+rocrand_status ROCRANDAPI rocrand_set_subsequence_length(rocrand_generator  generator,
+                                                         unsigned long long length);
+
+/**
+ * \brief Sets the number of blocks launched by a host generator.
+ *
+ * Host generators run the blocks of their kernels on the worker threads of the host. By
+ * default the number of blocks is selected from the number of hardware threads and the
+ * size of the L2 cache of the host, instead of the number of blocks launched on a GPU.
+ * This function overrides that selection. A launch never runs more blocks than it would run
+ * on a GPU, so larger numbers are reduced to that number.
+ *
+ * The number of blocks does not change the generated values.
+ *
+ * Supported by host XORWOW, MRG31k3p, MRG32k3a, LFSR113, Squares and ARS-5 generators.
+ *
+ * \param generator Pseudo-random number generator created with
+ * rocrand_create_generator_host() or rocrand_create_generator_host_blocking()
+ * \param blocks Number of blocks, from 1 to 65536
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a host generator or its values depend
+ *   on the number of blocks \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p blocks is 0 or larger than 65536 \n
+ * - ROCRAND_STATUS_SUCCESS if the number of blocks was set successfully \n
+ */
+rocrand_status ROCRANDAPI rocrand_set_host_launch_blocks(rocrand_generator generator,
+                                                         unsigned int      blocks);
+
 /**
  * \brief Set the number of dimensions of a quasi-random number generator.
  *
@@ -721,6 +1617,162 @@ rocrand_status ROCRANDAPI
 rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
                                               unsigned int dimensions);
 
+/**
+ * \brief Set the output layout of a quasi-random number generator.
+ *
+ * Set the layout in which a quasi-random number generator writes the
+ * points of a call to one of the generation functions. For a generator with
+ * \p d dimensions generating \p n values, that is <tt>n / d</tt> points:
+ * - ROCRAND_QUASI_RANDOM_LAYOUT_DIMENSION_MAJOR (default): value \p j of
+ *   dimension \p i is stored at <tt>output[i * (n / d) + j]</tt>.
+ * - ROCRAND_QUASI_RANDOM_LAYOUT_POINT_MAJOR: value \p j of dimension \p i
+ *   is stored at <tt>output[j * d + i]</tt>, i.e. the output is an
+ *   <tt>[n / d][d]</tt> row-major matrix of points.
+ *
+ * The layout does not change the generated values, only where they are stored.
+ *
+ * - This operation does not change the generator's internal state.
+ *
+ * \param generator Quasi-random number generator
+ * \param layout Output layout
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator is not a quasi-random number generator \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p layout is not valid \n
+ * - ROCRAND_STATUS_SUCCESS if the layout was set successfully \n
+ */
+rocrand_status ROCRANDAPI rocrand_set_quasi_random_layout(rocrand_generator           generator,
+                                                          rocrand_quasi_random_layout layout);
+
+/**
+ * \brief Returns the size of the saved state of a random number generator.
+ *
+ * Returns in \p size the number of bytes that rocrand_save_state() writes for
+ * \p generator. The size depends on the type, the ordering and the device of the
+ * generator, but not on its seed or offset.
+ *
+ * Supported by ROCRAND_RNG_PSEUDO_XORWOW, ROCRAND_RNG_PSEUDO_MRG31K3P,
+ * ROCRAND_RNG_PSEUDO_MRG32K3A, ROCRAND_RNG_PSEUDO_LFSR113, ROCRAND_RNG_PSEUDO_MTGP32
+ * and ROCRAND_RNG_PSEUDO_MT19937.
+ *
+ * \param generator Random number generator
+ * \param size Pointer to the size of the state in bytes
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p size is NULL \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support saving its state \n
+ * - ROCRAND_STATUS_SUCCESS if the size was successfully returned \n
+ */
+rocrand_status ROCRANDAPI rocrand_get_state_size(rocrand_generator generator, size_t* size);
+
+/**
+ * \brief Saves the state of a random number generator.
+ *
+ * Saves the complete state of \p generator to \p state, so that a generator loaded from
+ * it with rocrand_load_state() continues the same sequence, for example to restart a
+ * simulation from a checkpoint without regenerating the values that were already used.
+ *
+ * The state is copied asynchronously on the stream of the generator after all previous
+ * generate calls. \p state must be accessible by the generator (device memory for device
+ * generators, host memory for host generators), be aligned to 8 bytes and hold at least
+ * the number of bytes returned by rocrand_get_state_size().
+ *
+ * - This operation does not change the generator's state.
+ *
+ * \param generator Random number generator
+ * \param state Pointer to memory to store the state
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p state is NULL \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support saving its state \n
+ * - ROCRAND_STATUS_SUCCESS if the state was successfully saved \n
+ */
+rocrand_status ROCRANDAPI rocrand_save_state(rocrand_generator generator, void* state);
+
+/**
+ * \brief Loads the state of a random number generator.
+ *
+ * Loads a state saved by rocrand_save_state() to \p generator. The generator continues
+ * the sequence of the saved generator, and its seed, offset and ordering are set to the
+ * ones of the saved generator.
+ *
+ * The state must have been saved by a generator of the same type on the same kind of
+ * device. The header of the state is read on the stream of the generator after its previous
+ * work, so this call synchronizes the stream. The states of the engines are then copied
+ * asynchronously on the stream. If the state can't be loaded, the generator is not changed.
+ *
+ * \param generator Random number generator
+ * \param state Pointer to the saved state
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p state is NULL, or the state was saved with another
+ * ordering or on another device \n
+ * - ROCRAND_STATUS_LAUNCH_FAILURE if a HIP kernel launch failed \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support loading its state, or the
+ * state was saved by another type of generator \n
+ * - ROCRAND_STATUS_SUCCESS if the state was successfully loaded \n
+ */
+rocrand_status ROCRANDAPI rocrand_load_state(rocrand_generator generator, const void* state);
+
+/**
+ * \brief Splits a random number generator into independent child generators.
+ *
+ * Creates \p count new generators in \p children that produce sequences which do not
+ * overlap with each other, with the sequence of \p parent, or with the sequences of
+ * generators that are split from any of them later. The children have the type, seed,
+ * ordering and stream of \p parent and start at offset 0. They can be used like any other
+ * generator and must be destroyed with rocrand_destroy_generator().
+ *
+ * The subsequences of \p parent are divided into <tt>count + 1</tt> equal parts, \p parent
+ * keeps the first one, so its sequence is not changed. Every split reduces the number of
+ * subsequences available to the generator, so the depth of nested splits is limited.
+ *
+ * Supported by the XORWOW, MRG31K3P, MRG32K3A, LFSR113, PHILOX4_32_10, PHILOX4_64_10,
+ * THREEFRY2_32_20, THREEFRY2_64_20, THREEFRY4_32_20, THREEFRY4_64_20 and SQUARES
+ * generators. The children of host generators are host generators. Device memory of the
+ * children is allocated when they generate the first values.
+ *
+ * \param parent Random number generator to split
+ * \param count Number of child generators to create
+ * \param children Pointer to an array of \p count generators to create
+ *
+ * \return
+ * - ROCRAND_STATUS_NOT_CREATED if the parent generator wasn't created \n
+ * - ROCRAND_STATUS_OUT_OF_RANGE if \p count is 0, \p children is NULL, or the generator
+ * does not have enough subsequences left for \p count children \n
+ * - ROCRAND_STATUS_TYPE_ERROR if the generator doesn't support splitting \n
+ * - ROCRAND_STATUS_SUCCESS if the child generators were successfully created \n
+ */
+rocrand_status ROCRANDAPI rocrand_generator_split(rocrand_generator  parent,
+                                                  unsigned int       count,
+                                                  rocrand_generator* children);
+
+/**
+ * \brief Sets the size of the process-wide cache of initialized engine states.
+ *
+ * Initializing an MT19937 or MTGP32 generator computes the starting states of all its engines,
+ * which takes much longer than copying them. While the cache is enabled, the initialized engines
+ * of a seed are copied asynchronously to pinned host memory, and generators that are
+ * initialized again with the same seed, ordering and launch configuration copy their engines
+ * from the cache. The least recently used states are evicted when the cache grows larger
+ * than \p size bytes.
+ *
+ * The cache is disabled by default. Its initial size can be set in MiB with the environment
+ * variable <tt>ROCRAND_ENGINE_STATE_CACHE_SIZE</tt>. Setting \p size to 0 disables the cache
+ * and frees all cached states.
+ *
+ * \param size Maximum number of bytes of the cached states
+ *
+ * \return
+ * - ROCRAND_STATUS_SUCCESS if the size was successfully set \n
+ */
+rocrand_status ROCRANDAPI rocrand_set_engine_state_cache_size(size_t size);
+
 /**
  * \brief Returns the version number of the library.
  *
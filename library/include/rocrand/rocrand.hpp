@@ -1426,6 +1426,23 @@ public:
             throw rocrand_cpp::error(status);
     }
 
+    /// \brief Sets the number of values per subsequence of the subsequence ordering.
+    ///
+    /// With ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE, value \p j of the \p i -th block of
+    /// \p value values is value \p j of subsequence \p i. The default length is 2^20 values.
+    ///
+    /// - This operation resets the engine's internal state.
+    ///
+    /// \param value Number of values taken from every subsequence
+    ///
+    /// See also: rocrand_set_subsequence_length()
+    void subsequence_length(unsigned long long value)
+    {
+        rocrand_status status = rocrand_set_subsequence_length(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
     /// \copydoc philox4x32_10_engine::offset()
     void offset(offset_type value)
     {
@@ -1597,6 +1614,14 @@ public:
             throw rocrand_cpp::error(status);
     }
 
+    /// \copydoc mrg31k3p_engine::subsequence_length()
+    void subsequence_length(unsigned long long value)
+    {
+        rocrand_status status = rocrand_set_subsequence_length(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
     /// \copydoc philox4x32_10_engine::offset()
     void offset(offset_type value)
     {
@@ -2210,6 +2235,11 @@ public:
     ///
     /// See also dimensions()
     typedef unsigned int dimensions_num_type;
+    /// \typedef layout_type
+    /// Quasi-random number engine type for the output layout.
+    ///
+    /// See also layout()
+    typedef rocrand_quasi_random_layout layout_type;
     /// \brief The default number of dimenstions, equal to \p DefaultNumDimensions.
     static constexpr dimensions_num_type default_num_dimensions = DefaultNumDimensions;
 
@@ -2323,6 +2353,24 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+    /// \brief Set the output layout of a quasi-random number generator.
+    ///
+    /// With ROCRAND_QUASI_RANDOM_LAYOUT_DIMENSION_MAJOR (default) all values of the first
+    /// dimension are stored first, followed by the values of the second dimension, etc.
+    /// With ROCRAND_QUASI_RANDOM_LAYOUT_POINT_MAJOR the output is a row-major matrix
+    /// with one row per point.
+    ///
+    /// - This operation does not change the generator's internal state.
+    ///
+    /// \param value Output layout
+    ///
+    /// See also: rocrand_set_quasi_random_layout()
+    void layout(layout_type value)
+    {
+        rocrand_status status = rocrand_set_quasi_random_layout(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
     /// \brief Fills \p output with uniformly distributed random integer values.
     ///
     /// Generates \p size random integer values uniformly distributed
@@ -2411,6 +2459,8 @@ public:
     ///
     /// See also dimensions()
     typedef unsigned int dimensions_num_type;
+    /// \copydoc sobol32_engine::layout_type
+    typedef rocrand_quasi_random_layout layout_type;
     /// \brief The default number of dimenstions, equal to \p DefaultNumDimensions.
     static constexpr dimensions_num_type default_num_dimensions = DefaultNumDimensions;
 
@@ -2527,6 +2577,13 @@ public:
             throw rocrand_cpp::error(status);
     }
 
+    /// \copydoc sobol32_engine::layout()
+    void layout(layout_type value)
+    {
+        rocrand_status status = rocrand_set_quasi_random_layout(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
     /// \brief Fills \p output with uniformly distributed random integer values.
     ///
     /// Generates \p size random integer values uniformly distributed
@@ -2616,6 +2673,8 @@ public:
     ///
     /// See also dimensions()
     typedef unsigned int dimensions_num_type;
+    /// \copydoc sobol32_engine::layout_type
+    typedef rocrand_quasi_random_layout layout_type;
     /// \brief The default number of dimenstions, equal to \p DefaultNumDimensions.
     static constexpr dimensions_num_type default_num_dimensions = DefaultNumDimensions;
 
@@ -2729,6 +2788,13 @@ public:
         if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
     }
 
+    /// \copydoc sobol32_engine::layout()
+    void layout(layout_type value)
+    {
+        rocrand_status status = rocrand_set_quasi_random_layout(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
     /// \brief Fills \p output with uniformly distributed random integer values.
     ///
     /// Generates \p size random integer values uniformly distributed
@@ -2817,6 +2883,8 @@ public:
     ///
     /// See also dimensions()
     typedef unsigned int dimensions_num_type;
+    /// \copydoc sobol32_engine::layout_type
+    typedef rocrand_quasi_random_layout layout_type;
     /// \brief The default number of dimenstions, equal to \p DefaultNumDimensions.
     static constexpr dimensions_num_type default_num_dimensions = DefaultNumDimensions;
 
@@ -2933,6 +3001,13 @@ public:
             throw rocrand_cpp::error(status);
     }
 
+    /// \copydoc sobol32_engine::layout()
+    void layout(layout_type value)
+    {
+        rocrand_status status = rocrand_set_quasi_random_layout(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS) throw rocrand_cpp::error(status);
+    }
+
     /// \brief Fills \p output with uniformly distributed random integer values.
     ///
     /// Generates \p size random integer values uniformly distributed
@@ -3686,9 +3761,864 @@ constexpr typename threefry4x64_20_engine<DefaultSeed>::seed_type
     threefry4x64_20_engine<DefaultSeed>::default_seed;
 /// \endcond
 
+/// \brief Pseudorandom number engine based on 64-bit Philox algorithm.
+///
+/// It generates random numbers of type \p unsigned \p long \p long on the interval
+/// [0; 2^64 - 1]. Random numbers are generated in sets of four.
+template<unsigned long long DefaultSeed = ROCRAND_PHILOX4x64_DEFAULT_SEED>
+class philox4x64_10_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned long long result_type;
+    /// \copydoc philox4x32_10_engine::order_type
+    typedef rocrand_ordering order_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type, order_type)
+    philox4x64_10_engine(seed_type   seed_value   = DefaultSeed,
+                         offset_type offset_value = 0,
+                         order_type  order_value  = ROCRAND_ORDERING_PSEUDO_DEFAULT)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+        try
+        {
+            if(offset_value > 0)
+            {
+                this->offset(offset_value);
+            }
+            this->order(order_value);
+            this->seed(seed_value);
+        }
+        catch(...)
+        {
+            (void)rocrand_destroy_generator(m_generator);
+            throw;
+        }
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    explicit philox4x64_10_engine(rocrand_generator& generator) : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    philox4x64_10_engine(const philox4x64_10_engine&) = delete;
+
+    philox4x64_10_engine& operator=(const philox4x64_10_engine&) = delete;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(philox4x32_10_engine&&)
+    philox4x64_10_engine(philox4x64_10_engine&& rhs) noexcept : m_generator(rhs.m_generator)
+    {
+        rhs.m_generator = nullptr;
+    }
+
+    /// \copydoc philox4x32_10_engine::operator=(philox4x32_10_engine&&)
+    philox4x64_10_engine& operator=(philox4x64_10_engine&& rhs) noexcept
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        assert(status == ROCRAND_STATUS_SUCCESS || status == ROCRAND_STATUS_NOT_CREATED);
+        (void)status;
+
+        m_generator     = rhs.m_generator;
+        rhs.m_generator = nullptr;
+        return *this;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~philox4x64_10_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS && status != ROCRAND_STATUS_NOT_CREATED)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::order()
+    void order(order_type value)
+    {
+        rocrand_status status = rocrand_set_ordering(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    void operator()(result_type* output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate_long_long(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<unsigned long long>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_PHILOX4_64_10;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename philox4x64_10_engine<DefaultSeed>::seed_type
+    philox4x64_10_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Pseudorandom number engine based on the xoshiro256++ algorithm.
+///
+/// It generates random numbers of type \p unsigned \p long \p long on the interval
+/// [0; 2^64 - 1]. The generator has a 256-bit state and a period of 2^256 - 1.
+template<unsigned long long DefaultSeed = ROCRAND_XOSHIRO256PP_DEFAULT_SEED>
+class xoshiro256pp_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned long long result_type;
+    /// \copydoc philox4x32_10_engine::order_type
+    typedef rocrand_ordering order_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type, order_type)
+    xoshiro256pp_engine(seed_type   seed_value   = DefaultSeed,
+                        offset_type offset_value = 0,
+                        order_type  order_value  = ROCRAND_ORDERING_PSEUDO_DEFAULT)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+        try
+        {
+            if(offset_value > 0)
+            {
+                this->offset(offset_value);
+            }
+            this->order(order_value);
+            this->seed(seed_value);
+        }
+        catch(...)
+        {
+            (void)rocrand_destroy_generator(m_generator);
+            throw;
+        }
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    explicit xoshiro256pp_engine(rocrand_generator& generator) : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    xoshiro256pp_engine(const xoshiro256pp_engine&) = delete;
+
+    xoshiro256pp_engine& operator=(const xoshiro256pp_engine&) = delete;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(philox4x32_10_engine&&)
+    xoshiro256pp_engine(xoshiro256pp_engine&& rhs) noexcept : m_generator(rhs.m_generator)
+    {
+        rhs.m_generator = nullptr;
+    }
+
+    /// \copydoc philox4x32_10_engine::operator=(philox4x32_10_engine&&)
+    xoshiro256pp_engine& operator=(xoshiro256pp_engine&& rhs) noexcept
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        assert(status == ROCRAND_STATUS_SUCCESS || status == ROCRAND_STATUS_NOT_CREATED);
+        (void)status;
+
+        m_generator     = rhs.m_generator;
+        rhs.m_generator = nullptr;
+        return *this;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~xoshiro256pp_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS && status != ROCRAND_STATUS_NOT_CREATED)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::order()
+    void order(order_type value)
+    {
+        rocrand_status status = rocrand_set_ordering(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    void operator()(result_type* output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate_long_long(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<unsigned long long>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_XOSHIRO256PP;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename xoshiro256pp_engine<DefaultSeed>::seed_type
+    xoshiro256pp_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Pseudorandom number engine based on the xoroshiro128** algorithm.
+///
+/// It generates random numbers of type \p unsigned \p long \p long on the interval
+/// [0; 2^64 - 1]. The generator has a 128-bit state and a period of 2^128 - 1.
+template<unsigned long long DefaultSeed = ROCRAND_XOROSHIRO128SS_DEFAULT_SEED>
+class xoroshiro128ss_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned long long result_type;
+    /// \copydoc philox4x32_10_engine::order_type
+    typedef rocrand_ordering order_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type, order_type)
+    xoroshiro128ss_engine(seed_type   seed_value   = DefaultSeed,
+                          offset_type offset_value = 0,
+                          order_type  order_value  = ROCRAND_ORDERING_PSEUDO_DEFAULT)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+        try
+        {
+            if(offset_value > 0)
+            {
+                this->offset(offset_value);
+            }
+            this->order(order_value);
+            this->seed(seed_value);
+        }
+        catch(...)
+        {
+            (void)rocrand_destroy_generator(m_generator);
+            throw;
+        }
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    explicit xoroshiro128ss_engine(rocrand_generator& generator) : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    xoroshiro128ss_engine(const xoroshiro128ss_engine&) = delete;
+
+    xoroshiro128ss_engine& operator=(const xoroshiro128ss_engine&) = delete;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(philox4x32_10_engine&&)
+    xoroshiro128ss_engine(xoroshiro128ss_engine&& rhs) noexcept : m_generator(rhs.m_generator)
+    {
+        rhs.m_generator = nullptr;
+    }
+
+    /// \copydoc philox4x32_10_engine::operator=(philox4x32_10_engine&&)
+    xoroshiro128ss_engine& operator=(xoroshiro128ss_engine&& rhs) noexcept
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        assert(status == ROCRAND_STATUS_SUCCESS || status == ROCRAND_STATUS_NOT_CREATED);
+        (void)status;
+
+        m_generator     = rhs.m_generator;
+        rhs.m_generator = nullptr;
+        return *this;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~xoroshiro128ss_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS && status != ROCRAND_STATUS_NOT_CREATED)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::order()
+    void order(order_type value)
+    {
+        rocrand_status status = rocrand_set_ordering(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    void operator()(result_type* output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate_long_long(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<unsigned long long>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_XOROSHIRO128SS;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename xoroshiro128ss_engine<DefaultSeed>::seed_type
+    xoroshiro128ss_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Pseudorandom number engine based on the PCG64 DXSM algorithm.
+///
+/// It generates random numbers of type \p unsigned \p long \p long on the interval
+/// [0; 2^64 - 1]. The generator has a 128-bit state and a period of 2^128.
+/// For the same seed it produces the same values as NumPy's \p PCG64DXSM bit generator.
+template<unsigned long long DefaultSeed = ROCRAND_PCG64_DXSM_DEFAULT_SEED>
+class pcg64_dxsm_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned long long result_type;
+    /// \copydoc philox4x32_10_engine::order_type
+    typedef rocrand_ordering order_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type, order_type)
+    pcg64_dxsm_engine(seed_type   seed_value   = DefaultSeed,
+                      offset_type offset_value = 0,
+                      order_type  order_value  = ROCRAND_ORDERING_PSEUDO_DEFAULT)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+        try
+        {
+            if(offset_value > 0)
+            {
+                this->offset(offset_value);
+            }
+            this->order(order_value);
+            this->seed(seed_value);
+        }
+        catch(...)
+        {
+            (void)rocrand_destroy_generator(m_generator);
+            throw;
+        }
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    explicit pcg64_dxsm_engine(rocrand_generator& generator) : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    pcg64_dxsm_engine(const pcg64_dxsm_engine&) = delete;
+
+    pcg64_dxsm_engine& operator=(const pcg64_dxsm_engine&) = delete;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(philox4x32_10_engine&&)
+    pcg64_dxsm_engine(pcg64_dxsm_engine&& rhs) noexcept : m_generator(rhs.m_generator)
+    {
+        rhs.m_generator = nullptr;
+    }
+
+    /// \copydoc philox4x32_10_engine::operator=(philox4x32_10_engine&&)
+    pcg64_dxsm_engine& operator=(pcg64_dxsm_engine&& rhs) noexcept
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        assert(status == ROCRAND_STATUS_SUCCESS || status == ROCRAND_STATUS_NOT_CREATED);
+        (void)status;
+
+        m_generator     = rhs.m_generator;
+        rhs.m_generator = nullptr;
+        return *this;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~pcg64_dxsm_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS && status != ROCRAND_STATUS_NOT_CREATED)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::order()
+    void order(order_type value)
+    {
+        rocrand_status status = rocrand_set_ordering(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    void operator()(result_type* output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate_long_long(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<unsigned long long>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_PCG64_DXSM;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename pcg64_dxsm_engine<DefaultSeed>::seed_type
+    pcg64_dxsm_engine<DefaultSeed>::default_seed;
+/// \endcond
+
+/// \brief Pseudorandom number engine based on the Squares counter-based algorithm.
+///
+/// It generates random numbers of type \p unsigned \p int on the interval [0; 2^32 - 1].
+/// Every value is computed from a key and its position only, so the generator has
+/// no state besides its key and counter.
+template<unsigned long long DefaultSeed = ROCRAND_SQUARES_DEFAULT_SEED>
+class squares_engine
+{
+public:
+    /// \copydoc philox4x32_10_engine::result_type
+    typedef unsigned int result_type;
+    /// \copydoc philox4x32_10_engine::order_type
+    typedef rocrand_ordering order_type;
+    /// \copydoc philox4x32_10_engine::offset_type
+    typedef unsigned long long offset_type;
+    /// \copydoc philox4x32_10_engine::seed_type
+    typedef unsigned long long seed_type;
+    /// \copydoc philox4x32_10_engine::default_seed
+    static constexpr seed_type default_seed = DefaultSeed;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(seed_type, offset_type, order_type)
+    squares_engine(seed_type   seed_value   = DefaultSeed,
+                   offset_type offset_value = 0,
+                   order_type  order_value  = ROCRAND_ORDERING_PSEUDO_DEFAULT)
+    {
+        rocrand_status status;
+        status = rocrand_create_generator(&m_generator, this->type());
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+        try
+        {
+            if(offset_value > 0)
+            {
+                this->offset(offset_value);
+            }
+            this->order(order_value);
+            this->seed(seed_value);
+        }
+        catch(...)
+        {
+            (void)rocrand_destroy_generator(m_generator);
+            throw;
+        }
+    }
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(rocrand_generator&)
+    explicit squares_engine(rocrand_generator& generator) : m_generator(generator)
+    {
+        if(generator == NULL)
+        {
+            throw rocrand_cpp::error(ROCRAND_STATUS_NOT_CREATED);
+        }
+        generator = NULL;
+    }
+
+    squares_engine(const squares_engine&) = delete;
+
+    squares_engine& operator=(const squares_engine&) = delete;
+
+    /// \copydoc philox4x32_10_engine::philox4x32_10_engine(philox4x32_10_engine&&)
+    squares_engine(squares_engine&& rhs) noexcept : m_generator(rhs.m_generator)
+    {
+        rhs.m_generator = nullptr;
+    }
+
+    /// \copydoc philox4x32_10_engine::operator=(philox4x32_10_engine&&)
+    squares_engine& operator=(squares_engine&& rhs) noexcept
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        assert(status == ROCRAND_STATUS_SUCCESS || status == ROCRAND_STATUS_NOT_CREATED);
+        (void)status;
+
+        m_generator     = rhs.m_generator;
+        rhs.m_generator = nullptr;
+        return *this;
+    }
+
+    /// \copydoc philox4x32_10_engine::~philox4x32_10_engine()
+    ~squares_engine() noexcept(false)
+    {
+        rocrand_status status = rocrand_destroy_generator(m_generator);
+        if(status != ROCRAND_STATUS_SUCCESS && status != ROCRAND_STATUS_NOT_CREATED)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::stream()
+    void stream(hipStream_t value)
+    {
+        rocrand_status status = rocrand_set_stream(m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::order()
+    void order(order_type value)
+    {
+        rocrand_status status = rocrand_set_ordering(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::offset()
+    void offset(offset_type value)
+    {
+        rocrand_status status = rocrand_set_offset(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::seed()
+    void seed(seed_type value)
+    {
+        rocrand_status status = rocrand_set_seed(this->m_generator, value);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::operator()()
+    void operator()(result_type* output, size_t size)
+    {
+        rocrand_status status;
+        status = rocrand_generate(m_generator, output, size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+            throw rocrand_cpp::error(status);
+    }
+
+    /// \copydoc philox4x32_10_engine::min()
+    static constexpr result_type min()
+    {
+        return 0;
+    }
+
+    /// \copydoc philox4x32_10_engine::max()
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<unsigned int>::max();
+    }
+
+    /// \copydoc philox4x32_10_engine::type()
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_SQUARES;
+    }
+
+private:
+    rocrand_generator m_generator;
+
+    /// \cond
+    template<class T>
+    friend class ::rocrand_cpp::uniform_int_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::uniform_real_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::normal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::lognormal_distribution;
+
+    template<class T>
+    friend class ::rocrand_cpp::poisson_distribution;
+    /// \endcond
+};
+
+/// \cond
+template<unsigned long long DefaultSeed>
+constexpr typename squares_engine<DefaultSeed>::seed_type
+    squares_engine<DefaultSeed>::default_seed;
+/// \endcond
+
 /// \typedef philox4x32_10;
 /// \brief Typedef of rocrand_cpp::philox4x32_10_engine PRNG engine with default seed (#ROCRAND_PHILOX4x32_DEFAULT_SEED).
 typedef philox4x32_10_engine<> philox4x32_10;
+/// \typedef philox4x64_10;
+/// \brief Typedef of rocrand_cpp::philox4x64_10_engine PRNG engine with default seed (#ROCRAND_PHILOX4x64_DEFAULT_SEED).
+typedef philox4x64_10_engine<> philox4x64_10;
 /// \typedef xorwow
 /// \brief Typedef of \p rocrand_cpp::xorwow_engine PRNG engine with default seed (#ROCRAND_XORWOW_DEFAULT_SEED).
 typedef xorwow_engine<> xorwow;
@@ -3720,6 +4650,18 @@ typedef threefry4x32_20_engine<> threefry4x32;
 /// \typedef threefry4x64
 /// \brief Typedef of \p rocrand_cpp::threefry4x64_20_engine PRNG engine with default seed (0).
 typedef threefry4x64_20_engine<> threefry4x64;
+/// \typedef xoshiro256pp
+/// \brief Typedef of \p rocrand_cpp::xoshiro256pp_engine PRNG engine with default seed (#ROCRAND_XOSHIRO256PP_DEFAULT_SEED).
+typedef xoshiro256pp_engine<> xoshiro256pp;
+/// \typedef xoroshiro128ss
+/// \brief Typedef of \p rocrand_cpp::xoroshiro128ss_engine PRNG engine with default seed (#ROCRAND_XOROSHIRO128SS_DEFAULT_SEED).
+typedef xoroshiro128ss_engine<> xoroshiro128ss;
+/// \typedef pcg64_dxsm
+/// \brief Typedef of \p rocrand_cpp::pcg64_dxsm_engine PRNG engine with default seed (#ROCRAND_PCG64_DXSM_DEFAULT_SEED).
+typedef pcg64_dxsm_engine<> pcg64_dxsm;
+/// \typedef squares
+/// \brief Typedef of \p rocrand_cpp::squares_engine PRNG engine with default seed (#ROCRAND_SQUARES_DEFAULT_SEED).
+typedef squares_engine<> squares;
 /// \typedef sobol32
 /// \brief Typedef of \p rocrand_cpp::sobol32_engine QRNG engine with default number of dimensions (1).
 typedef sobol32_engine<> sobol32;
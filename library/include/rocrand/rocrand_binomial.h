@@ -0,0 +1,687 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_BINOMIAL_H_
+#define ROCRAND_BINOMIAL_H_
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+#include <math.h>
+
+#include "rocrand/rocrand_lfsr113.h"
+#include "rocrand/rocrand_mrg31k3p.h"
+#include "rocrand/rocrand_mrg32k3a.h"
+#include "rocrand/rocrand_mtgp32.h"
+#include "rocrand/rocrand_pcg64_dxsm.h"
+#include "rocrand/rocrand_philox4x32_10.h"
+#include "rocrand/rocrand_philox4x64_10.h"
+#include "rocrand/rocrand_scrambled_sobol32.h"
+#include "rocrand/rocrand_scrambled_sobol64.h"
+#include "rocrand/rocrand_sobol32.h"
+#include "rocrand/rocrand_sobol64.h"
+#include "rocrand/rocrand_squares.h"
+#include "rocrand/rocrand_threefry2x32_20.h"
+#include "rocrand/rocrand_threefry2x64_20.h"
+#include "rocrand/rocrand_threefry4x32_20.h"
+#include "rocrand/rocrand_threefry4x64_20.h"
+#include "rocrand/rocrand_xoroshiro128ss.h"
+#include "rocrand/rocrand_xorwow.h"
+#include "rocrand/rocrand_xoshiro256pp.h"
+
+#include "rocrand/rocrand_normal.h"
+#include "rocrand/rocrand_uniform.h"
+
+namespace rocrand_device {
+namespace detail {
+
+// BTRD is used when n * min(p, 1 - p) is at least this value, inversion otherwise
+constexpr double binomial_threshold_btrd = 10.0;
+// Single-value inversion falls back to the normal approximation above this value of
+// n * min(p, 1 - p), (1 - p)^n would underflow otherwise
+constexpr double binomial_threshold_huge = 500.0;
+
+/// \brief Parameters of the binomial distribution with \p n trials and success probability
+/// \p p, see make_binomial_distribution_params(). Only <tt>p <= 0.5</tt> is sampled directly,
+/// larger probabilities are sampled as <tt>n - X</tt> where <tt>X ~ B(n, 1 - p)</tt>.
+struct binomial_distribution_params
+{
+    unsigned int n;
+    bool         flip;
+    double       np;
+    double       npq;
+    double       sqrt_npq;
+    double       r;
+    double       nr;
+    // Inversion
+    double q_n;
+    double bound;
+    // BTRD
+    unsigned int m;
+    double       nm;
+    double       a;
+    double       b;
+    double       c;
+    double       alpha;
+    double       v_r;
+    double       u_rv_r;
+    double       h;
+};
+
+/// \brief Stirling correction <tt>log(k!) - log(sqrt(2 * pi)) - (k + 0.5) * log(k + 1) + k + 1</tt>
+__forceinline__ __device__ __host__ double binomial_stirling_correction(const unsigned int k)
+{
+    const double table[10] = {0.08106146679532726,
+                              0.04134069595540929,
+                              0.02767792568499834,
+                              0.02079067210376509,
+                              0.01664469118982119,
+                              0.01387612882307075,
+                              0.01189670994589177,
+                              0.01041126526197209,
+                              0.009255462182712733,
+                              0.008330563433362871};
+    if(k < 10)
+    {
+        return table[k];
+    }
+    const double k1  = k + 1.0;
+    const double k1s = k1 * k1;
+    return (1.0 / 12.0 - (1.0 / 360.0 - 1.0 / 1260.0 / k1s) / k1s) / k1;
+}
+
+__forceinline__ __device__ __host__ binomial_distribution_params
+    make_binomial_distribution_params(const unsigned int n, double p)
+{
+    binomial_distribution_params params;
+    params.n    = n;
+    params.flip = p > 0.5;
+    p           = params.flip ? 1.0 - p : p;
+
+    const double q  = 1.0 - p;
+    params.np       = n * p;
+    params.npq      = params.np * q;
+    params.sqrt_npq = sqrt(params.npq);
+    params.r        = p / q;
+    params.nr       = (n + 1.0) * params.r;
+
+    if(params.np < binomial_threshold_huge)
+    {
+        params.q_n   = exp(n * log1p(-p));
+        params.bound = fmin(static_cast<double>(n), params.np + 10.0 * sqrt(params.npq + 1.0));
+    }
+    if(params.np >= binomial_threshold_btrd)
+    {
+        params.m      = static_cast<unsigned int>(floor((n + 1.0) * p));
+        params.nm     = static_cast<double>(n - params.m) + 1.0;
+        params.b      = 1.15 + 2.53 * params.sqrt_npq;
+        params.a      = -0.0873 + 0.0248 * params.b + 0.01 * p;
+        params.c      = params.np + 0.5;
+        params.alpha  = (2.83 + 5.1 / params.b) * params.sqrt_npq;
+        params.v_r    = 0.92 - 4.2 / params.b;
+        params.u_rv_r = 0.86 * params.v_r;
+        params.h      = (params.m + 0.5) * log((params.m + 1.0) / (params.r * params.nm))
+                   + binomial_stirling_correction(params.m)
+                   + binomial_stirling_correction(n - params.m);
+    }
+    return params;
+}
+
+/// \brief One attempt of the sequential search from the uniformly distributed value \p u,
+/// which fails if the result is implausibly large due to rounding. Used for small n * p,
+/// where the expected number of steps is n * p + 1.
+__forceinline__ __device__ __host__ bool
+    binomial_distribution_inversion_attempt(double                              u,
+                                            const binomial_distribution_params& params,
+                                            unsigned int&                       x)
+{
+    x         = 0;
+    double px = params.q_n;
+    while(u > px)
+    {
+        x++;
+        if(x > params.bound)
+        {
+            return false;
+        }
+        u -= px;
+        px *= params.nr / x - params.r;
+    }
+    return true;
+}
+
+template<class UniformSource>
+__forceinline__ __device__ __host__ unsigned int
+    binomial_distribution_inversion(UniformSource& uniform,
+                                    const binomial_distribution_params& params)
+{
+    unsigned int x;
+    while(!binomial_distribution_inversion_attempt(uniform(), params, x))
+    {}
+    return x;
+}
+
+/// \brief One attempt of algorithm BTRD, which draws one or two uniformly distributed values
+/// from \p uniform.
+///
+/// W. Hormann
+/// The generation of binomial random variates
+/// Journal of Statistical Computation and Simulation 46, 1993
+template<class UniformSource>
+__forceinline__ __device__ __host__ bool
+    binomial_distribution_btrd_attempt(UniformSource&                      uniform,
+                                       const binomial_distribution_params& params,
+                                       unsigned int&                       x)
+{
+    const double n = params.n;
+
+    double v = uniform();
+    double u;
+    if(v <= params.u_rv_r)
+    {
+        u = v / params.v_r - 0.43;
+        x = static_cast<unsigned int>(
+            floor((2.0 * params.a / (0.5 - fabs(u)) + params.b) * u + params.c));
+        return true;
+    }
+    if(v >= params.v_r)
+    {
+        u = uniform() - 0.5;
+    }
+    else
+    {
+        u = v / params.v_r - 0.93;
+        u = copysign(0.5, u) - u;
+        v = uniform() * params.v_r;
+    }
+
+    const double us = 0.5 - fabs(u);
+    const double kd = floor((2.0 * params.a / us + params.b) * u + params.c);
+    if(!(kd >= 0.0 && kd <= n))
+    {
+        return false;
+    }
+    const unsigned int k  = static_cast<unsigned int>(kd);
+    const unsigned int km = k > params.m ? k - params.m : params.m - k;
+    v *= params.alpha / (params.a / (us * us) + params.b);
+    x = k;
+
+    if(km <= 15)
+    {
+        // Recursive evaluation of f(k)
+        double f = 1.0;
+        for(unsigned int i = params.m + 1; i <= k; i++)
+        {
+            f *= params.nr / i - params.r;
+        }
+        for(unsigned int i = k + 1; i <= params.m; i++)
+        {
+            v *= params.nr / i - params.r;
+        }
+        return v <= f;
+    }
+
+    // Squeeze acceptance or rejection
+    v                = log(v);
+    const double kmd = km;
+    const double rho
+        = (kmd / params.npq) * (((kmd / 3.0 + 0.625) * kmd + 1.0 / 6.0) / params.npq + 0.5);
+    const double t = -kmd * kmd / (2.0 * params.npq);
+    if(v < t - rho)
+    {
+        return true;
+    }
+    if(v > t + rho)
+    {
+        return false;
+    }
+
+    const double nk = n - k + 1.0;
+    return v <= params.h + (n + 1.0) * log(params.nm / nk)
+                    + (k + 0.5) * log(nk * params.r / (k + 1.0)) - binomial_stirling_correction(k)
+                    - binomial_stirling_correction(params.n - k);
+}
+
+template<class UniformSource>
+__forceinline__ __device__ __host__ unsigned int
+    binomial_distribution_btrd(UniformSource& uniform, const binomial_distribution_params& params)
+{
+    unsigned int x;
+    while(!binomial_distribution_btrd_attempt(uniform, params, x))
+    {}
+    return x;
+}
+
+/// \brief Returns a binomially distributed value, the uniformly distributed values in (0, 1]
+/// are drawn from \p uniform. The number of drawn values is variable.
+template<class UniformSource>
+__forceinline__ __device__ __host__ unsigned int
+    binomial_distribution(UniformSource& uniform, const binomial_distribution_params& params)
+{
+    const unsigned int x = params.np < binomial_threshold_btrd
+                               ? binomial_distribution_inversion(uniform, params)
+                               : binomial_distribution_btrd(uniform, params);
+    return params.flip ? params.n - x : x;
+}
+
+/// \brief Returns a binomially distributed value computed from a single uniformly distributed
+/// value \p u in (0, 1], so that low-discrepancy sequences keep their structure.
+__forceinline__ __device__ __host__ unsigned int
+    binomial_distribution_inv(double u, const binomial_distribution_params& params)
+{
+    unsigned int x;
+    if(params.np < binomial_threshold_huge)
+    {
+        x         = 0;
+        double px = params.q_n;
+        while(u > px && x < params.n)
+        {
+            u -= px;
+            x++;
+            px *= params.nr / x - params.r;
+        }
+    }
+    else
+    {
+        // Normal approximation
+        const double z = ROCRAND_SQRT2_DOUBLE * roc_d_erfinv(2.0 * u - 1.0);
+        const double v = floor(params.np + params.sqrt_npq * z + 0.5);
+        x              = v <= 0.0 ? 0 : v >= params.n ? params.n : static_cast<unsigned int>(v);
+    }
+    return params.flip ? params.n - x : x;
+}
+
+template<class State>
+struct binomial_state_uniform_source
+{
+    State state;
+
+    __forceinline__ __device__ __host__ double operator()()
+    {
+        return rocrand_uniform_double(state);
+    }
+};
+
+template<class State>
+__forceinline__ __device__ __host__ unsigned int
+    binomial_distribution(State state, const unsigned int n, const double p)
+{
+    binomial_state_uniform_source<State> uniform{state};
+    return binomial_distribution(uniform, make_binomial_distribution_params(n, p));
+}
+
+template<class State>
+__forceinline__ __device__ __host__ unsigned int
+    binomial_distribution_inv(State state, const unsigned int n, const double p)
+{
+    return binomial_distribution_inv(rocrand_uniform_double(state),
+                                     make_binomial_distribution_params(n, p));
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using Philox generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using Philox generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_philox4x32_10* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using MRG31k3p generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using MRG31k3p generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_mrg31k3p* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using MRG32k3a generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using MRG32k3a generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_mrg32k3a* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using XORWOW generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using XORWOW generator in \p state. State is incremented by a variable amount.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_xorwow* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using MTGP32 generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using MTGP32 generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_mtgp32* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using SOBOL32 generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using SOBOL32 generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_sobol32* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using SCRAMBLED_SOBOL32 generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using SCRAMBLED_SOBOL32 generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_scrambled_sobol32* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using SOBOL64 generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using SOBOL64 generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_sobol64* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using SCRAMBLED_SOBOL64 generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using SCRAMBLED_SOBOL64 generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_scrambled_sobol64* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using LFSR113 generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using LFSR113 generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_lfsr113* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using ThreeFry generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using ThreeFry generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_threefry2x32_20* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using ThreeFry generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using ThreeFry generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_threefry2x64_20* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using ThreeFry generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using ThreeFry generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_threefry4x32_20* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using ThreeFry generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using ThreeFry generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_threefry4x64_20* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using Philox4x64 generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using Philox4x64 generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_philox4x64_10* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using xoshiro256++ generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using xoshiro256++ generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_xoshiro256pp* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using xoroshiro128** generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using xoroshiro128** generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_xoroshiro128ss* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using PCG64 DXSM generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using PCG64 DXSM generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_pcg64_dxsm* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/**
+ * \brief Returns a binomially distributed <tt>unsigned int</tt> using Squares generator.
+ *
+ * Generates and returns binomially distributed random <tt>unsigned int</tt>
+ * values using Squares generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param n Number of trials of the binomial distribution
+ * \param p Success probability of the binomial distribution, must be in [0, 1]
+ *
+ * \return Binomially distributed <tt>unsigned int</tt> in [0, \p n]
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_binomial(rocrand_state_squares* state, unsigned int n, double p)
+{
+    return rocrand_device::detail::binomial_distribution_inv(state, n, p);
+}
+
+/** @} */ // end of group rocranddevice
+
+#endif // ROCRAND_BINOMIAL_H_
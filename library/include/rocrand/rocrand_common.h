@@ -105,6 +105,42 @@ unsigned long long mul_u64_u32(const unsigned int x, const unsigned int y)
     return static_cast<unsigned long long>(x) * static_cast<unsigned long long>(y);
 }
 
+// Returns the upper 64 bits of the 128-bit product of x and y
+__forceinline__ __device__ __host__
+unsigned long long mulhi_u64(const unsigned long long x, const unsigned long long y)
+{
+#if defined(__HIP_DEVICE_COMPILE__) || defined(__CUDA_ARCH__)
+    return __umul64hi(x, y);
+#elif defined(__SIZEOF_INT128__)
+    return static_cast<unsigned long long>(
+        (static_cast<unsigned __int128>(x) * static_cast<unsigned __int128>(y)) >> 64);
+#else
+    const unsigned long long x_lo = x & 0xFFFFFFFFULL;
+    const unsigned long long x_hi = x >> 32;
+    const unsigned long long y_lo = y & 0xFFFFFFFFULL;
+    const unsigned long long y_hi = y >> 32;
+
+    const unsigned long long lo_lo = x_lo * y_lo;
+    const unsigned long long hi_lo = x_hi * y_lo;
+    const unsigned long long lo_hi = x_lo * y_hi;
+    const unsigned long long hi_hi = x_hi * y_hi;
+
+    const unsigned long long mid = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFULL) + lo_hi;
+    return hi_hi + (hi_lo >> 32) + (mid >> 32);
+#endif
+}
+
+// SplitMix64 step, used to expand a 64-bit seed into the state of the xoshiro family
+// of generators as recommended by their authors.
+__forceinline__ __device__ __host__
+unsigned long long splitmix64(unsigned long long& x)
+{
+    unsigned long long z = (x += 0x9E3779B97F4A7C15ULL);
+    z                    = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z                    = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
 // This helps access fields of engine's internal state which
 // saves floats and doubles generated using the Box–Muller transform
 template<typename Engine>
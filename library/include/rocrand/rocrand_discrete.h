@@ -27,16 +27,21 @@
 #include "rocrand/rocrand_mrg31k3p.h"
 #include "rocrand/rocrand_mrg32k3a.h"
 #include "rocrand/rocrand_mtgp32.h"
+#include "rocrand/rocrand_pcg64_dxsm.h"
 #include "rocrand/rocrand_philox4x32_10.h"
+#include "rocrand/rocrand_philox4x64_10.h"
 #include "rocrand/rocrand_scrambled_sobol32.h"
 #include "rocrand/rocrand_scrambled_sobol64.h"
 #include "rocrand/rocrand_sobol32.h"
 #include "rocrand/rocrand_sobol64.h"
+#include "rocrand/rocrand_squares.h"
 #include "rocrand/rocrand_threefry2x32_20.h"
 #include "rocrand/rocrand_threefry2x64_20.h"
 #include "rocrand/rocrand_threefry4x32_20.h"
 #include "rocrand/rocrand_threefry4x64_20.h"
+#include "rocrand/rocrand_xoroshiro128ss.h"
 #include "rocrand/rocrand_xorwow.h"
+#include "rocrand/rocrand_xoshiro256pp.h"
 
 #include "rocrand/rocrand_discrete_types.h"
 
@@ -487,6 +492,121 @@ unsigned int rocrand_discrete(rocrand_state_threefry4x64_20*      state,
 #endif
 }
 
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using Philox4x64 generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state Pointer to a state to use
+ * \param discrete_distribution Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_discrete(rocrand_state_philox4x64_10*        state,
+                              const rocrand_discrete_distribution discrete_distribution)
+{
+#ifdef ROCRAND_PREFER_CDF_OVER_ALIAS
+    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+#else
+    return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
+#endif
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using xoshiro256++ generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state Pointer to a state to use
+ * \param discrete_distribution Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_discrete(rocrand_state_xoshiro256pp*         state,
+                              const rocrand_discrete_distribution discrete_distribution)
+{
+#ifdef ROCRAND_PREFER_CDF_OVER_ALIAS
+    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+#else
+    return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
+#endif
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using xoroshiro128** generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state Pointer to a state to use
+ * \param discrete_distribution Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_discrete(rocrand_state_xoroshiro128ss*       state,
+                              const rocrand_discrete_distribution discrete_distribution)
+{
+#ifdef ROCRAND_PREFER_CDF_OVER_ALIAS
+    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+#else
+    return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
+#endif
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using PCG64 DXSM generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state Pointer to a state to use
+ * \param discrete_distribution Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_discrete(rocrand_state_pcg64_dxsm*           state,
+                              const rocrand_discrete_distribution discrete_distribution)
+{
+#ifdef ROCRAND_PREFER_CDF_OVER_ALIAS
+    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+#else
+    return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
+#endif
+}
+
+/**
+ * \brief Returns a discrete distributed <tt>unsigned int</tt> value.
+ *
+ * Returns a <tt>unsigned int</tt> distributed according to with discrete distribution
+ * \p discrete_distribution using Squares generator in \p state, and increments
+ * the position of the generator by one.
+ *
+ * \param state Pointer to a state to use
+ * \param discrete_distribution Related discrete distribution
+ *
+ * \return <tt>unsigned int</tt> value distributed according to \p discrete_distribution
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_discrete(rocrand_state_squares*              state,
+                              const rocrand_discrete_distribution discrete_distribution)
+{
+#ifdef ROCRAND_PREFER_CDF_OVER_ALIAS
+    return rocrand_device::detail::discrete_cdf(rocrand(state), *discrete_distribution);
+#else
+    return rocrand_device::detail::discrete_alias(rocrand(state), *discrete_distribution);
+#endif
+}
+
 /** @} */ // end of group rocranddevice
 
 // Undefine the macro that may be defined at the top of the file!
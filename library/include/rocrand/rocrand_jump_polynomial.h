@@ -0,0 +1,157 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+
+#ifndef ROCRAND_JUMP_POLYNOMIAL_H_
+#define ROCRAND_JUMP_POLYNOMIAL_H_
+
+#include "rocrand/rocrand_common.h"
+
+// Jump polynomials of generators whose transition is linear over GF(2).
+//
+// If P(x) is a polynomial with P(A) = 0 for the transition matrix A (for example its
+// characteristic polynomial), jumping ahead by n steps is multiplying the state by
+// (x^n mod P)(A). The remainder is computed here by square-and-multiply, so any distance
+// can be skipped without precomputed jump matrices, and the evaluation costs one step of
+// the generator per coefficient.
+//
+// A polynomial is stored in 32-bit words, bit i of word i / 32 is the coefficient of x^i.
+// P(x) = x^(32 * Words) + L(x) is given by its lower part L.
+//
+// The XORWOW and LFSR113 engines use these polynomials instead of their precomputed jump
+// matrices if ROCRAND_RUNTIME_JUMP_POLYNOMIALS is defined before including rocRAND headers.
+// The large headers with the matrices are not included then, which shortens the compilation
+// of device code, but every skip ahead computes its polynomial. The generated values are
+// the same in both modes.
+//
+// The macro changes the definitions of inline functions of the engines, so it must be defined
+// (or not defined) the same way in every translation unit of a program. Mixing both modes is
+// a violation of the one definition rule, and the engines of some translation units may then
+// use the other mode.
+
+namespace rocrand_device
+{
+namespace detail
+{
+
+// Spreads the lower 16 bits of x to the even bits, i.e. squares the polynomial x.
+__forceinline__ __device__ __host__
+unsigned int gf2_spread_bits(unsigned int x)
+{
+    x &= 0xffffU;
+    x = (x | (x << 8)) & 0x00ff00ffU;
+    x = (x | (x << 4)) & 0x0f0f0f0fU;
+    x = (x | (x << 2)) & 0x33333333U;
+    x = (x | (x << 1)) & 0x55555555U;
+    return x;
+}
+
+// a = a^2 mod P
+template<unsigned int Words>
+__forceinline__ __device__ __host__
+void gf2_square_mod(unsigned int (&a)[Words], const unsigned int (&lower)[Words])
+{
+    unsigned int p[2 * Words];
+    for(unsigned int i = 0; i < Words; i++)
+    {
+        p[2 * i]     = gf2_spread_bits(a[i]);
+        p[2 * i + 1] = gf2_spread_bits(a[i] >> 16);
+    }
+
+    // x^(32 * Words + s) = x^s * L(x) mod P, the terms are reduced from the highest one
+    // as the lower part of P can set terms below it. Masks are used instead of branches,
+    // so all threads of a warp take the same path.
+    for(unsigned int i = 2 * Words - 1; i >= Words; i--)
+    {
+        for(int b = 31; b >= 0; b--)
+        {
+            const unsigned int mask = 0U - ((p[i] >> b) & 1U);
+            const unsigned int w    = i - Words;
+            p[w] ^= mask & (lower[0] << b);
+            for(unsigned int k = 1; k < Words; k++)
+            {
+                p[w + k] ^= mask & ((lower[k] << b) | (lower[k - 1] >> 1 >> (31 - b)));
+            }
+            p[w + Words] ^= mask & (lower[Words - 1] >> 1 >> (31 - b));
+        }
+    }
+
+    for(unsigned int i = 0; i < Words; i++)
+    {
+        a[i] = p[i];
+    }
+}
+
+// a = a * x mod P
+template<unsigned int Words>
+__forceinline__ __device__ __host__
+void gf2_mul_x_mod(unsigned int (&a)[Words], const unsigned int (&lower)[Words])
+{
+    const unsigned int carry = a[Words - 1] >> 31;
+    for(unsigned int i = Words - 1; i > 0; i--)
+    {
+        a[i] = (a[i] << 1) | (a[i - 1] >> 31);
+    }
+    a[0] <<= 1;
+    // The reduction is masked like in gf2_square_mod, so the threads do not diverge
+    const unsigned int mask = 0U - carry;
+    for(unsigned int i = 0; i < Words; i++)
+    {
+        a[i] ^= mask & lower[i];
+    }
+}
+
+// result = x^(v * 2^log2_multiplier) mod P
+template<unsigned int Words>
+__forceinline__ __device__ __host__
+void gf2_jump_polynomial(unsigned long long v,
+                         unsigned int       log2_multiplier,
+                         const unsigned int (&lower)[Words],
+                         unsigned int (&result)[Words])
+{
+    result[0] = 1;
+    for(unsigned int i = 1; i < Words; i++)
+    {
+        result[i] = 0;
+    }
+
+    bool started = false;
+    for(int b = 63; b >= 0; b--)
+    {
+        if(started)
+        {
+            gf2_square_mod(result, lower);
+        }
+        if((v >> b) & 1)
+        {
+            gf2_mul_x_mod(result, lower);
+            started = true;
+        }
+    }
+    for(unsigned int i = 0; i < log2_multiplier; i++)
+    {
+        gf2_square_mod(result, lower);
+    }
+}
+
+} // end namespace detail
+} // end namespace rocrand_device
+
+#endif // ROCRAND_JUMP_POLYNOMIAL_H_
@@ -22,7 +22,10 @@
 #define ROCRAND_LFSR113_H_
 
 #include "rocrand/rocrand_common.h"
-#include "rocrand/rocrand_lfsr113_precomputed.h"
+#include "rocrand/rocrand_jump_polynomial.h"
+#ifndef ROCRAND_RUNTIME_JUMP_POLYNOMIALS
+    #include "rocrand/rocrand_lfsr113_precomputed.h"
+#endif
 
 /** \rocrand_internal \addtogroup rocranddevice
  *
@@ -47,6 +50,24 @@ namespace rocrand_device
 namespace detail
 {
 
+// Computes the jump polynomials of v * 2^log2_multiplier steps of the four components.
+__forceinline__ __device__ __host__ void lfsr113_jump_polynomials(unsigned long long v,
+                                                                 unsigned int log2_multiplier,
+                                                                 unsigned int (&polynomials)[4])
+{
+    // These are the minimal polynomials of the transitions of the components multiplied
+    // by a power of x to reach degree 32 (without the x^32 term).
+    const unsigned int lower[4][1]
+        = {{0x008010aaU}, {0x00000028U}, {0x11131110U}, {0x020c3c80U}};
+    for(unsigned int c = 0; c < 4; c++)
+    {
+        unsigned int polynomial[1];
+        gf2_jump_polynomial(v, log2_multiplier, lower[c], polynomial);
+        polynomials[c] = polynomial[0];
+    }
+}
+
+#ifndef ROCRAND_RUNTIME_JUMP_POLYNOMIALS
 __forceinline__ __device__ __host__ void mul_mat_vec_inplace(const unsigned int* m, uint4* z)
 {
     unsigned int v[4]         = {z->x, z->y, z->z, z->w};
@@ -67,6 +88,7 @@ __forceinline__ __device__ __host__ void mul_mat_vec_inplace(const unsigned int*
     z->z = r[2];
     z->w = r[3];
 }
+#endif
 } // end namespace detail
 
 class lfsr113_engine
@@ -119,7 +141,9 @@ public:
     /// Advances the internal state to skip \p offset numbers.
     __forceinline__ __device__ __host__ void discard(unsigned long long offset)
     {
-#ifdef __HIP_DEVICE_COMPILE__
+#if defined(ROCRAND_RUNTIME_JUMP_POLYNOMIALS)
+        jump_polynomial(offset, 0);
+#elif defined(__HIP_DEVICE_COMPILE__)
         jump(offset, d_lfsr113_jump_matrices);
 #else
         jump(offset, h_lfsr113_jump_matrices);
@@ -131,7 +155,9 @@ public:
     __forceinline__ __device__ __host__ void discard_subsequence(unsigned int subsequence)
     {
 // Discard n * 2^55 samples
-#ifdef __HIP_DEVICE_COMPILE__
+#if defined(ROCRAND_RUNTIME_JUMP_POLYNOMIALS)
+        jump_polynomial(subsequence, 55);
+#elif defined(__HIP_DEVICE_COMPILE__)
         jump(subsequence, d_lfsr113_sequence_jump_matrices);
 #else
         jump(subsequence, h_lfsr113_sequence_jump_matrices);
@@ -178,6 +204,67 @@ protected:
         this->next();
     }
 
+    __forceinline__ __device__ __host__ void discard_state(unsigned int steps)
+    {
+        for(unsigned int i = 0; i < steps; i++)
+        {
+            discard_state();
+        }
+    }
+
+    // Multiplies every component by its transition matrix evaluated at its polynomial
+    // (i.e. jumps ahead by the distance the polynomials were computed for).
+    __forceinline__ __device__ __host__ void jump(const unsigned int (&polynomials)[4])
+    {
+        uint4 z = {0, 0, 0, 0};
+        for(unsigned int i = 0; i < 32; i++)
+        {
+            z.x ^= (0U - ((polynomials[0] >> i) & 1U)) & m_state.z.x;
+            z.y ^= (0U - ((polynomials[1] >> i) & 1U)) & m_state.z.y;
+            z.z ^= (0U - ((polynomials[2] >> i) & 1U)) & m_state.z.z;
+            z.w ^= (0U - ((polynomials[3] >> i) & 1U)) & m_state.z.w;
+            discard_state();
+        }
+        m_state.z = z;
+    }
+
+    // Advances the internal state by v steps, \p polynomials are the jump polynomials of v.
+    // Evaluating the jump polynomials costs one step per bit of a component,
+    // so short skips are done step by step.
+    __forceinline__ __device__ __host__ void jump(unsigned long long v,
+                                                  const unsigned int (&polynomials)[4])
+    {
+        if(v < 32)
+        {
+            discard_state(static_cast<unsigned int>(v));
+        }
+        else
+        {
+            jump(polynomials);
+        }
+    }
+
+    // Advances the internal state by v * 2^log2_multiplier steps with jump polynomials
+    // that are computed here instead of the precomputed jump matrices.
+    __forceinline__ __device__ __host__ void jump_polynomial(unsigned long long v,
+                                                             unsigned int       log2_multiplier)
+    {
+        if(log2_multiplier == 0 && v < 32)
+        {
+            discard_state(static_cast<unsigned int>(v));
+            return;
+        }
+        if(v == 0)
+        {
+            return;
+        }
+
+        unsigned int polynomials[4];
+        detail::lfsr113_jump_polynomials(v, log2_multiplier, polynomials);
+        jump(polynomials);
+    }
+
+#ifndef ROCRAND_RUNTIME_JUMP_POLYNOMIALS
     __forceinline__ __device__ __host__ void
         jump(unsigned long long v,
              const unsigned int (&jump_matrices)[LFSR113_JUMP_MATRICES][LFSR113_SIZE])
@@ -207,6 +294,7 @@ protected:
             v >>= LFSR113_JUMP_LOG2;
         }
     }
+#endif
 
 protected:
     lfsr113_state m_state;
@@ -32,16 +32,21 @@
 #include "rocrand/rocrand_mrg31k3p.h"
 #include "rocrand/rocrand_mrg32k3a.h"
 #include "rocrand/rocrand_mtgp32.h"
+#include "rocrand/rocrand_pcg64_dxsm.h"
 #include "rocrand/rocrand_philox4x32_10.h"
+#include "rocrand/rocrand_philox4x64_10.h"
 #include "rocrand/rocrand_scrambled_sobol32.h"
 #include "rocrand/rocrand_scrambled_sobol64.h"
 #include "rocrand/rocrand_sobol32.h"
 #include "rocrand/rocrand_sobol64.h"
+#include "rocrand/rocrand_squares.h"
 #include "rocrand/rocrand_threefry2x32_20.h"
 #include "rocrand/rocrand_threefry2x64_20.h"
 #include "rocrand/rocrand_threefry4x32_20.h"
 #include "rocrand/rocrand_threefry4x64_20.h"
+#include "rocrand/rocrand_xoroshiro128ss.h"
 #include "rocrand/rocrand_xorwow.h"
+#include "rocrand/rocrand_xoshiro256pp.h"
 
 #include "rocrand/rocrand_normal.h"
 
@@ -1267,6 +1272,439 @@ double2 rocrand_log_normal_double2(rocrand_state_threefry4x64_20* state, double
     return double2{exp(mean + (stddev * r.x)), exp(mean + (stddev * r.y))};
 }
 
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using Philox4x64
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+__forceinline__ __device__ __host__
+float rocrand_log_normal(rocrand_state_philox4x64_10* state, float mean, float stddev)
+{
+    float r = rocrand_device::detail::normal_distribution(rocrand(state));
+    return expf(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using Philox4x64
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+__forceinline__ __device__ __host__
+float2 rocrand_log_normal2(rocrand_state_philox4x64_10* state, float mean, float stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    return float2{expf(mean + (stddev * r.x)), expf(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using Philox4x64
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+__forceinline__ __device__ __host__
+double rocrand_log_normal_double(rocrand_state_philox4x64_10* state, double mean, double stddev)
+{
+    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
+    return exp(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using Philox4x64
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+__forceinline__ __device__ __host__
+double2 rocrand_log_normal_double2(rocrand_state_philox4x64_10* state, double mean, double stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+    return double2{exp(mean + (stddev * r.x)), exp(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using xoshiro256++
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+__forceinline__ __device__ __host__
+float rocrand_log_normal(rocrand_state_xoshiro256pp* state, float mean, float stddev)
+{
+    float r = rocrand_device::detail::normal_distribution(rocrand(state));
+    return expf(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using xoshiro256++
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+__forceinline__ __device__ __host__
+float2 rocrand_log_normal2(rocrand_state_xoshiro256pp* state, float mean, float stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    return float2{expf(mean + (stddev * r.x)), expf(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using xoshiro256++
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+__forceinline__ __device__ __host__
+double rocrand_log_normal_double(rocrand_state_xoshiro256pp* state, double mean, double stddev)
+{
+    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
+    return exp(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using xoshiro256++
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+__forceinline__ __device__ __host__
+double2 rocrand_log_normal_double2(rocrand_state_xoshiro256pp* state, double mean, double stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+    return double2{exp(mean + (stddev * r.x)), exp(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using xoroshiro128**
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+__forceinline__ __device__ __host__
+float rocrand_log_normal(rocrand_state_xoroshiro128ss* state, float mean, float stddev)
+{
+    float r = rocrand_device::detail::normal_distribution(rocrand(state));
+    return expf(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using xoroshiro128**
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+__forceinline__ __device__ __host__
+float2 rocrand_log_normal2(rocrand_state_xoroshiro128ss* state, float mean, float stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    return float2{expf(mean + (stddev * r.x)), expf(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using xoroshiro128**
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+__forceinline__ __device__ __host__
+double rocrand_log_normal_double(rocrand_state_xoroshiro128ss* state, double mean, double stddev)
+{
+    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
+    return exp(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using xoroshiro128**
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+__forceinline__ __device__ __host__
+double2 rocrand_log_normal_double2(rocrand_state_xoroshiro128ss* state, double mean, double stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+    return double2{exp(mean + (stddev * r.x)), exp(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using PCG64 DXSM
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+__forceinline__ __device__ __host__
+float rocrand_log_normal(rocrand_state_pcg64_dxsm* state, float mean, float stddev)
+{
+    float r = rocrand_device::detail::normal_distribution(rocrand(state));
+    return expf(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using PCG64 DXSM
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+__forceinline__ __device__ __host__
+float2 rocrand_log_normal2(rocrand_state_pcg64_dxsm* state, float mean, float stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    return float2{expf(mean + (stddev * r.x)), expf(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using PCG64 DXSM
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+__forceinline__ __device__ __host__
+double rocrand_log_normal_double(rocrand_state_pcg64_dxsm* state, double mean, double stddev)
+{
+    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
+    return exp(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using PCG64 DXSM
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+__forceinline__ __device__ __host__
+double2 rocrand_log_normal_double2(rocrand_state_pcg64_dxsm* state, double mean, double stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+    return double2{exp(mean + (stddev * r.x)), exp(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns a log-normally distributed \p float value.
+ *
+ * Generates and returns a log-normally distributed \p float value using Squares
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p float value
+ */
+__forceinline__ __device__ __host__
+float rocrand_log_normal(rocrand_state_squares* state, float mean, float stddev)
+{
+    float r = rocrand_device::detail::normal_distribution(rocrand(state));
+    return expf(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns two log-normally distributed \p float values.
+ *
+ * Generates and returns two log-normally distributed \p float values using Squares
+ * generator in \p state, and increments position of the generator by two.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p float value as \p float2
+ */
+__forceinline__ __device__ __host__
+float2 rocrand_log_normal2(rocrand_state_squares* state, float mean, float stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    float2 r = rocrand_device::detail::normal_distribution2(state1, state2);
+    return float2{expf(mean + (stddev * r.x)), expf(mean + (stddev * r.y))};
+}
+
+/**
+ * \brief Returns a log-normally distributed \p double value.
+ *
+ * Generates and returns a log-normally distributed \p double value using Squares
+ * generator in \p state, and increments position of the generator by one.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Log-normally distributed \p double value
+ */
+__forceinline__ __device__ __host__
+double rocrand_log_normal_double(rocrand_state_squares* state, double mean, double stddev)
+{
+    double r = rocrand_device::detail::normal_distribution_double(rocrand(state));
+    return exp(mean + (stddev * r));
+}
+
+/**
+ * \brief Returns two log-normally distributed \p double values.
+ *
+ * Generates and returns two log-normally distributed \p double values using Squares
+ * generator in \p state, and increments position of the generator by four.
+ * The function uses the Box-Muller transform method to generate two normally distributed
+ * values, transforms them to log-normally distributed values, and returns both.
+ *
+ * \param state  Pointer to a state to use
+ * \param mean   Mean of the related log-normal distribution
+ * \param stddev Standard deviation of the related log-normal distribution
+ *
+ * \return Two log-normally distributed \p double values as \p double2
+ */
+__forceinline__ __device__ __host__
+double2 rocrand_log_normal_double2(rocrand_state_squares* state, double mean, double stddev)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+    auto state3 = rocrand(state);
+    auto state4 = rocrand(state);
+
+    double2 r = rocrand_device::detail::normal_distribution_double2(
+        uint4{state1, state2, state3, state4});
+    return double2{exp(mean + (stddev * r.x)), exp(mean + (stddev * r.y))};
+}
+
 /** @} */ // end of group rocranddevice
 
 #endif // ROCRAND_LOG_NORMAL_H_
@@ -126,7 +126,7 @@ struct mtgp32_state
     unsigned int status[MTGP_STATE];
 };
 
-inline
+__forceinline__ __device__ __host__
 void rocrand_mtgp32_init_state(unsigned int array[],
                                const mtgp32_fast_params *para, unsigned int seed)
 {
@@ -138,7 +138,10 @@ void rocrand_mtgp32_init_state(unsigned int array[],
     tmp = hidden_seed;
     tmp += tmp >> 16;
     tmp += tmp >> 8;
-    memset(array, tmp & 0xff, sizeof(unsigned int) * size);
+    // Same as memset with the byte tmp & 0xff, but also available in device code
+    tmp = (tmp & 0xff) * 0x01010101U;
+    for (i = 0; i < size; i++)
+        array[i] = tmp;
     array[0] = seed;
     array[1] = hidden_seed;
     for (i = 1; i < size; i++)
@@ -330,6 +333,30 @@ public:
 
 }; // mtgp32_engine class
 
+/// Initializes \p engine as the \p id -th state of a set of states: its state is
+/// expanded from \p seed and its parameters are taken from \p params, except \p mask
+/// which is shared by all states of the set.
+__forceinline__ __device__ __host__
+void rocrand_mtgp32_init_engine(mtgp32_engine&            engine,
+                                const mtgp32_fast_params& params,
+                                unsigned int              mask,
+                                unsigned int              seed,
+                                int                       id)
+{
+    rocrand_mtgp32_init_state(&(engine.m_state.status[0]), &params, seed);
+    engine.m_state.offset = 0;
+    engine.m_state.id = id;
+    engine.pos_tbl = params.pos;
+    engine.sh1_tbl = params.sh1;
+    engine.sh2_tbl = params.sh2;
+    engine.mask = mask;
+    for (int j = 0; j < MTGP_TS; j++) {
+        engine.param_tbl[j] = params.tbl[j];
+        engine.temper_tbl[j] = params.tmp_tbl[j];
+        engine.single_temper_tbl[j] = params.flt_tmp_tbl[j];
+    }
+}
+
 } // end namespace rocrand_device
 
 /** \rocrand_internal \addtogroup rocranddevice
@@ -373,18 +400,11 @@ inline rocrand_status rocrand_make_state_mtgp32(rocrand_state_mtgp32* state,
         return ROCRAND_STATUS_ALLOCATION_FAILED;
 
     for (i = 0; i < n; i++) {
-        rocrand_device::rocrand_mtgp32_init_state(&(h_state[i].m_state.status[0]), &params[i], (unsigned int)seed + i + 1);
-        h_state[i].m_state.offset = 0;
-        h_state[i].m_state.id = i;
-        h_state[i].pos_tbl = params[i].pos;
-        h_state[i].sh1_tbl = params[i].sh1;
-        h_state[i].sh2_tbl = params[i].sh2;
-        h_state[i].mask = params[0].mask;
-        for (int j = 0; j < MTGP_TS; j++) {
-            h_state[i].param_tbl[j] = params[i].tbl[j];
-            h_state[i].temper_tbl[j] = params[i].tmp_tbl[j];
-            h_state[i].single_temper_tbl[j] = params[i].flt_tmp_tbl[j];
-        }
+        rocrand_device::rocrand_mtgp32_init_engine(h_state[i],
+                                                   params[i],
+                                                   params[0].mask,
+                                                   (unsigned int)seed + i + 1,
+                                                   i);
     }
 
     const hipError_t error
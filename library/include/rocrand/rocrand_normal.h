@@ -32,16 +32,21 @@
 #include "rocrand/rocrand_mrg31k3p.h"
 #include "rocrand/rocrand_mrg32k3a.h"
 #include "rocrand/rocrand_mtgp32.h"
+#include "rocrand/rocrand_pcg64_dxsm.h"
 #include "rocrand/rocrand_philox4x32_10.h"
+#include "rocrand/rocrand_philox4x64_10.h"
 #include "rocrand/rocrand_scrambled_sobol32.h"
 #include "rocrand/rocrand_scrambled_sobol64.h"
 #include "rocrand/rocrand_sobol32.h"
 #include "rocrand/rocrand_sobol64.h"
+#include "rocrand/rocrand_squares.h"
 #include "rocrand/rocrand_threefry2x32_20.h"
 #include "rocrand/rocrand_threefry2x64_20.h"
 #include "rocrand/rocrand_threefry4x32_20.h"
 #include "rocrand/rocrand_threefry4x64_20.h"
+#include "rocrand/rocrand_xoroshiro128ss.h"
 #include "rocrand/rocrand_xorwow.h"
+#include "rocrand/rocrand_xoshiro256pp.h"
 
 #include "rocrand/rocrand_uniform.h"
 
@@ -1475,6 +1480,419 @@ double2 rocrand_normal_double2(rocrand_state_threefry4x64_20* state)
     return rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
 }
 
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p float value using Philox4x64
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+__forceinline__ __device__ __host__
+float rocrand_normal(rocrand_state_philox4x64_10* state)
+{
+    return rocrand_device::detail::normal_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using Philox4x64
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+__forceinline__ __device__ __host__
+float2 rocrand_normal2(rocrand_state_philox4x64_10* state)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution2(state1, state2);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using Philox4x64
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+__forceinline__ __device__ __host__
+double rocrand_normal_double(rocrand_state_philox4x64_10* state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using Philox4x64
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
+__forceinline__ __device__ __host__
+double2 rocrand_normal_double2(rocrand_state_philox4x64_10* state)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p float value using xoshiro256++
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+__forceinline__ __device__ __host__
+float rocrand_normal(rocrand_state_xoshiro256pp* state)
+{
+    return rocrand_device::detail::normal_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using xoshiro256++
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+__forceinline__ __device__ __host__
+float2 rocrand_normal2(rocrand_state_xoshiro256pp* state)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution2(state1, state2);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using xoshiro256++
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+__forceinline__ __device__ __host__
+double rocrand_normal_double(rocrand_state_xoshiro256pp* state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using xoshiro256++
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
+__forceinline__ __device__ __host__
+double2 rocrand_normal_double2(rocrand_state_xoshiro256pp* state)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p float value using xoroshiro128**
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+__forceinline__ __device__ __host__
+float rocrand_normal(rocrand_state_xoroshiro128ss* state)
+{
+    return rocrand_device::detail::normal_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using xoroshiro128**
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+__forceinline__ __device__ __host__
+float2 rocrand_normal2(rocrand_state_xoroshiro128ss* state)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution2(state1, state2);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using xoroshiro128**
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+__forceinline__ __device__ __host__
+double rocrand_normal_double(rocrand_state_xoroshiro128ss* state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using xoroshiro128**
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
+__forceinline__ __device__ __host__
+double2 rocrand_normal_double2(rocrand_state_xoroshiro128ss* state)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p float value using PCG64 DXSM
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+__forceinline__ __device__ __host__
+float rocrand_normal(rocrand_state_pcg64_dxsm* state)
+{
+    return rocrand_device::detail::normal_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using PCG64 DXSM
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+__forceinline__ __device__ __host__
+float2 rocrand_normal2(rocrand_state_pcg64_dxsm* state)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution2(state1, state2);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using PCG64 DXSM
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+__forceinline__ __device__ __host__
+double rocrand_normal_double(rocrand_state_pcg64_dxsm* state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using PCG64 DXSM
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
+__forceinline__ __device__ __host__
+double2 rocrand_normal_double2(rocrand_state_pcg64_dxsm* state)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution_double2(ulonglong2{state1, state2});
+}
+
+/**
+ * \brief Returns a normally distributed \p float value.
+ *
+ * Generates and returns a normally distributed \p float value using Squares
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Normally distributed \p float value
+ */
+__forceinline__ __device__ __host__
+float rocrand_normal(rocrand_state_squares* state)
+{
+    return rocrand_device::detail::normal_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p float values.
+ *
+ * Generates and returns two normally distributed \p float values using Squares
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Two normally distributed \p float value as \p float2
+ */
+__forceinline__ __device__ __host__
+float2 rocrand_normal2(rocrand_state_squares* state)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution2(state1, state2);
+}
+
+/**
+ * \brief Returns a normally distributed \p double value.
+ *
+ * Generates and returns a normally distributed \p double value using Squares
+ * generator in \p state, and increments position of the generator by one.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Normally distributed \p double value
+ */
+__forceinline__ __device__ __host__
+double rocrand_normal_double(rocrand_state_squares* state)
+{
+    return rocrand_device::detail::normal_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns two normally distributed \p double values.
+ *
+ * Generates and returns two normally distributed \p double values using Squares
+ * generator in \p state, and increments position of the generator by two.
+ * Used normal distribution has mean value equal to 0.0f, and standard deviation
+ * equal to 1.0f.
+ * The function uses the Box-Muller transform method to generate two normally
+ * distributed values, and returns both of them.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Two normally distributed \p double value as \p double2
+ */
+__forceinline__ __device__ __host__
+double2 rocrand_normal_double2(rocrand_state_squares* state)
+{
+    auto state1 = rocrand(state);
+    auto state2 = rocrand(state);
+    auto state3 = rocrand(state);
+    auto state4 = rocrand(state);
+
+    return rocrand_device::detail::normal_distribution_double2(
+        uint4{state1, state2, state3, state4});
+}
+
 /** @} */ // end of group rocranddevice
 
 #endif // ROCRAND_NORMAL_H_
@@ -0,0 +1,349 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Based on the PCG family by Melissa O'Neill (https://www.pcg-random.org/) and
+// on the PCG64DXSM bit generator of NumPy (https://numpy.org/).
+
+#ifndef ROCRAND_PCG64_DXSM_H_
+#define ROCRAND_PCG64_DXSM_H_
+
+#include "rocrand/rocrand_common.h"
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+/**
+ * \def ROCRAND_PCG64_DXSM_DEFAULT_SEED
+ * \brief Default seed for PCG64_DXSM PRNG.
+ */
+#define ROCRAND_PCG64_DXSM_DEFAULT_SEED 0ULL
+/** @} */ // end of group rocranddevice
+
+namespace rocrand_device
+{
+
+/// PCG64 DXSM engine: a 128-bit LCG with the "cheap" 64-bit multiplier and
+/// the DXSM (double xorshift multiply) output function.
+///
+/// For seed \p s, subsequence \p k and offset \p n the engine produces the same
+/// values as <tt>numpy.random.PCG64DXSM(s).jumped(k)</tt> advanced by \p n.
+class pcg64_dxsm_engine
+{
+public:
+    struct pcg64_dxsm_state
+    {
+        // 128-bit integers, x holds the low and y the high 64 bits
+        ulonglong2 state;
+        ulonglong2 inc;
+    };
+
+    __forceinline__ __device__ __host__ pcg64_dxsm_engine()
+        : pcg64_dxsm_engine(ROCRAND_PCG64_DXSM_DEFAULT_SEED, 0, 0)
+    {}
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// A subsequence is 2^128 * (golden ratio - 1) numbers long, the jump
+    /// distance of NumPy's <tt>PCG64DXSM.jumped()</tt>.
+    __forceinline__ __device__ __host__ pcg64_dxsm_engine(const unsigned long long seed,
+                                                          const unsigned long long subsequence,
+                                                          const unsigned long long offset)
+    {
+        this->seed(seed, subsequence, offset);
+    }
+
+    /// Reinitializes the internal state of the PRNG using new
+    /// seed value \p seed_value, skips \p subsequence subsequences
+    /// and \p offset random numbers.
+    ///
+    /// The state and the increment are derived from \p seed_value in the
+    /// same way as by NumPy's <tt>SeedSequence</tt>.
+    __forceinline__ __device__ __host__ void seed(const unsigned long long seed_value,
+                                                  const unsigned long long subsequence,
+                                                  const unsigned long long offset)
+    {
+        unsigned long long words[4];
+        seed_sequence(seed_value, words);
+
+        // The initial state is set up with the default 128-bit multiplier of PCG64
+        const ulonglong2 initstate = {words[1], words[0]};
+        m_state.inc.x              = (words[3] << 1) | 1;
+        m_state.inc.y              = (words[2] << 1) | (words[3] >> 63);
+
+        const ulonglong2 multiplier = {0x4385DF649FCCF645ULL, 0x2360ED051FC65DA4ULL};
+        m_state.state               = m_state.inc;
+        m_state.state               = add(m_state.state, initstate);
+        m_state.state               = add(mul(m_state.state, multiplier), m_state.inc);
+
+        // Subsequence and offset are skipped together with a single advance
+        advance(add(subsequence_delta(subsequence), ulonglong2{offset, 0}));
+    }
+
+    /// Advances the internal state to skip one number.
+    __forceinline__ __device__ __host__ void discard()
+    {
+        discard_state();
+    }
+
+    /// Advances the internal state to skip \p offset numbers.
+    __forceinline__ __device__ __host__ void discard(unsigned long long offset)
+    {
+        advance(ulonglong2{offset, 0});
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences.
+    /// A subsequence is 2^128 * (golden ratio - 1) numbers long.
+    __forceinline__ __device__ __host__ void discard_subsequence(unsigned long long subsequence)
+    {
+        advance(subsequence_delta(subsequence));
+    }
+
+    __forceinline__ __device__ __host__ unsigned long long operator()()
+    {
+        return next();
+    }
+
+    __forceinline__ __device__ __host__ unsigned long long next()
+    {
+        // DXSM output function on the state before the step
+        unsigned long long       hi = m_state.state.y;
+        const unsigned long long lo = m_state.state.x | 1;
+        hi ^= hi >> 32;
+        hi *= cheap_multiplier;
+        hi ^= hi >> 48;
+        hi *= lo;
+
+        discard_state();
+        return hi;
+    }
+
+protected:
+    static constexpr unsigned long long cheap_multiplier = 0xDA942042E4DD58B5ULL;
+
+    // Advances the internal state to the next state.
+    __forceinline__ __device__ __host__ void discard_state()
+    {
+        // state * cheap_multiplier + inc, only needs a 64x128-bit product
+        const unsigned long long lo = m_state.state.x * cheap_multiplier;
+        const unsigned long long hi = m_state.state.y * cheap_multiplier
+                                      + detail::mulhi_u64(m_state.state.x, cheap_multiplier);
+        m_state.state = add(ulonglong2{lo, hi}, m_state.inc);
+    }
+
+    // Advances the state by delta steps in O(log(delta)) operations
+    // (F. Brown, "Random Number Generation with Arbitrary Stride").
+    __forceinline__ __device__ __host__ void advance(ulonglong2 delta)
+    {
+        ulonglong2 acc_mult = {1, 0};
+        ulonglong2 acc_plus = {0, 0};
+        ulonglong2 cur_mult = {cheap_multiplier, 0};
+        ulonglong2 cur_plus = m_state.inc;
+        while(delta.x != 0 || delta.y != 0)
+        {
+            if(delta.x & 1)
+            {
+                acc_mult = mul(acc_mult, cur_mult);
+                acc_plus = add(mul(acc_plus, cur_mult), cur_plus);
+            }
+            cur_plus = mul(add(cur_mult, ulonglong2{1, 0}), cur_plus);
+            cur_mult = mul(cur_mult, cur_mult);
+            delta.x  = (delta.x >> 1) | (delta.y << 63);
+            delta.y >>= 1;
+        }
+        m_state.state = add(mul(acc_mult, m_state.state), acc_plus);
+    }
+
+    // Number of steps in subsequence subsequences (mod 2^128)
+    static __forceinline__ __device__ __host__ ulonglong2
+        subsequence_delta(const unsigned long long subsequence)
+    {
+        const ulonglong2 jump = {0xF39CC0605CEDC835ULL, 0x9E3779B97F4A7C15ULL};
+        return ulonglong2{subsequence * jump.x,
+                          detail::mulhi_u64(subsequence, jump.x) + subsequence * jump.y};
+    }
+
+    static __forceinline__ __device__ __host__ ulonglong2 add(const ulonglong2 a, const ulonglong2 b)
+    {
+        const unsigned long long lo = a.x + b.x;
+        return ulonglong2{lo, a.y + b.y + (lo < a.x ? 1 : 0)};
+    }
+
+    // Low 128 bits of the product
+    static __forceinline__ __device__ __host__ ulonglong2 mul(const ulonglong2 a, const ulonglong2 b)
+    {
+        return ulonglong2{a.x * b.x, detail::mulhi_u64(a.x, b.x) + a.x * b.y + a.y * b.x};
+    }
+
+    // NumPy's SeedSequence with a single integer as entropy and no spawn key,
+    // generating four 64-bit words.
+    static __forceinline__ __device__ __host__ void
+        seed_sequence(const unsigned long long seed, unsigned long long (&words)[4])
+    {
+        constexpr unsigned int pool_size = 4;
+
+        unsigned int hash_const = 0x43B0D7E5U;
+        unsigned int pool[pool_size];
+        // The 64-bit seed is the entropy array {low, high}, shorter arrays
+        // are padded with zeros
+        for(unsigned int i = 0; i < pool_size; i++)
+        {
+            const unsigned int entropy
+                = i == 0 ? static_cast<unsigned int>(seed)
+                         : (i == 1 ? static_cast<unsigned int>(seed >> 32) : 0U);
+            pool[i] = hashmix(entropy, hash_const);
+        }
+        for(unsigned int i_src = 0; i_src < pool_size; i_src++)
+        {
+            for(unsigned int i_dst = 0; i_dst < pool_size; i_dst++)
+            {
+                if(i_src != i_dst)
+                {
+                    pool[i_dst] = mix(pool[i_dst], hashmix(pool[i_src], hash_const));
+                }
+            }
+        }
+
+        hash_const = 0x8B51F9DDU;
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            unsigned int half[2];
+            for(unsigned int j = 0; j < 2; j++)
+            {
+                unsigned int value = pool[(2 * i + j) % pool_size];
+                value ^= hash_const;
+                hash_const *= 0x58F38DEDU;
+                value *= hash_const;
+                value ^= value >> 16;
+                half[j] = value;
+            }
+            words[i] = half[0] | (static_cast<unsigned long long>(half[1]) << 32);
+        }
+    }
+
+    static __forceinline__ __device__ __host__ unsigned int hashmix(unsigned int  value,
+                                                                    unsigned int& hash_const)
+    {
+        value ^= hash_const;
+        hash_const *= 0x931E8875U;
+        value *= hash_const;
+        value ^= value >> 16;
+        return value;
+    }
+
+    static __forceinline__ __device__ __host__ unsigned int mix(const unsigned int x,
+                                                                const unsigned int y)
+    {
+        unsigned int result = 0xCA01F9DDU * x - 0x4973F715U * y;
+        result ^= result >> 16;
+        return result;
+    }
+
+protected:
+    pcg64_dxsm_state m_state;
+
+}; // pcg64_dxsm_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::pcg64_dxsm_engine rocrand_state_pcg64_dxsm;
+/// \endcond
+
+/**
+ * \brief Initializes PCG64 DXSM state.
+ *
+ * Initializes the PCG64 DXSM generator \p state with the given
+ * \p seed, \p subsequence, and \p offset.
+ *
+ * With subsequence 0 the generated values match NumPy's
+ * <tt>PCG64DXSM(seed)</tt> advanced by \p offset.
+ *
+ * \param seed Value to use as a seed
+ * \param subsequence Subsequence to start at
+ * \param offset Absolute offset into subsequence
+ * \param state Pointer to state to initialize
+ */
+__forceinline__ __device__ __host__
+void rocrand_init(const unsigned long long  seed,
+                  const unsigned long long  subsequence,
+                  const unsigned long long  offset,
+                  rocrand_state_pcg64_dxsm* state)
+{
+    *state = rocrand_state_pcg64_dxsm(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned long long</tt> value
+ * from [0; 2^64 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned long long</tt>
+ * value from [0; 2^64 - 1] range using PCG64 DXSM generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Pseudorandom value (64-bit) as an <tt>unsigned long long</tt>
+ */
+__forceinline__ __device__ __host__
+unsigned long long rocrand(rocrand_state_pcg64_dxsm* state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Updates PCG64 DXSM state to skip ahead by \p offset elements.
+ *
+ * Updates the PCG64 DXSM state in \p state to skip ahead by \p offset elements.
+ *
+ * \param offset Number of elements to skip
+ * \param state Pointer to state to update
+ */
+__forceinline__ __device__ __host__
+void skipahead(unsigned long long offset, rocrand_state_pcg64_dxsm* state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates PCG64 DXSM state to skip ahead by \p subsequence subsequences.
+ *
+ * Updates the PCG64 DXSM \p state to skip ahead by \p subsequence subsequences.
+ * Skipping one subsequence is equivalent to NumPy's <tt>PCG64DXSM.jumped()</tt>.
+ *
+ * \param subsequence Number of subsequences to skip
+ * \param state Pointer to state to update
+ */
+__forceinline__ __device__ __host__
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_pcg64_dxsm* state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/** @} */ // end of group rocranddevice
+
+#endif // ROCRAND_PCG64_DXSM_H_
@@ -32,16 +32,21 @@
 #include "rocrand/rocrand_mrg31k3p.h"
 #include "rocrand/rocrand_mrg32k3a.h"
 #include "rocrand/rocrand_mtgp32.h"
+#include "rocrand/rocrand_pcg64_dxsm.h"
 #include "rocrand/rocrand_philox4x32_10.h"
+#include "rocrand/rocrand_philox4x64_10.h"
 #include "rocrand/rocrand_scrambled_sobol32.h"
 #include "rocrand/rocrand_scrambled_sobol64.h"
 #include "rocrand/rocrand_sobol32.h"
 #include "rocrand/rocrand_sobol64.h"
+#include "rocrand/rocrand_squares.h"
 #include "rocrand/rocrand_threefry2x32_20.h"
 #include "rocrand/rocrand_threefry2x64_20.h"
 #include "rocrand/rocrand_threefry4x32_20.h"
 #include "rocrand/rocrand_threefry4x64_20.h"
+#include "rocrand/rocrand_xoroshiro128ss.h"
 #include "rocrand/rocrand_xorwow.h"
+#include "rocrand/rocrand_xoshiro256pp.h"
 
 #include "rocrand/rocrand_normal.h"
 #include "rocrand/rocrand_uniform.h"
@@ -511,6 +516,93 @@ unsigned int rocrand_poisson(rocrand_state_threefry4x64_20* state, double lambda
     return rocrand_device::detail::poisson_distribution_inv(state, lambda);
 }
 
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using Philox4x64 generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using Philox4x64 generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param lambda Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_poisson(rocrand_state_philox4x64_10* state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv(state, lambda);
+}
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using xoshiro256++ generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using xoshiro256++ generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param lambda Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_poisson(rocrand_state_xoshiro256pp* state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv(state, lambda);
+}
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using xoroshiro128** generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using xoroshiro128** generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param lambda Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_poisson(rocrand_state_xoroshiro128ss* state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv(state, lambda);
+}
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using PCG64 DXSM generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using PCG64 DXSM generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param lambda Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_poisson(rocrand_state_pcg64_dxsm* state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv(state, lambda);
+}
+
+/**
+ * \brief Returns a Poisson-distributed <tt>unsigned int</tt> using Squares generator.
+ *
+ * Generates and returns Poisson-distributed distributed random <tt>unsigned int</tt>
+ * values using Squares generator in \p state. State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ * \param lambda Lambda parameter of the Poisson distribution
+ *
+ * \return Poisson-distributed <tt>unsigned int</tt>
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_poisson(rocrand_state_squares* state, double lambda)
+{
+    return rocrand_device::detail::poisson_distribution_inv<rocrand_state_squares*, unsigned int>(
+        state,
+        lambda);
+}
+
 /** @} */ // end of group rocranddevice
 
 #endif // ROCRAND_POISSON_H_
@@ -0,0 +1,341 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Based on the Squares counter-based generator by Bernard Widynski,
+// see "Squares: A Fast Counter-Based RNG", arXiv:2004.06278.
+
+#ifndef ROCRAND_SQUARES_H_
+#define ROCRAND_SQUARES_H_
+
+#include "rocrand/rocrand_common.h"
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+/**
+ * \def ROCRAND_SQUARES_DEFAULT_SEED
+ * \brief Default seed for SQUARES PRNG.
+ */
+#define ROCRAND_SQUARES_DEFAULT_SEED 0ULL
+/** @} */ // end of group rocranddevice
+
+namespace rocrand_device
+{
+namespace detail
+{
+
+__forceinline__ __device__ __host__
+unsigned long long squares_swap_halves(const unsigned long long x)
+{
+    return (x >> 32) | (x << 32);
+}
+
+// Four rounds of squaring, 32-bit output.
+__forceinline__ __device__ __host__
+unsigned int squares32(const unsigned long long key, const unsigned long long counter)
+{
+    const unsigned long long y = counter * key;
+    const unsigned long long z = y + key;
+
+    unsigned long long x = y;
+    x                    = squares_swap_halves(x * x + y);
+    x                    = squares_swap_halves(x * x + z);
+    x                    = squares_swap_halves(x * x + y);
+    return static_cast<unsigned int>((x * x + z) >> 32);
+}
+
+// Five rounds of squaring, 64-bit output.
+__forceinline__ __device__ __host__
+unsigned long long squares64(const unsigned long long key, const unsigned long long counter)
+{
+    const unsigned long long y = counter * key;
+    const unsigned long long z = y + key;
+
+    unsigned long long x = y;
+    x                    = squares_swap_halves(x * x + y);
+    x                    = squares_swap_halves(x * x + z);
+    x                    = squares_swap_halves(x * x + y);
+    const unsigned long long t = x * x + z;
+    x                          = squares_swap_halves(t);
+    return t ^ ((x * x + y) >> 32);
+}
+
+// Derives a key from \p stream. Squares needs keys with an irregular bit
+// pattern: every hex digit is non-zero, neighbouring digits differ and the key
+// is odd. The digits are picked by a mixed-radix decomposition of a hashed
+// \p stream, so every stream maps to a valid key without a rejection loop.
+__forceinline__ __device__ __host__
+unsigned long long squares_key(unsigned long long stream)
+{
+    unsigned long long r = splitmix64(stream);
+
+    unsigned long long key  = 0;
+    unsigned int       prev = 0;
+    for(unsigned int i = 0; i < 15; i++)
+    {
+        // Any non-zero digit for the first one, any non-zero digit other than
+        // the previous one afterwards.
+        const unsigned int choices = i == 0 ? 15 : 14;
+        unsigned int       digit   = 1 + static_cast<unsigned int>(r % choices);
+        r /= choices;
+        if(i > 0 && digit >= prev)
+        {
+            digit++;
+        }
+        key  = (key << 4) | digit;
+        prev = digit;
+    }
+
+    // The last digit is odd and differs from the previous one.
+    const unsigned int choices = (prev & 1) ? 7 : 8;
+    unsigned int       digit   = 2 * static_cast<unsigned int>(r % choices) + 1;
+    if((prev & 1) && digit >= prev)
+    {
+        digit += 2;
+    }
+    return (key << 4) | digit;
+}
+
+} // end namespace detail
+
+class squares_engine
+{
+public:
+    struct squares_state
+    {
+        unsigned long long counter;
+        unsigned long long key;
+        // Index of the key, the key of subsequence s + n is derived from stream + n
+        unsigned long long stream;
+    };
+
+    __forceinline__ __device__ __host__ squares_engine()
+        : squares_engine(ROCRAND_SQUARES_DEFAULT_SEED, 0, 0)
+    {}
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// Every subsequence uses its own key and is 2^64 numbers long.
+    __forceinline__ __device__ __host__ squares_engine(const unsigned long long seed,
+                                                       const unsigned long long subsequence,
+                                                       const unsigned long long offset)
+    {
+        this->seed(seed, subsequence, offset);
+    }
+
+    /// Reinitializes the internal state of the PRNG using new
+    /// seed value \p seed_value, skips \p subsequence subsequences
+    /// and \p offset random numbers.
+    __forceinline__ __device__ __host__ void seed(unsigned long long       seed_value,
+                                                  const unsigned long long subsequence,
+                                                  const unsigned long long offset)
+    {
+        m_state.stream  = detail::splitmix64(seed_value) + subsequence;
+        m_state.key     = detail::squares_key(m_state.stream);
+        m_state.counter = offset;
+    }
+
+    /// Advances the internal state to skip one number.
+    __forceinline__ __device__ __host__ void discard()
+    {
+        m_state.counter++;
+    }
+
+    /// Advances the internal state to skip \p offset numbers.
+    __forceinline__ __device__ __host__ void discard(unsigned long long offset)
+    {
+        m_state.counter += offset;
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences.
+    /// The position within the subsequence is kept.
+    __forceinline__ __device__ __host__ void discard_subsequence(unsigned long long subsequence)
+    {
+        m_state.stream += subsequence;
+        m_state.key = detail::squares_key(m_state.stream);
+    }
+
+    __forceinline__ __device__ __host__ unsigned int operator()()
+    {
+        return next();
+    }
+
+    __forceinline__ __device__ __host__ unsigned int next()
+    {
+        return detail::squares32(m_state.key, m_state.counter++);
+    }
+
+    /// Returns the key of the current subsequence.
+    __forceinline__ __device__ __host__ unsigned long long key() const
+    {
+        return m_state.key;
+    }
+
+    /// Returns the counter of the next number.
+    __forceinline__ __device__ __host__ unsigned long long counter() const
+    {
+        return m_state.counter;
+    }
+
+protected:
+    squares_state m_state;
+
+}; // squares_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::squares_engine rocrand_state_squares;
+/// \endcond
+
+/**
+ * \brief Returns the Squares key of a subsequence.
+ *
+ * Returns the key used by a Squares state initialized with \p seed and
+ * \p subsequence. The value at \p offset of that subsequence is
+ * <tt>rocrand_squares32(rocrand_squares_key(seed, subsequence), offset)</tt>.
+ *
+ * \param seed Value to use as a seed
+ * \param subsequence Subsequence of the key
+ *
+ * \return Key of the subsequence
+ */
+__forceinline__ __device__ __host__
+unsigned long long rocrand_squares_key(const unsigned long long seed,
+                                       const unsigned long long subsequence)
+{
+    unsigned long long x = seed;
+    return rocrand_device::detail::squares_key(rocrand_device::detail::splitmix64(x)
+                                               + subsequence);
+}
+
+/**
+ * \brief Returns the 32-bit Squares value at \p counter.
+ *
+ * Computes the value directly from \p key and \p counter without any state,
+ * so every element of a sequence can be generated independently.
+ *
+ * \param key Key of the sequence, see rocrand_squares_key()
+ * \param counter Position in the sequence
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand_squares32(const unsigned long long key, const unsigned long long counter)
+{
+    return rocrand_device::detail::squares32(key, counter);
+}
+
+/**
+ * \brief Returns the 64-bit Squares value at \p counter.
+ *
+ * Computes the value directly from \p key and \p counter without any state
+ * using one more round than rocrand_squares32().
+ *
+ * \param key Key of the sequence, see rocrand_squares_key()
+ * \param counter Position in the sequence
+ *
+ * \return Pseudorandom value (64-bit) as an <tt>unsigned long long</tt>
+ */
+__forceinline__ __device__ __host__
+unsigned long long rocrand_squares64(const unsigned long long key,
+                                     const unsigned long long counter)
+{
+    return rocrand_device::detail::squares64(key, counter);
+}
+
+/**
+ * \brief Initializes Squares state.
+ *
+ * Initializes the Squares generator \p state with the given
+ * \p seed, \p subsequence, and \p offset.
+ *
+ * \param seed Value to use as a seed
+ * \param subsequence Subsequence to start at
+ * \param offset Absolute offset into subsequence
+ * \param state Pointer to state to initialize
+ */
+__forceinline__ __device__ __host__
+void rocrand_init(const unsigned long long seed,
+                  const unsigned long long subsequence,
+                  const unsigned long long offset,
+                  rocrand_state_squares*   state)
+{
+    *state = rocrand_state_squares(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned int</tt> value
+ * from [0; 2^32 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned int</tt>
+ * value from [0; 2^32 - 1] range using Squares generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Pseudorandom value (32-bit) as an <tt>unsigned int</tt>
+ */
+__forceinline__ __device__ __host__
+unsigned int rocrand(rocrand_state_squares* state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Updates Squares state to skip ahead by \p offset elements.
+ *
+ * Updates the Squares state in \p state to skip ahead by \p offset elements.
+ *
+ * \param offset Number of elements to skip
+ * \param state Pointer to state to update
+ */
+__forceinline__ __device__ __host__
+void skipahead(unsigned long long offset, rocrand_state_squares* state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates Squares state to skip ahead by \p subsequence subsequences.
+ *
+ * Updates the Squares \p state to skip ahead by \p subsequence subsequences.
+ * Each subsequence uses its own key and is 2^64 numbers long.
+ *
+ * \param subsequence Number of subsequences to skip
+ * \param state Pointer to state to update
+ */
+__forceinline__ __device__ __host__
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_squares* state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/** @} */ // end of group rocranddevice
+
+#endif // ROCRAND_SQUARES_H_
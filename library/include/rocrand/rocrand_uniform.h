@@ -30,16 +30,21 @@
 #include "rocrand/rocrand_mrg31k3p.h"
 #include "rocrand/rocrand_mrg32k3a.h"
 #include "rocrand/rocrand_mtgp32.h"
+#include "rocrand/rocrand_pcg64_dxsm.h"
 #include "rocrand/rocrand_philox4x32_10.h"
+#include "rocrand/rocrand_philox4x64_10.h"
 #include "rocrand/rocrand_scrambled_sobol32.h"
 #include "rocrand/rocrand_scrambled_sobol64.h"
 #include "rocrand/rocrand_sobol32.h"
 #include "rocrand/rocrand_sobol64.h"
+#include "rocrand/rocrand_squares.h"
 #include "rocrand/rocrand_threefry2x32_20.h"
 #include "rocrand/rocrand_threefry2x64_20.h"
 #include "rocrand/rocrand_threefry4x32_20.h"
 #include "rocrand/rocrand_threefry4x64_20.h"
+#include "rocrand/rocrand_xoroshiro128ss.h"
 #include "rocrand/rocrand_xorwow.h"
+#include "rocrand/rocrand_xoshiro256pp.h"
 
 #include "rocrand/rocrand_common.h"
 
@@ -841,6 +846,201 @@ double rocrand_uniform_double(rocrand_state_threefry4x64_20* state)
     return rocrand_device::detail::uniform_distribution_double(rocrand(state));
 }
 
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Philox4x64 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+__forceinline__ __device__ __host__
+float rocrand_uniform(rocrand_state_philox4x64_10* state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Philox4x64 generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from 53 random bits of one <tt>unsigned long long</tt> value.
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+__forceinline__ __device__ __host__
+double rocrand_uniform_double(rocrand_state_philox4x64_10* state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using xoshiro256++ generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+__forceinline__ __device__ __host__
+float rocrand_uniform(rocrand_state_xoshiro256pp* state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using xoshiro256++ generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from 53 random bits of one <tt>unsigned long long</tt> value.
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+__forceinline__ __device__ __host__
+double rocrand_uniform_double(rocrand_state_xoshiro256pp* state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using xoroshiro128** generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+__forceinline__ __device__ __host__
+float rocrand_uniform(rocrand_state_xoroshiro128ss* state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using xoroshiro128** generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from 53 random bits of one <tt>unsigned long long</tt> value.
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+__forceinline__ __device__ __host__
+double rocrand_uniform_double(rocrand_state_xoroshiro128ss* state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using PCG64 DXSM generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+__forceinline__ __device__ __host__
+float rocrand_uniform(rocrand_state_pcg64_dxsm* state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using PCG64 DXSM generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from 53 random bits of one <tt>unsigned long long</tt> value.
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+__forceinline__ __device__ __host__
+double rocrand_uniform_double(rocrand_state_pcg64_dxsm* state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>float</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p float value from (0; 1] range
+ * (excluding \p 0.0f, including \p 1.0f) using Squares generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Uniformly distributed \p float value from (0; 1] range.
+ */
+__forceinline__ __device__ __host__
+float rocrand_uniform(rocrand_state_squares* state)
+{
+    return rocrand_device::detail::uniform_distribution(rocrand(state));
+}
+
+/**
+ * \brief Returns a uniformly distributed random <tt>double</tt> value
+ * from (0; 1] range.
+ *
+ * Generates and returns a uniformly distributed \p double value from (0; 1] range
+ * (excluding \p 0.0, including \p 1.0) using Squares generator in \p state, and
+ * increments position of the generator by one.
+ *
+ * \param state Pointer to a state to use
+ *
+ * Note: In this implementation returned \p double value is generated
+ * from only 32 random bits (one <tt>unsigned int</tt> value).
+ *
+ * \return Uniformly distributed \p double value from (0; 1] range.
+ */
+__forceinline__ __device__ __host__
+double rocrand_uniform_double(rocrand_state_squares* state)
+{
+    return rocrand_device::detail::uniform_distribution_double(rocrand(state));
+}
+
 /** @} */ // end of group rocranddevice
 
 #endif // ROCRAND_UNIFORM_H_
@@ -0,0 +1,298 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Based on the public domain reference implementation of xoroshiro128**
+// by David Blackman and Sebastiano Vigna, see https://prng.di.unimi.it/
+
+#ifndef ROCRAND_XOROSHIRO128SS_H_
+#define ROCRAND_XOROSHIRO128SS_H_
+
+#include "rocrand/rocrand_common.h"
+#include "rocrand/rocrand_xoshiro_precomputed.h"
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+/**
+ * \def ROCRAND_XOROSHIRO128SS_DEFAULT_SEED
+ * \brief Default seed for XOROSHIRO128SS PRNG.
+ */
+#define ROCRAND_XOROSHIRO128SS_DEFAULT_SEED 0ULL
+/** @} */ // end of group rocranddevice
+
+namespace rocrand_device
+{
+
+class xoroshiro128ss_engine
+{
+public:
+    struct xoroshiro128ss_state
+    {
+        ulonglong2 s;
+    };
+
+    __forceinline__ __device__ __host__ xoroshiro128ss_engine()
+        : xoroshiro128ss_engine(ROCRAND_XOROSHIRO128SS_DEFAULT_SEED, 0, 0)
+    {}
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// A subsequence is 2^64 numbers long.
+    __forceinline__ __device__ __host__ xoroshiro128ss_engine(const unsigned long long seed,
+                                                            const unsigned long long subsequence,
+                                                            const unsigned long long offset)
+    {
+        this->seed(seed, subsequence, offset);
+    }
+
+    /// Reinitializes the internal state of the PRNG using new
+    /// seed value \p seed_value, skips \p subsequence subsequences
+    /// and \p offset random numbers.
+    ///
+    /// The 128-bit state is expanded from \p seed_value with SplitMix64,
+    /// so the state is never all zeros.
+    ///
+    /// A subsequence is 2^64 numbers long.
+    __forceinline__ __device__ __host__ void seed(unsigned long long       seed_value,
+                                                  const unsigned long long subsequence,
+                                                  const unsigned long long offset)
+    {
+        m_state.s.x = detail::splitmix64(seed_value);
+        m_state.s.y = detail::splitmix64(seed_value);
+
+        discard_subsequence(subsequence);
+        discard(offset);
+    }
+
+    /// Advances the internal state to skip one number.
+    __forceinline__ __device__ __host__ void discard()
+    {
+        discard_state();
+    }
+
+    /// Advances the internal state to skip \p offset numbers.
+    __forceinline__ __device__ __host__ void discard(unsigned long long offset)
+    {
+        // Evaluating a jump polynomial costs one step per bit of the state,
+        // so short skips are done step by step.
+        constexpr unsigned long long step_mask = XOROSHIRO128_WORDS * 64 - 1;
+        for(unsigned int i = 0; i < (offset & step_mask); i++)
+        {
+            discard_state();
+        }
+#ifdef __HIP_DEVICE_COMPILE__
+        jump(offset & ~step_mask, d_xoroshiro128ss_jump);
+#else
+        jump(offset & ~step_mask, h_xoroshiro128ss_jump);
+#endif
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences.
+    /// A subsequence is 2^64 numbers long.
+    __forceinline__ __device__ __host__ void discard_subsequence(unsigned long long subsequence)
+    {
+#ifdef __HIP_DEVICE_COMPILE__
+        jump(subsequence, d_xoroshiro128ss_subsequence_jump);
+#else
+        jump(subsequence, h_xoroshiro128ss_subsequence_jump);
+#endif
+    }
+
+    /// Advances the internal state to skip \p sequence sequences.
+    /// A sequence is 2^96 numbers long.
+    __forceinline__ __device__ __host__ void discard_sequence(unsigned long long sequence)
+    {
+#ifdef __HIP_DEVICE_COMPILE__
+        jump(sequence, d_xoroshiro128ss_sequence_jump);
+#else
+        jump(sequence, h_xoroshiro128ss_sequence_jump);
+#endif
+    }
+
+    __forceinline__ __device__ __host__ unsigned long long operator()()
+    {
+        return next();
+    }
+
+    __forceinline__ __device__ __host__ unsigned long long next()
+    {
+        const unsigned long long result = rotl(m_state.s.x * 5, 7) * 9;
+        discard_state();
+        return result;
+    }
+
+protected:
+    // Advances the internal state to the next state.
+    __forceinline__ __device__ __host__ void discard_state()
+    {
+        const unsigned long long s0 = m_state.s.x;
+        const unsigned long long s1 = m_state.s.y ^ s0;
+
+        m_state.s.x = rotl(s0, 24) ^ s1 ^ (s1 << 16);
+        m_state.s.y = rotl(s1, 37);
+    }
+
+    // Multiplies the state by the transition matrix evaluated at the polynomial
+    // (i.e. jumps ahead by the power of x the polynomial is the remainder of).
+    __forceinline__ __device__ __host__ void
+        jump(const unsigned long long (&polynomial)[XOROSHIRO128_WORDS])
+    {
+        ulonglong2 s = {0, 0};
+        for(unsigned int i = 0; i < XOROSHIRO128_WORDS; i++)
+        {
+            for(unsigned int b = 0; b < 64; b++)
+            {
+                if(polynomial[i] & (1ULL << b))
+                {
+                    s.x ^= m_state.s.x;
+                    s.y ^= m_state.s.y;
+                }
+                discard_state();
+            }
+        }
+        m_state.s = s;
+    }
+
+    __forceinline__ __device__ __host__ void jump(
+        unsigned long long v,
+        const unsigned long long (&polynomials)[XOROSHIRO128_JUMP_POLYNOMIALS][XOROSHIRO128_WORDS])
+    {
+        // polynomials[i] is the jump polynomial for 2^i times the base distance,
+        // so a skip of v times the base distance is a product of the polynomials
+        // for the set bits of v.
+        for(unsigned int i = 0; v > 0; i++, v >>= 1)
+        {
+            if(v & 1)
+            {
+                jump(polynomials[i]);
+            }
+        }
+    }
+
+    static __forceinline__ __device__ __host__ unsigned long long rotl(const unsigned long long x,
+                                                                       const int                k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+protected:
+    xoroshiro128ss_state m_state;
+
+}; // xoroshiro128ss_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::xoroshiro128ss_engine rocrand_state_xoroshiro128ss;
+/// \endcond
+
+/**
+ * \brief Initializes xoroshiro128** state.
+ *
+ * Initializes the xoroshiro128** generator \p state with the given
+ * \p seed, \p subsequence, and \p offset.
+ *
+ * \param seed Value to use as a seed
+ * \param subsequence Subsequence to start at
+ * \param offset Absolute offset into subsequence
+ * \param state Pointer to state to initialize
+ */
+__forceinline__ __device__ __host__
+void rocrand_init(const unsigned long long    seed,
+                  const unsigned long long    subsequence,
+                  const unsigned long long    offset,
+                  rocrand_state_xoroshiro128ss* state)
+{
+    *state = rocrand_state_xoroshiro128ss(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned long long</tt> value
+ * from [0; 2^64 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned long long</tt>
+ * value from [0; 2^64 - 1] range using xoroshiro128** generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Pseudorandom value (64-bit) as an <tt>unsigned long long</tt>
+ */
+__forceinline__ __device__ __host__
+unsigned long long rocrand(rocrand_state_xoroshiro128ss* state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Updates xoroshiro128** state to skip ahead by \p offset elements.
+ *
+ * Updates the xoroshiro128** state in \p state to skip ahead by \p offset elements.
+ *
+ * \param offset Number of elements to skip
+ * \param state Pointer to state to update
+ */
+__forceinline__ __device__ __host__
+void skipahead(unsigned long long offset, rocrand_state_xoroshiro128ss* state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates xoroshiro128** state to skip ahead by \p subsequence subsequences.
+ *
+ * Updates the xoroshiro128** \p state to skip ahead by \p subsequence subsequences.
+ * Each subsequence is 2^64 numbers long.
+ *
+ * \param subsequence Number of subsequences to skip
+ * \param state Pointer to state to update
+ */
+__forceinline__ __device__ __host__
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_xoroshiro128ss* state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/**
+ * \brief Updates xoroshiro128** state to skip ahead by \p sequence sequences.
+ *
+ * Updates the xoroshiro128** \p state to skip ahead by \p sequence sequences.
+ * Each sequence is 2^96 numbers long.
+ *
+ * \param sequence Number of sequences to skip
+ * \param state Pointer to state to update
+ */
+__forceinline__ __device__ __host__
+void skipahead_sequence(unsigned long long sequence, rocrand_state_xoroshiro128ss* state)
+{
+    return state->discard_sequence(sequence);
+}
+
+/** @} */ // end of group rocranddevice
+
+#endif // ROCRAND_XOROSHIRO128SS_H_
@@ -22,7 +22,10 @@
 #define ROCRAND_XORWOW_H_
 
 #include "rocrand/rocrand_common.h"
-#include "rocrand/rocrand_xorwow_precomputed.h"
+#include "rocrand/rocrand_jump_polynomial.h"
+#ifndef ROCRAND_RUNTIME_JUMP_POLYNOMIALS
+    #include "rocrand/rocrand_xorwow_precomputed.h"
+#endif
 
 /** \rocrand_internal \addtogroup rocranddevice
  *
@@ -38,6 +41,18 @@
 namespace rocrand_device {
 namespace detail {
 
+// Computes the jump polynomial of v * 2^log2_multiplier steps of the xorshift values.
+__forceinline__ __device__ __host__ void xorwow_jump_polynomial(unsigned long long v,
+                                                               unsigned int       log2_multiplier,
+                                                               unsigned int (&polynomial)[5])
+{
+    // Characteristic polynomial of the xorshift transition without the x^160 term
+    const unsigned int lower[5]
+        = {0x00060001U, 0x08610030U, 0x00062121U, 0x0f3c0035U, 0x00000f0eU};
+    gf2_jump_polynomial(v, log2_multiplier, lower, polynomial);
+}
+
+#ifndef ROCRAND_RUNTIME_JUMP_POLYNOMIALS
 __forceinline__ __device__ __host__ void copy_vec(unsigned int* dst, const unsigned int* src)
 {
     for (int i = 0; i < XORWOW_N; i++)
@@ -61,6 +76,7 @@ __forceinline__ __device__ __host__ void mul_mat_vec_inplace(const unsigned int*
     }
     copy_vec(v, r);
 }
+#endif
 
 } // end detail namespace
 
@@ -133,7 +149,9 @@ public:
     /// Advances the internal state to skip \p offset numbers.
     __forceinline__ __device__ __host__ void discard(unsigned long long offset)
     {
-        #ifdef __HIP_DEVICE_COMPILE__
+        #if defined(ROCRAND_RUNTIME_JUMP_POLYNOMIALS)
+        jump_polynomial(offset, 0);
+        #elif defined(__HIP_DEVICE_COMPILE__)
         jump(offset, d_xorwow_jump_matrices);
         #else
         jump(offset, h_xorwow_jump_matrices);
@@ -148,7 +166,9 @@ public:
     __forceinline__ __device__ __host__ void discard_subsequence(unsigned long long subsequence)
     {
         // Discard n * 2^67 samples
-        #ifdef __HIP_DEVICE_COMPILE__
+        #if defined(ROCRAND_RUNTIME_JUMP_POLYNOMIALS)
+        jump_polynomial(subsequence, 67);
+        #elif defined(__HIP_DEVICE_COMPILE__)
         jump(subsequence, d_xorwow_sequence_jump_matrices);
         #else
         jump(subsequence, h_xorwow_sequence_jump_matrices);
@@ -163,6 +183,17 @@ public:
     }
 
     __forceinline__ __device__ __host__ unsigned int next()
+    {
+        discard_xorshift();
+
+        m_state.d += 362437;
+
+        return m_state.d + m_state.x[4];
+    }
+
+protected:
+    // Advances the xorshift values to the next state, the Weyl sequence value is not changed.
+    __forceinline__ __device__ __host__ void discard_xorshift()
     {
         const unsigned int t = m_state.x[0] ^ (m_state.x[0] >> 2);
         m_state.x[0] = m_state.x[1];
@@ -170,13 +201,73 @@ public:
         m_state.x[2] = m_state.x[3];
         m_state.x[3] = m_state.x[4];
         m_state.x[4] = (m_state.x[4] ^ (m_state.x[4] << 4)) ^ (t ^ (t << 1));
+    }
 
-        m_state.d += 362437;
+    __forceinline__ __device__ __host__ void discard_xorshift(unsigned int steps)
+    {
+        for(unsigned int i = 0; i < steps; i++)
+        {
+            discard_xorshift();
+        }
+    }
 
-        return m_state.d + m_state.x[4];
+    // Multiplies the xorshift values by the transition matrix evaluated at the polynomial
+    // (i.e. jumps ahead by the distance the polynomial was computed for).
+    __forceinline__ __device__ __host__ void jump(const unsigned int (&polynomial)[5])
+    {
+        unsigned int x[5] = {0, 0, 0, 0, 0};
+        for(unsigned int i = 0; i < 160; i++)
+        {
+            const unsigned int mask = 0U - ((polynomial[i / 32] >> (i % 32)) & 1U);
+            for(unsigned int k = 0; k < 5; k++)
+            {
+                x[k] ^= mask & m_state.x[k];
+            }
+            discard_xorshift();
+        }
+        for(unsigned int k = 0; k < 5; k++)
+        {
+            m_state.x[k] = x[k];
+        }
     }
 
-protected:
+    // Advances the xorshift values by v steps, \p polynomial is the jump polynomial of v.
+    // Evaluating a jump polynomial costs one step per bit of the state,
+    // so short skips are done step by step.
+    __forceinline__ __device__ __host__ void jump(unsigned long long v,
+                                                  const unsigned int (&polynomial)[5])
+    {
+        if(v < 160)
+        {
+            discard_xorshift(static_cast<unsigned int>(v));
+        }
+        else
+        {
+            jump(polynomial);
+        }
+    }
+
+    // Advances the xorshift values by v * 2^log2_multiplier steps with a jump polynomial
+    // that is computed here instead of the precomputed jump matrices.
+    __forceinline__ __device__ __host__ void jump_polynomial(unsigned long long v,
+                                                             unsigned int       log2_multiplier)
+    {
+        if(log2_multiplier == 0 && v < 160)
+        {
+            discard_xorshift(static_cast<unsigned int>(v));
+            return;
+        }
+        if(v == 0)
+        {
+            return;
+        }
+
+        unsigned int polynomial[5];
+        detail::xorwow_jump_polynomial(v, log2_multiplier, polynomial);
+        jump(polynomial);
+    }
+
+#ifndef ROCRAND_RUNTIME_JUMP_POLYNOMIALS
     __forceinline__ __device__ __host__ void
         jump(unsigned long long v,
              const unsigned int jump_matrices[XORWOW_JUMP_MATRICES][XORWOW_SIZE])
@@ -206,6 +297,7 @@ protected:
             v >>= XORWOW_JUMP_LOG2;
         }
     }
+#endif
 
 protected:
     // State
@@ -0,0 +1,306 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Based on the public domain reference implementation of xoshiro256++
+// by David Blackman and Sebastiano Vigna, see https://prng.di.unimi.it/
+
+#ifndef ROCRAND_XOSHIRO256PP_H_
+#define ROCRAND_XOSHIRO256PP_H_
+
+#include "rocrand/rocrand_common.h"
+#include "rocrand/rocrand_xoshiro_precomputed.h"
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+/**
+ * \def ROCRAND_XOSHIRO256PP_DEFAULT_SEED
+ * \brief Default seed for XOSHIRO256PP PRNG.
+ */
+#define ROCRAND_XOSHIRO256PP_DEFAULT_SEED 0ULL
+/** @} */ // end of group rocranddevice
+
+namespace rocrand_device
+{
+
+class xoshiro256pp_engine
+{
+public:
+    struct xoshiro256pp_state
+    {
+        ulonglong4 s;
+    };
+
+    __forceinline__ __device__ __host__ xoshiro256pp_engine()
+        : xoshiro256pp_engine(ROCRAND_XOSHIRO256PP_DEFAULT_SEED, 0, 0)
+    {}
+
+    /// Initializes the internal state of the PRNG using
+    /// seed value \p seed, goes to \p subsequence -th subsequence,
+    /// and skips \p offset random numbers.
+    ///
+    /// A subsequence is 2^128 numbers long.
+    __forceinline__ __device__ __host__ xoshiro256pp_engine(const unsigned long long seed,
+                                                            const unsigned long long subsequence,
+                                                            const unsigned long long offset)
+    {
+        this->seed(seed, subsequence, offset);
+    }
+
+    /// Reinitializes the internal state of the PRNG using new
+    /// seed value \p seed_value, skips \p subsequence subsequences
+    /// and \p offset random numbers.
+    ///
+    /// The 256-bit state is expanded from \p seed_value with SplitMix64,
+    /// so the state is never all zeros.
+    ///
+    /// A subsequence is 2^128 numbers long.
+    __forceinline__ __device__ __host__ void seed(unsigned long long       seed_value,
+                                                  const unsigned long long subsequence,
+                                                  const unsigned long long offset)
+    {
+        m_state.s.x = detail::splitmix64(seed_value);
+        m_state.s.y = detail::splitmix64(seed_value);
+        m_state.s.z = detail::splitmix64(seed_value);
+        m_state.s.w = detail::splitmix64(seed_value);
+
+        discard_subsequence(subsequence);
+        discard(offset);
+    }
+
+    /// Advances the internal state to skip one number.
+    __forceinline__ __device__ __host__ void discard()
+    {
+        discard_state();
+    }
+
+    /// Advances the internal state to skip \p offset numbers.
+    __forceinline__ __device__ __host__ void discard(unsigned long long offset)
+    {
+        // Evaluating a jump polynomial costs one step per bit of the state,
+        // so short skips are done step by step.
+        constexpr unsigned long long step_mask = XOSHIRO256_WORDS * 64 - 1;
+        for(unsigned int i = 0; i < (offset & step_mask); i++)
+        {
+            discard_state();
+        }
+#ifdef __HIP_DEVICE_COMPILE__
+        jump(offset & ~step_mask, d_xoshiro256pp_jump);
+#else
+        jump(offset & ~step_mask, h_xoshiro256pp_jump);
+#endif
+    }
+
+    /// Advances the internal state to skip \p subsequence subsequences.
+    /// A subsequence is 2^128 numbers long.
+    __forceinline__ __device__ __host__ void discard_subsequence(unsigned long long subsequence)
+    {
+#ifdef __HIP_DEVICE_COMPILE__
+        jump(subsequence, d_xoshiro256pp_subsequence_jump);
+#else
+        jump(subsequence, h_xoshiro256pp_subsequence_jump);
+#endif
+    }
+
+    /// Advances the internal state to skip \p sequence sequences.
+    /// A sequence is 2^192 numbers long.
+    __forceinline__ __device__ __host__ void discard_sequence(unsigned long long sequence)
+    {
+#ifdef __HIP_DEVICE_COMPILE__
+        jump(sequence, d_xoshiro256pp_sequence_jump);
+#else
+        jump(sequence, h_xoshiro256pp_sequence_jump);
+#endif
+    }
+
+    __forceinline__ __device__ __host__ unsigned long long operator()()
+    {
+        return next();
+    }
+
+    __forceinline__ __device__ __host__ unsigned long long next()
+    {
+        const unsigned long long result = rotl(m_state.s.x + m_state.s.w, 23) + m_state.s.x;
+        discard_state();
+        return result;
+    }
+
+protected:
+    // Advances the internal state to the next state.
+    __forceinline__ __device__ __host__ void discard_state()
+    {
+        const unsigned long long t = m_state.s.y << 17;
+
+        m_state.s.z ^= m_state.s.x;
+        m_state.s.w ^= m_state.s.y;
+        m_state.s.y ^= m_state.s.z;
+        m_state.s.x ^= m_state.s.w;
+
+        m_state.s.z ^= t;
+        m_state.s.w = rotl(m_state.s.w, 45);
+    }
+
+    // Multiplies the state by the transition matrix evaluated at the polynomial
+    // (i.e. jumps ahead by the power of x the polynomial is the remainder of).
+    __forceinline__ __device__ __host__ void
+        jump(const unsigned long long (&polynomial)[XOSHIRO256_WORDS])
+    {
+        ulonglong4 s = {0, 0, 0, 0};
+        for(unsigned int i = 0; i < XOSHIRO256_WORDS; i++)
+        {
+            for(unsigned int b = 0; b < 64; b++)
+            {
+                if(polynomial[i] & (1ULL << b))
+                {
+                    s.x ^= m_state.s.x;
+                    s.y ^= m_state.s.y;
+                    s.z ^= m_state.s.z;
+                    s.w ^= m_state.s.w;
+                }
+                discard_state();
+            }
+        }
+        m_state.s = s;
+    }
+
+    __forceinline__ __device__ __host__ void jump(
+        unsigned long long v,
+        const unsigned long long (&polynomials)[XOSHIRO256_JUMP_POLYNOMIALS][XOSHIRO256_WORDS])
+    {
+        // polynomials[i] is the jump polynomial for 2^i times the base distance,
+        // so a skip of v times the base distance is a product of the polynomials
+        // for the set bits of v.
+        for(unsigned int i = 0; v > 0; i++, v >>= 1)
+        {
+            if(v & 1)
+            {
+                jump(polynomials[i]);
+            }
+        }
+    }
+
+    static __forceinline__ __device__ __host__ unsigned long long rotl(const unsigned long long x,
+                                                                       const int                k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+protected:
+    xoshiro256pp_state m_state;
+
+}; // xoshiro256pp_engine class
+
+} // end namespace rocrand_device
+
+/** \rocrand_internal \addtogroup rocranddevice
+ *
+ *  @{
+ */
+
+/// \cond ROCRAND_KERNEL_DOCS_TYPEDEFS
+typedef rocrand_device::xoshiro256pp_engine rocrand_state_xoshiro256pp;
+/// \endcond
+
+/**
+ * \brief Initializes xoshiro256++ state.
+ *
+ * Initializes the xoshiro256++ generator \p state with the given
+ * \p seed, \p subsequence, and \p offset.
+ *
+ * \param seed Value to use as a seed
+ * \param subsequence Subsequence to start at
+ * \param offset Absolute offset into subsequence
+ * \param state Pointer to state to initialize
+ */
+__forceinline__ __device__ __host__
+void rocrand_init(const unsigned long long    seed,
+                  const unsigned long long    subsequence,
+                  const unsigned long long    offset,
+                  rocrand_state_xoshiro256pp* state)
+{
+    *state = rocrand_state_xoshiro256pp(seed, subsequence, offset);
+}
+
+/**
+ * \brief Returns uniformly distributed random <tt>unsigned long long</tt> value
+ * from [0; 2^64 - 1] range.
+ *
+ * Generates and returns uniformly distributed random <tt>unsigned long long</tt>
+ * value from [0; 2^64 - 1] range using xoshiro256++ generator in \p state.
+ * State is incremented by one position.
+ *
+ * \param state Pointer to a state to use
+ *
+ * \return Pseudorandom value (64-bit) as an <tt>unsigned long long</tt>
+ */
+__forceinline__ __device__ __host__
+unsigned long long rocrand(rocrand_state_xoshiro256pp* state)
+{
+    return state->next();
+}
+
+/**
+ * \brief Updates xoshiro256++ state to skip ahead by \p offset elements.
+ *
+ * Updates the xoshiro256++ state in \p state to skip ahead by \p offset elements.
+ *
+ * \param offset Number of elements to skip
+ * \param state Pointer to state to update
+ */
+__forceinline__ __device__ __host__
+void skipahead(unsigned long long offset, rocrand_state_xoshiro256pp* state)
+{
+    return state->discard(offset);
+}
+
+/**
+ * \brief Updates xoshiro256++ state to skip ahead by \p subsequence subsequences.
+ *
+ * Updates the xoshiro256++ \p state to skip ahead by \p subsequence subsequences.
+ * Each subsequence is 2^128 numbers long.
+ *
+ * \param subsequence Number of subsequences to skip
+ * \param state Pointer to state to update
+ */
+__forceinline__ __device__ __host__
+void skipahead_subsequence(unsigned long long subsequence, rocrand_state_xoshiro256pp* state)
+{
+    return state->discard_subsequence(subsequence);
+}
+
+/**
+ * \brief Updates xoshiro256++ state to skip ahead by \p sequence sequences.
+ *
+ * Updates the xoshiro256++ \p state to skip ahead by \p sequence sequences.
+ * Each sequence is 2^192 numbers long.
+ *
+ * \param sequence Number of sequences to skip
+ * \param state Pointer to state to update
+ */
+__forceinline__ __device__ __host__
+void skipahead_sequence(unsigned long long sequence, rocrand_state_xoshiro256pp* state)
+{
+    return state->discard_sequence(sequence);
+}
+
+/** @} */ // end of group rocranddevice
+
+#endif // ROCRAND_XOSHIRO256PP_H_
@@ -0,0 +1,861 @@
+// Copyright (c) 2023 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Auto-generated file. Do not edit!
+// Generated by tools/xoshiro_precomputed_generator
+
+#ifndef ROCRAND_XOSHIRO_PRECOMPUTED_H_
+#define ROCRAND_XOSHIRO_PRECOMPUTED_H_
+
+#define XOSHIRO256_WORDS 4
+#define XOSHIRO256_JUMP_POLYNOMIALS 64
+
+// clang-format off
+static const __device__ unsigned long long d_xoshiro256pp_jump[XOSHIRO256_JUMP_POLYNOMIALS][XOSHIRO256_WORDS] = {
+    {0x0000000000000002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL},
+    {0x0000000000000004ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL},
+    {0x0000000000000010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL},
+    {0x0000000000000100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL},
+    {0x0000000000010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL},
+    {0x0000000100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL},
+    {0x0000000000000000ULL, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL},
+    {0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000001ULL, 0x0000000000000000ULL},
+    {0x9d116f2bb0f0f001ULL, 0x0280002bcefd1a5eULL, 0x04b4edcf26259f85ULL, 0x0003c03c3f3ecb19ULL},
+    {0xc7327d130e34b489ULL, 0x81f675e7a4ef7d84ULL, 0x6dd49b656055c9daULL, 0xbe7976372e930435ULL},
+    {0x060106bbbe4ff028ULL, 0x1be1d76854ddda93ULL, 0x8456faeb6230d984ULL, 0x65507439cf43f0e2ULL},
+    {0x876c2301125a85c0ULL, 0x15fe822628b16f04ULL, 0x3c8ca36ec9a74fa7ULL, 0x51edef31819e01ffULL},
+    {0xd7f4e8da7e228b85ULL, 0xd638d47ec5bcf595ULL, 0xaa6eb691cbf9ce10ULL, 0x0f41cce3698fad39ULL},
+    {0x669da12373880674ULL, 0xb1df898a4a6f1548ULL, 0x32104b94fe2534d3ULL, 0xda66e09e52b341d1ULL},
+    {0x4f20eb915e780231ULL, 0x3886af219b885248ULL, 0x023ecbee3f717fceULL, 0x3cec2c375bef249cULL},
+    {0x449b3ae793888c8cULL, 0xc3ce2f061f077568ULL, 0xa69393ac0d837e54ULL, 0x1a9dcf944ae47603ULL},
+    {0x7e89ac5ca2fbf2c7ULL, 0x92ae7ca370c0bf6bULL, 0xef43beaa06f02fb8ULL, 0xd87f8ce230817a21ULL},
+    {0x6c4adbe18e29df8aULL, 0x54adade3697d477fULL, 0xf0c168649cdba61fULL, 0xbd53027696368bbbULL},
+    {0x1a673fecf40e36b8ULL, 0xf2c602feb5ed002bULL, 0x1ea49b5067452594ULL, 0xf78a97c0d882cd37ULL},
+    {0xef4606da56224c47ULL, 0x770323eab8d437bdULL, 0x590923d02ec52531ULL, 0x1639a36e0968e3c5ULL},
+    {0x31d9d05c5d95f3cdULL, 0x7cde241817a3ce0fULL, 0x2f679f694a74c76aULL, 0x8b3919a9d298a415ULL},
+    {0x6b6622ae9590047aULL, 0xeace6d3840b79fefULL, 0xd9b36372fd70ec83ULL, 0x624eb7b63c322e71ULL},
+    {0x1b91fd9ba98d9e23ULL, 0xeb2c7e29d3c33d2eULL, 0xcebbfd2ef4e9aff4ULL, 0x2bac5517c9469796ULL},
+    {0x01f356e6083fe109ULL, 0xba0ffb6562a3a28aULL, 0x657a6b736317866bULL, 0xfb678bd3e5dac186ULL},
+    {0xc5461100f197a7e8ULL, 0xe46916a1426b676dULL, 0xf3469dbb4fe25d26ULL, 0xf5c010059e83bc3fULL},
+    {0x22dc028cb8c259dcULL, 0x3eec4eb6495ce5aaULL, 0x5de3e273dc7b84dcULL, 0xe677849e207f6afdULL},
+    {0x832d418900fd3b0fULL, 0x114e10c3b7c36788ULL, 0xdf2332a778d9c8dcULL, 0x0d19a1bdceb7522cULL},
+    {0xe2d0c9c10e8d7157ULL, 0x8b3ed7c37e947e38ULL, 0x98273f4d18ad073eULL, 0xf38f7e750d5f4f2aULL},
+    {0xe7109518f3510d70ULL, 0x34f30137eadb90b9ULL, 0x6d48dd206d56754dULL, 0xafa9e3fe5fea15c3ULL},
+    {0x8ee774f507ec9f39ULL, 0xd7c26ebd51ecf6c4ULL, 0xc76a456d998ddc4cULL, 0x1ca234ff511bcb05ULL},
+    {0x4905d8261158a7bcULL, 0x352f8b5d2137de83ULL, 0xe0e9fa345826626dULL, 0x3e667662caa54d16ULL},
+    {0x272a32be4bac7912ULL, 0xe1185a166bb38173ULL, 0x82b9aa358fe2ed58ULL, 0xa43d37468704d536ULL},
+    {0x58120d583c112f69ULL, 0x7d8d0632bd08e6acULL, 0x214fafc0fbdbc208ULL, 0x0e055d3520fdb9d7ULL},
+    {0xd9eb3e225a9ebb7dULL, 0x5d33a22177777716ULL, 0xffed2ffbcf857b42ULL, 0xa1b7ebf581a90f09ULL},
+    {0x3a433a5cff8501f4ULL, 0x0c2e65cfa3a44f3bULL, 0xa59f09ab33f1c8f4ULL, 0x0afe97309a7881b0ULL},
+    {0x635e9c6882ce5c6aULL, 0x53a34398808ef457ULL, 0x94295f82142a68bdULL, 0xc1cdf918a717c897ULL},
+    {0x1a2c804af78e2ed4ULL, 0x306c4d371040af1eULL, 0x63d3f9df102dfa7eULL, 0xac7fe0806aecd6c8ULL},
+    {0x7743a154e17a5e9bULL, 0x7823a1cd9453899bULL, 0x976589eefbb1c7f5ULL, 0x702cf168260fa29eULL},
+    {0x2edfce1b0667bf3fULL, 0x68ef5242f2d9c5b2ULL, 0x03803bdb9ea7d7e8ULL, 0xc4671ec91b902baeULL},
+    {0x4d2c07a0b0f7980fULL, 0x0af3e6140fcff185ULL, 0xaf03bea7ea7109fdULL, 0x755b16e231d1e7c9ULL},
+    {0xd24b31ab16542ea0ULL, 0x13a31dc36460a3b0ULL, 0xeece73d85df18361ULL, 0x51fc9b8eb1974e73ULL},
+    {0xec9c79ebd62a4a91ULL, 0xa374bf9822d660aaULL, 0xde49d57f23fdecb5ULL, 0xfb43cf1f4658ae1bULL},
+    {0x7602414a37bf1c08ULL, 0x48b8b0570f008a91ULL, 0x3aa3d49368a9c562ULL, 0x9b48db8907d00f97ULL},
+    {0xf7569be74f972355ULL, 0x9e11e129fcced20eULL, 0xa6994477ec2d6d85ULL, 0x8ec1a9dd27957370ULL},
+    {0xc223943200d6e8a0ULL, 0x82f1f8d3ebd9baffULL, 0xf6c987b8eb4f76dbULL, 0xba8b1a7be4521854ULL},
+    {0xe226bff99e7f9d4fULL, 0xf6faaff592dc08c7ULL, 0xbad2e3487a438d37ULL, 0xa8f7de3ed772d2d2ULL},
+    {0x6322f95d362137f1ULL, 0xb006241469247fbdULL, 0x181d6c749bfc7e7bULL, 0x3c63f6f95954e65eULL},
+    {0xaa878816402dab5fULL, 0x69811136f33b48faULL, 0x0df6566ff12f17f4ULL, 0x81f450881b843692ULL},
+    {0xf11fb4faea62c7f1ULL, 0xf825539dee5e4763ULL, 0x474579292f705634ULL, 0x5f728be2c97e9066ULL},
+    {0xf18ac1f5eac5120eULL, 0x36d6c9bc4bcb56f5ULL, 0xec104b9942b386beULL, 0x5ff98760441a364cULL},
+    {0x12b825906ddc86afULL, 0x168b84ac131ea856ULL, 0xd1c440c801f3cddfULL, 0xb01e1ff4eb0b05f6ULL},
+    {0x5696a9ed59ffcbe3ULL, 0xb5bb35fe03c3158aULL, 0xf1ab1bce1577ad4eULL, 0x140bd5e4e00ffdaaULL},
+    {0x61507225f9f0e0faULL, 0x8eadd052a304405fULL, 0x49c2df736ebe9c68ULL, 0x5177664e86d5e31bULL},
+    {0x87aac36cc0c1abaeULL, 0xca120d886e8fdf33ULL, 0x5b8d5f58ce3357a7ULL, 0xa93a7aadeced9cd7ULL},
+    {0xd4eb47064a9ac499ULL, 0x2b95939579346af1ULL, 0xa6f4a2ea423cc2f6ULL, 0xd5372758d87157efULL},
+    {0x549bf83ef12aebc3ULL, 0x56df3905d6712eedULL, 0xb86994c9cb3059a5ULL, 0x7e0b8abe53e950f8ULL},
+    {0x0b32b0dbe851dd9dULL, 0x27cc40c1479b95dfULL, 0xc405c1164a3a6d49ULL, 0x0888f2c33969763bULL},
+    {0x920a67ed72aa1155ULL, 0x7e5cbd2047cefb5eULL, 0x31acd0e23e87d9d3ULL, 0xfecb2b39fb96f078ULL},
+    {0x9841d4c5510c4700ULL, 0x97a6c4a0d2cdf9acULL, 0x82f88d9e6b9b17c0ULL, 0xf643cc9255f06741ULL},
+    {0x30ac848541c0b04fULL, 0x55756dedb136961fULL, 0x65ba2fdf5fe59ed1ULL, 0xe8e07ed05188af0fULL},
+    {0xadcede280bb92b99ULL, 0x6d885bb5321527a7ULL, 0x04ad0ecd62544db2ULL, 0x679b88958f3bbdcbULL},
+    {0x84db0e338a94ce16ULL, 0xaaee46b89b106201ULL, 0xbbf25302a56d6131ULL, 0xd10d621b74213644ULL},
+    {0xed3c94e03147ca9bULL, 0x31fbe8b0a2035587ULL, 0x5083dee093b632b7ULL, 0x6ff477672ddf72b1ULL},
+    {0x936ece877e64cc97ULL, 0x22a36cdc0fda409fULL, 0xbae4d9a25a3928b9ULL, 0xa9559a2368719526ULL},
+};
+// clang-format on
+
+// clang-format off
+static const __device__ unsigned long long d_xoshiro256pp_subsequence_jump[XOSHIRO256_JUMP_POLYNOMIALS][XOSHIRO256_WORDS] = {
+    {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL},
+    {0x8cfe9bd9ab71d992ULL, 0xccfc8ca2814de79eULL, 0xa5a28cccb37dba5bULL, 0xa23e49ee6f1a7a8dULL},
+    {0x1b2a94a672a48c05ULL, 0x5e38f4fbb6fcda72ULL, 0xca8a45310219dc67ULL, 0xd4e9921bccb8090bULL},
+    {0xf30974a2b1dbbb71ULL, 0x34cd4cc8228d74acULL, 0xfa0587a90f717438ULL, 0xee658f69deb5df26ULL},
+    {0xb42bd4670583b289ULL, 0xd2c0d8e0c8a2fb9bULL, 0x2573e3218d8bb7daULL, 0xd7aaaf48aa459c58ULL},
+    {0xf6a5ab84efb67883ULL, 0xcc7efdcfed1ac303ULL, 0xd82be75b83dbc2d0ULL, 0x8fd437c01abeab24ULL},
+    {0xc85ee5171484f5a4ULL, 0xedc8b8d02a22310bULL, 0xb0b87a330b854c8aULL, 0x7d16742eceb4d5abULL},
+    {0x4298ba0e862a6007ULL, 0x4157dc48443e3565ULL, 0x13c97c0891cab48aULL, 0x6533981804b420eaULL},
+    {0xee5f5a6f02dfe47cULL, 0xedc28c89cb341660ULL, 0x613b2ed9f0acc107ULL, 0xa1ee335d14807ae0ULL},
+    {0x5ec3050c6b43565aULL, 0x4b26f71c1fb1b47bULL, 0x0531513e8e0ac706ULL, 0x799d469b2145a8a3ULL},
+    {0x34f0a6799020283eULL, 0x7123f2290a1f413bULL, 0xb6acd7be4906b73dULL, 0x6007bb31ec5a2964ULL},
+    {0xaa0711c54877febdULL, 0x54fe6df4cff0db73ULL, 0x7e42d6f544840499ULL, 0xec907801890a47abULL},
+    {0x03833e601d82a673ULL, 0x3ec263f5c999196eULL, 0xd8c4367e574ab160ULL, 0x964e9d188c16508eULL},
+    {0xd64f3f2aaf8f2171ULL, 0xf524fd4408357a5cULL, 0x15ac212f3b861b5aULL, 0x24d9ba21277dd8d8ULL},
+    {0xfe9b778d7d1ca2deULL, 0xbbe0e2c0c44b2e1cULL, 0x17a7af3e97d8c402ULL, 0xf89354cfe1e6b5fbULL},
+    {0x695cf225704e767dULL, 0xf4873d277cd1ab72ULL, 0xaad8c318bc459cceULL, 0xb89526857566cd94ULL},
+    {0x3dcd32f39276a95fULL, 0xc51212c8b1aa2787ULL, 0x962c90a866ea6719ULL, 0xb81875d0f4f6f253ULL},
+    {0xb43cf8e4eaf8e068ULL, 0x1c554e97b2277f47ULL, 0xa5a140826c351d07ULL, 0x11495a1b200d4eb8ULL},
+    {0x417b73b324735d32ULL, 0xff957b6f55288048ULL, 0x05af69bf1fb82891ULL, 0x3e53bfa0db28e110ULL},
+    {0xb6c7a6004612889cULL, 0xfdb3f4ea18f0a56bULL, 0xd3da65e82bdd39e2ULL, 0x48f6214560239b46ULL},
+    {0xf1267ba0ec3c645eULL, 0xd9dc0929a54fea75ULL, 0xec60b640d685171dULL, 0xde364ef64a484f59ULL},
+    {0x2761cbab38e0f580ULL, 0xd7f1c5ade3de404aULL, 0xcb6286958a9af01aULL, 0x2b29c7d3ef18d3b3ULL},
+    {0x5a5ce93f67a3cdd6ULL, 0x547db3576511edc2ULL, 0x99455c744595c01fULL, 0x6a3b6a431109e3d1ULL},
+    {0xafd80c1c832a739eULL, 0x0d9d73da9f40f374ULL, 0xed1d0a619aa60748ULL, 0x00d2333b0c03f620ULL},
+    {0x11428ceb13f2cc2cULL, 0xef46e42368baead3ULL, 0x2a47bd3fc39081daULL, 0x3f03458e0273439bULL},
+    {0x47558e815c898e8bULL, 0x9f8160e9d0124398ULL, 0x0fdcfd4ab0f5afeeULL, 0xade2626c292a2a9fULL},
+    {0xe848ff06d72a9252ULL, 0xf8be2d3d6ce206b0ULL, 0xd84fc5f798c1a55eULL, 0xc35abe5cebab1ba4ULL},
+    {0xb0dd0edb19af078cULL, 0xee1d857a675ca074ULL, 0x60ef7116e6f3c1e0ULL, 0x7c25b2c3282fb730ULL},
+    {0xb51a19064886308aULL, 0x6b590805d407e77eULL, 0x57059d3707ee283aULL, 0x6298f48fa13cc12fULL},
+    {0x4f1102acb29c3230ULL, 0xcf69cee6182fa164ULL, 0x1780be415c86b5d5ULL, 0xab5d0760d1fe77dcULL},
+    {0xc639b7c24b26ef11ULL, 0xa57d650a8007d505ULL, 0xd81275131f4f91f8ULL, 0x10000e5f7bf7a58bULL},
+    {0x295b23eaa04478edULL, 0xf1d3279f36823213ULL, 0x743eedc2ede6d478ULL, 0x09d89163f581d1e0ULL},
+    {0xc04b4f9c5d26c200ULL, 0x69e6e6e431a2d40bULL, 0x4823b45b89dc689cULL, 0xf567382197055bf0ULL},
+    {0x09f16c9da06c8a66ULL, 0xf32c270b20ce5f38ULL, 0xbe61763d20685d37ULL, 0xda01b157a2b021e9ULL},
+    {0xc6d70a8c6aec7778ULL, 0xaccd356978aafc8eULL, 0xa1fbf40a9936c15dULL, 0x9d7c0c2cf565896cULL},
+    {0x90c526d9d0b6773fULL, 0x327a229ce1248578ULL, 0xfbdcc8828b2c1889ULL, 0x592056e6bbf026f6ULL},
+    {0xa14aaaccc2890705ULL, 0xe63e390ab5f8a1a5ULL, 0x0fbd392d992b9686ULL, 0x746ea463d01f96a4ULL},
+    {0xd8cd74de1850f135ULL, 0x441424d88baa1859ULL, 0xb4bb676b08602d23ULL, 0x4d1dc582c66946beULL},
+    {0x2adbc6211da0644cULL, 0x994b90f8d7149b3dULL, 0x4b145a211d1fdfdfULL, 0x621c1b93e8fa1183ULL},
+    {0x2fd0c3d604d53cdfULL, 0x340889c14a3c5736ULL, 0x7bd5128045929790ULL, 0xfaf3fe8684e4e611ULL},
+    {0x01e53e1bc659d517ULL, 0x5f15699d4848bfccULL, 0x6d8bf975dcc01074ULL, 0x4a55ccb047f7ed1fULL},
+    {0x71ce8d56b9692c38ULL, 0x629372507db35e61ULL, 0xefcb70ac050d5190ULL, 0x929a14fdb0efb0b5ULL},
+    {0x27d627035f8c74a5ULL, 0xe890fcbab799d186ULL, 0xde5841dcae8e37bbULL, 0xcf9e9a1026630265ULL},
+    {0xb405010a26f11c18ULL, 0xfd3a5a8b24565256ULL, 0x9d53ec478a607c58ULL, 0xbfbcf2e3dee7abfaULL},
+    {0xb072a316838de4eeULL, 0x8f148500f69fe8f8ULL, 0xbc2ad4d4d5a4ecb8ULL, 0x20d9430de74248c9ULL},
+    {0x732bd9e5c94b916aULL, 0xa0851e63a9ec247cULL, 0x63eb42892a0f4361ULL, 0x6db40995b68e4c68ULL},
+    {0xe87d88258b7992ceULL, 0xb38ada6d1a5427baULL, 0x29f4387fbb3eebe2ULL, 0x08543e7ab4077f43ULL},
+    {0x6735bb34738c34f7ULL, 0x0a1db90231a55a32ULL, 0x7f05b87543072eb8ULL, 0x2281c456455c4a6dULL},
+    {0x053ff7e4e8581163ULL, 0x0b4df9e68366344aULL, 0x259022fe05f4023eULL, 0x2432aaa71d816e63ULL},
+    {0xfc89e47923390d01ULL, 0x81690de70406c5b2ULL, 0xdcdf361320fa2c0bULL, 0x065e8192b0d9e2abULL},
+    {0x54ae81c77079738dULL, 0xe3da1faabf2f681dULL, 0xfac68c11fe1e596cULL, 0x6f46880c9915650eULL},
+    {0x9350f3f8897dc5ccULL, 0x3ac1fea4d54d0710ULL, 0x70f4ef60d5dd3890ULL, 0x8de6f3aa90cec548ULL},
+    {0xe7b23f10622b3386ULL, 0xc22f28a3d0afc80bULL, 0xcb5512bde4e7bf59ULL, 0xf930e902851defa3ULL},
+    {0xcaefa30f55ce5c0fULL, 0x7bf0fe15bdc9337fULL, 0x7a55e55bbd72fb81ULL, 0xb05640b794289f31ULL},
+    {0x30121e7a60194d6aULL, 0xb8b27bb7572d2871ULL, 0x61d6cf653e616a08ULL, 0x0fa65f166fbb0db4ULL},
+    {0x646fe4bfa600d564ULL, 0x3444a78d93dffc9aULL, 0x1c46fb7ea0484857ULL, 0x7a974830be953c4aULL},
+    {0x0ffabb6c5ce8d644ULL, 0xbe489e3f8ac41534ULL, 0xb8f35b514eb14767ULL, 0x7691957a691df817ULL},
+    {0x5b16024d0563a65aULL, 0x83f997e75e88067fULL, 0xa9c11c5aaf2cab97ULL, 0x57f44892a2ad86eaULL},
+    {0xa6c7eee290c62375ULL, 0x7fe5c232f064f464ULL, 0x947c9b3af027e791ULL, 0x6062e8c7dc309cb2ULL},
+    {0x038e07e40a2812e1ULL, 0x52a29a371c84710fULL, 0x4c5bac1c57856ed7ULL, 0x2629bab11c98b6aeULL},
+    {0x637242c48b99b633ULL, 0x3e3494a05f161ecdULL, 0xc3f6fbf07e464327ULL, 0xaaa38210dde97c64ULL},
+    {0xc4d01c7eb078fd29ULL, 0xc188ca2c76798705ULL, 0x81d165297d239d2aULL, 0xd6e3b368fb2a3110ULL},
+    {0x7f90ffb775c02726ULL, 0xacfe2b03b09803d0ULL, 0x5a70368075759194ULL, 0x6309de7dbb3bf59dULL},
+    {0xf0f03027dfdc22d5ULL, 0x902b0ee66222acc7ULL, 0x78a3e873f00291edULL, 0xdb9d6b2d354321b4ULL},
+};
+// clang-format on
+
+// clang-format off
+static const __device__ unsigned long long d_xoshiro256pp_sequence_jump[XOSHIRO256_JUMP_POLYNOMIALS][XOSHIRO256_WORDS] = {
+    {0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL, 0x77710069854ee241ULL, 0x39109bb02acbe635ULL},
+    {0x85d1837e6f0cd3feULL, 0xa4b0488571edcb9dULL, 0xe9edb73cb3e9fb7cULL, 0xba70f1bd97fc40b0ULL},
+    {0xac54fa504c60e306ULL, 0x0b893c16e4a7f3b3ULL, 0xaff90eda09ea8b4cULL, 0x3727c275522644a7ULL},
+    {0x302eda308643ab47ULL, 0xc9a202b2322bb7f6ULL, 0xd4483ff9a9ac5a23ULL, 0x574e4d0093e3a2e4ULL},
+    {0x261882d92ec8429fULL, 0xabfffe7ac9ea1612ULL, 0x236417db3b031424ULL, 0xec6aa16a8ffc76faULL},
+    {0x52f6a62700009087ULL, 0xf7c39d8fc76906a3ULL, 0x285943d7fb75d765ULL, 0x88e5349d50f3ddefULL},
+    {0x3facc68ed0053ac4ULL, 0xfc0c646fb82afcebULL, 0xf055378c576c5c9aULL, 0x21588c86cc534c29ULL},
+    {0xfe596054913ed407ULL, 0x3d38ff4fc965c1faULL, 0x776751b126655d13ULL, 0x443c1363fd5c7d43ULL},
+    {0x1a672a03c71adc2eULL, 0x6217b3306e3e9557ULL, 0x163160efcad9c046ULL, 0x5243e79672334390ULL},
+    {0x58ce1e7d6ea9281fULL, 0x5348b64c107873b6ULL, 0xdabe97e1dd9a59c1ULL, 0x2dcec71c419baa62ULL},
+    {0x955659c7b8793ecfULL, 0x37fae57370f8bc19ULL, 0xfba1683b54b1e0f6ULL, 0xe91553475948d23eULL},
+    {0xbb5b5c8aa1ad89e1ULL, 0x9d7c00c8471ddc07ULL, 0xa910bdeff21ce218ULL, 0x540fca0570720eb7ULL},
+    {0x0612914f1b46c912ULL, 0x6d8abce0cf641cfcULL, 0x32f22fb19ac4550bULL, 0xc4b65c3551c83c69ULL},
+    {0x536e6114e4189cfcULL, 0xbe100596c8da9541ULL, 0xee7eb44f2fdbd1b8ULL, 0xb1170d0754beeaa4ULL},
+    {0xbeb789dbbc4ea209ULL, 0x267d7103ef9f83a3ULL, 0x93f548c2cab0a32cULL, 0x45cac579389af5caULL},
+    {0x65ceb6cde220e757ULL, 0xd6f9074a4c2732f7ULL, 0xa8e0425b0d01cd1eULL, 0x2b75c5d185461341ULL},
+    {0xafbacb099d1967bdULL, 0x1af87374102c1031ULL, 0x470868184fcc3f5fULL, 0x114dcbb43b155057ULL},
+    {0x5f98e9b5ad62427dULL, 0xf27e722d27743cd9ULL, 0x7ebe95d47cd1daf2ULL, 0x1b98494373c20b8aULL},
+    {0x8f1d0f5ec26521a6ULL, 0x036e9886f63c9933ULL, 0x4ac6fab0688e4ccdULL, 0x93d03eea25d1d816ULL},
+    {0xdd4e745e4412a26aULL, 0xbb62b24404a1be96ULL, 0x9c227b5ba376faeeULL, 0x08615908bcc4c8f2ULL},
+    {0xebe0d315a9cb279bULL, 0xc7a967d45d82bbcaULL, 0x64d85cc844957794ULL, 0xf6a1ef6a7d3b2545ULL},
+    {0x29bfb1bdc678fcbeULL, 0x611e5aedd44a4fd4ULL, 0xd188547deb3f0136ULL, 0x2b8dd348e0f767aeULL},
+    {0xfad25fa87d091580ULL, 0x5154a018eba8e309ULL, 0xbd9b522fb9f15d0bULL, 0xfcd653bc999d276bULL},
+    {0x29c79a4cedb3baf2ULL, 0x946592914b67e34fULL, 0x04921932aaf82150ULL, 0xb36394657868f06eULL},
+    {0x6cbfcd64bf69402cULL, 0xca9a2b49a6e6b16dULL, 0xba835279ffb6a358ULL, 0xfbdf21da0bb9add0ULL},
+    {0x23436782d086ca23ULL, 0x0cf66f05d413a46dULL, 0xbb90914a9c9871a3ULL, 0xedcce16aeb59e5adULL},
+    {0x130e23fa572004a9ULL, 0xf9ce20dec18c4b44ULL, 0x5cea7b8a1ac11de9ULL, 0x6608d757c7d36be3ULL},
+    {0x70c7a48f09b95bb9ULL, 0xd03a1ed309668f2fULL, 0xa955e448a10873d4ULL, 0xd5d4c6699513858fULL},
+    {0x72015cf80ce336f4ULL, 0x619c9d98f6f33bcbULL, 0x59f1b7e5d5fbfdc3ULL, 0x16cac53fc2905146ULL},
+    {0x5f340fcb5be19401ULL, 0xce2129cd34ae493aULL, 0x14690cfa36c329edULL, 0xc6e96787aedc5c40ULL},
+    {0x7ad9f632881e960fULL, 0xb8052dcca0e13395ULL, 0xd457241f6a9863acULL, 0xf8d2e75e66d53d83ULL},
+    {0x23336699f63c8e45ULL, 0x33b2e33e1d4e5bdbULL, 0x37fdeee585fdcd8eULL, 0x9a5144da7f765fd8ULL},
+    {0x0c7840cbc3b121adULL, 0xd317530723ab526aULL, 0xf31d2e03157bc387ULL, 0xa2b5d83a373c7ac2ULL},
+    {0x47b3063d7d254e4cULL, 0xea7c37e6ee511ddfULL, 0x0b50e1ab78926eefULL, 0x3ff3ff3e9168fd71ULL},
+    {0x2c56cd0f48e4587dULL, 0x4c77464d80c69c23ULL, 0xcbbf60dca92d32deULL, 0x6021ef776e85bae8ULL},
+    {0xe3521a7cbf37c2a1ULL, 0xa5130e508b35bcf2ULL, 0xf308dc3d84a999f1ULL, 0x601a299a0bbe06e1ULL},
+    {0xde3439ebd3e4fcefULL, 0x5b1dcb68d8e77159ULL, 0xb00b42e8b528bff6ULL, 0x9b121812c345eb87ULL},
+    {0x07eb2f053805555cULL, 0xa7f205f341a367e5ULL, 0x5d5d85d95fc59359ULL, 0x057f094f242a8701ULL},
+    {0x2e990fa0b86f494dULL, 0x5d3d62bea3d0c982ULL, 0x2be3af695f4ca02dULL, 0xcc92a4a3521dba28ULL},
+    {0xdd8082fb069d5ee7ULL, 0x7dc029224f1676fbULL, 0x65e7ab91abe659d0ULL, 0x04fb453c7ad02c02ULL},
+    {0x90b632d403b4513cULL, 0x0f186a740aaa16b5ULL, 0xb93a0637f3af87f7ULL, 0x3910377fe08e48a3ULL},
+    {0xcafe235cd7fe7ef0ULL, 0x5f1e003e1d3a7dafULL, 0x7f5505759890b722ULL, 0xf2f7c89f1379cf05ULL},
+    {0x5a252ed34d09cd4fULL, 0xe8f150b98011d5feULL, 0x131bf6c475e29db1ULL, 0x07818fb0f5b0ff11ULL},
+    {0x0441124ba35b2f58ULL, 0x9d4b489eae71f97dULL, 0x50fa45528d32be3aULL, 0xce8349b10acdabcaULL},
+    {0xade4816bccf327acULL, 0xc14a5bff8ad78a52ULL, 0x4cc84cfe14a77c57ULL, 0x183c124cf3d64e0bULL},
+    {0x4dbeffc02ebf0904ULL, 0xc3b545955dbab803ULL, 0xb7fa51c1fe79c53bULL, 0x688b6947de87d7e9ULL},
+    {0x2f5b386d0a416de5ULL, 0xdd87232f5cca256aULL, 0x7ba82a958b9e6a9aULL, 0x2c55c09810b2f548ULL},
+    {0xf75f6b5cec404580ULL, 0x8f0aa8baea9011fdULL, 0x1221c7c14b1db112ULL, 0x1d8ee30bc2f88017ULL},
+    {0xd18562b8cfa0694fULL, 0xba5487bfcecce199ULL, 0xde5eb81978735ad0ULL, 0x33a1c005e4ccc286ULL},
+    {0xdca75eca4474cbe5ULL, 0x0388cd9f71f314e3ULL, 0xd4699ceb082644c3ULL, 0x1271254993f074aaULL},
+    {0x1c493fa07fa74dcdULL, 0xb59cd5fcb429c2a9ULL, 0x3e550b09e8493d84ULL, 0x516fabbf03d78293ULL},
+    {0xe6d4233d77a1930dULL, 0x00424fa384fbe6eeULL, 0x4c636e19b68da5afULL, 0x140c9813f8542a71ULL},
+    {0xbea7da1e4eabfb2cULL, 0x271441e275aceb6bULL, 0x00ef11ecb78fd7ddULL, 0x3564fd80ea4578c1ULL},
+    {0xaf64e36a267033fdULL, 0xb86eb7a249850b0fULL, 0x9a888e9f318a8efeULL, 0x734c58deea6bd24bULL},
+    {0x30765a1ca7975996ULL, 0xeb222e5b91776decULL, 0x27e74ceb6b5c8a44ULL, 0xaea3b00f90869cf7ULL},
+    {0xc41171736f6127bdULL, 0xbbe041e1a6089bafULL, 0x623b0619adb26e6bULL, 0xc119ec86604ac1deULL},
+    {0xcc48029f3903aa23ULL, 0xddf1854fc56579d8ULL, 0xaa69f6bbf9bfebccULL, 0xfc1385169b03eb72ULL},
+    {0x409b2e169eb1bbfaULL, 0x771b06055d169793ULL, 0x47bf1babcb2b82f5ULL, 0xace055588e22fd26ULL},
+    {0x01731918ee54abd6ULL, 0x759a7ec7f27f3792ULL, 0xb4d6164f3e9d573eULL, 0xb604b97729a3c214ULL},
+    {0x1a22142b7cc54bcfULL, 0x43461d4569c23fa4ULL, 0x8d7ff0d4f4fb9470ULL, 0x1a825a9fac612b54ULL},
+    {0x39da610606e0e771ULL, 0x4566a69758dd856dULL, 0x1c60396a2c51aa0bULL, 0xf418b6ce5a857da3ULL},
+    {0xdfca68648b28c5afULL, 0xb56437fb2b753802ULL, 0xebb82aacdf6ca80dULL, 0xa170e108788db093ULL},
+    {0xde5b821c4a3d86e8ULL, 0x861fffe004c85acaULL, 0x3413838181a6096fULL, 0x460de3bdbe1cb3acULL},
+    {0x5b7b491f49ccffccULL, 0xae7f8689b0bbd6a0ULL, 0x13865b737d9739bcULL, 0x6c132e0c5374c916ULL},
+};
+// clang-format on
+
+// clang-format off
+static const unsigned long long h_xoshiro256pp_jump[XOSHIRO256_JUMP_POLYNOMIALS][XOSHIRO256_WORDS] = {
+    {0x0000000000000002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL},
+    {0x0000000000000004ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL},
+    {0x0000000000000010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL},
+    {0x0000000000000100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL},
+    {0x0000000000010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL},
+    {0x0000000100000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL},
+    {0x0000000000000000ULL, 0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL},
+    {0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000001ULL, 0x0000000000000000ULL},
+    {0x9d116f2bb0f0f001ULL, 0x0280002bcefd1a5eULL, 0x04b4edcf26259f85ULL, 0x0003c03c3f3ecb19ULL},
+    {0xc7327d130e34b489ULL, 0x81f675e7a4ef7d84ULL, 0x6dd49b656055c9daULL, 0xbe7976372e930435ULL},
+    {0x060106bbbe4ff028ULL, 0x1be1d76854ddda93ULL, 0x8456faeb6230d984ULL, 0x65507439cf43f0e2ULL},
+    {0x876c2301125a85c0ULL, 0x15fe822628b16f04ULL, 0x3c8ca36ec9a74fa7ULL, 0x51edef31819e01ffULL},
+    {0xd7f4e8da7e228b85ULL, 0xd638d47ec5bcf595ULL, 0xaa6eb691cbf9ce10ULL, 0x0f41cce3698fad39ULL},
+    {0x669da12373880674ULL, 0xb1df898a4a6f1548ULL, 0x32104b94fe2534d3ULL, 0xda66e09e52b341d1ULL},
+    {0x4f20eb915e780231ULL, 0x3886af219b885248ULL, 0x023ecbee3f717fceULL, 0x3cec2c375bef249cULL},
+    {0x449b3ae793888c8cULL, 0xc3ce2f061f077568ULL, 0xa69393ac0d837e54ULL, 0x1a9dcf944ae47603ULL},
+    {0x7e89ac5ca2fbf2c7ULL, 0x92ae7ca370c0bf6bULL, 0xef43beaa06f02fb8ULL, 0xd87f8ce230817a21ULL},
+    {0x6c4adbe18e29df8aULL, 0x54adade3697d477fULL, 0xf0c168649cdba61fULL, 0xbd53027696368bbbULL},
+    {0x1a673fecf40e36b8ULL, 0xf2c602feb5ed002bULL, 0x1ea49b5067452594ULL, 0xf78a97c0d882cd37ULL},
+    {0xef4606da56224c47ULL, 0x770323eab8d437bdULL, 0x590923d02ec52531ULL, 0x1639a36e0968e3c5ULL},
+    {0x31d9d05c5d95f3cdULL, 0x7cde241817a3ce0fULL, 0x2f679f694a74c76aULL, 0x8b3919a9d298a415ULL},
+    {0x6b6622ae9590047aULL, 0xeace6d3840b79fefULL, 0xd9b36372fd70ec83ULL, 0x624eb7b63c322e71ULL},
+    {0x1b91fd9ba98d9e23ULL, 0xeb2c7e29d3c33d2eULL, 0xcebbfd2ef4e9aff4ULL, 0x2bac5517c9469796ULL},
+    {0x01f356e6083fe109ULL, 0xba0ffb6562a3a28aULL, 0x657a6b736317866bULL, 0xfb678bd3e5dac186ULL},
+    {0xc5461100f197a7e8ULL, 0xe46916a1426b676dULL, 0xf3469dbb4fe25d26ULL, 0xf5c010059e83bc3fULL},
+    {0x22dc028cb8c259dcULL, 0x3eec4eb6495ce5aaULL, 0x5de3e273dc7b84dcULL, 0xe677849e207f6afdULL},
+    {0x832d418900fd3b0fULL, 0x114e10c3b7c36788ULL, 0xdf2332a778d9c8dcULL, 0x0d19a1bdceb7522cULL},
+    {0xe2d0c9c10e8d7157ULL, 0x8b3ed7c37e947e38ULL, 0x98273f4d18ad073eULL, 0xf38f7e750d5f4f2aULL},
+    {0xe7109518f3510d70ULL, 0x34f30137eadb90b9ULL, 0x6d48dd206d56754dULL, 0xafa9e3fe5fea15c3ULL},
+    {0x8ee774f507ec9f39ULL, 0xd7c26ebd51ecf6c4ULL, 0xc76a456d998ddc4cULL, 0x1ca234ff511bcb05ULL},
+    {0x4905d8261158a7bcULL, 0x352f8b5d2137de83ULL, 0xe0e9fa345826626dULL, 0x3e667662caa54d16ULL},
+    {0x272a32be4bac7912ULL, 0xe1185a166bb38173ULL, 0x82b9aa358fe2ed58ULL, 0xa43d37468704d536ULL},
+    {0x58120d583c112f69ULL, 0x7d8d0632bd08e6acULL, 0x214fafc0fbdbc208ULL, 0x0e055d3520fdb9d7ULL},
+    {0xd9eb3e225a9ebb7dULL, 0x5d33a22177777716ULL, 0xffed2ffbcf857b42ULL, 0xa1b7ebf581a90f09ULL},
+    {0x3a433a5cff8501f4ULL, 0x0c2e65cfa3a44f3bULL, 0xa59f09ab33f1c8f4ULL, 0x0afe97309a7881b0ULL},
+    {0x635e9c6882ce5c6aULL, 0x53a34398808ef457ULL, 0x94295f82142a68bdULL, 0xc1cdf918a717c897ULL},
+    {0x1a2c804af78e2ed4ULL, 0x306c4d371040af1eULL, 0x63d3f9df102dfa7eULL, 0xac7fe0806aecd6c8ULL},
+    {0x7743a154e17a5e9bULL, 0x7823a1cd9453899bULL, 0x976589eefbb1c7f5ULL, 0x702cf168260fa29eULL},
+    {0x2edfce1b0667bf3fULL, 0x68ef5242f2d9c5b2ULL, 0x03803bdb9ea7d7e8ULL, 0xc4671ec91b902baeULL},
+    {0x4d2c07a0b0f7980fULL, 0x0af3e6140fcff185ULL, 0xaf03bea7ea7109fdULL, 0x755b16e231d1e7c9ULL},
+    {0xd24b31ab16542ea0ULL, 0x13a31dc36460a3b0ULL, 0xeece73d85df18361ULL, 0x51fc9b8eb1974e73ULL},
+    {0xec9c79ebd62a4a91ULL, 0xa374bf9822d660aaULL, 0xde49d57f23fdecb5ULL, 0xfb43cf1f4658ae1bULL},
+    {0x7602414a37bf1c08ULL, 0x48b8b0570f008a91ULL, 0x3aa3d49368a9c562ULL, 0x9b48db8907d00f97ULL},
+    {0xf7569be74f972355ULL, 0x9e11e129fcced20eULL, 0xa6994477ec2d6d85ULL, 0x8ec1a9dd27957370ULL},
+    {0xc223943200d6e8a0ULL, 0x82f1f8d3ebd9baffULL, 0xf6c987b8eb4f76dbULL, 0xba8b1a7be4521854ULL},
+    {0xe226bff99e7f9d4fULL, 0xf6faaff592dc08c7ULL, 0xbad2e3487a438d37ULL, 0xa8f7de3ed772d2d2ULL},
+    {0x6322f95d362137f1ULL, 0xb006241469247fbdULL, 0x181d6c749bfc7e7bULL, 0x3c63f6f95954e65eULL},
+    {0xaa878816402dab5fULL, 0x69811136f33b48faULL, 0x0df6566ff12f17f4ULL, 0x81f450881b843692ULL},
+    {0xf11fb4faea62c7f1ULL, 0xf825539dee5e4763ULL, 0x474579292f705634ULL, 0x5f728be2c97e9066ULL},
+    {0xf18ac1f5eac5120eULL, 0x36d6c9bc4bcb56f5ULL, 0xec104b9942b386beULL, 0x5ff98760441a364cULL},
+    {0x12b825906ddc86afULL, 0x168b84ac131ea856ULL, 0xd1c440c801f3cddfULL, 0xb01e1ff4eb0b05f6ULL},
+    {0x5696a9ed59ffcbe3ULL, 0xb5bb35fe03c3158aULL, 0xf1ab1bce1577ad4eULL, 0x140bd5e4e00ffdaaULL},
+    {0x61507225f9f0e0faULL, 0x8eadd052a304405fULL, 0x49c2df736ebe9c68ULL, 0x5177664e86d5e31bULL},
+    {0x87aac36cc0c1abaeULL, 0xca120d886e8fdf33ULL, 0x5b8d5f58ce3357a7ULL, 0xa93a7aadeced9cd7ULL},
+    {0xd4eb47064a9ac499ULL, 0x2b95939579346af1ULL, 0xa6f4a2ea423cc2f6ULL, 0xd5372758d87157efULL},
+    {0x549bf83ef12aebc3ULL, 0x56df3905d6712eedULL, 0xb86994c9cb3059a5ULL, 0x7e0b8abe53e950f8ULL},
+    {0x0b32b0dbe851dd9dULL, 0x27cc40c1479b95dfULL, 0xc405c1164a3a6d49ULL, 0x0888f2c33969763bULL},
+    {0x920a67ed72aa1155ULL, 0x7e5cbd2047cefb5eULL, 0x31acd0e23e87d9d3ULL, 0xfecb2b39fb96f078ULL},
+    {0x9841d4c5510c4700ULL, 0x97a6c4a0d2cdf9acULL, 0x82f88d9e6b9b17c0ULL, 0xf643cc9255f06741ULL},
+    {0x30ac848541c0b04fULL, 0x55756dedb136961fULL, 0x65ba2fdf5fe59ed1ULL, 0xe8e07ed05188af0fULL},
+    {0xadcede280bb92b99ULL, 0x6d885bb5321527a7ULL, 0x04ad0ecd62544db2ULL, 0x679b88958f3bbdcbULL},
+    {0x84db0e338a94ce16ULL, 0xaaee46b89b106201ULL, 0xbbf25302a56d6131ULL, 0xd10d621b74213644ULL},
+    {0xed3c94e03147ca9bULL, 0x31fbe8b0a2035587ULL, 0x5083dee093b632b7ULL, 0x6ff477672ddf72b1ULL},
+    {0x936ece877e64cc97ULL, 0x22a36cdc0fda409fULL, 0xbae4d9a25a3928b9ULL, 0xa9559a2368719526ULL},
+};
+// clang-format on
+
+// clang-format off
+static const unsigned long long h_xoshiro256pp_subsequence_jump[XOSHIRO256_JUMP_POLYNOMIALS][XOSHIRO256_WORDS] = {
+    {0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL, 0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL},
+    {0x8cfe9bd9ab71d992ULL, 0xccfc8ca2814de79eULL, 0xa5a28cccb37dba5bULL, 0xa23e49ee6f1a7a8dULL},
+    {0x1b2a94a672a48c05ULL, 0x5e38f4fbb6fcda72ULL, 0xca8a45310219dc67ULL, 0xd4e9921bccb8090bULL},
+    {0xf30974a2b1dbbb71ULL, 0x34cd4cc8228d74acULL, 0xfa0587a90f717438ULL, 0xee658f69deb5df26ULL},
+    {0xb42bd4670583b289ULL, 0xd2c0d8e0c8a2fb9bULL, 0x2573e3218d8bb7daULL, 0xd7aaaf48aa459c58ULL},
+    {0xf6a5ab84efb67883ULL, 0xcc7efdcfed1ac303ULL, 0xd82be75b83dbc2d0ULL, 0x8fd437c01abeab24ULL},
+    {0xc85ee5171484f5a4ULL, 0xedc8b8d02a22310bULL, 0xb0b87a330b854c8aULL, 0x7d16742eceb4d5abULL},
+    {0x4298ba0e862a6007ULL, 0x4157dc48443e3565ULL, 0x13c97c0891cab48aULL, 0x6533981804b420eaULL},
+    {0xee5f5a6f02dfe47cULL, 0xedc28c89cb341660ULL, 0x613b2ed9f0acc107ULL, 0xa1ee335d14807ae0ULL},
+    {0x5ec3050c6b43565aULL, 0x4b26f71c1fb1b47bULL, 0x0531513e8e0ac706ULL, 0x799d469b2145a8a3ULL},
+    {0x34f0a6799020283eULL, 0x7123f2290a1f413bULL, 0xb6acd7be4906b73dULL, 0x6007bb31ec5a2964ULL},
+    {0xaa0711c54877febdULL, 0x54fe6df4cff0db73ULL, 0x7e42d6f544840499ULL, 0xec907801890a47abULL},
+    {0x03833e601d82a673ULL, 0x3ec263f5c999196eULL, 0xd8c4367e574ab160ULL, 0x964e9d188c16508eULL},
+    {0xd64f3f2aaf8f2171ULL, 0xf524fd4408357a5cULL, 0x15ac212f3b861b5aULL, 0x24d9ba21277dd8d8ULL},
+    {0xfe9b778d7d1ca2deULL, 0xbbe0e2c0c44b2e1cULL, 0x17a7af3e97d8c402ULL, 0xf89354cfe1e6b5fbULL},
+    {0x695cf225704e767dULL, 0xf4873d277cd1ab72ULL, 0xaad8c318bc459cceULL, 0xb89526857566cd94ULL},
+    {0x3dcd32f39276a95fULL, 0xc51212c8b1aa2787ULL, 0x962c90a866ea6719ULL, 0xb81875d0f4f6f253ULL},
+    {0xb43cf8e4eaf8e068ULL, 0x1c554e97b2277f47ULL, 0xa5a140826c351d07ULL, 0x11495a1b200d4eb8ULL},
+    {0x417b73b324735d32ULL, 0xff957b6f55288048ULL, 0x05af69bf1fb82891ULL, 0x3e53bfa0db28e110ULL},
+    {0xb6c7a6004612889cULL, 0xfdb3f4ea18f0a56bULL, 0xd3da65e82bdd39e2ULL, 0x48f6214560239b46ULL},
+    {0xf1267ba0ec3c645eULL, 0xd9dc0929a54fea75ULL, 0xec60b640d685171dULL, 0xde364ef64a484f59ULL},
+    {0x2761cbab38e0f580ULL, 0xd7f1c5ade3de404aULL, 0xcb6286958a9af01aULL, 0x2b29c7d3ef18d3b3ULL},
+    {0x5a5ce93f67a3cdd6ULL, 0x547db3576511edc2ULL, 0x99455c744595c01fULL, 0x6a3b6a431109e3d1ULL},
+    {0xafd80c1c832a739eULL, 0x0d9d73da9f40f374ULL, 0xed1d0a619aa60748ULL, 0x00d2333b0c03f620ULL},
+    {0x11428ceb13f2cc2cULL, 0xef46e42368baead3ULL, 0x2a47bd3fc39081daULL, 0x3f03458e0273439bULL},
+    {0x47558e815c898e8bULL, 0x9f8160e9d0124398ULL, 0x0fdcfd4ab0f5afeeULL, 0xade2626c292a2a9fULL},
+    {0xe848ff06d72a9252ULL, 0xf8be2d3d6ce206b0ULL, 0xd84fc5f798c1a55eULL, 0xc35abe5cebab1ba4ULL},
+    {0xb0dd0edb19af078cULL, 0xee1d857a675ca074ULL, 0x60ef7116e6f3c1e0ULL, 0x7c25b2c3282fb730ULL},
+    {0xb51a19064886308aULL, 0x6b590805d407e77eULL, 0x57059d3707ee283aULL, 0x6298f48fa13cc12fULL},
+    {0x4f1102acb29c3230ULL, 0xcf69cee6182fa164ULL, 0x1780be415c86b5d5ULL, 0xab5d0760d1fe77dcULL},
+    {0xc639b7c24b26ef11ULL, 0xa57d650a8007d505ULL, 0xd81275131f4f91f8ULL, 0x10000e5f7bf7a58bULL},
+    {0x295b23eaa04478edULL, 0xf1d3279f36823213ULL, 0x743eedc2ede6d478ULL, 0x09d89163f581d1e0ULL},
+    {0xc04b4f9c5d26c200ULL, 0x69e6e6e431a2d40bULL, 0x4823b45b89dc689cULL, 0xf567382197055bf0ULL},
+    {0x09f16c9da06c8a66ULL, 0xf32c270b20ce5f38ULL, 0xbe61763d20685d37ULL, 0xda01b157a2b021e9ULL},
+    {0xc6d70a8c6aec7778ULL, 0xaccd356978aafc8eULL, 0xa1fbf40a9936c15dULL, 0x9d7c0c2cf565896cULL},
+    {0x90c526d9d0b6773fULL, 0x327a229ce1248578ULL, 0xfbdcc8828b2c1889ULL, 0x592056e6bbf026f6ULL},
+    {0xa14aaaccc2890705ULL, 0xe63e390ab5f8a1a5ULL, 0x0fbd392d992b9686ULL, 0x746ea463d01f96a4ULL},
+    {0xd8cd74de1850f135ULL, 0x441424d88baa1859ULL, 0xb4bb676b08602d23ULL, 0x4d1dc582c66946beULL},
+    {0x2adbc6211da0644cULL, 0x994b90f8d7149b3dULL, 0x4b145a211d1fdfdfULL, 0x621c1b93e8fa1183ULL},
+    {0x2fd0c3d604d53cdfULL, 0x340889c14a3c5736ULL, 0x7bd5128045929790ULL, 0xfaf3fe8684e4e611ULL},
+    {0x01e53e1bc659d517ULL, 0x5f15699d4848bfccULL, 0x6d8bf975dcc01074ULL, 0x4a55ccb047f7ed1fULL},
+    {0x71ce8d56b9692c38ULL, 0x629372507db35e61ULL, 0xefcb70ac050d5190ULL, 0x929a14fdb0efb0b5ULL},
+    {0x27d627035f8c74a5ULL, 0xe890fcbab799d186ULL, 0xde5841dcae8e37bbULL, 0xcf9e9a1026630265ULL},
+    {0xb405010a26f11c18ULL, 0xfd3a5a8b24565256ULL, 0x9d53ec478a607c58ULL, 0xbfbcf2e3dee7abfaULL},
+    {0xb072a316838de4eeULL, 0x8f148500f69fe8f8ULL, 0xbc2ad4d4d5a4ecb8ULL, 0x20d9430de74248c9ULL},
+    {0x732bd9e5c94b916aULL, 0xa0851e63a9ec247cULL, 0x63eb42892a0f4361ULL, 0x6db40995b68e4c68ULL},
+    {0xe87d88258b7992ceULL, 0xb38ada6d1a5427baULL, 0x29f4387fbb3eebe2ULL, 0x08543e7ab4077f43ULL},
+    {0x6735bb34738c34f7ULL, 0x0a1db90231a55a32ULL, 0x7f05b87543072eb8ULL, 0x2281c456455c4a6dULL},
+    {0x053ff7e4e8581163ULL, 0x0b4df9e68366344aULL, 0x259022fe05f4023eULL, 0x2432aaa71d816e63ULL},
+    {0xfc89e47923390d01ULL, 0x81690de70406c5b2ULL, 0xdcdf361320fa2c0bULL, 0x065e8192b0d9e2abULL},
+    {0x54ae81c77079738dULL, 0xe3da1faabf2f681dULL, 0xfac68c11fe1e596cULL, 0x6f46880c9915650eULL},
+    {0x9350f3f8897dc5ccULL, 0x3ac1fea4d54d0710ULL, 0x70f4ef60d5dd3890ULL, 0x8de6f3aa90cec548ULL},
+    {0xe7b23f10622b3386ULL, 0xc22f28a3d0afc80bULL, 0xcb5512bde4e7bf59ULL, 0xf930e902851defa3ULL},
+    {0xcaefa30f55ce5c0fULL, 0x7bf0fe15bdc9337fULL, 0x7a55e55bbd72fb81ULL, 0xb05640b794289f31ULL},
+    {0x30121e7a60194d6aULL, 0xb8b27bb7572d2871ULL, 0x61d6cf653e616a08ULL, 0x0fa65f166fbb0db4ULL},
+    {0x646fe4bfa600d564ULL, 0x3444a78d93dffc9aULL, 0x1c46fb7ea0484857ULL, 0x7a974830be953c4aULL},
+    {0x0ffabb6c5ce8d644ULL, 0xbe489e3f8ac41534ULL, 0xb8f35b514eb14767ULL, 0x7691957a691df817ULL},
+    {0x5b16024d0563a65aULL, 0x83f997e75e88067fULL, 0xa9c11c5aaf2cab97ULL, 0x57f44892a2ad86eaULL},
+    {0xa6c7eee290c62375ULL, 0x7fe5c232f064f464ULL, 0x947c9b3af027e791ULL, 0x6062e8c7dc309cb2ULL},
+    {0x038e07e40a2812e1ULL, 0x52a29a371c84710fULL, 0x4c5bac1c57856ed7ULL, 0x2629bab11c98b6aeULL},
+    {0x637242c48b99b633ULL, 0x3e3494a05f161ecdULL, 0xc3f6fbf07e464327ULL, 0xaaa38210dde97c64ULL},
+    {0xc4d01c7eb078fd29ULL, 0xc188ca2c76798705ULL, 0x81d165297d239d2aULL, 0xd6e3b368fb2a3110ULL},
+    {0x7f90ffb775c02726ULL, 0xacfe2b03b09803d0ULL, 0x5a70368075759194ULL, 0x6309de7dbb3bf59dULL},
+    {0xf0f03027dfdc22d5ULL, 0x902b0ee66222acc7ULL, 0x78a3e873f00291edULL, 0xdb9d6b2d354321b4ULL},
+};
+// clang-format on
+
+// clang-format off
+static const unsigned long long h_xoshiro256pp_sequence_jump[XOSHIRO256_JUMP_POLYNOMIALS][XOSHIRO256_WORDS] = {
+    {0x76e15d3efefdcbbfULL, 0xc5004e441c522fb3ULL, 0x77710069854ee241ULL, 0x39109bb02acbe635ULL},
+    {0x85d1837e6f0cd3feULL, 0xa4b0488571edcb9dULL, 0xe9edb73cb3e9fb7cULL, 0xba70f1bd97fc40b0ULL},
+    {0xac54fa504c60e306ULL, 0x0b893c16e4a7f3b3ULL, 0xaff90eda09ea8b4cULL, 0x3727c275522644a7ULL},
+    {0x302eda308643ab47ULL, 0xc9a202b2322bb7f6ULL, 0xd4483ff9a9ac5a23ULL, 0x574e4d0093e3a2e4ULL},
+    {0x261882d92ec8429fULL, 0xabfffe7ac9ea1612ULL, 0x236417db3b031424ULL, 0xec6aa16a8ffc76faULL},
+    {0x52f6a62700009087ULL, 0xf7c39d8fc76906a3ULL, 0x285943d7fb75d765ULL, 0x88e5349d50f3ddefULL},
+    {0x3facc68ed0053ac4ULL, 0xfc0c646fb82afcebULL, 0xf055378c576c5c9aULL, 0x21588c86cc534c29ULL},
+    {0xfe596054913ed407ULL, 0x3d38ff4fc965c1faULL, 0x776751b126655d13ULL, 0x443c1363fd5c7d43ULL},
+    {0x1a672a03c71adc2eULL, 0x6217b3306e3e9557ULL, 0x163160efcad9c046ULL, 0x5243e79672334390ULL},
+    {0x58ce1e7d6ea9281fULL, 0x5348b64c107873b6ULL, 0xdabe97e1dd9a59c1ULL, 0x2dcec71c419baa62ULL},
+    {0x955659c7b8793ecfULL, 0x37fae57370f8bc19ULL, 0xfba1683b54b1e0f6ULL, 0xe91553475948d23eULL},
+    {0xbb5b5c8aa1ad89e1ULL, 0x9d7c00c8471ddc07ULL, 0xa910bdeff21ce218ULL, 0x540fca0570720eb7ULL},
+    {0x0612914f1b46c912ULL, 0x6d8abce0cf641cfcULL, 0x32f22fb19ac4550bULL, 0xc4b65c3551c83c69ULL},
+    {0x536e6114e4189cfcULL, 0xbe100596c8da9541ULL, 0xee7eb44f2fdbd1b8ULL, 0xb1170d0754beeaa4ULL},
+    {0xbeb789dbbc4ea209ULL, 0x267d7103ef9f83a3ULL, 0x93f548c2cab0a32cULL, 0x45cac579389af5caULL},
+    {0x65ceb6cde220e757ULL, 0xd6f9074a4c2732f7ULL, 0xa8e0425b0d01cd1eULL, 0x2b75c5d185461341ULL},
+    {0xafbacb099d1967bdULL, 0x1af87374102c1031ULL, 0x470868184fcc3f5fULL, 0x114dcbb43b155057ULL},
+    {0x5f98e9b5ad62427dULL, 0xf27e722d27743cd9ULL, 0x7ebe95d47cd1daf2ULL, 0x1b98494373c20b8aULL},
+    {0x8f1d0f5ec26521a6ULL, 0x036e9886f63c9933ULL, 0x4ac6fab0688e4ccdULL, 0x93d03eea25d1d816ULL},
+    {0xdd4e745e4412a26aULL, 0xbb62b24404a1be96ULL, 0x9c227b5ba376faeeULL, 0x08615908bcc4c8f2ULL},
+    {0xebe0d315a9cb279bULL, 0xc7a967d45d82bbcaULL, 0x64d85cc844957794ULL, 0xf6a1ef6a7d3b2545ULL},
+    {0x29bfb1bdc678fcbeULL, 0x611e5aedd44a4fd4ULL, 0xd188547deb3f0136ULL, 0x2b8dd348e0f767aeULL},
+    {0xfad25fa87d091580ULL, 0x5154a018eba8e309ULL, 0xbd9b522fb9f15d0bULL, 0xfcd653bc999d276bULL},
+    {0x29c79a4cedb3baf2ULL, 0x946592914b67e34fULL, 0x04921932aaf82150ULL, 0xb36394657868f06eULL},
+    {0x6cbfcd64bf69402cULL, 0xca9a2b49a6e6b16dULL, 0xba835279ffb6a358ULL, 0xfbdf21da0bb9add0ULL},
+    {0x23436782d086ca23ULL, 0x0cf66f05d413a46dULL, 0xbb90914a9c9871a3ULL, 0xedcce16aeb59e5adULL},
+    {0x130e23fa572004a9ULL, 0xf9ce20dec18c4b44ULL, 0x5cea7b8a1ac11de9ULL, 0x6608d757c7d36be3ULL},
+    {0x70c7a48f09b95bb9ULL, 0xd03a1ed309668f2fULL, 0xa955e448a10873d4ULL, 0xd5d4c6699513858fULL},
+    {0x72015cf80ce336f4ULL, 0x619c9d98f6f33bcbULL, 0x59f1b7e5d5fbfdc3ULL, 0x16cac53fc2905146ULL},
+    {0x5f340fcb5be19401ULL, 0xce2129cd34ae493aULL, 0x14690cfa36c329edULL, 0xc6e96787aedc5c40ULL},
+    {0x7ad9f632881e960fULL, 0xb8052dcca0e13395ULL, 0xd457241f6a9863acULL, 0xf8d2e75e66d53d83ULL},
+    {0x23336699f63c8e45ULL, 0x33b2e33e1d4e5bdbULL, 0x37fdeee585fdcd8eULL, 0x9a5144da7f765fd8ULL},
+    {0x0c7840cbc3b121adULL, 0xd317530723ab526aULL, 0xf31d2e03157bc387ULL, 0xa2b5d83a373c7ac2ULL},
+    {0x47b3063d7d254e4cULL, 0xea7c37e6ee511ddfULL, 0x0b50e1ab78926eefULL, 0x3ff3ff3e9168fd71ULL},
+    {0x2c56cd0f48e4587dULL, 0x4c77464d80c69c23ULL, 0xcbbf60dca92d32deULL, 0x6021ef776e85bae8ULL},
+    {0xe3521a7cbf37c2a1ULL, 0xa5130e508b35bcf2ULL, 0xf308dc3d84a999f1ULL, 0x601a299a0bbe06e1ULL},
+    {0xde3439ebd3e4fcefULL, 0x5b1dcb68d8e77159ULL, 0xb00b42e8b528bff6ULL, 0x9b121812c345eb87ULL},
+    {0x07eb2f053805555cULL, 0xa7f205f341a367e5ULL, 0x5d5d85d95fc59359ULL, 0x057f094f242a8701ULL},
+    {0x2e990fa0b86f494dULL, 0x5d3d62bea3d0c982ULL, 0x2be3af695f4ca02dULL, 0xcc92a4a3521dba28ULL},
+    {0xdd8082fb069d5ee7ULL, 0x7dc029224f1676fbULL, 0x65e7ab91abe659d0ULL, 0x04fb453c7ad02c02ULL},
+    {0x90b632d403b4513cULL, 0x0f186a740aaa16b5ULL, 0xb93a0637f3af87f7ULL, 0x3910377fe08e48a3ULL},
+    {0xcafe235cd7fe7ef0ULL, 0x5f1e003e1d3a7dafULL, 0x7f5505759890b722ULL, 0xf2f7c89f1379cf05ULL},
+    {0x5a252ed34d09cd4fULL, 0xe8f150b98011d5feULL, 0x131bf6c475e29db1ULL, 0x07818fb0f5b0ff11ULL},
+    {0x0441124ba35b2f58ULL, 0x9d4b489eae71f97dULL, 0x50fa45528d32be3aULL, 0xce8349b10acdabcaULL},
+    {0xade4816bccf327acULL, 0xc14a5bff8ad78a52ULL, 0x4cc84cfe14a77c57ULL, 0x183c124cf3d64e0bULL},
+    {0x4dbeffc02ebf0904ULL, 0xc3b545955dbab803ULL, 0xb7fa51c1fe79c53bULL, 0x688b6947de87d7e9ULL},
+    {0x2f5b386d0a416de5ULL, 0xdd87232f5cca256aULL, 0x7ba82a958b9e6a9aULL, 0x2c55c09810b2f548ULL},
+    {0xf75f6b5cec404580ULL, 0x8f0aa8baea9011fdULL, 0x1221c7c14b1db112ULL, 0x1d8ee30bc2f88017ULL},
+    {0xd18562b8cfa0694fULL, 0xba5487bfcecce199ULL, 0xde5eb81978735ad0ULL, 0x33a1c005e4ccc286ULL},
+    {0xdca75eca4474cbe5ULL, 0x0388cd9f71f314e3ULL, 0xd4699ceb082644c3ULL, 0x1271254993f074aaULL},
+    {0x1c493fa07fa74dcdULL, 0xb59cd5fcb429c2a9ULL, 0x3e550b09e8493d84ULL, 0x516fabbf03d78293ULL},
+    {0xe6d4233d77a1930dULL, 0x00424fa384fbe6eeULL, 0x4c636e19b68da5afULL, 0x140c9813f8542a71ULL},
+    {0xbea7da1e4eabfb2cULL, 0x271441e275aceb6bULL, 0x00ef11ecb78fd7ddULL, 0x3564fd80ea4578c1ULL},
+    {0xaf64e36a267033fdULL, 0xb86eb7a249850b0fULL, 0x9a888e9f318a8efeULL, 0x734c58deea6bd24bULL},
+    {0x30765a1ca7975996ULL, 0xeb222e5b91776decULL, 0x27e74ceb6b5c8a44ULL, 0xaea3b00f90869cf7ULL},
+    {0xc41171736f6127bdULL, 0xbbe041e1a6089bafULL, 0x623b0619adb26e6bULL, 0xc119ec86604ac1deULL},
+    {0xcc48029f3903aa23ULL, 0xddf1854fc56579d8ULL, 0xaa69f6bbf9bfebccULL, 0xfc1385169b03eb72ULL},
+    {0x409b2e169eb1bbfaULL, 0x771b06055d169793ULL, 0x47bf1babcb2b82f5ULL, 0xace055588e22fd26ULL},
+    {0x01731918ee54abd6ULL, 0x759a7ec7f27f3792ULL, 0xb4d6164f3e9d573eULL, 0xb604b97729a3c214ULL},
+    {0x1a22142b7cc54bcfULL, 0x43461d4569c23fa4ULL, 0x8d7ff0d4f4fb9470ULL, 0x1a825a9fac612b54ULL},
+    {0x39da610606e0e771ULL, 0x4566a69758dd856dULL, 0x1c60396a2c51aa0bULL, 0xf418b6ce5a857da3ULL},
+    {0xdfca68648b28c5afULL, 0xb56437fb2b753802ULL, 0xebb82aacdf6ca80dULL, 0xa170e108788db093ULL},
+    {0xde5b821c4a3d86e8ULL, 0x861fffe004c85acaULL, 0x3413838181a6096fULL, 0x460de3bdbe1cb3acULL},
+    {0x5b7b491f49ccffccULL, 0xae7f8689b0bbd6a0ULL, 0x13865b737d9739bcULL, 0x6c132e0c5374c916ULL},
+};
+// clang-format on
+
+#define XOROSHIRO128_WORDS 2
+#define XOROSHIRO128_JUMP_POLYNOMIALS 64
+
+// clang-format off
+static const __device__ unsigned long long d_xoroshiro128ss_jump[XOROSHIRO128_JUMP_POLYNOMIALS][XOROSHIRO128_WORDS] = {
+    {0x0000000000000002ULL, 0x0000000000000000ULL},
+    {0x0000000000000004ULL, 0x0000000000000000ULL},
+    {0x0000000000000010ULL, 0x0000000000000000ULL},
+    {0x0000000000000100ULL, 0x0000000000000000ULL},
+    {0x0000000000010000ULL, 0x0000000000000000ULL},
+    {0x0000000100000000ULL, 0x0000000000000000ULL},
+    {0x0000000000000000ULL, 0x0000000000000001ULL},
+    {0x095b8f76579aa001ULL, 0x0008828e513b43d5ULL},
+    {0x162ad6ec01b26eaeULL, 0x7a8ff5b1c465a931ULL},
+    {0xb4fbaa5c54ee8b8fULL, 0xb18b0d36cd81a8f5ULL},
+    {0x1207a1706bebb202ULL, 0x23ac5e0ba1cecb29ULL},
+    {0x2c88ef71166bc53dULL, 0xbb18e9c8d463bb1bULL},
+    {0xc3865bb154e9be10ULL, 0xe3fbe606ef4e8e09ULL},
+    {0x1a9fc99fa7818274ULL, 0x28faaaebb31ee2dbULL},
+    {0x588abd4c2ce2ba80ULL, 0x30a7c4eef203c7ebULL},
+    {0x9c90debc053e8cefULL, 0xa425003f3220a91dULL},
+    {0xb82ca99a09a4e71eULL, 0x81e1dd96586cf985ULL},
+    {0x35d69e118698a31dULL, 0x4f7fd3dfbb820bfbULL},
+    {0x49613606c466efd3ULL, 0xfee2760ef3a900b3ULL},
+    {0xbd031d011900a9e5ULL, 0xf0df0531f434c57dULL},
+    {0x235e761b3b378590ULL, 0x442576715266740cULL},
+    {0x3710a7ae7945df77ULL, 0x1e8bae8f680d2b35ULL},
+    {0x75d8e7dbceda609cULL, 0xfd7027fe6d2f6764ULL},
+    {0xde2cba60cd3332b5ULL, 0x28eff231ad438124ULL},
+    {0x377e64c4e80a06faULL, 0x1808760d0a0909a1ULL},
+    {0x0cf0a2225da7fb95ULL, 0xb9a362fafedfe9d2ULL},
+    {0x2bab58a3cadfc0a3ULL, 0xf57881ab117349fdULL},
+    {0x8d51ecdb9ed82455ULL, 0x849272241425c996ULL},
+    {0x521b29d0a57326c1ULL, 0xf1ccb8898cbc07cdULL},
+    {0xfbe65017abec72ddULL, 0x61179e44214caafaULL},
+    {0x6c446b9bc95c267bULL, 0xd9aa6b1e93fbb6e4ULL},
+    {0x64f80248d23655c6ULL, 0x86e3772194563f6dULL},
+    {0xfad843622b252c78ULL, 0xd4e95eef9edbdbc6ULL},
+    {0x598742bbfddde630ULL, 0x05667023c584a68aULL},
+    {0x3a9d7dce072134a6ULL, 0x401aacf87a5e21eeULL},
+    {0xf0cc32eaf522f0e0ULL, 0xe114b1e65a950e43ULL},
+    {0xeb2beaa80d3fd8a7ULL, 0x905dff85834fb8d1ULL},
+    {0x61f29536e1bb6b99ULL, 0xc449c069734817cbULL},
+    {0x390cd235d35187daULL, 0x1e5bc0fe7032f3dfULL},
+    {0x744e5f1168ba3345ULL, 0x3f399e6f1ea22dbcULL},
+    {0x8cc9aa88a153f5f8ULL, 0xd47a02636f041ccaULL},
+    {0x08d037056c80b9e0ULL, 0xf83c06b106d3b7abULL},
+    {0x4ce3c123d196bf7aULL, 0x14223eedae116a83ULL},
+    {0xb1b206870da4e89aULL, 0x24bfd164204335aeULL},
+    {0x207bb2453717cf67ULL, 0x4a5953c8f4bc2a51ULL},
+    {0xa14e342bb11ff7e6ULL, 0xf6b3f196dc551ccfULL},
+    {0x5422bca5015dd3b7ULL, 0x5b6233b76fa214d7ULL},
+    {0xede7341c00c65b85ULL, 0xf20d7136458bd924ULL},
+    {0xd769cfc9028deb78ULL, 0x9b19ba6b3752065aULL},
+    {0xc7b0e531abe7e4bdULL, 0x4f27796502238c48ULL},
+    {0x1c6d3ba4bb94182aULL, 0xb7b17dcd25003305ULL},
+    {0x3ae9471d0e2d0bcfULL, 0xaaae579366147d07ULL},
+    {0x8f9cd3794ca46fbfULL, 0x0d56bb288c661ccfULL},
+    {0xdb2ad4e9c15a9d4eULL, 0x0402342eedff424cULL},
+    {0x79e061af5be21395ULL, 0x4e71559e6d0e7f00ULL},
+    {0x96e7d88c0794e785ULL, 0x8367af1c9d6c1406ULL},
+    {0xccdda809db64b3e7ULL, 0x0dbfcd2453d1d33fULL},
+    {0x6c64681c21cd0286ULL, 0x3309e57f180d4ff6ULL},
+    {0xacb8d4c6ba67113eULL, 0xb439f330ab3b9715ULL},
+    {0xbad04ca5d96e2cd3ULL, 0xc58f079d0205bcf3ULL},
+    {0xebfbc2723a906760ULL, 0x09417d8c80a37aa7ULL},
+    {0x38ac01316167183dULL, 0x52f51ac639e09712ULL},
+    {0x7a134006d4efa484ULL, 0xf37ead6ea53b96baULL},
+    {0x351561e58f8572d4ULL, 0xdc1c01799cb8d734ULL},
+};
+// clang-format on
+
+// clang-format off
+static const __device__ unsigned long long d_xoroshiro128ss_subsequence_jump[XOROSHIRO128_JUMP_POLYNOMIALS][XOROSHIRO128_WORDS] = {
+    {0xdf900294d8f554a5ULL, 0x170865df4b3201fcULL},
+    {0x2992ead4972eaed2ULL, 0xb2a7b279a8cb1f50ULL},
+    {0xc026a7d9e04a7700ULL, 0xe7859c665be57882ULL},
+    {0xb4cb6197dea2b1feULL, 0x4b4a7aa8c389701cULL},
+    {0x0dcfc5b909e7df4dULL, 0xadb7753d55646eefULL},
+    {0x468431669864f789ULL, 0xc80926301806a352ULL},
+    {0x22b6c1736285fcc8ULL, 0xc05da051ec96af1dULL},
+    {0x74c1daac8729d8bbULL, 0xf88f6bac8fd30448ULL},
+    {0x847757c126b23e45ULL, 0x752b98d002c408f7ULL},
+    {0x0f9eaa62d0c9e2a3ULL, 0x1aa7bc96dbace110ULL},
+    {0x7475d71b98314377ULL, 0xc469b29353a4984bULL},
+    {0xbbb7d266d61c85eaULL, 0x4b6dd41bce3bb499ULL},
+    {0xc419b3742570e16fULL, 0xe023777e70b3a2f8ULL},
+    {0x2a71db3a3ce8b968ULL, 0x131e94fb35203d80ULL},
+    {0x2897bb8961b4dce9ULL, 0x9240c95b1e7fa08bULL},
+    {0xf0fc3553d7881d5fULL, 0xb879fca0915f893fULL},
+    {0xe754db3fbc7536bcULL, 0x2adca86fbefe1366ULL},
+    {0x0a9e201adfe7baa9ULL, 0x0a40a688d77855baULL},
+    {0x1d0d601e49c35837ULL, 0x17771c905e0775a8ULL},
+    {0x9b031395aec7b584ULL, 0x2cf775e419a607e0ULL},
+    {0x79ead2eeddf66699ULL, 0x93a7cf27dec9b306ULL},
+    {0xe1b9805c107679fcULL, 0x93615189fe85b7d5ULL},
+    {0x2c3925dcd790e3d6ULL, 0x466421124b50fbfbULL},
+    {0xdca9b0fa4e95600eULL, 0x1cda7bd04e3bb94bULL},
+    {0xefc7905e1cbb5ffbULL, 0x5ec431d73bbfe49fULL},
+    {0x854414811d534483ULL, 0x31a1f85fd532f302ULL},
+    {0xadb9ba2958f30b6eULL, 0xed9b991c09177e2fULL},
+    {0x76f8fdf26b0d1cbbULL, 0x38d9e87dffdfca70ULL},
+    {0x51f21cddcebdb8c7ULL, 0xd8e9e7254052af4dULL},
+    {0xa03f796efb295305ULL, 0x62769780d13fbc08ULL},
+    {0x4f2083f6b19e628aULL, 0x66e5456c2eaedbffULL},
+    {0x8b2be9cd79734bedULL, 0xace8d6ce8e3fba17ULL},
+    {0xd2a98b26625eee7bULL, 0xdddf9b1090aa7ac1ULL},
+    {0x4fff128094edd94cULL, 0x00d67dc46ad28695ULL},
+    {0x726438e9a1d3c6eaULL, 0xf9540570703e7cf3ULL},
+    {0x92cc6a0937c9d34eULL, 0x066a9599766619b5ULL},
+    {0xc5730de058e1047fULL, 0xa4e540c7ac49aa1bULL},
+    {0xe408bbecda066551ULL, 0xc2edfc1ab51c00adULL},
+    {0xc5477ea8821ce588ULL, 0xf11753a4339e78c3ULL},
+    {0x3c6058e633063180ULL, 0xbb42e906efb12540ULL},
+    {0xbec40e0518086e21ULL, 0x4e86f36c495eeedbULL},
+    {0x465276434fd98954ULL, 0xe8345a7c487fefd6ULL},
+    {0x3adaea5cdfe12e3bULL, 0x688b762874221434ULL},
+    {0xc9dffa95904e99b1ULL, 0x833801923a05f253ULL},
+    {0xa10c3fb0b18df787ULL, 0x58a00d23a8086646ULL},
+    {0xa4e41f760281c3d0ULL, 0xec69708d487dbfc4ULL},
+    {0xb8880fff0e41261cULL, 0x47176f17de7ff0e9ULL},
+    {0x58ee3b30f542767eULL, 0x4f40c533643920eaULL},
+    {0x15f2d25b60c5acd7ULL, 0x83fd48d6b9620584ULL},
+    {0xe448c83950a687eaULL, 0x0ce303c7d3aabbc8ULL},
+    {0xa6ff7863c363cfd4ULL, 0x1746715df0dd8fe3ULL},
+    {0x7e9d8517b195d9c9ULL, 0xc00185964caef8bbULL},
+    {0x40ddb4daf3fbdda8ULL, 0xb6bde02bd004b144ULL},
+    {0x7a794b820672a49bULL, 0xba43c63ec5a9f187ULL},
+    {0xc1be31e7536236fbULL, 0x2467071b1d261621ULL},
+    {0xf0eec34daea486fbULL, 0x5a6fc0435f011daaULL},
+    {0xf42c01a2a3815db4ULL, 0xa5af34331c044d81ULL},
+    {0xdf7964c343b312deULL, 0xdb43b553cd16ea44ULL},
+    {0x8454182464c29903ULL, 0x432c2bbcd03e65f6ULL},
+    {0x7b6c0ecc6cb5adbbULL, 0xcdf56412d1e7ba6eULL},
+    {0x380b97764c9f7748ULL, 0xac13c8b2ff838036ULL},
+    {0x1868a9f5a4fd4d64ULL, 0x71d208cc2e5c56e9ULL},
+    {0xe89f5fe075d74a79ULL, 0xd1d08a01b73de005ULL},
+    {0x25aa87f3c2704c69ULL, 0xa9495c12936ad0fdULL},
+};
+// clang-format on
+
+// clang-format off
+static const __device__ unsigned long long d_xoroshiro128ss_sequence_jump[XOROSHIRO128_JUMP_POLYNOMIALS][XOROSHIRO128_WORDS] = {
+    {0xd2a98b26625eee7bULL, 0xdddf9b1090aa7ac1ULL},
+    {0x4fff128094edd94cULL, 0x00d67dc46ad28695ULL},
+    {0x726438e9a1d3c6eaULL, 0xf9540570703e7cf3ULL},
+    {0x92cc6a0937c9d34eULL, 0x066a9599766619b5ULL},
+    {0xc5730de058e1047fULL, 0xa4e540c7ac49aa1bULL},
+    {0xe408bbecda066551ULL, 0xc2edfc1ab51c00adULL},
+    {0xc5477ea8821ce588ULL, 0xf11753a4339e78c3ULL},
+    {0x3c6058e633063180ULL, 0xbb42e906efb12540ULL},
+    {0xbec40e0518086e21ULL, 0x4e86f36c495eeedbULL},
+    {0x465276434fd98954ULL, 0xe8345a7c487fefd6ULL},
+    {0x3adaea5cdfe12e3bULL, 0x688b762874221434ULL},
+    {0xc9dffa95904e99b1ULL, 0x833801923a05f253ULL},
+    {0xa10c3fb0b18df787ULL, 0x58a00d23a8086646ULL},
+    {0xa4e41f760281c3d0ULL, 0xec69708d487dbfc4ULL},
+    {0xb8880fff0e41261cULL, 0x47176f17de7ff0e9ULL},
+    {0x58ee3b30f542767eULL, 0x4f40c533643920eaULL},
+    {0x15f2d25b60c5acd7ULL, 0x83fd48d6b9620584ULL},
+    {0xe448c83950a687eaULL, 0x0ce303c7d3aabbc8ULL},
+    {0xa6ff7863c363cfd4ULL, 0x1746715df0dd8fe3ULL},
+    {0x7e9d8517b195d9c9ULL, 0xc00185964caef8bbULL},
+    {0x40ddb4daf3fbdda8ULL, 0xb6bde02bd004b144ULL},
+    {0x7a794b820672a49bULL, 0xba43c63ec5a9f187ULL},
+    {0xc1be31e7536236fbULL, 0x2467071b1d261621ULL},
+    {0xf0eec34daea486fbULL, 0x5a6fc0435f011daaULL},
+    {0xf42c01a2a3815db4ULL, 0xa5af34331c044d81ULL},
+    {0xdf7964c343b312deULL, 0xdb43b553cd16ea44ULL},
+    {0x8454182464c29903ULL, 0x432c2bbcd03e65f6ULL},
+    {0x7b6c0ecc6cb5adbbULL, 0xcdf56412d1e7ba6eULL},
+    {0x380b97764c9f7748ULL, 0xac13c8b2ff838036ULL},
+    {0x1868a9f5a4fd4d64ULL, 0x71d208cc2e5c56e9ULL},
+    {0xe89f5fe075d74a79ULL, 0xd1d08a01b73de005ULL},
+    {0x25aa87f3c2704c69ULL, 0xa9495c12936ad0fdULL},
+    {0x0000000000000002ULL, 0x0000000000000000ULL},
+    {0x0000000000000004ULL, 0x0000000000000000ULL},
+    {0x0000000000000010ULL, 0x0000000000000000ULL},
+    {0x0000000000000100ULL, 0x0000000000000000ULL},
+    {0x0000000000010000ULL, 0x0000000000000000ULL},
+    {0x0000000100000000ULL, 0x0000000000000000ULL},
+    {0x0000000000000000ULL, 0x0000000000000001ULL},
+    {0x095b8f76579aa001ULL, 0x0008828e513b43d5ULL},
+    {0x162ad6ec01b26eaeULL, 0x7a8ff5b1c465a931ULL},
+    {0xb4fbaa5c54ee8b8fULL, 0xb18b0d36cd81a8f5ULL},
+    {0x1207a1706bebb202ULL, 0x23ac5e0ba1cecb29ULL},
+    {0x2c88ef71166bc53dULL, 0xbb18e9c8d463bb1bULL},
+    {0xc3865bb154e9be10ULL, 0xe3fbe606ef4e8e09ULL},
+    {0x1a9fc99fa7818274ULL, 0x28faaaebb31ee2dbULL},
+    {0x588abd4c2ce2ba80ULL, 0x30a7c4eef203c7ebULL},
+    {0x9c90debc053e8cefULL, 0xa425003f3220a91dULL},
+    {0xb82ca99a09a4e71eULL, 0x81e1dd96586cf985ULL},
+    {0x35d69e118698a31dULL, 0x4f7fd3dfbb820bfbULL},
+    {0x49613606c466efd3ULL, 0xfee2760ef3a900b3ULL},
+    {0xbd031d011900a9e5ULL, 0xf0df0531f434c57dULL},
+    {0x235e761b3b378590ULL, 0x442576715266740cULL},
+    {0x3710a7ae7945df77ULL, 0x1e8bae8f680d2b35ULL},
+    {0x75d8e7dbceda609cULL, 0xfd7027fe6d2f6764ULL},
+    {0xde2cba60cd3332b5ULL, 0x28eff231ad438124ULL},
+    {0x377e64c4e80a06faULL, 0x1808760d0a0909a1ULL},
+    {0x0cf0a2225da7fb95ULL, 0xb9a362fafedfe9d2ULL},
+    {0x2bab58a3cadfc0a3ULL, 0xf57881ab117349fdULL},
+    {0x8d51ecdb9ed82455ULL, 0x849272241425c996ULL},
+    {0x521b29d0a57326c1ULL, 0xf1ccb8898cbc07cdULL},
+    {0xfbe65017abec72ddULL, 0x61179e44214caafaULL},
+    {0x6c446b9bc95c267bULL, 0xd9aa6b1e93fbb6e4ULL},
+    {0x64f80248d23655c6ULL, 0x86e3772194563f6dULL},
+};
+// clang-format on
+
+// clang-format off
+static const unsigned long long h_xoroshiro128ss_jump[XOROSHIRO128_JUMP_POLYNOMIALS][XOROSHIRO128_WORDS] = {
+    {0x0000000000000002ULL, 0x0000000000000000ULL},
+    {0x0000000000000004ULL, 0x0000000000000000ULL},
+    {0x0000000000000010ULL, 0x0000000000000000ULL},
+    {0x0000000000000100ULL, 0x0000000000000000ULL},
+    {0x0000000000010000ULL, 0x0000000000000000ULL},
+    {0x0000000100000000ULL, 0x0000000000000000ULL},
+    {0x0000000000000000ULL, 0x0000000000000001ULL},
+    {0x095b8f76579aa001ULL, 0x0008828e513b43d5ULL},
+    {0x162ad6ec01b26eaeULL, 0x7a8ff5b1c465a931ULL},
+    {0xb4fbaa5c54ee8b8fULL, 0xb18b0d36cd81a8f5ULL},
+    {0x1207a1706bebb202ULL, 0x23ac5e0ba1cecb29ULL},
+    {0x2c88ef71166bc53dULL, 0xbb18e9c8d463bb1bULL},
+    {0xc3865bb154e9be10ULL, 0xe3fbe606ef4e8e09ULL},
+    {0x1a9fc99fa7818274ULL, 0x28faaaebb31ee2dbULL},
+    {0x588abd4c2ce2ba80ULL, 0x30a7c4eef203c7ebULL},
+    {0x9c90debc053e8cefULL, 0xa425003f3220a91dULL},
+    {0xb82ca99a09a4e71eULL, 0x81e1dd96586cf985ULL},
+    {0x35d69e118698a31dULL, 0x4f7fd3dfbb820bfbULL},
+    {0x49613606c466efd3ULL, 0xfee2760ef3a900b3ULL},
+    {0xbd031d011900a9e5ULL, 0xf0df0531f434c57dULL},
+    {0x235e761b3b378590ULL, 0x442576715266740cULL},
+    {0x3710a7ae7945df77ULL, 0x1e8bae8f680d2b35ULL},
+    {0x75d8e7dbceda609cULL, 0xfd7027fe6d2f6764ULL},
+    {0xde2cba60cd3332b5ULL, 0x28eff231ad438124ULL},
+    {0x377e64c4e80a06faULL, 0x1808760d0a0909a1ULL},
+    {0x0cf0a2225da7fb95ULL, 0xb9a362fafedfe9d2ULL},
+    {0x2bab58a3cadfc0a3ULL, 0xf57881ab117349fdULL},
+    {0x8d51ecdb9ed82455ULL, 0x849272241425c996ULL},
+    {0x521b29d0a57326c1ULL, 0xf1ccb8898cbc07cdULL},
+    {0xfbe65017abec72ddULL, 0x61179e44214caafaULL},
+    {0x6c446b9bc95c267bULL, 0xd9aa6b1e93fbb6e4ULL},
+    {0x64f80248d23655c6ULL, 0x86e3772194563f6dULL},
+    {0xfad843622b252c78ULL, 0xd4e95eef9edbdbc6ULL},
+    {0x598742bbfddde630ULL, 0x05667023c584a68aULL},
+    {0x3a9d7dce072134a6ULL, 0x401aacf87a5e21eeULL},
+    {0xf0cc32eaf522f0e0ULL, 0xe114b1e65a950e43ULL},
+    {0xeb2beaa80d3fd8a7ULL, 0x905dff85834fb8d1ULL},
+    {0x61f29536e1bb6b99ULL, 0xc449c069734817cbULL},
+    {0x390cd235d35187daULL, 0x1e5bc0fe7032f3dfULL},
+    {0x744e5f1168ba3345ULL, 0x3f399e6f1ea22dbcULL},
+    {0x8cc9aa88a153f5f8ULL, 0xd47a02636f041ccaULL},
+    {0x08d037056c80b9e0ULL, 0xf83c06b106d3b7abULL},
+    {0x4ce3c123d196bf7aULL, 0x14223eedae116a83ULL},
+    {0xb1b206870da4e89aULL, 0x24bfd164204335aeULL},
+    {0x207bb2453717cf67ULL, 0x4a5953c8f4bc2a51ULL},
+    {0xa14e342bb11ff7e6ULL, 0xf6b3f196dc551ccfULL},
+    {0x5422bca5015dd3b7ULL, 0x5b6233b76fa214d7ULL},
+    {0xede7341c00c65b85ULL, 0xf20d7136458bd924ULL},
+    {0xd769cfc9028deb78ULL, 0x9b19ba6b3752065aULL},
+    {0xc7b0e531abe7e4bdULL, 0x4f27796502238c48ULL},
+    {0x1c6d3ba4bb94182aULL, 0xb7b17dcd25003305ULL},
+    {0x3ae9471d0e2d0bcfULL, 0xaaae579366147d07ULL},
+    {0x8f9cd3794ca46fbfULL, 0x0d56bb288c661ccfULL},
+    {0xdb2ad4e9c15a9d4eULL, 0x0402342eedff424cULL},
+    {0x79e061af5be21395ULL, 0x4e71559e6d0e7f00ULL},
+    {0x96e7d88c0794e785ULL, 0x8367af1c9d6c1406ULL},
+    {0xccdda809db64b3e7ULL, 0x0dbfcd2453d1d33fULL},
+    {0x6c64681c21cd0286ULL, 0x3309e57f180d4ff6ULL},
+    {0xacb8d4c6ba67113eULL, 0xb439f330ab3b9715ULL},
+    {0xbad04ca5d96e2cd3ULL, 0xc58f079d0205bcf3ULL},
+    {0xebfbc2723a906760ULL, 0x09417d8c80a37aa7ULL},
+    {0x38ac01316167183dULL, 0x52f51ac639e09712ULL},
+    {0x7a134006d4efa484ULL, 0xf37ead6ea53b96baULL},
+    {0x351561e58f8572d4ULL, 0xdc1c01799cb8d734ULL},
+};
+// clang-format on
+
+// clang-format off
+static const unsigned long long h_xoroshiro128ss_subsequence_jump[XOROSHIRO128_JUMP_POLYNOMIALS][XOROSHIRO128_WORDS] = {
+    {0xdf900294d8f554a5ULL, 0x170865df4b3201fcULL},
+    {0x2992ead4972eaed2ULL, 0xb2a7b279a8cb1f50ULL},
+    {0xc026a7d9e04a7700ULL, 0xe7859c665be57882ULL},
+    {0xb4cb6197dea2b1feULL, 0x4b4a7aa8c389701cULL},
+    {0x0dcfc5b909e7df4dULL, 0xadb7753d55646eefULL},
+    {0x468431669864f789ULL, 0xc80926301806a352ULL},
+    {0x22b6c1736285fcc8ULL, 0xc05da051ec96af1dULL},
+    {0x74c1daac8729d8bbULL, 0xf88f6bac8fd30448ULL},
+    {0x847757c126b23e45ULL, 0x752b98d002c408f7ULL},
+    {0x0f9eaa62d0c9e2a3ULL, 0x1aa7bc96dbace110ULL},
+    {0x7475d71b98314377ULL, 0xc469b29353a4984bULL},
+    {0xbbb7d266d61c85eaULL, 0x4b6dd41bce3bb499ULL},
+    {0xc419b3742570e16fULL, 0xe023777e70b3a2f8ULL},
+    {0x2a71db3a3ce8b968ULL, 0x131e94fb35203d80ULL},
+    {0x2897bb8961b4dce9ULL, 0x9240c95b1e7fa08bULL},
+    {0xf0fc3553d7881d5fULL, 0xb879fca0915f893fULL},
+    {0xe754db3fbc7536bcULL, 0x2adca86fbefe1366ULL},
+    {0x0a9e201adfe7baa9ULL, 0x0a40a688d77855baULL},
+    {0x1d0d601e49c35837ULL, 0x17771c905e0775a8ULL},
+    {0x9b031395aec7b584ULL, 0x2cf775e419a607e0ULL},
+    {0x79ead2eeddf66699ULL, 0x93a7cf27dec9b306ULL},
+    {0xe1b9805c107679fcULL, 0x93615189fe85b7d5ULL},
+    {0x2c3925dcd790e3d6ULL, 0x466421124b50fbfbULL},
+    {0xdca9b0fa4e95600eULL, 0x1cda7bd04e3bb94bULL},
+    {0xefc7905e1cbb5ffbULL, 0x5ec431d73bbfe49fULL},
+    {0x854414811d534483ULL, 0x31a1f85fd532f302ULL},
+    {0xadb9ba2958f30b6eULL, 0xed9b991c09177e2fULL},
+    {0x76f8fdf26b0d1cbbULL, 0x38d9e87dffdfca70ULL},
+    {0x51f21cddcebdb8c7ULL, 0xd8e9e7254052af4dULL},
+    {0xa03f796efb295305ULL, 0x62769780d13fbc08ULL},
+    {0x4f2083f6b19e628aULL, 0x66e5456c2eaedbffULL},
+    {0x8b2be9cd79734bedULL, 0xace8d6ce8e3fba17ULL},
+    {0xd2a98b26625eee7bULL, 0xdddf9b1090aa7ac1ULL},
+    {0x4fff128094edd94cULL, 0x00d67dc46ad28695ULL},
+    {0x726438e9a1d3c6eaULL, 0xf9540570703e7cf3ULL},
+    {0x92cc6a0937c9d34eULL, 0x066a9599766619b5ULL},
+    {0xc5730de058e1047fULL, 0xa4e540c7ac49aa1bULL},
+    {0xe408bbecda066551ULL, 0xc2edfc1ab51c00adULL},
+    {0xc5477ea8821ce588ULL, 0xf11753a4339e78c3ULL},
+    {0x3c6058e633063180ULL, 0xbb42e906efb12540ULL},
+    {0xbec40e0518086e21ULL, 0x4e86f36c495eeedbULL},
+    {0x465276434fd98954ULL, 0xe8345a7c487fefd6ULL},
+    {0x3adaea5cdfe12e3bULL, 0x688b762874221434ULL},
+    {0xc9dffa95904e99b1ULL, 0x833801923a05f253ULL},
+    {0xa10c3fb0b18df787ULL, 0x58a00d23a8086646ULL},
+    {0xa4e41f760281c3d0ULL, 0xec69708d487dbfc4ULL},
+    {0xb8880fff0e41261cULL, 0x47176f17de7ff0e9ULL},
+    {0x58ee3b30f542767eULL, 0x4f40c533643920eaULL},
+    {0x15f2d25b60c5acd7ULL, 0x83fd48d6b9620584ULL},
+    {0xe448c83950a687eaULL, 0x0ce303c7d3aabbc8ULL},
+    {0xa6ff7863c363cfd4ULL, 0x1746715df0dd8fe3ULL},
+    {0x7e9d8517b195d9c9ULL, 0xc00185964caef8bbULL},
+    {0x40ddb4daf3fbdda8ULL, 0xb6bde02bd004b144ULL},
+    {0x7a794b820672a49bULL, 0xba43c63ec5a9f187ULL},
+    {0xc1be31e7536236fbULL, 0x2467071b1d261621ULL},
+    {0xf0eec34daea486fbULL, 0x5a6fc0435f011daaULL},
+    {0xf42c01a2a3815db4ULL, 0xa5af34331c044d81ULL},
+    {0xdf7964c343b312deULL, 0xdb43b553cd16ea44ULL},
+    {0x8454182464c29903ULL, 0x432c2bbcd03e65f6ULL},
+    {0x7b6c0ecc6cb5adbbULL, 0xcdf56412d1e7ba6eULL},
+    {0x380b97764c9f7748ULL, 0xac13c8b2ff838036ULL},
+    {0x1868a9f5a4fd4d64ULL, 0x71d208cc2e5c56e9ULL},
+    {0xe89f5fe075d74a79ULL, 0xd1d08a01b73de005ULL},
+    {0x25aa87f3c2704c69ULL, 0xa9495c12936ad0fdULL},
+};
+// clang-format on
+
+// clang-format off
+static const unsigned long long h_xoroshiro128ss_sequence_jump[XOROSHIRO128_JUMP_POLYNOMIALS][XOROSHIRO128_WORDS] = {
+    {0xd2a98b26625eee7bULL, 0xdddf9b1090aa7ac1ULL},
+    {0x4fff128094edd94cULL, 0x00d67dc46ad28695ULL},
+    {0x726438e9a1d3c6eaULL, 0xf9540570703e7cf3ULL},
+    {0x92cc6a0937c9d34eULL, 0x066a9599766619b5ULL},
+    {0xc5730de058e1047fULL, 0xa4e540c7ac49aa1bULL},
+    {0xe408bbecda066551ULL, 0xc2edfc1ab51c00adULL},
+    {0xc5477ea8821ce588ULL, 0xf11753a4339e78c3ULL},
+    {0x3c6058e633063180ULL, 0xbb42e906efb12540ULL},
+    {0xbec40e0518086e21ULL, 0x4e86f36c495eeedbULL},
+    {0x465276434fd98954ULL, 0xe8345a7c487fefd6ULL},
+    {0x3adaea5cdfe12e3bULL, 0x688b762874221434ULL},
+    {0xc9dffa95904e99b1ULL, 0x833801923a05f253ULL},
+    {0xa10c3fb0b18df787ULL, 0x58a00d23a8086646ULL},
+    {0xa4e41f760281c3d0ULL, 0xec69708d487dbfc4ULL},
+    {0xb8880fff0e41261cULL, 0x47176f17de7ff0e9ULL},
+    {0x58ee3b30f542767eULL, 0x4f40c533643920eaULL},
+    {0x15f2d25b60c5acd7ULL, 0x83fd48d6b9620584ULL},
+    {0xe448c83950a687eaULL, 0x0ce303c7d3aabbc8ULL},
+    {0xa6ff7863c363cfd4ULL, 0x1746715df0dd8fe3ULL},
+    {0x7e9d8517b195d9c9ULL, 0xc00185964caef8bbULL},
+    {0x40ddb4daf3fbdda8ULL, 0xb6bde02bd004b144ULL},
+    {0x7a794b820672a49bULL, 0xba43c63ec5a9f187ULL},
+    {0xc1be31e7536236fbULL, 0x2467071b1d261621ULL},
+    {0xf0eec34daea486fbULL, 0x5a6fc0435f011daaULL},
+    {0xf42c01a2a3815db4ULL, 0xa5af34331c044d81ULL},
+    {0xdf7964c343b312deULL, 0xdb43b553cd16ea44ULL},
+    {0x8454182464c29903ULL, 0x432c2bbcd03e65f6ULL},
+    {0x7b6c0ecc6cb5adbbULL, 0xcdf56412d1e7ba6eULL},
+    {0x380b97764c9f7748ULL, 0xac13c8b2ff838036ULL},
+    {0x1868a9f5a4fd4d64ULL, 0x71d208cc2e5c56e9ULL},
+    {0xe89f5fe075d74a79ULL, 0xd1d08a01b73de005ULL},
+    {0x25aa87f3c2704c69ULL, 0xa9495c12936ad0fdULL},
+    {0x0000000000000002ULL, 0x0000000000000000ULL},
+    {0x0000000000000004ULL, 0x0000000000000000ULL},
+    {0x0000000000000010ULL, 0x0000000000000000ULL},
+    {0x0000000000000100ULL, 0x0000000000000000ULL},
+    {0x0000000000010000ULL, 0x0000000000000000ULL},
+    {0x0000000100000000ULL, 0x0000000000000000ULL},
+    {0x0000000000000000ULL, 0x0000000000000001ULL},
+    {0x095b8f76579aa001ULL, 0x0008828e513b43d5ULL},
+    {0x162ad6ec01b26eaeULL, 0x7a8ff5b1c465a931ULL},
+    {0xb4fbaa5c54ee8b8fULL, 0xb18b0d36cd81a8f5ULL},
+    {0x1207a1706bebb202ULL, 0x23ac5e0ba1cecb29ULL},
+    {0x2c88ef71166bc53dULL, 0xbb18e9c8d463bb1bULL},
+    {0xc3865bb154e9be10ULL, 0xe3fbe606ef4e8e09ULL},
+    {0x1a9fc99fa7818274ULL, 0x28faaaebb31ee2dbULL},
+    {0x588abd4c2ce2ba80ULL, 0x30a7c4eef203c7ebULL},
+    {0x9c90debc053e8cefULL, 0xa425003f3220a91dULL},
+    {0xb82ca99a09a4e71eULL, 0x81e1dd96586cf985ULL},
+    {0x35d69e118698a31dULL, 0x4f7fd3dfbb820bfbULL},
+    {0x49613606c466efd3ULL, 0xfee2760ef3a900b3ULL},
+    {0xbd031d011900a9e5ULL, 0xf0df0531f434c57dULL},
+    {0x235e761b3b378590ULL, 0x442576715266740cULL},
+    {0x3710a7ae7945df77ULL, 0x1e8bae8f680d2b35ULL},
+    {0x75d8e7dbceda609cULL, 0xfd7027fe6d2f6764ULL},
+    {0xde2cba60cd3332b5ULL, 0x28eff231ad438124ULL},
+    {0x377e64c4e80a06faULL, 0x1808760d0a0909a1ULL},
+    {0x0cf0a2225da7fb95ULL, 0xb9a362fafedfe9d2ULL},
+    {0x2bab58a3cadfc0a3ULL, 0xf57881ab117349fdULL},
+    {0x8d51ecdb9ed82455ULL, 0x849272241425c996ULL},
+    {0x521b29d0a57326c1ULL, 0xf1ccb8898cbc07cdULL},
+    {0xfbe65017abec72ddULL, 0x61179e44214caafaULL},
+    {0x6c446b9bc95c267bULL, 0xd9aa6b1e93fbb6e4ULL},
+    {0x64f80248d23655c6ULL, 0x86e3772194563f6dULL},
+};
+// clang-format on
+
+#endif // ROCRAND_XOSHIRO_PRECOMPUTED_H_
@@ -34,6 +34,12 @@ module rocrand_m
     integer, public :: ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 = 409
     integer, public :: ROCRAND_RNG_PSEUDO_THREEFRY4_32_20 = 410
     integer, public :: ROCRAND_RNG_PSEUDO_THREEFRY4_64_20 = 411
+    integer, public :: ROCRAND_RNG_PSEUDO_PHILOX4_64_10 = 412
+    integer, public :: ROCRAND_RNG_PSEUDO_XOSHIRO256PP = 413
+    integer, public :: ROCRAND_RNG_PSEUDO_XOROSHIRO128SS = 414
+    integer, public :: ROCRAND_RNG_PSEUDO_PCG64_DXSM = 415
+    integer, public :: ROCRAND_RNG_PSEUDO_SQUARES = 416
+    integer, public :: ROCRAND_RNG_PSEUDO_ARS = 417
     integer, public :: ROCRAND_RNG_QUASI_DEFAULT = 500
     integer, public :: ROCRAND_RNG_QUASI_SOBOL32 = 501
     integer, public :: ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 = 502
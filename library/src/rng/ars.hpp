@@ -0,0 +1,680 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Based on the ARS (AES Random Stream) generator of the Random123 library by
+// D. E. Shaw Research, see "Parallel Random Numbers: As Easy as 1, 2, 3", SC11.
+
+#ifndef ROCRAND_RNG_ARS_H_
+#define ROCRAND_RNG_ARS_H_
+
+#include "common.hpp"
+#include "config_types.hpp"
+#include "distributions.hpp"
+#include "generator_type.hpp"
+#include "system.hpp"
+
+#include <rocrand/rocrand.h>
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+#if !defined(__HIP_DEVICE_COMPILE__) && (defined(__x86_64__) || defined(_M_X64)) \
+    && (defined(__GNUC__) || defined(__clang__))
+    #define ROCRAND_ARS_X86_AES
+    #include <immintrin.h>
+#endif
+
+namespace rocrand_impl::host
+{
+
+// ARS-5 is a counter-based generator: a 128-bit counter is encrypted with five AES rounds.
+// The round keys are not expanded with the AES key schedule but are obtained by adding
+// a Weyl sequence to the key, one 64-bit lane at a time. Every encrypted counter (block)
+// gives four 32-bit values.
+//
+// The key is the 64-bit seed (the upper half is zero), and block b of the stream is the
+// encryption of the counter b.
+
+inline constexpr unsigned long long ars_weyl_lo = 0x9E3779B97F4A7C15ULL; // golden ratio
+inline constexpr unsigned long long ars_weyl_hi = 0xBB67AE8584CAA73BULL; // sqrt(3) - 1
+
+inline constexpr unsigned int ars_rounds = 5;
+
+inline constexpr unsigned char ars_sbox[256] = {
+    0x63, 0x7c, 0x77, 0x7b, 0xf2, 0x6b, 0x6f, 0xc5, 0x30, 0x01, 0x67, 0x2b, 0xfe, 0xd7, 0xab, 0x76,
+    0xca, 0x82, 0xc9, 0x7d, 0xfa, 0x59, 0x47, 0xf0, 0xad, 0xd4, 0xa2, 0xaf, 0x9c, 0xa4, 0x72, 0xc0,
+    0xb7, 0xfd, 0x93, 0x26, 0x36, 0x3f, 0xf7, 0xcc, 0x34, 0xa5, 0xe5, 0xf1, 0x71, 0xd8, 0x31, 0x15,
+    0x04, 0xc7, 0x23, 0xc3, 0x18, 0x96, 0x05, 0x9a, 0x07, 0x12, 0x80, 0xe2, 0xeb, 0x27, 0xb2, 0x75,
+    0x09, 0x83, 0x2c, 0x1a, 0x1b, 0x6e, 0x5a, 0xa0, 0x52, 0x3b, 0xd6, 0xb3, 0x29, 0xe3, 0x2f, 0x84,
+    0x53, 0xd1, 0x00, 0xed, 0x20, 0xfc, 0xb1, 0x5b, 0x6a, 0xcb, 0xbe, 0x39, 0x4a, 0x4c, 0x58, 0xcf,
+    0xd0, 0xef, 0xaa, 0xfb, 0x43, 0x4d, 0x33, 0x85, 0x45, 0xf9, 0x02, 0x7f, 0x50, 0x3c, 0x9f, 0xa8,
+    0x51, 0xa3, 0x40, 0x8f, 0x92, 0x9d, 0x38, 0xf5, 0xbc, 0xb6, 0xda, 0x21, 0x10, 0xff, 0xf3, 0xd2,
+    0xcd, 0x0c, 0x13, 0xec, 0x5f, 0x97, 0x44, 0x17, 0xc4, 0xa7, 0x7e, 0x3d, 0x64, 0x5d, 0x19, 0x73,
+    0x60, 0x81, 0x4f, 0xdc, 0x22, 0x2a, 0x90, 0x88, 0x46, 0xee, 0xb8, 0x14, 0xde, 0x5e, 0x0b, 0xdb,
+    0xe0, 0x32, 0x3a, 0x0a, 0x49, 0x06, 0x24, 0x5c, 0xc2, 0xd3, 0xac, 0x62, 0x91, 0x95, 0xe4, 0x79,
+    0xe7, 0xc8, 0x37, 0x6d, 0x8d, 0xd5, 0x4e, 0xa9, 0x6c, 0x56, 0xf4, 0xea, 0x65, 0x7a, 0xae, 0x08,
+    0xba, 0x78, 0x25, 0x2e, 0x1c, 0xa6, 0xb4, 0xc6, 0xe8, 0xdd, 0x74, 0x1f, 0x4b, 0xbd, 0x8b, 0x8a,
+    0x70, 0x3e, 0xb5, 0x66, 0x48, 0x03, 0xf6, 0x0e, 0x61, 0x35, 0x57, 0xb9, 0x86, 0xc1, 0x1d, 0x9e,
+    0xe1, 0xf8, 0x98, 0x11, 0x69, 0xd9, 0x8e, 0x94, 0x9b, 0x1e, 0x87, 0xe9, 0xce, 0x55, 0x28, 0xdf,
+    0x8c, 0xa1, 0x89, 0x0d, 0xbf, 0xe6, 0x42, 0x68, 0x41, 0x99, 0x2d, 0x0f, 0xb0, 0x54, 0xbb, 0x16,
+};
+
+// SubBytes and MixColumns of one byte of a column, rotated to the byte's row
+// gives the contribution of the byte to the output column.
+constexpr std::array<unsigned int, 256> make_ars_te_table()
+{
+    std::array<unsigned int, 256> te{};
+    for(unsigned int i = 0; i < 256; i++)
+    {
+        const unsigned int s  = ars_sbox[i];
+        const unsigned int s2 = ((s << 1) ^ ((s & 0x80) ? 0x1B : 0)) & 0xFF;
+        const unsigned int s3 = s2 ^ s;
+        te[i]                 = s2 | (s << 8) | (s << 16) | (s3 << 24);
+    }
+    return te;
+}
+
+inline constexpr std::array<unsigned int, 256> ars_te = make_ars_te_table();
+
+inline unsigned int ars_rotl32(const unsigned int x, const int k)
+{
+    return (x << k) | (x >> (32 - k));
+}
+
+// Same as _mm_aesenc_si128: ShiftRows, SubBytes, MixColumns, AddRoundKey.
+// Word c of the state is column c, byte r of the word is row r.
+inline void ars_aes_round(unsigned int (&v)[4], const unsigned int (&k)[4])
+{
+    unsigned int r[4];
+    for(unsigned int c = 0; c < 4; c++)
+    {
+        r[c] = ars_te[v[c] & 0xFF] ^ ars_rotl32(ars_te[(v[(c + 1) & 3] >> 8) & 0xFF], 8)
+               ^ ars_rotl32(ars_te[(v[(c + 2) & 3] >> 16) & 0xFF], 16)
+               ^ ars_rotl32(ars_te[v[(c + 3) & 3] >> 24], 24) ^ k[c];
+    }
+    for(unsigned int c = 0; c < 4; c++)
+    {
+        v[c] = r[c];
+    }
+}
+
+// Same as _mm_aesenclast_si128: ShiftRows, SubBytes, AddRoundKey.
+inline void ars_aes_last_round(unsigned int (&v)[4], const unsigned int (&k)[4])
+{
+    unsigned int r[4];
+    for(unsigned int c = 0; c < 4; c++)
+    {
+        r[c] = (static_cast<unsigned int>(ars_sbox[v[c] & 0xFF])
+                | static_cast<unsigned int>(ars_sbox[(v[(c + 1) & 3] >> 8) & 0xFF]) << 8
+                | static_cast<unsigned int>(ars_sbox[(v[(c + 2) & 3] >> 16) & 0xFF]) << 16
+                | static_cast<unsigned int>(ars_sbox[v[(c + 3) & 3] >> 24]) << 24)
+               ^ k[c];
+    }
+    for(unsigned int c = 0; c < 4; c++)
+    {
+        v[c] = r[c];
+    }
+}
+
+/// Portable implementation. Writes blocks [first_block, first_block + blocks)
+/// of the stream with key \p key to \p output (4 values per block).
+inline void ars_generate_blocks_scalar(const unsigned long long key,
+                                       const unsigned long long first_block,
+                                       const size_t             blocks,
+                                       unsigned int*            output)
+{
+    unsigned int round_keys[ars_rounds + 1][4];
+    unsigned long long k_lo = key;
+    unsigned long long k_hi = 0;
+    for(unsigned int r = 0; r <= ars_rounds; r++)
+    {
+        round_keys[r][0] = static_cast<unsigned int>(k_lo);
+        round_keys[r][1] = static_cast<unsigned int>(k_lo >> 32);
+        round_keys[r][2] = static_cast<unsigned int>(k_hi);
+        round_keys[r][3] = static_cast<unsigned int>(k_hi >> 32);
+        k_lo += ars_weyl_lo;
+        k_hi += ars_weyl_hi;
+    }
+
+    for(size_t i = 0; i < blocks; i++)
+    {
+        const unsigned long long counter = first_block + i;
+
+        unsigned int v[4] = {static_cast<unsigned int>(counter) ^ round_keys[0][0],
+                             static_cast<unsigned int>(counter >> 32) ^ round_keys[0][1],
+                             round_keys[0][2],
+                             round_keys[0][3]};
+        for(unsigned int r = 1; r < ars_rounds; r++)
+        {
+            ars_aes_round(v, round_keys[r]);
+        }
+        ars_aes_last_round(v, round_keys[ars_rounds]);
+
+        for(unsigned int c = 0; c < 4; c++)
+        {
+            output[4 * i + c] = v[c];
+        }
+    }
+}
+
+#ifdef ROCRAND_ARS_X86_AES
+
+/// AES-NI implementation, produces the same values as ars_generate_blocks_scalar().
+__attribute__((target("aes"))) inline void
+    ars_generate_blocks_aesni(const unsigned long long key,
+                              const unsigned long long first_block,
+                              const size_t             blocks,
+                              unsigned int*            output)
+{
+    const __m128i weyl = _mm_set_epi64x(static_cast<long long>(ars_weyl_hi),
+                                        static_cast<long long>(ars_weyl_lo));
+    __m128i       round_keys[ars_rounds + 1];
+    round_keys[0] = _mm_set_epi64x(0, static_cast<long long>(key));
+    for(unsigned int r = 1; r <= ars_rounds; r++)
+    {
+        round_keys[r] = _mm_add_epi64(round_keys[r - 1], weyl);
+    }
+
+    // Four independent blocks hide the latency of the AES instructions.
+    constexpr size_t lanes = 4;
+    size_t           i     = 0;
+    for(; i + lanes <= blocks; i += lanes)
+    {
+        __m128i v[lanes];
+        for(size_t j = 0; j < lanes; j++)
+        {
+            v[j] = _mm_xor_si128(_mm_set_epi64x(0, static_cast<long long>(first_block + i + j)),
+                                 round_keys[0]);
+        }
+        for(unsigned int r = 1; r < ars_rounds; r++)
+        {
+            for(size_t j = 0; j < lanes; j++)
+            {
+                v[j] = _mm_aesenc_si128(v[j], round_keys[r]);
+            }
+        }
+        for(size_t j = 0; j < lanes; j++)
+        {
+            v[j] = _mm_aesenclast_si128(v[j], round_keys[ars_rounds]);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 4 * (i + j)), v[j]);
+        }
+    }
+    for(; i < blocks; i++)
+    {
+        __m128i v = _mm_xor_si128(_mm_set_epi64x(0, static_cast<long long>(first_block + i)),
+                                  round_keys[0]);
+        for(unsigned int r = 1; r < ars_rounds; r++)
+        {
+            v = _mm_aesenc_si128(v, round_keys[r]);
+        }
+        v = _mm_aesenclast_si128(v, round_keys[ars_rounds]);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + 4 * i), v);
+    }
+}
+
+/// VAES implementation, encrypts two blocks per instruction. Produces the same values
+/// as ars_generate_blocks_scalar().
+__attribute__((target("aes,avx2,vaes"))) inline void
+    ars_generate_blocks_vaes(const unsigned long long key,
+                             const unsigned long long first_block,
+                             const size_t             blocks,
+                             unsigned int*            output)
+{
+    const __m256i weyl = _mm256_set_epi64x(static_cast<long long>(ars_weyl_hi),
+                                           static_cast<long long>(ars_weyl_lo),
+                                           static_cast<long long>(ars_weyl_hi),
+                                           static_cast<long long>(ars_weyl_lo));
+    __m256i       round_keys[ars_rounds + 1];
+    round_keys[0]
+        = _mm256_set_epi64x(0, static_cast<long long>(key), 0, static_cast<long long>(key));
+    for(unsigned int r = 1; r <= ars_rounds; r++)
+    {
+        round_keys[r] = _mm256_add_epi64(round_keys[r - 1], weyl);
+    }
+
+    // Four registers of two blocks each hide the latency of the AES instructions.
+    constexpr size_t lanes = 4;
+    size_t           i     = 0;
+    for(; i + 2 * lanes <= blocks; i += 2 * lanes)
+    {
+        __m256i v[lanes];
+        for(size_t j = 0; j < lanes; j++)
+        {
+            const unsigned long long counter = first_block + i + 2 * j;
+            v[j] = _mm256_xor_si256(_mm256_set_epi64x(0,
+                                                      static_cast<long long>(counter + 1),
+                                                      0,
+                                                      static_cast<long long>(counter)),
+                                    round_keys[0]);
+        }
+        for(unsigned int r = 1; r < ars_rounds; r++)
+        {
+            for(size_t j = 0; j < lanes; j++)
+            {
+                v[j] = _mm256_aesenc_epi128(v[j], round_keys[r]);
+            }
+        }
+        for(size_t j = 0; j < lanes; j++)
+        {
+            v[j] = _mm256_aesenclast_epi128(v[j], round_keys[ars_rounds]);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 4 * (i + 2 * j)), v[j]);
+        }
+    }
+    ars_generate_blocks_aesni(key, first_block + i, blocks - i, output + 4 * i);
+}
+
+#endif // ROCRAND_ARS_X86_AES
+
+enum class ars_implementation
+{
+    scalar,
+    aesni,
+    vaes
+};
+
+/// Returns the fastest implementation supported by the CPU.
+inline ars_implementation ars_get_implementation()
+{
+#ifdef ROCRAND_ARS_X86_AES
+    static const ars_implementation implementation = []
+    {
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("vaes") && __builtin_cpu_supports("avx2"))
+        {
+            return ars_implementation::vaes;
+        }
+        if(__builtin_cpu_supports("aes"))
+        {
+            return ars_implementation::aesni;
+        }
+        return ars_implementation::scalar;
+    }();
+    return implementation;
+#else
+    return ars_implementation::scalar;
+#endif
+}
+
+/// Writes blocks [first_block, first_block + blocks) of the stream with key \p key to
+/// \p output using \p implementation, which must be supported by the CPU.
+inline void ars_generate_blocks(const ars_implementation implementation,
+                                const unsigned long long key,
+                                const unsigned long long first_block,
+                                const size_t             blocks,
+                                unsigned int*            output)
+{
+    switch(implementation)
+    {
+#ifdef ROCRAND_ARS_X86_AES
+        case ars_implementation::vaes:
+            ars_generate_blocks_vaes(key, first_block, blocks, output);
+            break;
+        case ars_implementation::aesni:
+            ars_generate_blocks_aesni(key, first_block, blocks, output);
+            break;
+#endif
+        default: ars_generate_blocks_scalar(key, first_block, blocks, output); break;
+    }
+}
+
+// Each thread generates one contiguous chunk of the output. Values are first written
+// to a small buffer a batch of blocks at a time, so the AES implementations can work
+// on several blocks at once, and the distribution is applied from the buffer.
+template<typename T, typename Distribution>
+void generate_ars(dim3                     block_idx,
+                  dim3                     thread_idx,
+                  dim3                     grid_dim,
+                  dim3                     block_dim,
+                  const ars_implementation implementation,
+                  const unsigned long long key,
+                  const unsigned long long position,
+                  T*                       data,
+                  const size_t             n,
+                  Distribution             distribution)
+{
+    constexpr unsigned int input_width  = Distribution::input_width;
+    constexpr unsigned int output_width = Distribution::output_width;
+
+    constexpr size_t batch_blocks       = 64;
+    constexpr size_t batch_applications = 4 * batch_blocks / input_width;
+
+    const size_t thread_id = block_idx.x * block_dim.x + thread_idx.x;
+    const size_t stride    = grid_dim.x * block_dim.x;
+
+    const size_t applications = (n + output_width - 1) / output_width;
+    const size_t chunk        = (applications + stride - 1) / stride;
+    const size_t begin        = std::min(applications, thread_id * chunk);
+    const size_t end          = std::min(applications, begin + chunk);
+
+    // One more block for a batch that doesn't start at the first value of a block.
+    unsigned int values[4 * (batch_blocks + 1)];
+    unsigned int input[input_width];
+    T            output[output_width];
+
+    for(size_t index = begin; index < end; index += batch_applications)
+    {
+        const size_t count = std::min(batch_applications, end - index);
+
+        const unsigned long long first_value = position + index * input_width;
+        const unsigned int       skip        = first_value % 4;
+        const size_t             blocks      = (skip + count * input_width + 3) / 4;
+        ars_generate_blocks(implementation, key, first_value / 4, blocks, values);
+
+        for(size_t a = 0; a < count; a++)
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = values[skip + a * input_width + i];
+            }
+            distribution(input, output);
+
+            const size_t out_index = (index + a) * output_width;
+            for(unsigned int o = 0; o < output_width; o++)
+            {
+                if(out_index + o < n)
+                {
+                    data[out_index + o] = output[o];
+                }
+            }
+        }
+    }
+}
+
+template<typename System, typename ConfigProvider>
+class ars_generator_template : public generator_impl_base
+{
+public:
+    using base_type   = generator_impl_base;
+    using system_type = System;
+    using poisson_distribution_manager_t
+        = poisson_distribution_manager<DISCRETE_METHOD_ALIAS, system_type>;
+    using poisson_distribution_t = typename poisson_distribution_manager_t::distribution_t;
+    using poisson_approx_distribution_t =
+        typename poisson_distribution_manager_t::approx_distribution_t;
+
+    static_assert(!System::is_device(), "ARS is only supported on the host");
+
+    ars_generator_template(unsigned long long seed   = 0,
+                           unsigned long long offset = 0,
+                           rocrand_ordering   order  = ROCRAND_ORDERING_PSEUDO_DEFAULT,
+                           hipStream_t        stream = 0)
+        : base_type(order, offset, stream), m_seed(seed)
+    {}
+
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_ARS;
+    }
+
+    void reset() override final
+    {
+        m_engines_initialized = false;
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    void set_seed(unsigned long long seed)
+    {
+        m_seed = seed;
+        reset();
+    }
+
+    unsigned long long get_seed() const
+    {
+        return m_seed;
+    }
+
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        static constexpr std::array supported_orderings{
+            ROCRAND_ORDERING_PSEUDO_DEFAULT,
+            ROCRAND_ORDERING_PSEUDO_BEST,
+            ROCRAND_ORDERING_PSEUDO_LEGACY,
+        };
+        if(std::find(supported_orderings.begin(), supported_orderings.end(), order)
+           == supported_orderings.end())
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_order = order;
+        reset();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status set_host_launch_blocks(unsigned int blocks) override final
+    {
+        if(system_type::is_device())
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+        if(blocks == 0 || blocks > max_host_launch_blocks)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_host_launch_blocks = blocks;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status set_stream(hipStream_t stream)
+    {
+        const rocrand_status status = m_poisson.set_stream(stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        base_type::set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        if(m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        m_position = m_offset;
+
+        rocrand_status status = m_poisson.init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<typename T, typename Distribution = uniform_distribution<T>>
+    rocrand_status generate(T* data, size_t data_size, Distribution distribution = Distribution())
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = launch_generate(m_position, data, data_size, distribution);
+        if(status != ROCRAND_STATUS_SUCCESS || data == nullptr)
+        {
+            return status;
+        }
+
+        // Generating data_size values will use this many distributions
+        const auto num_applied_generators = (data_size + Distribution::output_width - 1)
+                                            / Distribution::output_width
+                                            * Distribution::input_width;
+
+        m_position += num_applied_generators;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate(unsigned long long* data, size_t data_size)
+    {
+        // Cannot generate 64-bit values with this generator.
+        (void)data;
+        (void)data_size;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    template<typename Distribution>
+    rocrand_status generate(unsigned long long* data, size_t data_size, Distribution distribution)
+    {
+        // Cannot generate 64-bit values with this generator.
+        (void)data;
+        (void)data_size;
+        (void)distribution;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    /// Generates \p data_size values starting at \p first_index of the stream of the seed.
+    /// The offset and the state of the generator are neither used nor changed.
+    rocrand_status
+        generate_range(unsigned int* data, unsigned long long first_index, size_t data_size) const
+    {
+        return launch_generate(first_index, data, data_size, uniform_distribution<unsigned int>());
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T* data, size_t data_size)
+    {
+        uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T* data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T* data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T* data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T* data, size_t data_size, T alpha, T beta)
+    {
+        beta_distribution<T> distribution(alpha, beta);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status
+        generate_binomial(unsigned int* data, size_t data_size, unsigned int n, double p)
+    {
+        binomial_distribution<> distribution(n, p);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_geometric(unsigned int* data, size_t data_size, double p)
+    {
+        geometric_distribution<> distribution(p);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_poisson(unsigned int* data, size_t data_size, double lambda)
+    {
+        auto result = m_poisson.get_distribution(lambda);
+        if(auto* dis = std::get_if<poisson_distribution_t>(&result))
+        {
+            return generate(data, data_size, *dis);
+        }
+        if(auto* dis = std::get_if<poisson_approx_distribution_t>(&result))
+        {
+            return generate(data, data_size, *dis);
+        }
+        return std::get<rocrand_status>(result);
+    }
+
+private:
+    template<typename T, typename Distribution>
+    rocrand_status launch_generate(const unsigned long long position,
+                                   T*                       data,
+                                   size_t                   data_size,
+                                   Distribution             distribution) const
+    {
+        generator_config config;
+        const hipError_t error = ConfigProvider::template host_config<T>(m_stream, m_order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        if(data == nullptr)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // Every thread writes one contiguous chunk
+        const unsigned int blocks
+            = get_launch_blocks<system_type>(config.threads, config.blocks, 0, 0);
+
+        return system_type::template launch<generate_ars<T, Distribution>, ConfigProvider, T>(
+            dim3(blocks),
+            dim3(config.threads),
+            0,
+            m_stream,
+            ars_get_implementation(),
+            m_seed,
+            position,
+            data,
+            data_size,
+            distribution);
+    }
+
+    bool m_engines_initialized = false;
+
+    unsigned long long m_seed;
+    // Index of the next 32-bit value of the stream
+    unsigned long long m_position = 0;
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager_t m_poisson;
+
+    // m_offset from base_type
+};
+
+// ARS has no device implementation. Every block of the host launch runs a single
+// thread that generates one contiguous chunk.
+template<bool UseHostFunc>
+using ars_generator_host
+    = ars_generator_template<system::host_system<UseHostFunc>, static_config_provider<1, 64>>;
+
+} // namespace rocrand_impl::host
+
+#endif // ROCRAND_RNG_ARS_H_
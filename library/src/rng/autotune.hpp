@@ -0,0 +1,245 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/// \file
+/// \brief Run-time tuning of the number of blocks of the portable ordering.
+
+#ifndef ROCRAND_RNG_AUTOTUNE_H_
+#define ROCRAND_RNG_AUTOTUNE_H_
+
+#include "autotune_cache.hpp"
+#include "config_types.hpp"
+
+#include <rocrand/rocrand.h>
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+#include <set>
+#include <type_traits>
+
+namespace rocrand_impl::host
+{
+
+/// Size of the values generated by every timed launch.
+inline constexpr size_t autotune_bytes = size_t{32} << 20;
+/// Number of timed launches of every candidate, after one launch to warm up.
+inline constexpr unsigned int autotune_repeats = 3;
+
+namespace detail
+{
+
+template<class LaunchOnce>
+hipError_t time_autotune_launches(hipStream_t       stream,
+                                  hipEvent_t        start,
+                                  hipEvent_t        stop,
+                                  const LaunchOnce& launch_once,
+                                  float&            elapsed)
+{
+    if(launch_once() != ROCRAND_STATUS_SUCCESS)
+    {
+        return hipErrorLaunchFailure;
+    }
+    hipError_t error = hipEventRecord(start, stream);
+    for(unsigned int i = 0; i < autotune_repeats && error == hipSuccess; i++)
+    {
+        error = launch_once() == ROCRAND_STATUS_SUCCESS ? hipSuccess : hipErrorLaunchFailure;
+    }
+    if(error == hipSuccess)
+    {
+        error = hipEventRecord(stop, stream);
+    }
+    if(error == hipSuccess)
+    {
+        error = hipEventSynchronize(stop);
+    }
+    if(error == hipSuccess)
+    {
+        error = hipEventElapsedTime(&elapsed, start, stop);
+    }
+    return error;
+}
+
+} // namespace detail
+
+/// Tunes the number of blocks of the portable ordering of \p GeneratorType generating \p T
+/// on the device of \p stream if it is not in the autotune_cache yet. The candidates are the
+/// number of blocks of the dynamic ordering and multiples of the number of compute units, up
+/// to one thread per engine. <tt>launch(blocks, threads, engines, data, n)</tt> must generate
+/// \p n values to \p data with a copy of the \p engines_size \p engines, so the state of the
+/// generator is not changed.
+///
+/// Only device generators with the default configs are tuned, other config providers do not
+/// read the cache.
+template<rocrand_rng_type GeneratorType,
+         class T,
+         class ConfigProvider,
+         class System,
+         class Engine,
+         class Launch>
+rocrand_status autotune_portable_blocks(const hipStream_t  stream,
+                                        const Engine*      engines,
+                                        const unsigned int engines_size,
+                                        Launch&&           launch)
+{
+    if constexpr(!System::is_device()
+                 || !std::is_same_v<ConfigProvider, default_config_provider<GeneratorType>>)
+    {
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    else
+    {
+        autotune_cache& cache = autotune_cache::instance();
+        if(!cache.is_enabled())
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        int              device_id;
+        generator_config config;
+        hipError_t       error = get_device_from_stream(stream, device_id);
+        if(error == hipSuccess)
+        {
+            error = get_generator_config<GeneratorType, T>(stream,
+                                                           ROCRAND_ORDERING_PSEUDO_PORTABLE,
+                                                           config);
+        }
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        // More blocks than needed for one engine per thread would only add idle threads
+        const unsigned int max_blocks = (engines_size + config.threads - 1) / config.threads;
+
+        unsigned int blocks;
+        bool         found;
+        unsigned int compute_units;
+        error = cache.find(device_id,
+                           GeneratorType,
+                           get_autotune_value_type<T>(),
+                           max_blocks,
+                           blocks,
+                           found);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(found)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        error = cache.get_compute_units(device_id, compute_units);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        std::set<unsigned int> candidates{std::min(config.blocks, max_blocks)};
+        for(unsigned int b = compute_units; b > 0 && b <= max_blocks; b *= 2)
+        {
+            candidates.insert(b);
+        }
+
+        const size_t n = autotune_bytes / sizeof(T);
+
+        Engine*        scratch_engines;
+        T*             data;
+        rocrand_status status = System::alloc(&scratch_engines, engines_size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = System::alloc(&data, n);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            System::free(scratch_engines);
+            return status;
+        }
+        status = System::memcpy(scratch_engines,
+                                engines,
+                                sizeof(Engine) * engines_size,
+                                hipMemcpyDeviceToDevice);
+
+        hipEvent_t start = nullptr;
+        hipEvent_t stop  = nullptr;
+        error            = status == ROCRAND_STATUS_SUCCESS ? hipEventCreate(&start)
+                                                            : hipErrorInvalidValue;
+        if(error == hipSuccess)
+        {
+            error = hipEventCreate(&stop);
+        }
+
+        unsigned int best_blocks  = 0;
+        float        best_elapsed = 0.0f;
+        for(auto it = candidates.begin(); it != candidates.end() && error == hipSuccess; ++it)
+        {
+            const unsigned int candidate = *it;
+
+            float elapsed;
+            error = detail::time_autotune_launches(
+                stream,
+                start,
+                stop,
+                [&]
+                {
+                    return launch(dim3(candidate),
+                                  dim3(config.threads),
+                                  scratch_engines,
+                                  data,
+                                  n);
+                },
+                elapsed);
+            if(error == hipSuccess && (best_blocks == 0 || elapsed < best_elapsed))
+            {
+                best_blocks  = candidate;
+                best_elapsed = elapsed;
+            }
+        }
+
+        if(start != nullptr)
+        {
+            ROCRAND_HIP_FATAL_ASSERT(hipEventDestroy(start));
+        }
+        if(stop != nullptr)
+        {
+            ROCRAND_HIP_FATAL_ASSERT(hipEventDestroy(stop));
+        }
+        System::free(data);
+        System::free(scratch_engines);
+
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+        return cache.store(device_id, GeneratorType, get_autotune_value_type<T>(), best_blocks)
+                       == hipSuccess
+                   ? ROCRAND_STATUS_SUCCESS
+                   : ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+}
+
+} // namespace rocrand_impl::host
+
+#endif // ROCRAND_RNG_AUTOTUNE_H_
@@ -0,0 +1,247 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/// \file
+/// \brief Persistent cache of the launch configs tuned at run time.
+///
+/// The block sizes of the kernels are compile-time constants, but with
+/// ROCRAND_ORDERING_PSEUDO_PORTABLE the number of blocks does not change the generated values.
+/// When the environment variable ROCRAND_AUTOTUNE_CACHE names a file, the first generation of
+/// every generator and value type on a device times a few numbers of blocks and the fastest
+/// one is kept in that file, keyed by the architecture, the number of compute units and the
+/// driver version of the device and by the version of rocRAND. Later processes read the file
+/// instead of tuning again.
+///
+/// Every line of the file is <tt>device \\t generator \\t value type \\t blocks</tt>, lines
+/// that cannot be parsed are ignored and later lines replace earlier ones.
+
+#ifndef ROCRAND_RNG_AUTOTUNE_CACHE_H_
+#define ROCRAND_RNG_AUTOTUNE_CACHE_H_
+
+#include <rocrand/rocrand.h>
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace rocrand_impl::host
+{
+
+/// Name of the value type \p T in the keys of the cache, e.g. "u32" or "f64".
+template<class T>
+std::string get_autotune_value_type()
+{
+    return (std::is_integral_v<T> ? "u" : "f") + std::to_string(8 * sizeof(T));
+}
+
+class autotune_cache
+{
+public:
+    /// The cache of the file named by ROCRAND_AUTOTUNE_CACHE, it is disabled if the variable
+    /// is not set.
+    static autotune_cache& instance()
+    {
+        static autotune_cache cache(get_path_from_environment());
+        return cache;
+    }
+
+    explicit autotune_cache(std::string path) : m_path(std::move(path)) {}
+
+    bool is_enabled() const
+    {
+        return !m_path.empty();
+    }
+
+    /// Sets \p blocks to the tuned number of blocks of \p type generating \p value_type on
+    /// \p device_id, clamped to [1, \p max_blocks] in case the file was edited or written for
+    /// other configs. \p found is set to false, and \p blocks is not changed, if the configuration
+    /// has not been tuned yet.
+    hipError_t find(int                device_id,
+                    rocrand_rng_type   type,
+                    const std::string& value_type,
+                    const unsigned int max_blocks,
+                    unsigned int&      blocks,
+                    bool&              found)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        found = false;
+        std::string      key;
+        const hipError_t error = get_key(device_id, type, value_type, key);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        load();
+        const auto it = m_blocks.find(key);
+        if(it != m_blocks.end())
+        {
+            blocks = std::clamp(it->second, 1U, max_blocks);
+            found  = true;
+        }
+        return hipSuccess;
+    }
+
+    /// Keeps \p blocks as the tuned number of blocks of \p type generating \p value_type on
+    /// \p device_id and appends it to the file. The cache is still used by this process if
+    /// the file cannot be written.
+    hipError_t store(int                device_id,
+                     rocrand_rng_type   type,
+                     const std::string& value_type,
+                     unsigned int       blocks)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        std::string      key;
+        const hipError_t error = get_key(device_id, type, value_type, key);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        load();
+        m_blocks[key] = blocks;
+
+        std::ofstream file(m_path, std::ios::app);
+        file << key << '\t' << blocks << '\n';
+        return hipSuccess;
+    }
+
+    /// Returns the number of compute units of \p device_id.
+    hipError_t get_compute_units(int device_id, unsigned int& compute_units)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        const device_info* info;
+        const hipError_t   error = get_device_info(device_id, info);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        compute_units = info->compute_units;
+        return hipSuccess;
+    }
+
+private:
+    struct device_info
+    {
+        std::string  key;
+        unsigned int compute_units;
+    };
+
+    static std::string get_path_from_environment()
+    {
+        const char* path = std::getenv("ROCRAND_AUTOTUNE_CACHE");
+        return path == nullptr ? std::string() : std::string(path);
+    }
+
+    hipError_t get_device_info(int device_id, const device_info*& info)
+    {
+        const auto it = m_devices.find(device_id);
+        if(it != m_devices.end())
+        {
+            info = &it->second;
+            return hipSuccess;
+        }
+
+        hipDeviceProp_t props;
+        hipError_t      error = hipGetDeviceProperties(&props, device_id);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        int driver_version;
+        error = hipDriverGetVersion(&driver_version);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+
+        // Other versions of the library may have other kernels, so they are tuned again
+        const unsigned int compute_units = static_cast<unsigned int>(props.multiProcessorCount);
+        device_info        new_info{std::string(props.gcnArchName) + ':'
+                                 + std::to_string(compute_units) + ':'
+                                 + std::to_string(driver_version) + ':'
+                                 + std::to_string(ROCRAND_VERSION),
+                             compute_units};
+        info = &m_devices.emplace(device_id, std::move(new_info)).first->second;
+        return hipSuccess;
+    }
+
+    hipError_t get_key(int                device_id,
+                       rocrand_rng_type   type,
+                       const std::string& value_type,
+                       std::string&       key)
+    {
+        const device_info* info;
+        const hipError_t   error = get_device_info(device_id, info);
+        if(error != hipSuccess)
+        {
+            return error;
+        }
+        key = info->key + '\t' + std::to_string(static_cast<int>(type)) + '\t' + value_type;
+        return hipSuccess;
+    }
+
+    void load()
+    {
+        if(m_loaded)
+        {
+            return;
+        }
+        m_loaded = true;
+
+        std::ifstream file(m_path);
+        std::string   line;
+        while(std::getline(file, line))
+        {
+            const size_t separator = line.rfind('\t');
+            if(separator == std::string::npos)
+            {
+                continue;
+            }
+            std::istringstream blocks_stream(line.substr(separator + 1));
+            unsigned int       blocks;
+            if(blocks_stream >> blocks && blocks > 0)
+            {
+                m_blocks[line.substr(0, separator)] = blocks;
+            }
+        }
+    }
+
+    std::mutex                          m_mutex;
+    std::string                         m_path;
+    bool                                m_loaded = false;
+    std::map<std::string, unsigned int> m_blocks;
+    std::map<int, device_info>          m_devices;
+};
+
+} // namespace rocrand_impl::host
+
+#endif // ROCRAND_RNG_AUTOTUNE_CACHE_H_
@@ -35,6 +35,7 @@
 #include <hip/hip_runtime.h>
 #include <hip/hip_runtime_api.h>
 
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 
@@ -47,6 +48,143 @@ struct alignas(sizeof(T) * N) aligned_vec_type
     T data[N];
 };
 
+namespace host
+{
+
+/// Output of the generate kernels that stores the values contiguously at \p data.
+template<class T>
+struct dense_output
+{
+    using value_type = T;
+
+    T* data;
+
+    /// Number of values stored one by one before the values that are stored in vectors of
+    /// \p Width values.
+    template<unsigned int Width>
+    __host__ __device__ __forceinline__ size_t misalignment() const
+    {
+        const uintptr_t uintptr = reinterpret_cast<uintptr_t>(data);
+        return (Width - uintptr / sizeof(T) % Width) % Width;
+    }
+
+    __host__ __device__ __forceinline__ T& operator[](const size_t index) const
+    {
+        return data[index];
+    }
+
+    /// Stores \p Width values at \p index, which is misalignment<Width>() plus a multiple of
+    /// \p Width.
+    template<unsigned int Width>
+    __host__ __device__ __forceinline__ void store(const size_t index, const T* values) const
+    {
+        using vec_type = aligned_vec_type<T, Width>;
+        *reinterpret_cast<vec_type*>(data + index) = *reinterpret_cast<const vec_type*>(values);
+    }
+};
+
+/// Output of the generate kernels that stores value i at row <tt>i / width</tt> and column
+/// <tt>i % width</tt> of a 2-D array with \p pitch elements per row. The values are the same
+/// as the ones of a dense output aligned to the vectors of the kernel.
+template<class T>
+struct pitched_output
+{
+    using value_type = T;
+
+    T*     data;
+    size_t width;
+    size_t pitch;
+
+    template<unsigned int Width>
+    __host__ __device__ __forceinline__ size_t misalignment() const
+    {
+        return 0;
+    }
+
+    __host__ __device__ __forceinline__ T& operator[](const size_t index) const
+    {
+        return data[index / width * pitch + index % width];
+    }
+
+    template<unsigned int Width>
+    __host__ __device__ __forceinline__ void store(const size_t index, const T* values) const
+    {
+        for(unsigned int i = 0; i < Width; i++)
+        {
+            (*this)[index + i] = values[i];
+        }
+    }
+};
+
+/// The engines run by one thread of the generate kernels of engine-based generators:
+/// \p first, <tt>first + step</tt>, ... up to \p last.
+struct virtual_engine_range
+{
+    unsigned int first;
+    unsigned int last;
+    unsigned int step;
+};
+
+/// Returns the engines of \p num_engines run by thread \p id of a grid of \p stride threads.
+/// Adjacent device threads run adjacent engines, so their accesses are coalesced. The threads
+/// of a block run one after another on the host, so there every thread runs a contiguous range
+/// of engines, and the values of an engine are written next to the values of the previous
+/// engine while they are still in the cache.
+__host__ __device__ inline virtual_engine_range get_virtual_engine_range(
+    const unsigned int id, const unsigned int stride, const unsigned int num_engines)
+{
+#if defined(__HIP_DEVICE_COMPILE__)
+    return virtual_engine_range{id, num_engines, stride};
+#else
+    const unsigned int engines_per_thread = (num_engines + stride - 1) / stride;
+    const unsigned int first = id <= (num_engines - 1) / engines_per_thread
+                                   ? id * engines_per_thread
+                                   : num_engines;
+    const unsigned int last  = num_engines - first < engines_per_thread
+                                   ? num_engines
+                                   : first + engines_per_thread;
+    return virtual_engine_range{first, last, 1};
+#endif
+}
+
+/// Writes the 32-bit halves of the 64-bit values of \p engine to \p data, the lower half
+/// first. If \p first_half is 1, the first half written is the upper half of the first value.
+/// Every value is computed from its own position, so unlike the generate kernels the output
+/// does not depend on the alignment of \p data.
+template<class Engine>
+__host__ __device__ __forceinline__ void generate_halves(dim3               block_idx,
+                                                         dim3               thread_idx,
+                                                         dim3               grid_dim,
+                                                         dim3               block_dim,
+                                                         Engine             engine,
+                                                         unsigned int*      data,
+                                                         const size_t       n,
+                                                         const unsigned int first_half)
+{
+    const size_t thread_id = block_idx.x * block_dim.x + thread_idx.x;
+    const size_t stride    = grid_dim.x * block_dim.x;
+
+    const size_t values = (first_half + n + 1) / 2;
+    for(size_t index = thread_id; index < values; index += stride)
+    {
+        Engine value_engine = engine;
+        value_engine.discard(index);
+        const unsigned long long value = value_engine();
+
+        const size_t lower = 2 * index;
+        if(lower >= first_half && lower - first_half < n)
+        {
+            data[lower - first_half] = static_cast<unsigned int>(value);
+        }
+        if(lower + 1 - first_half < n)
+        {
+            data[lower + 1 - first_half] = static_cast<unsigned int>(value >> 32);
+        }
+    }
+}
+
+} // namespace host
+
 } // namespace rocrand_impl
 
 /**
@@ -107,6 +107,41 @@ struct generator_config_defaults<ROCRAND_RNG_PSEUDO_THREEFRY4_64_20, T>
     static constexpr inline unsigned int blocks  = 1024;
 };
 
+template<class T>
+struct generator_config_defaults<ROCRAND_RNG_PSEUDO_PHILOX4_64_10, T>
+{
+    static constexpr inline unsigned int threads = 256;
+    static constexpr inline unsigned int blocks  = 1024;
+};
+
+template<class T>
+struct generator_config_defaults<ROCRAND_RNG_PSEUDO_XOSHIRO256PP, T>
+{
+    static constexpr inline unsigned int threads = 256;
+    static constexpr inline unsigned int blocks  = 512;
+};
+
+template<class T>
+struct generator_config_defaults<ROCRAND_RNG_PSEUDO_XOROSHIRO128SS, T>
+{
+    static constexpr inline unsigned int threads = 256;
+    static constexpr inline unsigned int blocks  = 512;
+};
+
+template<class T>
+struct generator_config_defaults<ROCRAND_RNG_PSEUDO_PCG64_DXSM, T>
+{
+    static constexpr inline unsigned int threads = 256;
+    static constexpr inline unsigned int blocks  = 512;
+};
+
+template<class T>
+struct generator_config_defaults<ROCRAND_RNG_PSEUDO_SQUARES, T>
+{
+    static constexpr inline unsigned int threads = 256;
+    static constexpr inline unsigned int blocks  = 1024;
+};
+
 } // end namespace rocrand_impl::host
 
 #endif // ROCRAND_RNG_CONFIG_CONFIG_DEFAULTS_HPP_
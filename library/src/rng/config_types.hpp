@@ -21,6 +21,7 @@
 #ifndef ROCRAND_RNG_CONFIG_TYPES_H_
 #define ROCRAND_RNG_CONFIG_TYPES_H_
 
+#include "autotune_cache.hpp"
 #include "common.hpp"
 #include "rocrand/rocrand.h"
 #include "utils/cpp_utils.hpp"
@@ -32,6 +33,7 @@
 #include <limits>
 #include <numeric>
 #include <string>
+#include <type_traits>
 
 namespace rocrand_impl::host
 {
@@ -180,7 +182,6 @@ inline hipError_t get_device_arch([[maybe_unused]] int device_id, target_arch& a
     return hipSuccess;
 }
 
-#ifdef USE_DEVICE_DISPATCH
 /// @brief Queries a device corresponding to a stream using the HIP API.
 /// @param stream The stream in question.
 /// @param device_id Out parameter. The result of the device query is written here.
@@ -204,7 +205,6 @@ inline hipError_t get_device_from_stream(const hipStream_t stream, int& device_i
     }
     return hipSuccess;
 }
-#endif
 
 /// @brief Queries the device architecture of a device corresponding to a HIP stream.
 /// @param stream The ID of the HIP stream.
@@ -282,9 +282,36 @@ struct generator_config
 __host__ __device__ constexpr bool is_ordering_dynamic(const rocrand_ordering ordering)
 {
     return ordering == ROCRAND_ORDERING_PSEUDO_DYNAMIC
+           || ordering == ROCRAND_ORDERING_PSEUDO_PORTABLE
            || ordering == ROCRAND_ORDERING_QUASI_DEFAULT;
 }
 
+/// @brief Returns the ordering that defines the generated sequence of the provided ordering.
+/// \c ROCRAND_ORDERING_PSEUDO_PORTABLE generates the sequence of the default ordering, its
+/// kernels run the engines of the default configs with the threads of the dynamic configs.
+__host__ __device__ constexpr rocrand_ordering
+    get_sequence_ordering(const rocrand_ordering ordering)
+{
+    return ordering == ROCRAND_ORDERING_PSEUDO_PORTABLE ? ROCRAND_ORDERING_PSEUDO_DEFAULT
+                                                        : ordering;
+}
+
+/// @brief Returns the ordering that selects the kernel launch parameters of the provided
+/// ordering. Host generators do not select configs for a device, so they launch
+/// \c ROCRAND_ORDERING_PSEUDO_PORTABLE with the configs of the default ordering. The values
+/// of \c ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE do not depend on the config, so devices launch
+/// it with the configs of the dynamic ordering.
+__host__ __device__ constexpr rocrand_ordering
+    get_launch_ordering(const rocrand_ordering ordering, const bool is_device)
+{
+    if(!is_device)
+    {
+        return get_sequence_ordering(ordering);
+    }
+    return ordering == ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE ? ROCRAND_ORDERING_PSEUDO_DYNAMIC
+                                                           : ordering;
+}
+
 /// @brief Returns whether this ordering is applicable to pseudo-random number generators.
 __host__ __device__ constexpr bool is_ordering_pseudo(const rocrand_ordering ordering)
 {
@@ -308,6 +335,39 @@ auto dynamic_dispatch(rocrand_ordering order, Function&& func)
     return std::forward<Function>(func)(std::false_type{});
 }
 
+/// @brief The largest number of sequences generated by one launch of a batched kernel. Every
+/// sequence is generated by one row of the grid, and the y dimension of grids is limited.
+inline constexpr size_t max_batch_grid_rows = 65535;
+
+/// @brief Returns the largest number of blocks of \p threads threads that are tuned for the
+/// portable ordering of \p GeneratorType, which runs the engines of the default configs of
+/// all value types. More blocks than needed for one thread per engine would only add idle
+/// threads.
+template<rocrand_rng_type GeneratorType>
+constexpr unsigned int get_portable_max_blocks(const unsigned int threads)
+{
+    const auto get_grid_size = [](const auto tag)
+    {
+        using T = std::decay_t<decltype(tag)>;
+        return generator_config_defaults<GeneratorType, T>::threads
+               * generator_config_defaults<GeneratorType, T>::blocks;
+    };
+    const unsigned int grid_sizes[] = {get_grid_size(static_cast<unsigned int>(0)),
+                                       get_grid_size(static_cast<unsigned short>(0)),
+                                       get_grid_size(static_cast<unsigned char>(0)),
+                                       get_grid_size(static_cast<unsigned long long>(0)),
+                                       get_grid_size(0.0f),
+                                       get_grid_size(0.0),
+                                       get_grid_size(half())};
+
+    unsigned int engines = 1;
+    for(const unsigned int grid_size : grid_sizes)
+    {
+        engines = cpp_utils::lcm(engines, grid_size);
+    }
+    return (engines + threads - 1) / threads;
+}
+
 /// @brief Selects the preset kernel launch config for the given random engine and
 /// generated value type.
 /// @tparam T The datatype of the generated random values.
@@ -331,6 +391,26 @@ hipError_t get_generator_config(const hipStream_t      stream,
         }
         config.threads = generator_config_selector<GeneratorType, T>::get_threads(current_arch);
         config.blocks  = generator_config_selector<GeneratorType, T>::get_blocks(current_arch);
+
+        // The number of blocks does not change the values of the portable ordering, so it
+        // can be replaced by the one tuned at run time (see autotune_cache)
+        autotune_cache& cache = autotune_cache::instance();
+        if(ordering == ROCRAND_ORDERING_PSEUDO_PORTABLE && cache.is_enabled())
+        {
+            int              device_id;
+            const hipError_t device_error = get_device_from_stream(stream, device_id);
+            if(device_error != hipSuccess)
+            {
+                return device_error;
+            }
+            bool found;
+            return cache.find(device_id,
+                              GeneratorType,
+                              get_autotune_value_type<T>(),
+                              get_portable_max_blocks<GeneratorType>(config.threads),
+                              config.blocks,
+                              found);
+        }
     }
     else
     {
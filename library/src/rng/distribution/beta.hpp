@@ -0,0 +1,249 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_BETA_H_
+#define ROCRAND_RNG_DISTRIBUTION_BETA_H_
+
+#include "../common.hpp"
+#include "gamma.hpp"
+
+#include <rocrand/rocrand_uniform.h>
+
+#include <hip/hip_runtime.h>
+
+#include <float.h>
+#include <type_traits>
+
+// Beta distribution
+//
+// R. C. H. Cheng
+// Generating beta variates with nonintegral shape parameters
+// Communications of the ACM 21, 1978
+//
+// Algorithm BB if both shapes are greater than 1, algorithm BC otherwise. Like the gamma
+// distribution, both are rejection methods that use two uniformly distributed values per
+// attempt, see rejection.hpp.
+
+namespace rocrand_impl::host
+{
+
+/// \brief Parameters and sampling method of the beta distribution.
+template<class T>
+struct beta_sampler
+{
+    using result_type  = T;
+    using uniform_type = T;
+
+    T a; // The smaller shape
+    T b; // The larger shape
+    T sum;
+    T v_scale;
+    // Algorithm BB
+    T bb_gamma;
+    // Algorithm BC
+    T k1;
+    T k2;
+
+    bool algorithm_bb;
+    bool alpha_is_smaller;
+
+    beta_sampler(T alpha, T beta)
+        : a(alpha <= beta ? alpha : beta)
+        , b(alpha <= beta ? beta : alpha)
+        , sum(alpha + beta)
+        , algorithm_bb(a > T(1))
+        , alpha_is_smaller(alpha <= beta)
+    {
+        if(algorithm_bb)
+        {
+            v_scale  = sqrt((sum - T(2)) / (T(2) * a * b - sum));
+            bb_gamma = a + T(1) / v_scale;
+            k1       = T(0);
+            k2       = T(0);
+        }
+        else
+        {
+            const T delta = T(1) + b - a;
+            v_scale       = T(1) / a;
+            bb_gamma      = T(0);
+            k1 = delta * (T(0.0138889) + T(0.0416667) * a) / (b * v_scale - T(0.777778));
+            k2 = T(0.25) + (T(0.5) + T(0.25) / delta) * a;
+        }
+    }
+
+    /// \brief One attempt to sample a beta distributed value from the uniformly distributed
+    /// values \p u and \p v in (0, 1]. Returns a negative value if the attempt is rejected.
+    __forceinline__ __host__ __device__
+    T attempt(const T u, const T v) const
+    {
+        using math = rejection_math<T>;
+
+        if(algorithm_bb)
+        {
+            const T x = v_scale * math::log_(u / (T(1) - u));
+            const T w = weight(a, x);
+            const T z = u * u * v;
+            const T r = bb_gamma * x - T(1.3862944);
+            const T s = a + r - w;
+            if(s + T(2.609438) < T(5) * z)
+            {
+                const T t = math::log_(z);
+                if(s <= t && r + sum * math::log_(sum / (b + w)) < t)
+                {
+                    return T(-1);
+                }
+            }
+            return alpha_is_smaller ? w / (b + w) : b / (b + w);
+        }
+
+        // Some values in the upper half are accepted without the final test
+        T    z;
+        bool test = true;
+        if(u < T(0.5))
+        {
+            const T y = u * v;
+            z         = u * y;
+            if(T(0.25) * v + z - y >= k1)
+            {
+                return T(-1);
+            }
+        }
+        else
+        {
+            z = u * u * v;
+            if(z <= T(0.25))
+            {
+                test = false;
+            }
+            else if(z >= k2)
+            {
+                return T(-1);
+            }
+        }
+        const T x = v_scale * math::log_(u / (T(1) - u));
+        const T w = weight(b, x);
+        if(test && sum * (math::log_(sum / (a + w)) + x) - T(1.3862944) < math::log_(z))
+        {
+            return T(-1);
+        }
+        return alpha_is_smaller ? a / (a + w) : w / (a + w);
+    }
+
+    __forceinline__ __host__ __device__
+    static bool is_rejected(const T value)
+    {
+        return value < T(0);
+    }
+
+private:
+    /// \brief Returns <tt>shape * exp(x)</tt>, limited to the largest finite value.
+    __forceinline__ __host__ __device__
+    static T weight(const T shape, const T x)
+    {
+        constexpr T max     = std::is_same_v<T, float> ? T(FLT_MAX) : T(DBL_MAX);
+        constexpr T log_max = std::is_same_v<T, float> ? T(88.7228391) : T(709.782712893384);
+        const T     w       = x < log_max ? shape * rejection_math<T>::exp_(x) : max;
+        return w < max ? w : max;
+    }
+};
+
+// Universal and 64 bit Universal
+
+template<class Output, class Input = unsigned int>
+struct beta_distribution
+{
+    static_assert(std::is_same_v<Output, float> || std::is_same_v<Output, double>,
+                  "The beta distribution supports only float and double");
+
+    static constexpr unsigned int input_width  = 2;
+    static constexpr unsigned int output_width = 1;
+
+    const beta_sampler<Output> sampler;
+
+    beta_distribution(Output alpha, Output beta) : sampler(alpha, beta) {}
+
+    __forceinline__ __host__ __device__
+    void operator()(const Input (&input)[2], Output (&output)[1]) const
+    {
+        output[0] = sample_rejection(sampler,
+                                     uniform(input[0]),
+                                     uniform(input[1]),
+                                     input[0],
+                                     input[1]);
+    }
+
+private:
+    __forceinline__ __host__ __device__
+    static Output uniform(const Input v)
+    {
+        if constexpr(std::is_same_v<Output, float>)
+        {
+            return rocrand_device::detail::uniform_distribution(v);
+        }
+        else
+        {
+            return rocrand_device::detail::uniform_distribution_double(v);
+        }
+    }
+};
+
+// Mrg32k3a and Mrg31k3p
+
+template<class T, typename state_type>
+struct mrg_engine_beta_distribution
+{
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                  "The beta distribution supports only float and double");
+
+    static constexpr unsigned int input_width  = 2;
+    static constexpr unsigned int output_width = 1;
+
+    const beta_sampler<T> sampler;
+
+    mrg_engine_beta_distribution(T alpha, T beta) : sampler(alpha, beta) {}
+
+    __forceinline__ __host__ __device__
+    void operator()(const unsigned int (&input)[2], T (&output)[1]) const
+    {
+        output[0] = sample_rejection(sampler,
+                                     uniform(input[0]),
+                                     uniform(input[1]),
+                                     input[0],
+                                     input[1]);
+    }
+
+private:
+    __forceinline__ __host__ __device__
+    static T uniform(const unsigned int v)
+    {
+        if constexpr(std::is_same_v<T, float>)
+        {
+            return rocrand_device::detail::mrg_uniform_distribution<state_type>(v);
+        }
+        else
+        {
+            return rocrand_device::detail::mrg_uniform_distribution_double<state_type>(v);
+        }
+    }
+};
+
+} // namespace rocrand_impl::host
+
+#endif // ROCRAND_RNG_DISTRIBUTION_BETA_H_
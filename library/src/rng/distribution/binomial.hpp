@@ -0,0 +1,175 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
+#define ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
+
+#include "../common.hpp"
+#include "rejection.hpp"
+
+#include <rocrand/rocrand_binomial.h>
+#include <rocrand/rocrand_mrg31k3p.h>
+#include <rocrand/rocrand_mrg32k3a.h>
+#include <rocrand/rocrand_uniform.h>
+
+#include <hip/hip_runtime.h>
+
+
+// Binomial distribution, BTRD for n * min(p, 1 - p) >= 10 and inversion otherwise, see
+// rocrand_binomial.h. The parameters are computed once per generate call. Like the gamma
+// distribution, both are rejection methods that use at most two uniformly distributed values per
+// attempt, see rejection.hpp. The quasi-random generators use inversion of a single value
+// instead.
+
+namespace rocrand_impl::host
+{
+
+/// \brief Parameters and sampling method of the binomial distribution.
+struct binomial_sampler
+{
+    using result_type  = unsigned int;
+    using uniform_type = double;
+
+    rocrand_device::detail::binomial_distribution_params params;
+    /// The value of rejected attempts. It is only a possible result if n is the largest value
+    /// and n successes with a probability of at most 0.5 are sampled, which does not happen.
+    unsigned int rejected_value;
+
+    binomial_sampler(unsigned int n, double p)
+        : params(rocrand_device::detail::make_binomial_distribution_params(n, p))
+        , rejected_value(params.flip && n == ~0u ? 0u : ~0u)
+    {}
+
+    /// \brief One attempt to sample a binomially distributed value from the uniformly
+    /// distributed values \p u and \p v in (0, 1].
+    __forceinline__ __host__ __device__
+    unsigned int attempt(const double u, const double v) const
+    {
+        unsigned int x;
+        bool         accepted;
+        if(params.np < rocrand_device::detail::binomial_threshold_btrd)
+        {
+            accepted
+                = rocrand_device::detail::binomial_distribution_inversion_attempt(u, params, x);
+        }
+        else
+        {
+            uniform_pair uniform{{u, v}, 0};
+            accepted
+                = rocrand_device::detail::binomial_distribution_btrd_attempt(uniform, params, x);
+        }
+        if(!accepted)
+        {
+            return rejected_value;
+        }
+        return params.flip ? params.n - x : x;
+    }
+
+    __forceinline__ __host__ __device__
+    bool is_rejected(const unsigned int value) const
+    {
+        return value == rejected_value;
+    }
+
+private:
+    struct uniform_pair
+    {
+        double       values[2];
+        unsigned int next;
+
+        __forceinline__ __host__ __device__
+        double operator()()
+        {
+            return values[next++];
+        }
+    };
+};
+
+// Universal and 64 bit Universal
+
+template<class Input = unsigned int>
+struct binomial_distribution
+{
+    static constexpr unsigned int input_width  = 2;
+    static constexpr unsigned int output_width = 1;
+
+    const binomial_sampler sampler;
+
+    binomial_distribution(unsigned int n, double p) : sampler(n, p) {}
+
+    __forceinline__ __host__ __device__
+    void operator()(const Input (&input)[2], unsigned int (&output)[1]) const
+    {
+        output[0]
+            = sample_rejection(sampler,
+                               rocrand_device::detail::uniform_distribution_double(input[0]),
+                               rocrand_device::detail::uniform_distribution_double(input[1]),
+                               input[0],
+                               input[1]);
+    }
+};
+
+// Mrg32k3a and Mrg31k3p
+
+template<typename state_type>
+struct mrg_engine_binomial_distribution
+{
+    static constexpr unsigned int input_width  = 2;
+    static constexpr unsigned int output_width = 1;
+
+    const binomial_sampler sampler;
+
+    mrg_engine_binomial_distribution(unsigned int n, double p) : sampler(n, p) {}
+
+    __forceinline__ __host__ __device__
+    void operator()(const unsigned int (&input)[2], unsigned int (&output)[1]) const
+    {
+        output[0] = sample_rejection(
+            sampler,
+            rocrand_device::detail::mrg_uniform_distribution_double<state_type>(input[0]),
+            rocrand_device::detail::mrg_uniform_distribution_double<state_type>(input[1]),
+            input[0],
+            input[1]);
+    }
+};
+
+// Sobol
+
+struct sobol_binomial_distribution
+{
+    const rocrand_device::detail::binomial_distribution_params params;
+
+    sobol_binomial_distribution(unsigned int n, double p)
+        : params(rocrand_device::detail::make_binomial_distribution_params(n, p))
+    {}
+
+    template<class DirectionVectorType>
+    __forceinline__ __host__ __device__
+    unsigned int operator()(const DirectionVectorType x) const
+    {
+        return rocrand_device::detail::binomial_distribution_inv(
+            rocrand_device::detail::uniform_distribution_double(x),
+            params);
+    }
+};
+
+} // namespace rocrand_impl::host
+
+#endif // ROCRAND_RNG_DISTRIBUTION_BINOMIAL_H_
@@ -0,0 +1,256 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_BROWNIAN_BRIDGE_H_
+#define ROCRAND_RNG_DISTRIBUTION_BROWNIAN_BRIDGE_H_
+
+#include "../system.hpp"
+
+#include <rocrand/rocrand.h>
+
+#include <hip/hip_runtime.h>
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+// Brownian bridge construction of Wiener paths
+//
+// P. Jaeckel
+// Monte Carlo Methods in Finance, 2002
+//
+// P. Glasserman
+// Monte Carlo Methods in Financial Engineering, 2003, Section 3.1
+//
+// The first normal value determines the end point of the path and every next value fills in
+// the midpoint of the widest remaining gap. Driving the construction with the dimensions of a
+// quasi-random sequence in order assigns the best distributed (lowest) dimensions to the
+// coarse structure of the paths.
+
+namespace rocrand_impl::host
+{
+
+/// \brief One step of a Brownian bridge construction: the point \p bridge_index of the path is
+/// interpolated between points <tt>left_index - 1</tt> (or the origin if \p left_index is 0)
+/// and \p right_index, and a normal value scaled by \p stddev is added.
+template<class T>
+struct brownian_bridge_step
+{
+    unsigned int bridge_index;
+    unsigned int left_index;
+    unsigned int right_index;
+    T            left_weight;
+    T            right_weight;
+    T            stddev;
+};
+
+/// \brief Computes the construction order of a Brownian bridge over \p count equally spaced
+/// unit time steps. The standard deviations scale with the square root of the time step, so
+/// the same steps are valid for any time step.
+template<class T>
+std::vector<brownian_bridge_step<T>> create_brownian_bridge_steps(const unsigned int count)
+{
+    std::vector<brownian_bridge_step<T>> steps(count);
+    // Construction step that fills each point of the path, 0 if not filled yet
+    std::vector<unsigned int> filled(count, 0);
+
+    // Times are t[i] = i + 1
+    const auto t = [](const unsigned int i) { return static_cast<double>(i) + 1.0; };
+
+    filled[count - 1] = 1;
+    steps[0]          = {count - 1, 0, 0, T(0), T(0), static_cast<T>(std::sqrt(t(count - 1)))};
+
+    unsigned int j = 0;
+    for(unsigned int i = 1; i < count; i++)
+    {
+        // Find the next gap
+        while(filled[j])
+        {
+            j++;
+        }
+        unsigned int k = j;
+        while(!filled[k])
+        {
+            k++;
+        }
+        // Fill its midpoint
+        const unsigned int l = j + ((k - 1 - j) >> 1);
+        filled[l]            = i;
+
+        const double t_left  = j == 0 ? 0.0 : t(j - 1);
+        const double t_mid   = t(l);
+        const double t_right = t(k);
+
+        steps[i] = {l,
+                    j,
+                    k,
+                    static_cast<T>((t_right - t_mid) / (t_right - t_left)),
+                    static_cast<T>((t_mid - t_left) / (t_right - t_left)),
+                    static_cast<T>(
+                        std::sqrt((t_mid - t_left) * (t_right - t_mid) / (t_right - t_left)))};
+
+        j = k + 1;
+        if(j >= count)
+        {
+            j = 0;
+        }
+    }
+    return steps;
+}
+
+/// \brief Constructs the points of one path with \p count steps and stores them to
+/// <tt>path[i * stride]</tt>. The increments of the path are the differences of adjacent
+/// points, the point before the first one is the origin.
+/// \param normal Callable returning the standard normal value that drives step \p i.
+template<class T, class Normal>
+__forceinline__ __host__ __device__
+void construct_brownian_bridge(const brownian_bridge_step<T>* steps,
+                               const unsigned int             count,
+                               const T                        sqrt_time_step,
+                               T*                             path,
+                               const size_t                   stride,
+                               Normal&&                       normal)
+{
+    path[(count - 1) * stride] = steps[0].stddev * sqrt_time_step * normal(0);
+    for(unsigned int i = 1; i < count; i++)
+    {
+        const brownian_bridge_step<T> step = steps[i];
+
+        T value = step.right_weight * path[step.right_index * stride];
+        if(step.left_index != 0)
+        {
+            value += step.left_weight * path[(step.left_index - 1) * stride];
+        }
+        path[step.bridge_index * stride] = value + step.stddev * sqrt_time_step * normal(i);
+    }
+}
+
+/// \brief Caches the construction steps of a Brownian bridge in memory accessible by \p System
+/// and recomputes them only when the number of steps changes.
+template<class System, class T>
+class brownian_bridge_manager
+{
+public:
+    using system_type = System;
+
+    brownian_bridge_manager() = default;
+
+    brownian_bridge_manager(const brownian_bridge_manager&) = delete;
+
+    brownian_bridge_manager(brownian_bridge_manager&& other)
+        : m_steps(std::exchange(other.m_steps, nullptr))
+        , m_count(std::exchange(other.m_count, 0))
+        , m_scratch(std::exchange(other.m_scratch, nullptr))
+        , m_scratch_size(std::exchange(other.m_scratch_size, 0))
+    {}
+
+    brownian_bridge_manager& operator=(const brownian_bridge_manager&) = delete;
+
+    brownian_bridge_manager& operator=(brownian_bridge_manager&& other)
+    {
+        std::swap(m_steps, other.m_steps);
+        std::swap(m_count, other.m_count);
+        std::swap(m_scratch, other.m_scratch);
+        std::swap(m_scratch_size, other.m_scratch_size);
+        return *this;
+    }
+
+    ~brownian_bridge_manager()
+    {
+        if(m_steps != nullptr)
+        {
+            system_type::free(m_steps);
+        }
+        if(m_scratch != nullptr)
+        {
+            system_type::free(m_scratch);
+        }
+    }
+
+    /// \brief Returns in \p steps the construction steps of a bridge with \p count steps.
+    rocrand_status get_steps(const unsigned int count, const brownian_bridge_step<T>** steps)
+    {
+        if(count != m_count)
+        {
+            if(m_steps != nullptr)
+            {
+                // Waits for the generations that may still use the previous steps
+                system_type::free(m_steps);
+                m_steps = nullptr;
+                m_count = 0;
+            }
+
+            const std::vector<brownian_bridge_step<T>> host_steps
+                = create_brownian_bridge_steps<T>(count);
+
+            rocrand_status status = system_type::alloc(&m_steps, count);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+            status = system_type::memcpy(m_steps,
+                                         host_steps.data(),
+                                         count * sizeof(brownian_bridge_step<T>),
+                                         hipMemcpyHostToDevice);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+            m_count = count;
+        }
+        *steps = m_steps;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// \brief Returns in \p scratch memory of at least \p size bytes for the paths of the
+    /// generations that do not fit into shared memory. The memory is kept for later generations.
+    rocrand_status get_scratch(const size_t size, unsigned char** scratch)
+    {
+        if(size > m_scratch_size)
+        {
+            if(m_scratch != nullptr)
+            {
+                // Waits for the generations that may still use the previous scratch
+                system_type::free(m_scratch);
+                m_scratch      = nullptr;
+                m_scratch_size = 0;
+            }
+
+            const rocrand_status status = system_type::alloc(&m_scratch, size);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+            m_scratch_size = size;
+        }
+        *scratch = m_scratch;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+private:
+    brownian_bridge_step<T>* m_steps        = nullptr;
+    unsigned int             m_count        = 0;
+    unsigned char*           m_scratch      = nullptr;
+    size_t                   m_scratch_size = 0;
+};
+
+} // namespace rocrand_impl::host
+
+#endif // ROCRAND_RNG_DISTRIBUTION_BROWNIAN_BRIDGE_H_
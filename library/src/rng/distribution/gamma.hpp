@@ -0,0 +1,300 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_GAMMA_H_
+#define ROCRAND_RNG_DISTRIBUTION_GAMMA_H_
+
+#include "../common.hpp"
+#include "rejection.hpp"
+
+#include <rocrand/rocrand_common.h>
+#include <rocrand/rocrand_mrg31k3p.h>
+#include <rocrand/rocrand_mrg32k3a.h>
+#include <rocrand/rocrand_uniform.h>
+
+#include <hip/hip_runtime.h>
+
+#include <math.h>
+#include <type_traits>
+
+// Gamma distribution
+//
+// G. Marsaglia, W. W. Tsang
+// A simple method for generating gamma variables
+// ACM Transactions on Mathematical Software 26, 2000
+//
+// J. H. Ahrens, U. Dieter
+// Computer methods for sampling from gamma, beta, Poisson and binomial distributions
+// Computing 12, 1974 (Algorithm GS, used for shapes below 1)
+//
+// Both are rejection methods that use two uniformly distributed values per attempt. The
+// distributions make the first attempt of every output from the values of the generator and the
+// further attempts from a stream keyed by these values, see rejection.hpp.
+
+namespace rocrand_impl::host
+{
+
+/// \brief Box-Muller transformation of two uniformly distributed values in (0, 1].
+template<class T>
+__forceinline__ __host__ __device__
+void gamma_box_muller(const T u, const T v, T& x, T& y)
+{
+    if constexpr(std::is_same_v<T, float>)
+    {
+        const float s = sqrtf(-2.0f * logf(u));
+#ifdef __HIP_DEVICE_COMPILE__
+        sincospif(2.0f * v, &x, &y);
+#else
+        x = sinf(2.0f * ROCRAND_PI * v);
+        y = cosf(2.0f * ROCRAND_PI * v);
+#endif
+        x *= s;
+        y *= s;
+    }
+    else
+    {
+        const double s = sqrt(-2.0 * log(u));
+#ifdef __HIP_DEVICE_COMPILE__
+        sincospi(2.0 * v, &x, &y);
+#else
+        x = sin(2.0 * ROCRAND_PI_DOUBLE * v);
+        y = cos(2.0 * ROCRAND_PI_DOUBLE * v);
+#endif
+        x *= s;
+        y *= s;
+    }
+}
+
+/// \brief Math functions of float and double used by the rejection methods.
+template<class T>
+struct rejection_math
+{
+    __forceinline__ __host__ __device__
+    static T log_(const T x)
+    {
+        if constexpr(std::is_same_v<T, float>)
+        {
+            return logf(x);
+        }
+        else
+        {
+            return log(x);
+        }
+    }
+
+    __forceinline__ __host__ __device__
+    static T exp_(const T x)
+    {
+        if constexpr(std::is_same_v<T, float>)
+        {
+            return expf(x);
+        }
+        else
+        {
+            return exp(x);
+        }
+    }
+
+    __forceinline__ __host__ __device__
+    static T pow_(const T x, const T y)
+    {
+        if constexpr(std::is_same_v<T, float>)
+        {
+            return powf(x, y);
+        }
+        else
+        {
+            return pow(x, y);
+        }
+    }
+
+    /// \brief Standard normal CDF.
+    __forceinline__ __host__ __device__
+    static T normal_cdf(const T x)
+    {
+        if constexpr(std::is_same_v<T, float>)
+        {
+            return 0.5f * erfcf(-0.70710678f * x);
+        }
+        else
+        {
+            return 0.5 * erfc(-0.7071067811865476 * x);
+        }
+    }
+};
+
+/// \brief Parameters and sampling method of the gamma distribution with shape \p shape and
+/// scale \p scale.
+template<class T>
+struct gamma_sampler
+{
+    using result_type  = T;
+    using uniform_type = T;
+
+    // Marsaglia-Tsang
+    T d;
+    T c;
+    // Algorithm GS
+    T b;
+    T inv_shape;
+    T shape_minus_one;
+
+    T    scale;
+    bool small_shape;
+
+    gamma_sampler(T shape, T scale) : scale(scale), small_shape(shape < T(1))
+    {
+        d               = shape - T(1) / T(3);
+        c               = small_shape ? T(0) : T(1) / sqrt(T(9) * d);
+        b               = T(1) + shape / T(2.718281828459045);
+        inv_shape       = T(1) / shape;
+        shape_minus_one = shape - T(1);
+    }
+
+    /// \brief One attempt to sample a gamma distributed value from the uniformly distributed
+    /// values \p u and \p v in (0, 1]. Returns a negative value if the attempt is rejected.
+    __forceinline__ __host__ __device__
+    T attempt(const T u, const T v) const
+    {
+        using math = rejection_math<T>;
+
+        if(small_shape)
+        {
+            const T p = b * u;
+            if(p <= T(1))
+            {
+                const T x = math::pow_(p, inv_shape);
+                return v <= math::exp_(-x) ? x * scale : T(-1);
+            }
+            const T x = -math::log_((b - p) * inv_shape);
+            return v <= math::pow_(x, shape_minus_one) ? x * scale : T(-1);
+        }
+
+        // The normal value and the uniform value of the acceptance test are the two independent
+        // normal values of the Box-Muller transformation, the latter mapped to (0, 1) by its CDF.
+        T x, y;
+        gamma_box_muller(u, v, x, y);
+        T w = T(1) + c * x;
+        if(w <= T(0))
+        {
+            return T(-1);
+        }
+        w             = w * w * w;
+        const T a     = math::normal_cdf(y);
+        const T x2    = x * x;
+        // Squeeze, accepts most values without evaluating the logarithms
+        if(a < T(1) - T(0.0331) * x2 * x2
+           || math::log_(a) < T(0.5) * x2 + d * (T(1) - w + math::log_(w)))
+        {
+            return d * w * scale;
+        }
+        return T(-1);
+    }
+
+    __forceinline__ __host__ __device__
+    static bool is_rejected(const T value)
+    {
+        return value < T(0);
+    }
+};
+
+// Universal and 64 bit Universal
+
+template<class Output, class Input = unsigned int>
+struct gamma_distribution
+{
+    static_assert(std::is_same_v<Output, float> || std::is_same_v<Output, double>,
+                  "The gamma distribution supports only float and double");
+
+    static constexpr unsigned int input_width  = 2;
+    static constexpr unsigned int output_width = 1;
+
+    const gamma_sampler<Output> sampler;
+
+    gamma_distribution(Output shape, Output scale) : sampler(shape, scale) {}
+
+    __forceinline__ __host__ __device__
+    void operator()(const Input (&input)[2], Output (&output)[1]) const
+    {
+        output[0] = sample_rejection(sampler,
+                                     uniform(input[0]),
+                                     uniform(input[1]),
+                                     input[0],
+                                     input[1]);
+    }
+
+private:
+    __forceinline__ __host__ __device__
+    static Output uniform(const Input v)
+    {
+        if constexpr(std::is_same_v<Output, float>)
+        {
+            return rocrand_device::detail::uniform_distribution(v);
+        }
+        else
+        {
+            return rocrand_device::detail::uniform_distribution_double(v);
+        }
+    }
+};
+
+// Mrg32k3a and Mrg31k3p
+
+template<class T, typename state_type>
+struct mrg_engine_gamma_distribution
+{
+    static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                  "The gamma distribution supports only float and double");
+
+    static constexpr unsigned int input_width  = 2;
+    static constexpr unsigned int output_width = 1;
+
+    const gamma_sampler<T> sampler;
+
+    mrg_engine_gamma_distribution(T shape, T scale) : sampler(shape, scale) {}
+
+    __forceinline__ __host__ __device__
+    void operator()(const unsigned int (&input)[2], T (&output)[1]) const
+    {
+        output[0] = sample_rejection(sampler,
+                                     uniform(input[0]),
+                                     uniform(input[1]),
+                                     input[0],
+                                     input[1]);
+    }
+
+private:
+    __forceinline__ __host__ __device__
+    static T uniform(const unsigned int v)
+    {
+        if constexpr(std::is_same_v<T, float>)
+        {
+            return rocrand_device::detail::mrg_uniform_distribution<state_type>(v);
+        }
+        else
+        {
+            return rocrand_device::detail::mrg_uniform_distribution_double<state_type>(v);
+        }
+    }
+};
+
+} // namespace rocrand_impl::host
+
+#endif // ROCRAND_RNG_DISTRIBUTION_GAMMA_H_
@@ -0,0 +1,108 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_GEOMETRIC_H_
+#define ROCRAND_RNG_DISTRIBUTION_GEOMETRIC_H_
+
+#include "../common.hpp"
+
+#include <rocrand/rocrand_mrg31k3p.h>
+#include <rocrand/rocrand_mrg32k3a.h>
+#include <rocrand/rocrand_uniform.h>
+
+#include <hip/hip_runtime.h>
+
+#include <math.h>
+
+// Geometric distribution (number of trials up to and including the first success) by
+// inversion: floor(log(u) / log(1 - p)) + 1 for u in (0, 1]. Values that do not fit into
+// unsigned int are saturated.
+
+namespace rocrand_impl::host
+{
+
+__forceinline__ __host__ __device__
+unsigned int geometric_inversion(const double u, const double log_q)
+{
+    const double x = floor(log(u) / log_q) + 1.0;
+    return x < 4294967295.0 ? static_cast<unsigned int>(x) : 4294967295U;
+}
+
+// Universal and 64 bit Universal
+
+template<class Input = unsigned int>
+struct geometric_distribution
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const double log_q;
+
+    explicit geometric_distribution(double p) : log_q(log1p(-p)) {}
+
+    __forceinline__ __host__ __device__
+    void operator()(const Input (&input)[1], unsigned int (&output)[1]) const
+    {
+        output[0]
+            = geometric_inversion(rocrand_device::detail::uniform_distribution_double(input[0]),
+                                  log_q);
+    }
+};
+
+// Mrg32k3a and Mrg31k3p
+
+template<typename state_type>
+struct mrg_engine_geometric_distribution
+{
+    static constexpr unsigned int input_width  = 1;
+    static constexpr unsigned int output_width = 1;
+
+    const double log_q;
+
+    explicit mrg_engine_geometric_distribution(double p) : log_q(log1p(-p)) {}
+
+    __forceinline__ __host__ __device__
+    void operator()(const unsigned int (&input)[1], unsigned int (&output)[1]) const
+    {
+        output[0] = geometric_inversion(
+            rocrand_device::detail::mrg_uniform_distribution_double<state_type>(input[0]),
+            log_q);
+    }
+};
+
+// Sobol
+
+struct sobol_geometric_distribution
+{
+    const double log_q;
+
+    explicit sobol_geometric_distribution(double p) : log_q(log1p(-p)) {}
+
+    template<class DirectionVectorType>
+    __forceinline__ __host__ __device__
+    unsigned int operator()(const DirectionVectorType x) const
+    {
+        return geometric_inversion(rocrand_device::detail::uniform_distribution_double(x), log_q);
+    }
+};
+
+} // namespace rocrand_impl::host
+
+#endif // ROCRAND_RNG_DISTRIBUTION_GEOMETRIC_H_
@@ -57,6 +57,7 @@ struct log_normal_distribution<float, unsigned int, 4>
     const float mean;
     const float stddev;
 
+    __host__ __device__
     log_normal_distribution(float mean, float stddev) : mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
@@ -77,6 +78,7 @@ struct log_normal_distribution<double, unsigned int, 2>
     const double mean;
     const double stddev;
 
+    __host__ __device__
     log_normal_distribution(double mean, double stddev) : mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
@@ -96,6 +98,7 @@ struct log_normal_distribution<double, unsigned int, 4>
     const double mean;
     const double stddev;
 
+    __host__ __device__
     log_normal_distribution(double mean, double stddev) : mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
@@ -144,6 +147,7 @@ struct log_normal_distribution<float, unsigned long long, 4>
     const float mean;
     const float stddev;
 
+    __host__ __device__
     log_normal_distribution(float mean, float stddev) : mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
@@ -164,6 +168,7 @@ struct log_normal_distribution<double, unsigned long long, 4>
     const double mean;
     const double stddev;
 
+    __host__ __device__
     log_normal_distribution(double mean, double stddev) : mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
@@ -215,6 +220,7 @@ struct mrg_engine_log_normal_distribution<float, state_type>
     const float mean;
     const float stddev;
 
+    __host__ __device__
     mrg_engine_log_normal_distribution(float mean, float stddev) : mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
@@ -235,6 +241,7 @@ struct mrg_engine_log_normal_distribution<double, state_type>
     const double mean;
     const double stddev;
 
+    __host__ __device__
     mrg_engine_log_normal_distribution(double mean, double stddev) : mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
@@ -55,6 +55,7 @@ struct normal_distribution<float, unsigned int, 4>
     const float mean;
     const float stddev;
 
+    __host__ __device__
     normal_distribution(float mean, float stddev) : mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
@@ -75,6 +76,7 @@ struct normal_distribution<double, unsigned int, 2>
     const double mean;
     const double stddev;
 
+    __host__ __device__
     normal_distribution(double mean, double stddev) : mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
@@ -94,6 +96,7 @@ struct normal_distribution<double, unsigned int, 4>
     const double mean;
     const double stddev;
 
+    __host__ __device__
     normal_distribution(double mean, double stddev) : mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
@@ -141,6 +144,7 @@ struct normal_distribution<float, unsigned long long, 4>
     const float mean;
     const float stddev;
 
+    __host__ __device__
     normal_distribution(float mean, float stddev) : mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
@@ -161,6 +165,7 @@ struct normal_distribution<double, unsigned long long, 4>
     const double mean;
     const double stddev;
 
+    __host__ __device__
     normal_distribution(double mean, double stddev) : mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
@@ -211,6 +216,7 @@ struct mrg_engine_normal_distribution<float, state_type>
     const float mean;
     const float stddev;
 
+    __host__ __device__
     mrg_engine_normal_distribution(float mean, float stddev) : mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
@@ -231,6 +237,7 @@ struct mrg_engine_normal_distribution<double, state_type>
     const double mean;
     const double stddev;
 
+    __host__ __device__
     mrg_engine_normal_distribution(double mean, double stddev) : mean(mean), stddev(stddev) {}
 
     __forceinline__ __host__ __device__
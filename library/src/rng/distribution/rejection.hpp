@@ -0,0 +1,111 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_DISTRIBUTION_REJECTION_H_
+#define ROCRAND_RNG_DISTRIBUTION_REJECTION_H_
+
+#include "../common.hpp"
+
+#include <rocrand/rocrand_common.h>
+#include <rocrand/rocrand_uniform.h>
+
+#include <hip/hip_runtime.h>
+
+#include <type_traits>
+
+// Rejection methods need a variable number of random values per output, but the generators
+// expect distributions to consume a fixed number of inputs. The distributions therefore make
+// the first attempt of every output from their inputs, and an output whose first attempt fails
+// makes further attempts in the same thread until one is accepted. The values of the further
+// attempts are taken from a SplitMix64 stream keyed by the inputs of the first attempt, so
+// they only depend on the position of the output in the sequence of the generator: the results
+// do not depend on the launch config, and the generator consumes the same number of values
+// for every output.
+//
+// A sampler of such a distribution provides:
+// * result_type and uniform_type, the types of the outputs and of the uniform values,
+// * result_type attempt(uniform_type u, uniform_type v), one attempt from two uniformly
+//   distributed values in (0, 1],
+// * bool is_rejected(result_type value), true for the values of failed attempts.
+
+namespace rocrand_impl::host
+{
+
+/// \brief Returns the next uniformly distributed value in (0, 1] of the SplitMix64 stream
+/// \p state.
+template<class T>
+__forceinline__ __host__ __device__
+T rejection_stream_uniform(unsigned long long& state)
+{
+    const unsigned long long v = rocrand_device::detail::splitmix64(state);
+    if constexpr(std::is_same_v<T, float>)
+    {
+        return rocrand_device::detail::uniform_distribution(v);
+    }
+    else
+    {
+        return rocrand_device::detail::uniform_distribution_double(v);
+    }
+}
+
+/// \brief Samples a value with \p sampler. The first attempt uses the uniformly distributed
+/// values \p u and \p v, which the distribution computed from the inputs \p x and \p y. The
+/// further attempts use the stream keyed by \p x and \p y. For valid parameters the methods
+/// accept an attempt with a probability that is bounded away from 0, so only a few attempts
+/// are made.
+template<class Sampler, class Input>
+__forceinline__ __host__ __device__
+typename Sampler::result_type sample_rejection(const Sampler&                     sampler,
+                                               const typename Sampler::uniform_type u,
+                                               const typename Sampler::uniform_type v,
+                                               const Input                        x,
+                                               const Input                        y)
+{
+    using uniform_type = typename Sampler::uniform_type;
+
+    typename Sampler::result_type value = sampler.attempt(u, v);
+    if(!sampler.is_rejected(value))
+    {
+        return value;
+    }
+
+    unsigned long long state;
+    if constexpr(sizeof(Input) == sizeof(unsigned int))
+    {
+        state = (static_cast<unsigned long long>(x) << 32) | y;
+    }
+    else
+    {
+        state = x;
+        state = rocrand_device::detail::splitmix64(state) ^ y;
+    }
+    do
+    {
+        const uniform_type u2 = rejection_stream_uniform<uniform_type>(state);
+        const uniform_type v2 = rejection_stream_uniform<uniform_type>(state);
+        value                 = sampler.attempt(u2, v2);
+    }
+    while(sampler.is_rejected(value));
+    return value;
+}
+
+} // namespace rocrand_impl::host
+
+#endif // ROCRAND_RNG_DISTRIBUTION_REJECTION_H_
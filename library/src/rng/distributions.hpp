@@ -24,7 +24,13 @@
 #include "distribution/uniform.hpp"
 #include "distribution/normal.hpp"
 #include "distribution/log_normal.hpp"
+#include "distribution/exponential.hpp"
+#include "distribution/gamma.hpp"
+#include "distribution/beta.hpp"
+#include "distribution/binomial.hpp"
+#include "distribution/geometric.hpp"
 #include "distribution/discrete.hpp"
 #include "distribution/poisson.hpp"
+#include "distribution/brownian_bridge.hpp"
 
 #endif // ROCRAND_RNG_DISTRIBUTION_S_H_
@@ -0,0 +1,251 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/// \file
+/// \brief Process-wide cache of initialized engine states.
+///
+/// Some generators spend most of their initialization on computing the starting states of
+/// their engines (MT19937 jumps every engine ahead with a polynomial of degree 19937, MTGP32
+/// initializes the tables of up to 512 engines from their parameter sets). The result only
+/// depends on the seed and the layout of the engines, so a host copy of it can be kept here
+/// and generators that are created again with the same seed copy their engines from the cache
+/// instead of running the initialization kernels.
+///
+/// The cache keeps pinned host memory, so it is disabled unless a size limit is set with
+/// rocrand_set_engine_state_cache_size() or, in MiB, with the environment variable
+/// ROCRAND_ENGINE_STATE_CACHE_SIZE.
+
+#ifndef ROCRAND_RNG_ENGINE_STATE_CACHE_H_
+#define ROCRAND_RNG_ENGINE_STATE_CACHE_H_
+
+#include <rocrand/rocrand.h>
+
+#include <hip/hip_runtime.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+
+namespace rocrand_impl::host
+{
+
+/// Everything the initialized engines of a generator depend on.
+struct engine_state_key
+{
+    rocrand_rng_type   type;
+    unsigned long long seed;
+    rocrand_ordering   order;
+    /// The engines are laid out for this launch configuration.
+    unsigned int threads;
+    unsigned int blocks;
+    bool         is_device;
+
+    bool operator==(const engine_state_key& other) const
+    {
+        return type == other.type && seed == other.seed && order == other.order
+               && threads == other.threads && blocks == other.blocks
+               && is_device == other.is_device;
+    }
+};
+
+class engine_state_cache
+{
+public:
+    static engine_state_cache& instance()
+    {
+        static engine_state_cache cache;
+        return cache;
+    }
+
+    /// Sets the size in bytes above which the least recently used states are evicted and
+    /// evicts them. A size of 0 disables the cache and frees all states.
+    void set_max_size(size_t max_size)
+    {
+        std::list<std::shared_ptr<entry>> evicted;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_max_size = max_size;
+            evict(0, evicted);
+        }
+        // The pinned memory is freed after the lock is released
+    }
+
+    size_t get_max_size()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_max_size;
+    }
+
+    bool is_enabled()
+    {
+        return get_max_size() > 0;
+    }
+
+    /// Copies the cached engines of \p key to \p engines. \p found is set to false, and
+    /// \p engines is not changed, if the cache has no engines of \p key with \p size bytes.
+    template<class System>
+    rocrand_status load(const engine_state_key& key, void* engines, size_t size, bool& found)
+    {
+        found = false;
+        std::shared_ptr<entry> cached;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for(auto it = m_entries.begin(); it != m_entries.end(); ++it)
+            {
+                if((*it)->key == key && (*it)->size == size)
+                {
+                    // Most recently used first
+                    m_entries.splice(m_entries.begin(), m_entries, it);
+                    cached = *it;
+                    break;
+                }
+            }
+        }
+        if(!cached)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // The entry stays alive while it is copied, even if it is evicted meanwhile
+        if(hipEventSynchronize(cached->filled) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        found = true;
+        return System::memcpy(engines, cached->words, size, hipMemcpyHostToDevice);
+    }
+
+    /// Adds a copy of the \p size bytes of \p engines, which are initialized on \p stream,
+    /// as the engines of \p key. The copy is enqueued on \p stream and does not block the host.
+    rocrand_status
+        store(const engine_state_key& key, const void* engines, size_t size, hipStream_t stream)
+    {
+        if(size > get_max_size())
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        auto added = std::make_shared<entry>();
+        added->key = key;
+        if(hipHostMalloc(&added->words, size) != hipSuccess)
+        {
+            // The engines are valid, they are only not cached
+            added->words = nullptr;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+        added->size = size;
+        if(hipEventCreateWithFlags(&added->filled, hipEventDisableTiming) != hipSuccess)
+        {
+            added->filled = nullptr;
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(hipMemcpyAsync(added->words, engines, size, hipMemcpyDefault, stream) != hipSuccess
+           || hipEventRecord(added->filled, stream) != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        std::list<std::shared_ptr<entry>> evicted;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for(auto it = m_entries.begin(); it != m_entries.end(); ++it)
+            {
+                if((*it)->key == key)
+                {
+                    m_size -= (*it)->size;
+                    evicted.splice(evicted.begin(), m_entries, it);
+                    break;
+                }
+            }
+            // The limit may have been lowered meanwhile
+            if(size <= m_max_size)
+            {
+                evict(size, evicted);
+                m_entries.push_front(std::move(added));
+                m_size += size;
+            }
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+private:
+    /// A host copy of engines, filled asynchronously until \p filled is complete.
+    struct entry
+    {
+        engine_state_key key;
+        void*            words  = nullptr;
+        size_t           size   = 0;
+        hipEvent_t       filled = nullptr;
+
+        entry() = default;
+
+        entry(const entry&)            = delete;
+        entry& operator=(const entry&) = delete;
+
+        ~entry()
+        {
+            if(filled != nullptr)
+            {
+                // Waits for the copy that may still write to the memory
+                (void)hipEventSynchronize(filled);
+                (void)hipEventDestroy(filled);
+            }
+            if(words != nullptr)
+            {
+                (void)hipHostFree(words);
+            }
+        }
+    };
+
+    engine_state_cache() : m_max_size(get_max_size_from_environment()) {}
+
+    static size_t get_max_size_from_environment()
+    {
+        const char* value = std::getenv("ROCRAND_ENGINE_STATE_CACHE_SIZE");
+        if(value == nullptr)
+        {
+            return 0;
+        }
+        return static_cast<size_t>(std::strtoull(value, nullptr, 10)) << 20;
+    }
+
+    /// Moves the least recently used entries to \p evicted until \p size more bytes fit.
+    /// The caller destroys them after releasing the lock.
+    void evict(size_t size, std::list<std::shared_ptr<entry>>& evicted)
+    {
+        while(!m_entries.empty() && m_size + size > m_max_size)
+        {
+            m_size -= m_entries.back()->size;
+            evicted.splice(evicted.begin(), m_entries, std::prev(m_entries.end()));
+        }
+    }
+
+    std::mutex                        m_mutex;
+    std::list<std::shared_ptr<entry>> m_entries;
+    size_t                            m_size = 0;
+    size_t                            m_max_size;
+};
+
+} // namespace rocrand_impl::host
+
+#endif // ROCRAND_RNG_ENGINE_STATE_CACHE_H_
@@ -0,0 +1,265 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/// \file
+/// \brief Generation of several requests of rocrand_generate_fused() with one launch.
+///
+/// The generate kernels of the engine-based generators load an engine, generate the values
+/// of one output with it and store it again. The fused kernels load every engine once, then
+/// generate the values of all requests in the same way as the generate kernel of every
+/// request would, and store the engine once. Every request starts at the engine that the
+/// previous request stopped at, so the values are the same as the ones of separate launches.
+
+#ifndef ROCRAND_RNG_FUSED_H_
+#define ROCRAND_RNG_FUSED_H_
+
+#include "common.hpp"
+#include "config_types.hpp"
+#include "distributions.hpp"
+
+#include <rocrand/rocrand.h>
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+
+namespace rocrand_impl::host
+{
+
+/// The number of requests generated by one launch, the next requests take another launch.
+inline constexpr unsigned int max_fused_requests = 8;
+
+/// A request of rocrand_generate_fused() and the engines that generate it.
+struct fused_request
+{
+    rocrand_fused_request request;
+    /// The engine that generates the first value, like \p start_engine_id of the generate
+    /// kernels.
+    unsigned int start_engine_id;
+    /// The number of engines whose values are interleaved in the output.
+    unsigned int num_engines;
+};
+
+/// The requests of one launch of a fused kernel.
+struct fused_request_list
+{
+    unsigned int  count;
+    /// The largest \p num_engines of the requests.
+    unsigned int  num_engines;
+    fused_request requests[max_fused_requests];
+};
+
+/// The distributions of the requests of generators that use the common distributions.
+struct default_fused_distributions
+{
+    template<class T>
+    using uniform = uniform_distribution<T>;
+    template<class T>
+    using normal = normal_distribution<T>;
+    template<class T>
+    using log_normal = log_normal_distribution<T>;
+};
+
+/// Returns true if \p distribution is supported by rocrand_generate_fused().
+inline bool is_fused_distribution(const rocrand_fused_distribution distribution)
+{
+    switch(distribution)
+    {
+        case ROCRAND_FUSED_UNIFORM_UINT:
+        case ROCRAND_FUSED_UNIFORM_FLOAT:
+        case ROCRAND_FUSED_UNIFORM_DOUBLE:
+        case ROCRAND_FUSED_NORMAL_FLOAT:
+        case ROCRAND_FUSED_NORMAL_DOUBLE:
+        case ROCRAND_FUSED_LOG_NORMAL_FLOAT:
+        case ROCRAND_FUSED_LOG_NORMAL_DOUBLE: return true;
+    }
+    return false;
+}
+
+/// Calls <tt>f(output, distribution)</tt> with the output and the distribution of \p request,
+/// which are selected by \p Distributions. Nothing is called if the distribution is not
+/// supported, see is_fused_distribution().
+template<class Distributions, class F>
+__host__ __device__ __forceinline__ void visit_fused_request(const rocrand_fused_request& request,
+                                                             F&&                          f)
+{
+    switch(request.distribution)
+    {
+        case ROCRAND_FUSED_UNIFORM_UINT:
+            f(dense_output<unsigned int>{static_cast<unsigned int*>(request.output_data)},
+              typename Distributions::template uniform<unsigned int>());
+            break;
+        case ROCRAND_FUSED_UNIFORM_FLOAT:
+            f(dense_output<float>{static_cast<float*>(request.output_data)},
+              typename Distributions::template uniform<float>());
+            break;
+        case ROCRAND_FUSED_UNIFORM_DOUBLE:
+            f(dense_output<double>{static_cast<double*>(request.output_data)},
+              typename Distributions::template uniform<double>());
+            break;
+        case ROCRAND_FUSED_NORMAL_FLOAT:
+            f(dense_output<float>{static_cast<float*>(request.output_data)},
+              typename Distributions::template normal<float>(static_cast<float>(request.mean),
+                                                             static_cast<float>(request.stddev)));
+            break;
+        case ROCRAND_FUSED_NORMAL_DOUBLE:
+            f(dense_output<double>{static_cast<double*>(request.output_data)},
+              typename Distributions::template normal<double>(request.mean, request.stddev));
+            break;
+        case ROCRAND_FUSED_LOG_NORMAL_FLOAT:
+            f(dense_output<float>{static_cast<float*>(request.output_data)},
+              typename Distributions::template log_normal<float>(
+                  static_cast<float>(request.mean),
+                  static_cast<float>(request.stddev)));
+            break;
+        case ROCRAND_FUSED_LOG_NORMAL_DOUBLE:
+            f(dense_output<double>{static_cast<double*>(request.output_data)},
+              typename Distributions::template log_normal<double>(request.mean, request.stddev));
+            break;
+    }
+}
+
+/// Generates the requests of \p requests with the engines run by thread \p thread_id of a
+/// grid of \p stride threads. <tt>generate_values(id, num_engines, engine, output, n,
+/// distribution)</tt> must generate the values of \p engine like the generate kernel of the
+/// generator does for virtual engine \p id of \p num_engines engines.
+template<class Distributions, class Engine, class GenerateValues>
+__host__ __device__ __forceinline__ void run_fused_requests(const unsigned int        thread_id,
+                                                            const unsigned int        stride,
+                                                            Engine*                   engines,
+                                                            const fused_request_list& requests,
+                                                            GenerateValues generate_values)
+{
+    const virtual_engine_range range
+        = get_virtual_engine_range(thread_id, stride, requests.num_engines);
+    for(unsigned int engine_id = range.first; engine_id < range.last; engine_id += range.step)
+    {
+        Engine engine = engines[engine_id];
+
+        for(unsigned int r = 0; r < requests.count; r++)
+        {
+            const fused_request& request     = requests.requests[r];
+            const unsigned int   num_engines = request.num_engines;
+            if(engine_id >= num_engines)
+            {
+                continue;
+            }
+            // The inverse of engine_id = (virtual_id + start_engine_id) % num_engines of the
+            // generate kernels
+            const unsigned int virtual_id
+                = (engine_id + num_engines - request.start_engine_id % num_engines)
+                  % num_engines;
+            visit_fused_request<Distributions>(
+                request.request,
+                [&](auto output, auto distribution)
+                {
+                    generate_values(virtual_id,
+                                    num_engines,
+                                    engine,
+                                    output,
+                                    request.request.n,
+                                    distribution);
+                });
+        }
+
+        // Save engine with its state
+        engines[engine_id] = engine;
+    }
+}
+
+/// Generates \p count requests of \p requests with launches of up to max_fused_requests
+/// requests. The engines of every request are selected with \p ConfigProvider and
+/// \p sequence_order, like the generate functions of the generator do. \p start_engine_id
+/// is advanced after every launch as it is after the separate generations of the requests
+/// of the launch. <tt>launch(list)</tt> must launch the fused kernel with \p list.
+template<class ConfigProvider, class Distributions, class Launch>
+rocrand_status generate_fused_requests(const hipStream_t            stream,
+                                       const rocrand_ordering       sequence_order,
+                                       const unsigned int           engines_size,
+                                       const rocrand_fused_request* requests,
+                                       const size_t                 count,
+                                       unsigned int&                start_engine_id,
+                                       Launch&&                     launch)
+{
+    fused_request_list list{};
+    unsigned int       next_start_engine_id = start_engine_id;
+    for(size_t i = 0; i < count; i++)
+    {
+        const rocrand_fused_request& request = requests[i];
+        if(request.output_data == nullptr || request.n == 0)
+        {
+            continue;
+        }
+
+        generator_config sequence_config{};
+        unsigned int     output_width = 1;
+        hipError_t       error        = hipSuccess;
+        visit_fused_request<Distributions>(
+            request,
+            [&](auto output, auto distribution)
+            {
+                using T = typename decltype(output)::value_type;
+                error   = ConfigProvider::template host_config<T>(stream,
+                                                                sequence_order,
+                                                                sequence_config);
+                output_width = decltype(distribution)::output_width;
+            });
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        const unsigned int num_engines = sequence_config.threads * sequence_config.blocks;
+
+        list.requests[list.count] = fused_request{request, next_start_engine_id, num_engines};
+        list.count++;
+        list.num_engines = std::max(list.num_engines, num_engines);
+
+        // Generating n values will use this many distributions
+        const size_t touched_engines = (request.n + output_width - 1) / output_width;
+        next_start_engine_id         = (next_start_engine_id + touched_engines) % engines_size;
+
+        if(list.count == max_fused_requests)
+        {
+            const rocrand_status status = launch(list);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+            start_engine_id = next_start_engine_id;
+            list            = fused_request_list{};
+        }
+    }
+
+    if(list.count == 0)
+    {
+        return ROCRAND_STATUS_SUCCESS;
+    }
+    const rocrand_status status = launch(list);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+    start_engine_id = next_start_engine_id;
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+} // namespace rocrand_impl::host
+
+#endif // ROCRAND_RNG_FUSED_H_
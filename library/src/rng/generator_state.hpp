@@ -0,0 +1,234 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+/// \file
+/// \brief Saving and loading the states of stateful generators.
+///
+/// A saved state is a `generator_state_header` followed by the states of all engines of the
+/// generator. The header holds the host-side members that are needed to continue the sequence
+/// (seed, offset, position in the engines), the engines are copied as they are. Both are
+/// copied by a kernel on the stream of the generator, so saving does not wait for previous
+/// generate calls. Loading needs the header on the host and synchronizes the stream.
+
+#ifndef ROCRAND_RNG_GENERATOR_STATE_H_
+#define ROCRAND_RNG_GENERATOR_STATE_H_
+
+#include "config_types.hpp"
+#include "system.hpp"
+
+#include <rocrand/rocrand.h>
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+
+namespace rocrand_impl::host
+{
+
+struct generator_state_header
+{
+    /// Size of the header, rejects buffers that were not written by save_state().
+    unsigned int     header_size;
+    rocrand_rng_type type;
+    rocrand_ordering order;
+    /// Number of engines, it depends on the ordering and the device.
+    unsigned int engines_size;
+    /// Size of the state of one engine in bytes.
+    unsigned int engine_bytes;
+    /// Position of the next values in the engines, its meaning depends on the generator.
+    unsigned int       position[2];
+    unsigned long long seed[2];
+    unsigned long long offset;
+};
+
+static_assert(sizeof(generator_state_header) % sizeof(unsigned int) == 0,
+              "The engines are stored in 32-bit words after the header");
+
+template<class Engine>
+generator_state_header make_generator_state_header(rocrand_rng_type   type,
+                                                   rocrand_ordering   order,
+                                                   unsigned int       engines_size,
+                                                   unsigned long long offset)
+{
+    static_assert(sizeof(Engine) % sizeof(unsigned int) == 0,
+                  "Engines are copied in 32-bit words");
+
+    generator_state_header header{};
+    header.header_size  = sizeof(generator_state_header);
+    header.type         = type;
+    header.order        = order;
+    header.engines_size = engines_size;
+    header.engine_bytes = sizeof(Engine);
+    header.offset       = offset;
+    return header;
+}
+
+inline size_t get_generator_state_size(const generator_state_header& header)
+{
+    return sizeof(generator_state_header) + size_t{header.engines_size} * header.engine_bytes;
+}
+
+__host__ __device__ inline void save_generator_state_words(dim3 block_idx,
+                                                           dim3 thread_idx,
+                                                           dim3 grid_dim,
+                                                           dim3 block_dim,
+                                                           generator_state_header header,
+                                                           const unsigned int*    engines,
+                                                           size_t                 engines_words,
+                                                           unsigned int*          state)
+{
+    constexpr size_t header_words = sizeof(generator_state_header) / sizeof(unsigned int);
+
+    const size_t id = block_idx.x * block_dim.x + thread_idx.x;
+    if(id == 0)
+    {
+        *reinterpret_cast<generator_state_header*>(state) = header;
+    }
+
+    const size_t stride = static_cast<size_t>(grid_dim.x) * block_dim.x;
+    for(size_t index = id; index < engines_words; index += stride)
+    {
+        state[header_words + index] = engines[index];
+    }
+}
+
+__host__ __device__ inline void load_generator_state_words(dim3 block_idx,
+                                                           dim3 thread_idx,
+                                                           dim3 grid_dim,
+                                                           dim3 block_dim,
+                                                           const unsigned int* state,
+                                                           size_t              engines_words,
+                                                           unsigned int*       engines)
+{
+    constexpr size_t header_words = sizeof(generator_state_header) / sizeof(unsigned int);
+
+    const size_t stride = static_cast<size_t>(grid_dim.x) * block_dim.x;
+    for(size_t index = block_idx.x * block_dim.x + thread_idx.x; index < engines_words;
+        index += stride)
+    {
+        engines[index] = state[header_words + index];
+    }
+}
+
+namespace detail
+{
+
+constexpr unsigned int state_copy_threads    = ROCRAND_DEFAULT_MAX_BLOCK_SIZE;
+constexpr unsigned int state_copy_max_blocks = 1024;
+
+inline dim3 get_state_copy_blocks(size_t words)
+{
+    const size_t blocks = (words + state_copy_threads - 1) / state_copy_threads;
+    return dim3(static_cast<unsigned int>(
+        std::max<size_t>(1, std::min<size_t>(blocks, state_copy_max_blocks))));
+}
+
+} // namespace detail
+
+/// Writes \p header and the states of \p engines to \p state on \p stream.
+template<class System>
+rocrand_status save_generator_state(const generator_state_header& header,
+                                    const void*                   engines,
+                                    void*                         state,
+                                    hipStream_t                   stream)
+{
+    const size_t engines_words
+        = size_t{header.engines_size} * header.engine_bytes / sizeof(unsigned int);
+    const size_t words = sizeof(generator_state_header) / sizeof(unsigned int) + engines_words;
+
+    return System::template launch<save_generator_state_words,
+                                   static_block_size_config_provider<detail::state_copy_threads>>(
+        detail::get_state_copy_blocks(words),
+        dim3(detail::state_copy_threads),
+        0,
+        stream,
+        header,
+        static_cast<const unsigned int*>(engines),
+        engines_words,
+        static_cast<unsigned int*>(state));
+}
+
+/// Reads the header of \p state and checks that it was saved by a generator of type \p type.
+/// The header is copied on \p stream after the previous work of the generator, for example
+/// a save_generator_state() to the same buffer. The header is needed on the host, so this call
+/// synchronizes \p stream.
+inline rocrand_status read_generator_state_header(const void*             state,
+                                                  rocrand_rng_type        type,
+                                                  hipStream_t             stream,
+                                                  generator_state_header& header)
+{
+    hipError_t error
+        = hipMemcpyAsync(&header, state, sizeof(generator_state_header), hipMemcpyDefault, stream);
+    if(error != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    error = hipStreamSynchronize(stream);
+    if(error != hipSuccess)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+
+    if(header.header_size != sizeof(generator_state_header) || header.type != type)
+    {
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+/// Checks that the engines of \p header have the layout of \p engines_size engines of type
+/// \p Engine. Otherwise the state was saved with another ordering or on another device and
+/// ROCRAND_STATUS_OUT_OF_RANGE is returned. Generators check this before they change their
+/// ordering or engines, so a state that can't be loaded leaves them as they were.
+template<class Engine>
+rocrand_status check_generator_state_layout(const generator_state_header& header,
+                                            unsigned int                  engines_size)
+{
+    if(header.engines_size != engines_size || header.engine_bytes != sizeof(Engine))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+/// Copies the states of the engines from \p state to \p engines on \p stream. The layout of
+/// the engines must have been checked with check_generator_state_layout().
+template<class Engine, class System>
+rocrand_status load_generator_state(const void*  state,
+                                    unsigned int engines_size,
+                                    Engine*      engines,
+                                    hipStream_t  stream)
+{
+    const size_t engines_words = size_t{engines_size} * sizeof(Engine) / sizeof(unsigned int);
+
+    return System::template launch<load_generator_state_words,
+                                   static_block_size_config_provider<detail::state_copy_threads>>(
+        detail::get_state_copy_blocks(engines_words),
+        dim3(detail::state_copy_threads),
+        0,
+        stream,
+        static_cast<const unsigned int*>(state),
+        engines_words,
+        reinterpret_cast<unsigned int*>(engines));
+}
+
+} // namespace rocrand_impl::host
+
+#endif // ROCRAND_RNG_GENERATOR_STATE_H_
@@ -25,6 +25,10 @@
 #include <hip/hip_vector_types.h>
 #include <rocrand/rocrand.h>
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 struct rocrand_generator_base_type
 {
     rocrand_generator_base_type() = default;
@@ -43,38 +47,110 @@ struct rocrand_generator_base_type
     virtual rocrand_ordering get_order() const                 = 0;
     virtual rocrand_status   set_order(rocrand_ordering order) = 0;
 
+    virtual rocrand_status set_subsequence_length(unsigned long long length) = 0;
+
+    virtual rocrand_status set_host_launch_blocks(unsigned int blocks) = 0;
+
     virtual hipStream_t get_stream() const             = 0;
     virtual rocrand_status set_stream(hipStream_t stream) = 0;
 
     virtual rocrand_status set_dimensions(unsigned int dimensions) = 0;
 
+    virtual rocrand_status set_layout(rocrand_quasi_random_layout layout) = 0;
+
     virtual rocrand_status init() = 0;
 
+    virtual rocrand_status get_state_size(size_t& size) = 0;
+    virtual rocrand_status save_state(void* state)       = 0;
+    virtual rocrand_status load_state(const void* state) = 0;
+
+    virtual rocrand_status split(unsigned int count, rocrand_generator_base_type** children) = 0;
+
     // clang-format off
     virtual rocrand_status generate_char(unsigned char* output_data, size_t n) = 0;
     virtual rocrand_status generate_short(unsigned short* output_data, size_t n) = 0;
     virtual rocrand_status generate_int(unsigned int* output_data, size_t n) = 0;
     virtual rocrand_status generate_long(unsigned long long int* output_data, size_t n) = 0;
 
+    virtual rocrand_status generate_int_range(unsigned int* output_data, unsigned long long first_index, size_t n) const = 0;
+    virtual rocrand_status generate_int_2d(unsigned int* output_data, size_t width, size_t height, size_t pitch) = 0;
+    virtual rocrand_status generate_int_batched(unsigned int* output_data, size_t n, size_t pitch, const unsigned long long* seeds, const unsigned long long* offsets, size_t batch_size) const = 0;
+
     virtual rocrand_status generate_uniform_half(half* output_data, size_t n) = 0;
     virtual rocrand_status generate_uniform_float(float* output_data, size_t n) = 0;
     virtual rocrand_status generate_uniform_double(double* output_data, size_t n) = 0;
+    virtual rocrand_status generate_uniform_float_2d(float* output_data, size_t width, size_t height, size_t pitch) = 0;
+    virtual rocrand_status generate_uniform_double_2d(double* output_data, size_t width, size_t height, size_t pitch) = 0;
 
     virtual rocrand_status generate_normal_half(half* output_data, size_t n, half mean, half stddev) = 0;
     virtual rocrand_status generate_normal_float(float* output_data, size_t n, float mean, float stddev) = 0;
     virtual rocrand_status generate_normal_double(double* output_data, size_t n, double mean, double stddev) = 0;
+    virtual rocrand_status generate_normal_float_2d(float* output_data, size_t width, size_t height, size_t pitch, float mean, float stddev) = 0;
+    virtual rocrand_status generate_normal_double_2d(double* output_data, size_t width, size_t height, size_t pitch, double mean, double stddev) = 0;
+    virtual rocrand_status generate_normal_float_batched(float* output_data, size_t n, size_t pitch, const unsigned long long* seeds, const unsigned long long* offsets, size_t batch_size, float mean, float stddev) const = 0;
 
     virtual rocrand_status generate_log_normal_half(half* output_data, size_t n, half mean, half stddev) = 0;
     virtual rocrand_status generate_log_normal_float(float* output_data, size_t n, float mean, float stddev) = 0;
     virtual rocrand_status generate_log_normal_double(double* output_data, size_t n, double mean, double stddev) = 0;
 
+    virtual rocrand_status generate_exponential_float(float* output_data, size_t n, float lambda) = 0;
+    virtual rocrand_status generate_exponential_double(double* output_data, size_t n, double lambda) = 0;
+
+    virtual rocrand_status generate_gamma_float(float* output_data, size_t n, float shape, float scale) = 0;
+    virtual rocrand_status generate_gamma_double(double* output_data, size_t n, double shape, double scale) = 0;
+
+    virtual rocrand_status generate_beta_float(float* output_data, size_t n, float alpha, float beta) = 0;
+    virtual rocrand_status generate_beta_double(double* output_data, size_t n, double alpha, double beta) = 0;
+
     virtual rocrand_status generate_poisson(unsigned int* output_data, size_t n, double lambda) = 0;
+
+    virtual rocrand_status generate_binomial(unsigned int* output_data, size_t n, unsigned int trials, double p) = 0;
+
+    virtual rocrand_status generate_geometric(unsigned int* output_data, size_t n, double p) = 0;
+
+    virtual rocrand_status generate_brownian_bridge_float(float* output_data, size_t n, float time_step) = 0;
+    virtual rocrand_status generate_brownian_bridge_double(double* output_data, size_t n, double time_step) = 0;
+
+    virtual rocrand_status generate_fused(const rocrand_fused_request* requests, size_t count) = 0;
     // clang-format on
 };
 
 namespace rocrand_impl::host
 {
 
+/// The largest number of blocks that can be set with set_host_launch_blocks(). Launches run at
+/// most the blocks of their config, see generator_impl_base::get_launch_blocks().
+inline constexpr unsigned int max_host_launch_blocks = 65536;
+
+/// Range of subsequences of a generator that can be split into independent children.
+/// The generator uses the first subsequences of its range for its own engines. split()
+/// divides the range into equal parts, the parent keeps the first one and every child gets
+/// one of the others, so the subsequences of a generator and all its descendants are disjoint.
+struct subsequence_range
+{
+    unsigned long long first = 0;
+    unsigned long long size  = ~0ULL;
+
+    /// Divides the range into the <tt>count + 1</tt> equal \p parts of the parent, which is
+    /// <tt>parts[0]</tt>, and of \p count children. Every part must hold the \p used
+    /// subsequences of one generator. The range itself is not changed, so the parent commits
+    /// its part only after all children were created.
+    rocrand_status
+        split(unsigned long long used, unsigned int count, subsequence_range* parts) const
+    {
+        const unsigned long long part = size / (count + 1ULL);
+        if(part < used)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        for(unsigned int i = 0; i <= count; i++)
+        {
+            parts[i] = subsequence_range{first + i * part, part};
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+};
+
 /// This wrapper provides support for the different types of generator functions,
 /// while calling into a generic function in the actual generator implementation.
 /// This saves us to write the same code for the distributions every time.
@@ -123,6 +199,16 @@ struct generator_type : rocrand_generator_base_type
         return m_generator.set_order(order);
     }
 
+    rocrand_status set_subsequence_length(unsigned long long length) override final
+    {
+        return m_generator.set_subsequence_length(length);
+    }
+
+    rocrand_status set_host_launch_blocks(unsigned int blocks) override final
+    {
+        return m_generator.set_host_launch_blocks(blocks);
+    }
+
     hipStream_t get_stream() const override final
     {
         return m_generator.get_stream();
@@ -138,11 +224,61 @@ struct generator_type : rocrand_generator_base_type
         return m_generator.set_dimensions(dimensions);
     }
 
+    rocrand_status set_layout(rocrand_quasi_random_layout layout) override final
+    {
+        return m_generator.set_layout(layout);
+    }
+
     rocrand_status init() override final
     {
         return m_generator.init();
     }
 
+    rocrand_status get_state_size(size_t& size) override final
+    {
+        return m_generator.get_state_size(size);
+    }
+
+    rocrand_status save_state(void* state) override final
+    {
+        return m_generator.save_state(state);
+    }
+
+    rocrand_status load_state(const void* state) override final
+    {
+        return m_generator.load_state(state);
+    }
+
+    rocrand_status split(unsigned int                  count,
+                         rocrand_generator_base_type** children) override final
+    {
+        std::vector<subsequence_range> ranges(count + 1ULL);
+        rocrand_status                 status = m_generator.split(count, ranges.data());
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        std::vector<std::unique_ptr<generator_type>> created(count);
+        for(unsigned int i = 0; i < count; i++)
+        {
+            created[i] = std::make_unique<generator_type>();
+            status     = created[i]->m_generator.fork_from(m_generator, ranges[i + 1]);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                // The parent keeps its range, the created children are destroyed
+                return status;
+            }
+        }
+
+        m_generator.keep_subsequences(ranges[0]);
+        for(unsigned int i = 0; i < count; i++)
+        {
+            children[i] = created[i].release();
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status generate_char(unsigned char* output_data, size_t n) override final
     {
         return m_generator.generate(output_data, n);
@@ -163,6 +299,31 @@ struct generator_type : rocrand_generator_base_type
         return m_generator.generate(output_data, n);
     }
 
+    rocrand_status generate_int_range(unsigned int*      output_data,
+                                      unsigned long long first_index,
+                                      size_t             n) const override final
+    {
+        return m_generator.generate_range(output_data, first_index, n);
+    }
+
+    rocrand_status generate_int_2d(unsigned int* output_data,
+                                   size_t        width,
+                                   size_t        height,
+                                   size_t        pitch) override final
+    {
+        return m_generator.generate_2d(output_data, width, height, pitch);
+    }
+
+    rocrand_status generate_int_batched(unsigned int*             output_data,
+                                        size_t                    n,
+                                        size_t                    pitch,
+                                        const unsigned long long* seeds,
+                                        const unsigned long long* offsets,
+                                        size_t batch_size) const override final
+    {
+        return m_generator.generate_batched(output_data, n, pitch, seeds, offsets, batch_size);
+    }
+
     rocrand_status generate_uniform_half(half* output_data, size_t n) override final
     {
         return m_generator.generate_uniform(output_data, n);
@@ -178,6 +339,22 @@ struct generator_type : rocrand_generator_base_type
         return m_generator.generate_uniform(output_data, n);
     }
 
+    rocrand_status generate_uniform_float_2d(float* output_data,
+                                             size_t width,
+                                             size_t height,
+                                             size_t pitch) override final
+    {
+        return m_generator.generate_uniform_2d(output_data, width, height, pitch);
+    }
+
+    rocrand_status generate_uniform_double_2d(double* output_data,
+                                              size_t  width,
+                                              size_t  height,
+                                              size_t  pitch) override final
+    {
+        return m_generator.generate_uniform_2d(output_data, width, height, pitch);
+    }
+
     rocrand_status
         generate_normal_half(half* output_data, size_t n, half mean, half stddev) override final
     {
@@ -198,6 +375,45 @@ struct generator_type : rocrand_generator_base_type
         return m_generator.generate_normal(output_data, n, mean, stddev);
     }
 
+    rocrand_status generate_normal_float_2d(float* output_data,
+                                            size_t width,
+                                            size_t height,
+                                            size_t pitch,
+                                            float  mean,
+                                            float  stddev) override final
+    {
+        return m_generator.generate_normal_2d(output_data, width, height, pitch, mean, stddev);
+    }
+
+    rocrand_status generate_normal_double_2d(double* output_data,
+                                             size_t  width,
+                                             size_t  height,
+                                             size_t  pitch,
+                                             double  mean,
+                                             double  stddev) override final
+    {
+        return m_generator.generate_normal_2d(output_data, width, height, pitch, mean, stddev);
+    }
+
+    rocrand_status generate_normal_float_batched(float*                    output_data,
+                                                 size_t                    n,
+                                                 size_t                    pitch,
+                                                 const unsigned long long* seeds,
+                                                 const unsigned long long* offsets,
+                                                 size_t                    batch_size,
+                                                 float                     mean,
+                                                 float stddev) const override final
+    {
+        return m_generator.generate_normal_batched(output_data,
+                                                   n,
+                                                   pitch,
+                                                   seeds,
+                                                   offsets,
+                                                   batch_size,
+                                                   mean,
+                                                   stddev);
+    }
+
     rocrand_status
         generate_log_normal_half(half* output_data, size_t n, half mean, half stddev) override final
     {
@@ -219,12 +435,88 @@ struct generator_type : rocrand_generator_base_type
         return m_generator.generate_log_normal(output_data, n, mean, stddev);
     }
 
+    rocrand_status
+        generate_exponential_float(float* output_data, size_t n, float lambda) override final
+    {
+        return m_generator.generate_exponential(output_data, n, lambda);
+    }
+
+    rocrand_status
+        generate_exponential_double(double* output_data, size_t n, double lambda) override final
+    {
+        return m_generator.generate_exponential(output_data, n, lambda);
+    }
+
+    rocrand_status generate_gamma_float(float* output_data,
+                                        size_t n,
+                                        float  shape,
+                                        float  scale) override final
+    {
+        return m_generator.generate_gamma(output_data, n, shape, scale);
+    }
+
+    rocrand_status generate_gamma_double(double* output_data,
+                                         size_t  n,
+                                         double  shape,
+                                         double  scale) override final
+    {
+        return m_generator.generate_gamma(output_data, n, shape, scale);
+    }
+
+    rocrand_status
+        generate_beta_float(float* output_data, size_t n, float alpha, float beta) override final
+    {
+        return m_generator.generate_beta(output_data, n, alpha, beta);
+    }
+
+    rocrand_status generate_beta_double(double* output_data,
+                                        size_t  n,
+                                        double  alpha,
+                                        double  beta) override final
+    {
+        return m_generator.generate_beta(output_data, n, alpha, beta);
+    }
+
     rocrand_status
         generate_poisson(unsigned int* output_data, size_t n, double lambda) override final
     {
         return m_generator.generate_poisson(output_data, n, lambda);
     }
 
+    rocrand_status generate_binomial(unsigned int* output_data,
+                                     size_t        n,
+                                     unsigned int  trials,
+                                     double        p) override final
+    {
+        return m_generator.generate_binomial(output_data, n, trials, p);
+    }
+
+    rocrand_status
+        generate_geometric(unsigned int* output_data, size_t n, double p) override final
+    {
+        return m_generator.generate_geometric(output_data, n, p);
+    }
+
+    rocrand_status generate_brownian_bridge_float(float* output_data,
+                                                  size_t n,
+                                                  float  time_step) override final
+    {
+        return m_generator.generate_brownian_bridge(output_data, n, time_step);
+    }
+
+    rocrand_status generate_brownian_bridge_double(double* output_data,
+                                                   size_t  n,
+                                                   double  time_step) override final
+    {
+        return m_generator.generate_brownian_bridge(output_data, n, time_step);
+    }
+
+    rocrand_status generate_fused(const rocrand_fused_request* requests,
+                                  size_t                       count) override final
+    {
+        return m_generator.generate_fused(requests, count);
+    }
+
 private:
     Generator m_generator;
 };
@@ -277,6 +569,21 @@ struct generator_impl_base
         m_stream = stream;
     }
 
+    virtual rocrand_status set_subsequence_length(unsigned long long length)
+    {
+        // This method should be overridden for generators that support it.
+        (void)length;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    virtual rocrand_status set_host_launch_blocks(unsigned int blocks)
+    {
+        // This method should be overridden for host generators whose values do not depend
+        // on the number of blocks.
+        (void)blocks;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
     virtual rocrand_status set_dimensions(unsigned int dimensions)
     {
         // This method should be overridden for generators that support it.
@@ -284,10 +591,236 @@ struct generator_impl_base
         return ROCRAND_STATUS_TYPE_ERROR;
     }
 
+    virtual rocrand_status set_layout(rocrand_quasi_random_layout layout)
+    {
+        // This method should be overridden for generators that support it.
+        (void)layout;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    rocrand_status get_state_size(size_t& size)
+    {
+        // This method should be hidden by generators that support it.
+        (void)size;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    rocrand_status save_state(void* state)
+    {
+        // This method should be hidden by generators that support it.
+        (void)state;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    rocrand_status load_state(const void* state)
+    {
+        // This method should be hidden by generators that support it.
+        (void)state;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    rocrand_status split(unsigned int count, subsequence_range* parts) const
+    {
+        // This method should be hidden by generators that support it.
+        (void)count;
+        (void)parts;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    void keep_subsequences(const subsequence_range& subsequences)
+    {
+        // This method should be hidden by generators that support split().
+        (void)subsequences;
+    }
+
+    template<class Generator>
+    rocrand_status fork_from(const Generator& parent, const subsequence_range& subsequences)
+    {
+        // This method should be hidden by generators that support split().
+        (void)parent;
+        (void)subsequences;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        // This method should be hidden by generators that support it.
+        (void)data;
+        (void)data_size;
+        (void)lambda;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T* data, size_t data_size, T shape, T scale)
+    {
+        // This method should be hidden by generators that support it.
+        (void)data;
+        (void)data_size;
+        (void)shape;
+        (void)scale;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T* data, size_t data_size, T alpha, T beta)
+    {
+        // This method should be hidden by generators that support it.
+        (void)data;
+        (void)data_size;
+        (void)alpha;
+        (void)beta;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    rocrand_status
+        generate_binomial(unsigned int* data, size_t data_size, unsigned int n, double p)
+    {
+        // This method should be hidden by generators that support it.
+        (void)data;
+        (void)data_size;
+        (void)n;
+        (void)p;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    rocrand_status generate_geometric(unsigned int* data, size_t data_size, double p)
+    {
+        // This method should be hidden by generators that support it.
+        (void)data;
+        (void)data_size;
+        (void)p;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    template<class T>
+    rocrand_status generate_brownian_bridge(T* data, size_t data_size, T time_step)
+    {
+        // This method should be hidden by generators that support it.
+        (void)data;
+        (void)data_size;
+        (void)time_step;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    rocrand_status generate_fused(const rocrand_fused_request* requests, size_t count)
+    {
+        // This method should be hidden by generators that support it.
+        (void)requests;
+        (void)count;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    rocrand_status
+        generate_range(unsigned int* data, unsigned long long first_index, size_t data_size) const
+    {
+        // This method should be hidden by generators that support it.
+        (void)data;
+        (void)first_index;
+        (void)data_size;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    template<class T>
+    rocrand_status generate_2d(T* data, size_t width, size_t height, size_t pitch)
+    {
+        // This method should be hidden by generators that support it.
+        (void)data;
+        (void)width;
+        (void)height;
+        (void)pitch;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_2d(T* data, size_t width, size_t height, size_t pitch)
+    {
+        // This method should be hidden by generators that support it.
+        (void)data;
+        (void)width;
+        (void)height;
+        (void)pitch;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    template<class T>
+    rocrand_status
+        generate_normal_2d(T* data, size_t width, size_t height, size_t pitch, T mean, T stddev)
+    {
+        // This method should be hidden by generators that support it.
+        (void)data;
+        (void)width;
+        (void)height;
+        (void)pitch;
+        (void)mean;
+        (void)stddev;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    template<class T>
+    rocrand_status generate_batched(T*                        data,
+                                    size_t                    data_size,
+                                    size_t                    pitch,
+                                    const unsigned long long* seeds,
+                                    const unsigned long long* offsets,
+                                    size_t                    batch_size) const
+    {
+        // This method should be hidden by generators that support it.
+        (void)data;
+        (void)data_size;
+        (void)pitch;
+        (void)seeds;
+        (void)offsets;
+        (void)batch_size;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    template<class T>
+    rocrand_status generate_normal_batched(T*                        data,
+                                           size_t                    data_size,
+                                           size_t                    pitch,
+                                           const unsigned long long* seeds,
+                                           const unsigned long long* offsets,
+                                           size_t                    batch_size,
+                                           T                         mean,
+                                           T                         stddev) const
+    {
+        // This method should be hidden by generators that support it.
+        (void)data;
+        (void)data_size;
+        (void)pitch;
+        (void)seeds;
+        (void)offsets;
+        (void)batch_size;
+        (void)mean;
+        (void)stddev;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
 protected:
+    /// Returns the number of blocks of \p threads threads that \p System launches instead of
+    /// the \p max_blocks blocks of the config, for generators whose values do not depend on
+    /// the number of blocks: the number set with set_host_launch_blocks() up to \p max_blocks,
+    /// or the number selected by \p System if none was set.
+    template<class System>
+    unsigned int get_launch_blocks(const unsigned int threads,
+                                   const unsigned int max_blocks,
+                                   const size_t       size_bytes,
+                                   const size_t       vector_bytes) const
+    {
+        if(m_host_launch_blocks != 0)
+        {
+            return std::min(m_host_launch_blocks, max_blocks);
+        }
+        return System::get_launch_blocks(threads, max_blocks, size_bytes, vector_bytes);
+    }
+
     rocrand_ordering   m_order;
     unsigned long long m_offset;
     hipStream_t        m_stream;
+    /// The number of blocks set with set_host_launch_blocks(), 0 to select it automatically.
+    unsigned int m_host_launch_blocks = 0;
 };
 
 } // namespace rocrand_impl::host
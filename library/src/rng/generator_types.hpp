@@ -23,18 +23,25 @@
 
 #include "generator_type.hpp"
 
+#include "ars.hpp"
 #include "lfsr113.hpp"
 #include "mrg.hpp"
 #include "mt19937.hpp"
 #include "mtgp32.hpp"
+#include "pcg64_dxsm.hpp"
 #include "philox4x32_10.hpp"
+#include "philox4x64_10.hpp"
 #include "sobol.hpp"
+#include "squares.hpp"
 #include "threefry.hpp"
 #include "xorwow.hpp"
+#include "xoshiro.hpp"
 
 namespace rocrand_impl::host
 {
 
+extern template struct generator_type<ars_generator_host<false>>;
+extern template struct generator_type<ars_generator_host<true>>;
 extern template struct generator_type<lfsr113_generator>;
 extern template struct generator_type<lfsr113_generator_host<false>>;
 extern template struct generator_type<lfsr113_generator_host<true>>;
@@ -50,9 +57,15 @@ extern template struct generator_type<mt19937_generator_host<false>>;
 extern template struct generator_type<mtgp32_generator>;
 extern template struct generator_type<mtgp32_generator_host<false>>;
 extern template struct generator_type<mtgp32_generator_host<true>>;
+extern template struct generator_type<pcg64_dxsm_generator>;
+extern template struct generator_type<pcg64_dxsm_generator_host<false>>;
+extern template struct generator_type<pcg64_dxsm_generator_host<true>>;
 extern template struct generator_type<philox4x32_10_generator>;
 extern template struct generator_type<philox4x32_10_generator_host<false>>;
 extern template struct generator_type<philox4x32_10_generator_host<true>>;
+extern template struct generator_type<philox4x64_10_generator>;
+extern template struct generator_type<philox4x64_10_generator_host<false>>;
+extern template struct generator_type<philox4x64_10_generator_host<true>>;
 extern template struct generator_type<scrambled_sobol32_generator_host<false>>;
 extern template struct generator_type<scrambled_sobol32_generator_host<true>>;
 extern template struct generator_type<scrambled_sobol32_generator>;
@@ -65,6 +78,9 @@ extern template struct generator_type<sobol32_generator>;
 extern template struct generator_type<sobol64_generator_host<false>>;
 extern template struct generator_type<sobol64_generator_host<true>>;
 extern template struct generator_type<sobol64_generator>;
+extern template struct generator_type<squares_generator>;
+extern template struct generator_type<squares_generator_host<false>>;
+extern template struct generator_type<squares_generator_host<true>>;
 extern template struct generator_type<threefry2x32_20_generator>;
 extern template struct generator_type<threefry2x32_20_generator_host<false>>;
 extern template struct generator_type<threefry2x32_20_generator_host<true>>;
@@ -80,6 +96,12 @@ extern template struct generator_type<threefry4x64_20_generator_host<true>>;
 extern template struct generator_type<xorwow_generator>;
 extern template struct generator_type<xorwow_generator_host<false>>;
 extern template struct generator_type<xorwow_generator_host<true>>;
+extern template struct generator_type<xoroshiro128ss_generator>;
+extern template struct generator_type<xoroshiro128ss_generator_host<false>>;
+extern template struct generator_type<xoroshiro128ss_generator_host<true>>;
+extern template struct generator_type<xoshiro256pp_generator>;
+extern template struct generator_type<xoshiro256pp_generator_host<false>>;
+extern template struct generator_type<xoshiro256pp_generator_host<true>>;
 
 } // namespace rocrand_impl::host
 
@@ -23,9 +23,12 @@
 
 #include "config/lfsr113_config.hpp"
 
+#include "autotune.hpp"
 #include "common.hpp"
 #include "config_types.hpp"
 #include "distributions.hpp"
+#include "fused.hpp"
+#include "generator_state.hpp"
 #include "generator_type.hpp"
 #include "system.hpp"
 #include "utils/cpp_utils.hpp"
@@ -41,7 +44,46 @@
 namespace rocrand_impl::host
 {
 
-typedef ::rocrand_device::lfsr113_engine lfsr113_device_engine;
+/// Skip ahead of all engines by the same offset. The jump polynomials are computed once on
+/// the host, so every engine evaluates them once instead of walking the jump matrices digit
+/// by digit.
+struct lfsr113_offset_jump
+{
+    unsigned long long offset;
+    unsigned int       polynomials[4];
+
+    explicit lfsr113_offset_jump(unsigned long long offset) : offset(offset)
+    {
+        ::rocrand_device::detail::lfsr113_jump_polynomials(offset, 0, polynomials);
+    }
+};
+
+struct lfsr113_device_engine : public ::rocrand_device::lfsr113_engine
+{
+    typedef ::rocrand_device::lfsr113_engine base_type;
+
+    __forceinline__ __device__ __host__ lfsr113_device_engine(
+        const uint4              seed        = {ROCRAND_LFSR113_DEFAULT_SEED_X,
+                                                ROCRAND_LFSR113_DEFAULT_SEED_Y,
+                                                ROCRAND_LFSR113_DEFAULT_SEED_Z,
+                                                ROCRAND_LFSR113_DEFAULT_SEED_W},
+        const unsigned int       subsequence = 0,
+        const unsigned long long offset      = 0)
+        : base_type(seed, subsequence, offset)
+    {}
+
+    /// Same as the engine constructed with offset \p jump.offset.
+    __forceinline__ __device__ __host__
+        lfsr113_device_engine(const uint4                seed,
+                              const unsigned int         subsequence,
+                              const lfsr113_offset_jump& jump)
+        : base_type(seed, subsequence, 0)
+    {
+        this->jump(jump.offset, jump.polynomials);
+    }
+
+    // m_state from base class
+};
 
 __host__ __device__ inline void init_lfsr113_engines(dim3 block_idx,
                                                      dim3 thread_idx,
@@ -50,46 +92,37 @@ __host__ __device__ inline void init_lfsr113_engines(dim3 block_idx,
                                                      lfsr113_device_engine* engines,
                                                      const unsigned int     start_engine_id,
                                                      const unsigned int     engines_size,
+                                                     const unsigned int     subsequence,
                                                      const uint4            seeds,
-                                                     const unsigned int     offset)
+                                                     lfsr113_offset_jump    offset)
 {
     const unsigned int engine_id = block_idx.x * block_dim.x + thread_idx.x;
     if(engine_id < engines_size)
     {
-        engines[engine_id] = lfsr113_device_engine(seeds,
-                                                   engine_id,
-                                                   offset + (engine_id < start_engine_id ? 1 : 0));
+        lfsr113_device_engine engine(seeds, subsequence + engine_id, offset);
+        if(engine_id < start_engine_id)
+        {
+            // These engines start one number later
+            engine.discard();
+        }
+        engines[engine_id] = engine;
     }
 }
 
-template<class ConfigProvider, bool IsDynamic, class T, class Distribution>
-__host__ __device__ __forceinline__ void generate_lfsr113(dim3 block_idx,
-                                                          dim3 thread_idx,
-                                                          dim3 grid_dim,
-                                                          dim3 /*block_dim*/,
-                                                          lfsr113_device_engine* engines,
-                                                          const unsigned int     start_engine_id,
-                                                          T*                     data,
-                                                          const size_t           n,
-                                                          Distribution           distribution)
+/// Generates the values of engine \p id of \p stride engines that interleave their values.
+template<class T, class Distribution>
+__host__ __device__ __forceinline__ void generate_lfsr113_values(const unsigned int     id,
+                                                                 const unsigned int     stride,
+                                                                 lfsr113_device_engine& engine,
+                                                                 T*                     data,
+                                                                 const size_t           n,
+                                                                 Distribution distribution)
 {
-    static_assert(is_single_tile_config<ConfigProvider, T>(IsDynamic),
-                  "This kernel should only be used with single tile configs");
-    constexpr unsigned int BlockSize    = get_block_size<ConfigProvider, T>(IsDynamic);
     constexpr unsigned int input_width  = Distribution::input_width;
     constexpr unsigned int output_width = Distribution::output_width;
 
     using vec_type = aligned_vec_type<T, output_width>;
 
-    const unsigned int id          = block_idx.x * BlockSize + thread_idx.x;
-    const unsigned int num_engines = grid_dim.x * BlockSize;
-
-    const unsigned int    engine_id = (id + start_engine_id) & (num_engines - 1);
-    lfsr113_device_engine engine    = engines[engine_id];
-
-    unsigned int input[input_width];
-    T            output[output_width];
-
     const uintptr_t uintptr   = reinterpret_cast<uintptr_t>(data);
     const size_t misalignment = (output_width - uintptr / sizeof(T) % output_width) % output_width;
     const unsigned int head_size    = cpp_utils::min(n, misalignment);
@@ -97,7 +130,11 @@ __host__ __device__ __forceinline__ void generate_lfsr113(dim3 block_idx,
     const size_t       vec_n     = (n - head_size) / output_width;
 
     vec_type* vec_data = reinterpret_cast<vec_type*>(data + misalignment);
-    size_t    index    = id;
+
+    unsigned int input[input_width];
+    T            output[output_width];
+
+    size_t index = id;
 
     while(index < vec_n)
     {
@@ -116,7 +153,7 @@ __host__ __device__ __forceinline__ void generate_lfsr113(dim3 block_idx,
         __builtin_amdgcn_s_waitcnt(/*vmcnt*/ 0 | (/*exp_cnt*/ 0x7 << 4) | (/*lgkmcnt*/ 0xf << 8));
 #endif
         vec_data[index] = *reinterpret_cast<vec_type*>(output);
-        index += num_engines;
+        index += stride;
     }
 
     if(output_width > 1 && index == vec_n)
@@ -157,9 +194,69 @@ __host__ __device__ __forceinline__ void generate_lfsr113(dim3 block_idx,
             }
         }
     }
+}
+
+template<class ConfigProvider, bool IsDynamic, class T, class Distribution>
+__host__ __device__ __forceinline__ void generate_lfsr113(dim3 block_idx,
+                                                          dim3 thread_idx,
+                                                          dim3 grid_dim,
+                                                          dim3 /*block_dim*/,
+                                                          lfsr113_device_engine* engines,
+                                                          const unsigned int     start_engine_id,
+                                                          const unsigned int     num_engines,
+                                                          T*                     data,
+                                                          const size_t           n,
+                                                          Distribution           distribution)
+{
+    static_assert(is_single_tile_config<ConfigProvider, T>(IsDynamic),
+                  "This kernel should only be used with single tile configs");
+    constexpr unsigned int BlockSize = get_block_size<ConfigProvider, T>(IsDynamic);
+
+    const unsigned int id     = block_idx.x * BlockSize + thread_idx.x;
+    const unsigned int stride = grid_dim.x * BlockSize;
+
+    // The sequence is defined by num_engines engines and every engine is run by one thread,
+    // so the launch config does not change the values.
+    const virtual_engine_range range = get_virtual_engine_range(id, stride, num_engines);
+    for(unsigned int virtual_id = range.first; virtual_id < range.last;
+        virtual_id += range.step)
+    {
+        const unsigned int    engine_id = (virtual_id + start_engine_id) & (num_engines - 1);
+        lfsr113_device_engine engine    = engines[engine_id];
+
+        generate_lfsr113_values(virtual_id, num_engines, engine, data, n, distribution);
+
+        // Save engine with its state
+        engines[engine_id] = engine;
+    }
+}
 
-    // Save engine with its state
-    engines[engine_id] = engine;
+/// Generates all requests of \p requests with one load and store of every engine, see
+/// run_fused_requests.
+template<class ConfigProvider, bool IsDynamic>
+__host__ __device__ __forceinline__ void generate_lfsr113_fused(dim3 block_idx,
+                                                                dim3 thread_idx,
+                                                                dim3 grid_dim,
+                                                                dim3 /*block_dim*/,
+                                                                lfsr113_device_engine* engines,
+                                                                fused_request_list     requests)
+{
+    static_assert(is_single_tile_config<ConfigProvider, unsigned int>(IsDynamic),
+                  "This kernel should only be used with single tile configs");
+    constexpr unsigned int BlockSize = get_block_size<ConfigProvider, unsigned int>(IsDynamic);
+
+    run_fused_requests<default_fused_distributions>(
+        block_idx.x * BlockSize + thread_idx.x,
+        grid_dim.x * BlockSize,
+        engines,
+        requests,
+        [](const unsigned int     id,
+           const unsigned int     stride,
+           lfsr113_device_engine& engine,
+           auto                   data,
+           const size_t           n,
+           auto                   distribution)
+        { generate_lfsr113_values(id, stride, engine, data.data, n, distribution); });
 }
 
 template<class System, class ConfigProvider>
@@ -194,6 +291,7 @@ public:
         , m_start_engine_id(other.m_start_engine_id)
         , m_engines_size(other.m_engines_size)
         , m_seed(other.m_seed)
+        , m_subsequences(other.m_subsequences)
         , m_poisson(std::move(other.m_poisson))
     {
         other.m_engines_initialized = false;
@@ -210,6 +308,7 @@ public:
         m_start_engine_id              = other.m_start_engine_id;
         m_engines_size                 = other.m_engines_size;
         m_seed                         = other.m_seed;
+        m_subsequences                 = other.m_subsequences;
         m_poisson                      = std::move(other.m_poisson);
 
         other.m_engines_initialized = false;
@@ -294,6 +393,7 @@ public:
             ROCRAND_ORDERING_PSEUDO_DYNAMIC,
             ROCRAND_ORDERING_PSEUDO_BEST,
             ROCRAND_ORDERING_PSEUDO_LEGACY,
+            ROCRAND_ORDERING_PSEUDO_PORTABLE,
         };
         if(std::find(supported_orderings.begin(), supported_orderings.end(), order)
            == supported_orderings.end())
@@ -305,6 +405,20 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    rocrand_status set_host_launch_blocks(unsigned int blocks) override final
+    {
+        if(system_type::is_device())
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+        if(blocks == 0 || blocks > max_host_launch_blocks)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_host_launch_blocks = blocks;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status set_stream(hipStream_t stream)
     {
         const rocrand_status status = m_poisson.set_stream(stream);
@@ -316,31 +430,63 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    rocrand_status init()
+    /// Divides the subsequences of this generator into the ranges \p parts of itself and
+    /// \p count children without changing it, see subsequence_range. The engines of this generator keep their subsequences.
+    rocrand_status split(unsigned int count, subsequence_range* parts) const
     {
-        if(m_engines_initialized)
-        {
-            return ROCRAND_STATUS_SUCCESS;
-        }
-
-        hipError_t error
-            = get_least_common_grid_size<ConfigProvider>(m_stream, m_order, m_engines_size);
+        unsigned int engines_size;
+        hipError_t   error
+            = get_least_common_grid_size<ConfigProvider>(m_stream,
+                                                         get_sequence_ordering(m_order),
+                                                         engines_size);
         if(error != hipSuccess)
         {
             return ROCRAND_STATUS_INTERNAL_ERROR;
         }
+        return m_subsequences.split(engines_size, count, parts);
+    }
 
-        m_start_engine_id = m_offset % m_engines_size;
+    /// Keeps only \p subsequences, the first part of a split() whose children were created.
+    void keep_subsequences(const subsequence_range& subsequences)
+    {
+        m_subsequences = subsequences;
+    }
 
-        if(m_engines != nullptr)
+    /// Makes this generator a child of \p parent that uses \p subsequences.
+    rocrand_status fork_from(const lfsr113_generator_template& parent,
+                             const subsequence_range&          subsequences)
+    {
+        rocrand_status status = set_stream(parent.m_stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
         {
-            system_type::free(m_engines);
+            return status;
         }
-        rocrand_status status = system_type::alloc(&m_engines, m_engines_size);
+        status = set_order(parent.m_order);
         if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
         }
+        m_seed               = parent.m_seed;
+        m_subsequences       = subsequences;
+        m_host_launch_blocks = parent.m_host_launch_blocks;
+        reset();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        if(m_engines_initialized)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        rocrand_status status = allocate_engines();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        m_start_engine_id = m_offset % m_engines_size;
 
         constexpr unsigned int init_threads = 256;
         const unsigned int     init_blocks  = (m_engines_size + init_threads - 1) / init_threads;
@@ -354,19 +500,104 @@ public:
             m_engines,
             m_start_engine_id,
             m_engines_size,
+            static_cast<unsigned int>(m_subsequences.first),
             m_seed,
-            m_offset / m_engines_size);
+            lfsr113_offset_jump(m_offset / m_engines_size));
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        status = m_poisson.init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status get_state_size(size_t& size)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        size = get_generator_state_size(get_state_header());
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status save_state(void* state)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        return save_generator_state<system_type>(get_state_header(), m_engines, state, m_stream);
+    }
+
+    rocrand_status load_state(const void* state)
+    {
+        generator_state_header header;
+        rocrand_status         status
+            = read_generator_state_header(state, type(), m_stream, header);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        // The layout is checked before the ordering and the engines are changed
+        unsigned int engines_size;
+        status = get_engines_size(header.order, engines_size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = check_generator_state_layout<engine_type>(header, engines_size);
         if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
         }
+        if(header.order != m_order)
+        {
+            status = set_order(header.order);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
 
+        // The engines are only allocated, their states are loaded below
+        m_engines_initialized = false;
+        status                = allocate_engines();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = load_generator_state<engine_type, system_type>(state,
+                                                                m_engines_size,
+                                                                m_engines,
+                                                                m_stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
         status = m_poisson.init();
         if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
         }
 
+        m_seed            = uint4{static_cast<unsigned int>(header.seed[0]),
+                                  static_cast<unsigned int>(header.seed[0] >> 32),
+                                  static_cast<unsigned int>(header.seed[1]),
+                                  static_cast<unsigned int>(header.seed[1] >> 32)};
+        m_offset          = header.offset;
+        m_start_engine_id = header.position[0];
+
         m_engines_initialized = true;
         return ROCRAND_STATUS_SUCCESS;
     }
@@ -380,8 +611,51 @@ public:
             return status;
         }
 
+        const rocrand_ordering launch_order
+            = get_launch_ordering(m_order, system_type::is_device());
+
+        generator_config sequence_config;
+        hipError_t       error
+            = ConfigProvider::template host_config<T>(m_stream,
+                                                      get_sequence_ordering(m_order),
+                                                      sequence_config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        const unsigned int num_engines = sequence_config.threads * sequence_config.blocks;
+
+        if(m_order == ROCRAND_ORDERING_PSEUDO_PORTABLE && data != nullptr)
+        {
+            status = autotune_portable_blocks<type(), T, ConfigProvider, system_type>(
+                m_stream,
+                m_engines,
+                m_engines_size,
+                [&, this](dim3 blocks, dim3 threads, engine_type* engines, T* scratch, size_t n)
+                {
+                    return system_type::template launch<
+                        generate_lfsr113<ConfigProvider, true, T, Distribution>,
+                        ConfigProvider,
+                        T,
+                        true>(blocks,
+                              threads,
+                              0,
+                              m_stream,
+                              engines,
+                              0U,
+                              num_engines,
+                              scratch,
+                              n,
+                              distribution);
+                });
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+
         generator_config config;
-        const hipError_t error = ConfigProvider::template host_config<T>(m_stream, m_order, config);
+        error = ConfigProvider::template host_config<T>(m_stream, launch_order, config);
         if(error != hipSuccess)
         {
             return ROCRAND_STATUS_INTERNAL_ERROR;
@@ -392,20 +666,25 @@ public:
             return ROCRAND_STATUS_SUCCESS;
         }
 
+        // The host threads write the values of consecutive engines, next to each other
+        const unsigned int blocks
+            = get_launch_blocks<system_type>(config.threads, config.blocks, 0, 0);
+
         status = dynamic_dispatch(
-            m_order,
+            launch_order,
             [&, this](auto is_dynamic)
             {
                 return system_type::template launch<
                     generate_lfsr113<ConfigProvider, is_dynamic, T, Distribution>,
                     ConfigProvider,
                     T,
-                    is_dynamic>(dim3(config.blocks),
+                    is_dynamic>(dim3(blocks),
                                 dim3(config.threads),
                                 0,
                                 m_stream,
                                 m_engines,
                                 m_start_engine_id,
+                                num_engines,
                                 data,
                                 data_size,
                                 distribution);
@@ -463,6 +742,40 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T* data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T* data, size_t data_size, T alpha, T beta)
+    {
+        beta_distribution<T> distribution(alpha, beta);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status
+        generate_binomial(unsigned int* data, size_t data_size, unsigned int n, double p)
+    {
+        binomial_distribution<> distribution(n, p);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_geometric(unsigned int* data, size_t data_size, double p)
+    {
+        geometric_distribution<> distribution(p);
+        return generate(data, data_size, distribution);
+    }
+
     rocrand_status generate_poisson(unsigned int* data, size_t data_size, double lambda)
     {
         auto result = m_poisson.get_distribution(lambda);
@@ -477,12 +790,109 @@ public:
         return std::get<rocrand_status>(result);
     }
 
+    /// Generates the \p count requests of \p requests. Every launch generates up to
+    /// max_fused_requests requests with one load and store of every engine, the values are
+    /// the same as the ones of separate generations of the requests.
+    rocrand_status generate_fused(const rocrand_fused_request* requests, size_t count)
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        const rocrand_ordering launch_order
+            = get_launch_ordering(m_order, system_type::is_device());
+
+        // The kernel is launched with the config of 32-bit values, the engines of every
+        // request are the ones of its value type
+        generator_config config;
+        const hipError_t error
+            = ConfigProvider::template host_config<unsigned int>(m_stream, launch_order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        // The host threads write the values of consecutive engines, next to each other
+        const unsigned int blocks
+            = get_launch_blocks<system_type>(config.threads, config.blocks, 0, 0);
+
+        return generate_fused_requests<ConfigProvider, default_fused_distributions>(
+            m_stream,
+            get_sequence_ordering(m_order),
+            m_engines_size,
+            requests,
+            count,
+            m_start_engine_id,
+            [&, this](const fused_request_list& list)
+            {
+                return dynamic_dispatch(
+                    launch_order,
+                    [&, this](auto is_dynamic)
+                    {
+                        return system_type::template launch<
+                            generate_lfsr113_fused<ConfigProvider, is_dynamic>,
+                            ConfigProvider,
+                            unsigned int,
+                            is_dynamic>(dim3(blocks),
+                                        dim3(config.threads),
+                                        0,
+                                        m_stream,
+                                        m_engines,
+                                        list);
+                    });
+            });
+    }
+
 private:
+    /// Returns the number of engines of the ordering \p order in \p engines_size.
+    rocrand_status get_engines_size(rocrand_ordering order, unsigned int& engines_size) const
+    {
+        hipError_t error
+            = get_least_common_grid_size<ConfigProvider>(m_stream,
+                                                         get_sequence_ordering(order),
+                                                         engines_size);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Allocates the engines for the current ordering without initializing their states.
+    rocrand_status allocate_engines()
+    {
+        const rocrand_status status = get_engines_size(m_order, m_engines_size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        if(m_engines != nullptr)
+        {
+            system_type::free(m_engines);
+        }
+        return system_type::alloc(&m_engines, m_engines_size);
+    }
+
+    generator_state_header get_state_header() const
+    {
+        generator_state_header header
+            = make_generator_state_header<engine_type>(type(), m_order, m_engines_size, m_offset);
+        header.seed[0]     = m_seed.x | static_cast<unsigned long long>(m_seed.y) << 32;
+        header.seed[1]     = m_seed.z | static_cast<unsigned long long>(m_seed.w) << 32;
+        header.position[0] = m_start_engine_id;
+        return header;
+    }
+
     bool         m_engines_initialized = false;
     engine_type* m_engines             = nullptr;
     unsigned int m_start_engine_id     = 0;
     unsigned int m_engines_size        = 0;
     uint4        m_seed;
+    // The engines have 2^32 subsequences
+    subsequence_range m_subsequences{0, 1ULL << 32};
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager_t m_poisson;
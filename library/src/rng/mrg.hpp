@@ -24,9 +24,12 @@
 #include "config/mrg31k3p_config.hpp"
 #include "config/mrg32k3a_config.hpp"
 
+#include "autotune.hpp"
 #include "common.hpp"
 #include "config_types.hpp"
 #include "distributions.hpp"
+#include "fused.hpp"
+#include "generator_state.hpp"
 #include "generator_type.hpp"
 #include "system.hpp"
 #include "utils/cpp_utils.hpp"
@@ -37,6 +40,7 @@
 
 #include <hip/hip_runtime.h>
 
+#include <algorithm>
 #include <type_traits>
 
 namespace rocrand_impl::host
@@ -50,6 +54,7 @@ __host__ __device__ void init_engines_mrg(dim3               block_idx,
                                           Engine*            engines,
                                           const unsigned int start_engine_id,
                                           const unsigned int engines_size,
+                                          unsigned long long subsequence,
                                           unsigned long long seed,
                                           unsigned long long offset)
 {
@@ -57,47 +62,35 @@ __host__ __device__ void init_engines_mrg(dim3               block_idx,
     const unsigned int engine_id = block_idx.x * block_dim.x + thread_idx.x;
     if(engine_id < engines_size)
     {
-        engines[engine_id]
-            = Engine(seed, engine_id, offset + (engine_id < start_engine_id ? 1 : 0));
+        engines[engine_id] = Engine(seed,
+                                    subsequence + engine_id,
+                                    offset + (engine_id < start_engine_id ? 1 : 0));
     }
 }
 
-template<class ConfigProvider, bool IsDynamic, class Engine, class T, class Distribution>
-__host__ __device__ __forceinline__ void generate_mrg(dim3 block_idx,
-                                      dim3 thread_idx,
-                                      dim3 grid_dim,
-                                      dim3 /*block_dim*/,
-                                      Engine*            engines,
-                                      const unsigned int start_engine_id,
-                                      T*                 data,
-                                      const size_t       n,
-                                      Distribution       distribution)
+/// Generates the values of engine \p id of \p stride engines that interleave their values.
+template<class Engine, class Output, class Distribution>
+__host__ __device__ __forceinline__ void generate_mrg_values(const unsigned int id,
+                                                             const unsigned int stride,
+                                                             Engine&            engine,
+                                                             Output             data,
+                                                             const size_t       n,
+                                                             Distribution       distribution)
 {
-    static_assert(is_single_tile_config<ConfigProvider, T>(IsDynamic),
-                  "This kernel should only be used with single tile configs");
-    constexpr unsigned int block_size   = get_block_size<ConfigProvider, T>(IsDynamic);
+    using T = typename Output::value_type;
+
     constexpr unsigned int input_width  = Distribution::input_width;
     constexpr unsigned int output_width = Distribution::output_width;
 
-    using vec_type = aligned_vec_type<T, output_width>;
-
-    const unsigned int id     = block_idx.x * block_size + thread_idx.x;
-    const unsigned int stride = grid_dim.x * block_size;
-
-    const unsigned int engine_id = (id + start_engine_id) % stride;
-    Engine             engine    = engines[engine_id];
-
     unsigned int input[input_width];
     T            output[output_width];
 
-    const uintptr_t uintptr   = reinterpret_cast<uintptr_t>(data);
-    const size_t misalignment = (output_width - uintptr / sizeof(T) % output_width) % output_width;
+    const size_t       misalignment = data.template misalignment<output_width>();
     const unsigned int head_size    = cpp_utils::min(n, misalignment);
     const unsigned int tail_size = (n - head_size) % output_width;
     const size_t       vec_n     = (n - head_size) / output_width;
 
-    vec_type* vec_data = reinterpret_cast<vec_type*>(data + misalignment);
-    size_t    index    = id;
+    size_t index = id;
     while(index < vec_n)
     {
         for(unsigned int i = 0; i < input_width; i++)
@@ -106,7 +99,7 @@ __host__ __device__ __forceinline__ void generate_mrg(dim3 block_idx,
         }
         distribution(input, output);
 
-        vec_data[index] = *reinterpret_cast<vec_type*>(output);
+        data.template store<output_width>(misalignment + index * output_width, output);
         // Next position
         index += stride;
     }
@@ -151,9 +144,356 @@ __host__ __device__ __forceinline__ void generate_mrg(dim3 block_idx,
             }
         }
     }
+}
+
+template<class ConfigProvider, bool IsDynamic, class Engine, class Output, class Distribution>
+__host__ __device__ __forceinline__ void generate_mrg(dim3 block_idx,
+                                      dim3 thread_idx,
+                                      dim3 grid_dim,
+                                      dim3 /*block_dim*/,
+                                      Engine*            engines,
+                                      const unsigned int start_engine_id,
+                                      const unsigned int num_engines,
+                                      Output             data,
+                                      const size_t       n,
+                                      Distribution       distribution)
+{
+    using T = typename Output::value_type;
+
+    static_assert(is_single_tile_config<ConfigProvider, T>(IsDynamic),
+                  "This kernel should only be used with single tile configs");
+    constexpr unsigned int block_size = get_block_size<ConfigProvider, T>(IsDynamic);
+
+    const unsigned int id     = block_idx.x * block_size + thread_idx.x;
+    const unsigned int stride = grid_dim.x * block_size;
+
+    // The sequence is defined by num_engines engines and every engine is run by one thread,
+    // so the launch config does not change the values.
+    const virtual_engine_range range = get_virtual_engine_range(id, stride, num_engines);
+    for(unsigned int virtual_id = range.first; virtual_id < range.last;
+        virtual_id += range.step)
+    {
+        const unsigned int engine_id = (virtual_id + start_engine_id) % num_engines;
+        Engine             engine    = engines[engine_id];
+
+        generate_mrg_values(virtual_id, num_engines, engine, data, n, distribution);
+
+        // Save engine with its state
+        engines[engine_id] = engine;
+    }
+}
+
+/// The distributions of the requests of MRG generators.
+template<class Engine>
+struct mrg_fused_distributions
+{
+    template<class T>
+    using uniform = mrg_engine_uniform_distribution<T, Engine>;
+    template<class T>
+    using normal = mrg_engine_normal_distribution<T, Engine>;
+    template<class T>
+    using log_normal = mrg_engine_log_normal_distribution<T, Engine>;
+};
+
+/// Generates all requests of \p requests with one load and store of every engine, see
+/// run_fused_requests.
+template<class ConfigProvider, bool IsDynamic, class Engine>
+__host__ __device__ __forceinline__ void generate_mrg_fused(dim3 block_idx,
+                                                            dim3 thread_idx,
+                                                            dim3 grid_dim,
+                                                            dim3 /*block_dim*/,
+                                                            Engine*            engines,
+                                                            fused_request_list requests)
+{
+    static_assert(is_single_tile_config<ConfigProvider, unsigned int>(IsDynamic),
+                  "This kernel should only be used with single tile configs");
+    constexpr unsigned int block_size = get_block_size<ConfigProvider, unsigned int>(IsDynamic);
+
+    run_fused_requests<mrg_fused_distributions<Engine>>(
+        block_idx.x * block_size + thread_idx.x,
+        grid_dim.x * block_size,
+        engines,
+        requests,
+        [](const unsigned int id,
+           const unsigned int stride,
+           Engine&            engine,
+           auto               data,
+           const size_t       n,
+           auto               distribution)
+        { generate_mrg_values(id, stride, engine, data, n, distribution); });
+}
+
+/// Number of values of a subsequence that are generated by one thread with the subsequence
+/// ordering, a multiple of the output width of all distributions.
+inline constexpr unsigned int mrg_subsequence_tile_size = 256;
+
+/// Number of values of every subsequence with the subsequence ordering until it is set with
+/// set_subsequence_length().
+inline constexpr unsigned long long mrg_default_subsequence_length = 1ULL << 20;
+
+/// Number of bytes of every tile that are staged in shared memory at once by blocks of
+/// \p block_size threads with the subsequence ordering. The staged values of a block with
+/// 1024 threads still fit into 64 KiB, and a block of 256 threads stores runs of 128 bytes.
+__host__ __device__ constexpr unsigned int
+    mrg_subsequence_stage_bytes(const unsigned int block_size)
+{
+    return block_size <= 256 ? 128 : block_size <= 512 ? 64 : 32;
+}
+
+/// Generates \p n values of the subsequence ordering starting at \p position of the stream:
+/// the value at position p is value <tt>p % subsequence_length</tt> of subsequence
+/// <tt>first_subsequence + p / subsequence_length</tt>. The subsequences are split into
+/// tiles of mrg_subsequence_tile_size values and every tile is generated by one thread with
+/// an engine that skips ahead to the tile, so the values do not depend on the grid.
+///
+/// On the device, adjacent threads generate adjacent tiles. Their values are staged in shared
+/// memory a few at a time and stored by the whole block, so every run of staged values is
+/// written with adjacent vector stores instead of one thread writing every tile.
+template<class ConfigProvider, bool IsDynamic, class Engine, class Output, class Distribution>
+__host__ __device__ __forceinline__ void
+    generate_mrg_subsequences(dim3                     block_idx,
+                              dim3                     thread_idx,
+                              dim3                     grid_dim,
+                              dim3                     /*block_dim*/,
+                              const unsigned long long seed,
+                              const unsigned long long first_subsequence,
+                              const unsigned long long subsequence_length,
+                              const unsigned long long position,
+                              Output                   data,
+                              const size_t             n,
+                              Distribution             distribution)
+{
+    using T = typename Output::value_type;
+
+    constexpr unsigned int block_size   = get_block_size<ConfigProvider, T>(IsDynamic);
+    constexpr unsigned int input_width  = Distribution::input_width;
+    constexpr unsigned int output_width = Distribution::output_width;
+    static_assert(mrg_subsequence_tile_size % output_width == 0,
+                  "Tiles must start at the first value of an output");
+
+    const unsigned long long tiles_per_subsequence
+        = (subsequence_length + mrg_subsequence_tile_size - 1) / mrg_subsequence_tile_size;
+    const auto get_tile = [&](const unsigned long long p)
+    {
+        return p / subsequence_length * tiles_per_subsequence
+               + p % subsequence_length / mrg_subsequence_tile_size;
+    };
+    const unsigned long long first_tile = get_tile(position);
+    const unsigned long long end_tile   = get_tile(position + n - 1) + 1;
+
+    unsigned int input[input_width];
+    T            output[output_width];
+
+#if defined(__HIP_DEVICE_COMPILE__)
+    constexpr unsigned int stage_size  = mrg_subsequence_stage_bytes(block_size) / sizeof(T);
+    constexpr unsigned int vector_size
+        = cpp_utils::min(static_cast<unsigned int>(16 / sizeof(T)), stage_size);
+    // A run that is not aligned to the vectors spans one more vector
+    constexpr unsigned int stage_vectors = stage_size / vector_size + 1;
+    // The padding keeps the values written by adjacent threads in different banks
+    constexpr unsigned int stage_stride = stage_size + 1;
+    static_assert(mrg_subsequence_tile_size % stage_size == 0 && stage_size % output_width == 0,
+                  "Stages must start at the first value of an output");
+
+    __shared__ T            staged[block_size * stage_stride];
+    __shared__ size_t       staged_index[block_size];
+    __shared__ unsigned int staged_offset[block_size];
+    __shared__ unsigned int staged_count[block_size];
+
+    const size_t misalignment = data.template misalignment<vector_size>();
+
+    for(unsigned long long group = first_tile + block_idx.x * block_size; group < end_tile;
+        group += grid_dim.x * block_size)
+    {
+        const unsigned long long tile   = group + thread_idx.x;
+        const bool               active = tile < end_tile;
+
+        const unsigned long long subsequence          = tile / tiles_per_subsequence;
+        const unsigned long long subsequence_position = subsequence * subsequence_length;
+        const unsigned long long tile_first
+            = tile % tiles_per_subsequence * mrg_subsequence_tile_size;
+
+        // Values [begin, end) of the subsequence are stored by this tile
+        unsigned long long begin = tile_first;
+        unsigned long long end   = 0;
+        if(active)
+        {
+            end = cpp_utils::min(begin + mrg_subsequence_tile_size, subsequence_length);
+            if(position > subsequence_position)
+            {
+                begin = cpp_utils::max(begin, position - subsequence_position);
+            }
+            end = cpp_utils::min(end, position + n - subsequence_position);
+        }
+
+        // The first output of the tile may start before the first stored value
+        unsigned long long value = begin - begin % output_width;
+        Engine             engine(seed,
+                      active ? first_subsequence + subsequence : 0,
+                      active ? value / output_width * input_width : 0);
+
+        for(unsigned int stage = 0; stage < mrg_subsequence_tile_size; stage += stage_size)
+        {
+            const unsigned long long stage_first = tile_first + stage;
+            const unsigned long long stage_end   = stage_first + stage_size;
+
+            for(; value < cpp_utils::min(end, stage_end); value += output_width)
+            {
+                for(unsigned int i = 0; i < input_width; i++)
+                {
+                    input[i] = engine();
+                }
+                distribution(input, output);
+                for(unsigned int o = 0; o < output_width; o++)
+                {
+                    staged[thread_idx.x * stage_stride + (value - stage_first) + o] = output[o];
+                }
+            }
+
+            // The values [first, last) of the subsequence are stored from this stage
+            const unsigned long long first = cpp_utils::max(begin, stage_first);
+            const unsigned long long last  = cpp_utils::min(end, stage_end);
+            staged_index[thread_idx.x]     = subsequence_position + first - position;
+            staged_offset[thread_idx.x]
+                = thread_idx.x * stage_stride + static_cast<unsigned int>(first - stage_first);
+            staged_count[thread_idx.x]
+                = last > first ? static_cast<unsigned int>(last - first) : 0;
+            __syncthreads();
+
+            for(unsigned int i = thread_idx.x; i < block_size * stage_vectors; i += block_size)
+            {
+                const unsigned int run   = i / stage_vectors;
+                const int          count = static_cast<int>(staged_count[run]);
+                if(count == 0)
+                {
+                    continue;
+                }
+                const size_t       index  = staged_index[run];
+                const unsigned int offset = staged_offset[run];
+
+                // The vectors are aligned to the output, so the first one of a run may start
+                // before its first value
+                const int shift = static_cast<int>((index - misalignment) % vector_size);
+                const int vector_first
+                    = static_cast<int>(i % stage_vectors * vector_size) - shift;
+                if(vector_first >= 0 && vector_first + static_cast<int>(vector_size) <= count)
+                {
+                    T values[vector_size];
+                    for(unsigned int v = 0; v < vector_size; v++)
+                    {
+                        values[v] = staged[offset + vector_first + v];
+                    }
+                    data.template store<vector_size>(index + vector_first, values);
+                }
+                else
+                {
+                    for(int j = cpp_utils::max(vector_first, 0);
+                        j < cpp_utils::min(vector_first + static_cast<int>(vector_size), count);
+                        j++)
+                    {
+                        data[index + j] = staged[offset + j];
+                    }
+                }
+            }
+            __syncthreads();
+        }
+    }
+#else
+    const unsigned int id     = block_idx.x * block_size + thread_idx.x;
+    const unsigned int stride = grid_dim.x * block_size;
+
+    const size_t misalignment = data.template misalignment<output_width>();
+
+    for(unsigned long long tile = first_tile + id; tile < end_tile; tile += stride)
+    {
+        const unsigned long long subsequence = tile / tiles_per_subsequence;
+        const unsigned long long subsequence_position = subsequence * subsequence_length;
+
+        // Values [begin, end) of the subsequence are stored by this tile
+        unsigned long long begin = tile % tiles_per_subsequence * mrg_subsequence_tile_size;
+        unsigned long long end
+            = cpp_utils::min(begin + mrg_subsequence_tile_size, subsequence_length);
+        if(position > subsequence_position)
+        {
+            begin = cpp_utils::max(begin, position - subsequence_position);
+        }
+        end = cpp_utils::min(end, position + n - subsequence_position);
+
+        // The first output of the tile may start before the first stored value
+        const unsigned long long first_value = begin - begin % output_width;
+        Engine engine(seed,
+                      first_subsequence + subsequence,
+                      first_value / output_width * input_width);
+
+        for(unsigned long long value = first_value; value < end; value += output_width)
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = engine();
+            }
+            distribution(input, output);
+
+            // May wrap around for the values before begin, they are not stored
+            const size_t index = subsequence_position + value - position;
+            if(value >= begin && value + output_width <= end && index >= misalignment
+               && (index - misalignment) % output_width == 0)
+            {
+                data.template store<output_width>(index, output);
+            }
+            else
+            {
+                for(unsigned int o = 0; o < output_width; o++)
+                {
+                    if(value + o >= begin && value + o < end)
+                    {
+                        data[index + o] = output[o];
+                    }
+                }
+            }
+        }
+    }
+#endif
+}
+
+template<class ConfigProvider, bool IsDynamic, class Engine, class T, class Distribution>
+__host__ __device__ __forceinline__ void
+    generate_mrg_batched(dim3                      block_idx,
+                         dim3                      thread_idx,
+                         dim3                      grid_dim,
+                         dim3                      /*block_dim*/,
+                         const unsigned long long* seeds,
+                         const unsigned long long* offsets,
+                         const unsigned long long  default_seed,
+                         const unsigned int        engines_size,
+                         T*                        data,
+                         const size_t              n,
+                         const size_t              pitch,
+                         Distribution              distribution)
+{
+    static_assert(is_single_tile_config<ConfigProvider, T>(IsDynamic),
+                  "This kernel should only be used with single tile configs");
+    constexpr unsigned int block_size = get_block_size<ConfigProvider, T>(IsDynamic);
+
+    const unsigned int id     = block_idx.x * block_size + thread_idx.x;
+    const unsigned int stride = grid_dim.x * block_size;
 
-    // Save engine with its state
-    engines[engine_id] = engine;
+    // Every row of the grid generates the values of one seed. The engine is the one that
+    // init_engines_mrg creates for that seed and offset.
+    const size_t             batch_index = block_idx.y;
+    const unsigned long long seed   = seeds[batch_index] == 0 ? default_seed : seeds[batch_index];
+    const unsigned long long offset = offsets == nullptr ? 0 : offsets[batch_index];
+
+    const unsigned int start_engine_id = offset % engines_size;
+    const unsigned int engine_id       = (id + start_engine_id) % stride;
+
+    Engine engine(seed, engine_id, offset / engines_size + (engine_id < start_engine_id ? 1 : 0));
+
+    generate_mrg_values(id,
+                        stride,
+                        engine,
+                        dense_output<T>{data + batch_index * pitch},
+                        n,
+                        distribution);
 }
 
 template<typename System, typename Engine, typename ConfigProvider>
@@ -190,6 +530,9 @@ public:
         , m_engines_size(other.m_engines_size)
         , m_start_engine_id(other.m_start_engine_id)
         , m_seed(other.m_seed)
+        , m_subsequences(other.m_subsequences)
+        , m_subsequence_length(other.m_subsequence_length)
+        , m_position(other.m_position)
         , m_poisson(std::move(other.m_poisson))
     {}
 
@@ -203,6 +546,9 @@ public:
         m_engines_size                 = other.m_engines_size;
         m_start_engine_id              = other.m_start_engine_id;
         m_seed                         = other.m_seed;
+        m_subsequences                 = other.m_subsequences;
+        m_subsequence_length           = other.m_subsequence_length;
+        m_position                     = other.m_position;
         m_poisson                      = std::move(other.m_poisson);
 
         return *this;
@@ -259,6 +605,8 @@ public:
             ROCRAND_ORDERING_PSEUDO_DYNAMIC,
             ROCRAND_ORDERING_PSEUDO_BEST,
             ROCRAND_ORDERING_PSEUDO_LEGACY,
+            ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE,
+            ROCRAND_ORDERING_PSEUDO_PORTABLE,
         };
         if(std::find(supported_orderings.begin(), supported_orderings.end(), order)
            == supported_orderings.end())
@@ -270,6 +618,32 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    /// Sets the number of values of every subsequence with ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE.
+    rocrand_status set_subsequence_length(unsigned long long length) override final
+    {
+        if(length == 0)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_subsequence_length = length;
+        reset();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status set_host_launch_blocks(unsigned int blocks) override final
+    {
+        if(system_type::is_device())
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+        if(blocks == 0 || blocks > max_host_launch_blocks)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_host_launch_blocks = blocks;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status set_stream(hipStream_t stream)
     {
         const rocrand_status status = m_poisson.set_stream(stream);
@@ -281,32 +655,80 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    rocrand_status init()
+    /// Divides the subsequences of this generator into the ranges \p parts of itself and
+    /// \p count children without changing it, see subsequence_range. The engines of this generator keep their subsequences.
+    rocrand_status split(unsigned int count, subsequence_range* parts) const
     {
-        if(m_engines_initialized)
+        unsigned int engines_size;
+        hipError_t   error
+            = get_least_common_grid_size<ConfigProvider>(m_stream,
+                                                         get_sequence_ordering(m_order),
+                                                         engines_size);
+        if(error != hipSuccess)
         {
-            return ROCRAND_STATUS_SUCCESS;
+            return ROCRAND_STATUS_INTERNAL_ERROR;
         }
+        return m_subsequences.split(engines_size, count, parts);
+    }
 
-        hipError_t error
-            = get_least_common_grid_size<ConfigProvider>(m_stream, m_order, m_engines_size);
-        if(error != hipSuccess)
+    /// Keeps only \p subsequences, the first part of a split() whose children were created.
+    void keep_subsequences(const subsequence_range& subsequences)
+    {
+        m_subsequences = subsequences;
+    }
+
+    /// Makes this generator a child of \p parent that uses \p subsequences.
+    rocrand_status fork_from(const mrg_generator_template& parent,
+                             const subsequence_range&      subsequences)
+    {
+        rocrand_status status = set_stream(parent.m_stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
         {
-            return ROCRAND_STATUS_INTERNAL_ERROR;
+            return status;
         }
+        status = set_order(parent.m_order);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        m_seed               = parent.m_seed;
+        m_subsequences       = subsequences;
+        m_subsequence_length = parent.m_subsequence_length;
+        m_host_launch_blocks = parent.m_host_launch_blocks;
+        reset();
+        return ROCRAND_STATUS_SUCCESS;
+    }
 
-        m_start_engine_id = m_offset % m_engines_size;
+    rocrand_status init()
+    {
+        if(m_engines_initialized)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
 
-        if(m_engines != nullptr)
+        if(m_order == ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE)
         {
-            system_type::free(m_engines);
+            // Every tile creates its own engine, only the position in the stream is kept
+            m_engines_size = 0;
+            m_position     = m_offset;
+
+            const rocrand_status status = m_poisson.init();
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+            m_engines_initialized = true;
+            return ROCRAND_STATUS_SUCCESS;
         }
-        rocrand_status status = system_type::alloc(&m_engines, m_engines_size);
+
+        rocrand_status status = allocate_engines();
         if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
         }
 
+        m_start_engine_id = m_offset % m_engines_size;
+
         constexpr unsigned int init_threads = ROCRAND_DEFAULT_MAX_BLOCK_SIZE;
         const unsigned int     init_blocks  = (m_engines_size + init_threads - 1) / init_threads;
 
@@ -319,6 +741,7 @@ public:
             m_engines,
             m_start_engine_id,
             m_engines_size,
+            m_subsequences.first,
             m_seed,
             m_offset / m_engines_size);
         if(status != ROCRAND_STATUS_SUCCESS)
@@ -336,61 +759,93 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    template<class T, class Distribution = mrg_engine_uniform_distribution<T, engine_type>>
-    rocrand_status generate(T* data, size_t data_size, Distribution distribution = Distribution())
+    rocrand_status get_state_size(size_t& size)
     {
-        rocrand_status status = init();
+        const rocrand_status status = init();
         if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
         }
+        size = get_generator_state_size(get_state_header());
+        return ROCRAND_STATUS_SUCCESS;
+    }
 
-        generator_config config;
-        const hipError_t error = ConfigProvider::template host_config<T>(m_stream, m_order, config);
-        if(error != hipSuccess)
+    rocrand_status save_state(void* state)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
         {
-            return ROCRAND_STATUS_INTERNAL_ERROR;
+            return status;
         }
+        return save_generator_state<system_type>(get_state_header(), m_engines, state, m_stream);
+    }
 
-        if(data == nullptr)
+    rocrand_status load_state(const void* state)
+    {
+        generator_state_header header;
+        rocrand_status         status
+            = read_generator_state_header(state, type(), m_stream, header);
+        if(status != ROCRAND_STATUS_SUCCESS)
         {
-            return ROCRAND_STATUS_SUCCESS;
+            return status;
         }
 
-        status = dynamic_dispatch(
-            m_order,
-            [&, this](auto is_dynamic)
+        // The layout is checked before the ordering and the engines are changed
+        unsigned int engines_size;
+        status = get_engines_size(header.order, engines_size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = check_generator_state_layout<engine_type>(header, engines_size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if(header.order != m_order)
+        {
+            status = set_order(header.order);
+            if(status != ROCRAND_STATUS_SUCCESS)
             {
-                return system_type::template launch<
-                    generate_mrg<ConfigProvider, is_dynamic, engine_type, T, Distribution>,
-                    ConfigProvider,
-                    T,
-                    is_dynamic>(dim3(config.blocks),
-                                dim3(config.threads),
-                                0,
-                                m_stream,
-                                m_engines,
-                                m_start_engine_id,
-                                data,
-                                data_size,
-                                distribution);
-            });
+                return status;
+            }
+        }
 
-        // Check kernel status
+        // The engines are only allocated, their states are loaded below
+        m_engines_initialized = false;
+        status                = allocate_engines();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = load_generator_state<engine_type, system_type>(state,
+                                                                m_engines_size,
+                                                                m_engines,
+                                                                m_stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = m_poisson.init();
         if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
         }
 
-        // Generating data_size values will use this many distributions
-        const auto touched_engines
-            = (data_size + Distribution::output_width - 1) / Distribution::output_width;
-
-        m_start_engine_id = (m_start_engine_id + touched_engines) % m_engines_size;
-
+        m_seed                = header.seed[0];
+        m_offset              = header.offset;
+        m_start_engine_id     = header.position[0];
+        m_position            = header.position[0] | (1ULL * header.position[1] << 32);
+        m_engines_initialized = true;
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    template<class T, class Distribution = mrg_engine_uniform_distribution<T, engine_type>>
+    rocrand_status generate(T* data, size_t data_size, Distribution distribution = Distribution())
+    {
+        return generate_output(dense_output<T>{data}, data_size, distribution);
+    }
+
     rocrand_status generate(unsigned long long* data, size_t data_size)
     {
         // Cannot generate 64-bit values with this generator.
@@ -409,6 +864,102 @@ public:
         return ROCRAND_STATUS_TYPE_ERROR;
     }
 
+    /// Generates \p data_size values for each of the \p batch_size seeds in \p seeds. The
+    /// values of seed i are stored at <tt>data + i * pitch</tt> and are the same as the ones
+    /// generated after setting the seed to <tt>seeds[i]</tt> and the offset to
+    /// <tt>offsets[i]</tt> (or 0 if \p offsets is nullptr). \p seeds and \p offsets must be
+    /// accessible by the kernels like \p data. The engines of the generator are not used.
+    template<class T, class Distribution = mrg_engine_uniform_distribution<T, engine_type>>
+    rocrand_status generate_batched(T*                        data,
+                                    size_t                    data_size,
+                                    size_t                    pitch,
+                                    const unsigned long long* seeds,
+                                    const unsigned long long* offsets,
+                                    size_t                    batch_size,
+                                    Distribution              distribution = Distribution()) const
+    {
+        if(m_order == ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE)
+        {
+            // The subsequence ordering keeps no engines that the batches could follow
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+
+        // Every batch runs one engine per thread, so the portable ordering launches the
+        // configs that define its sequence
+        const rocrand_ordering order = get_sequence_ordering(m_order);
+
+        unsigned int engines_size;
+        hipError_t   error
+            = get_least_common_grid_size<ConfigProvider>(m_stream, order, engines_size);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        generator_config config;
+        error = ConfigProvider::template host_config<T>(m_stream, order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        if(data == nullptr)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        for(size_t first = 0; first < batch_size; first += max_batch_grid_rows)
+        {
+            const unsigned int rows
+                = static_cast<unsigned int>(std::min(batch_size - first, max_batch_grid_rows));
+
+            const rocrand_status status = dynamic_dispatch(
+                order,
+                [&, this](auto is_dynamic)
+                {
+                    return system_type::template launch<
+                        generate_mrg_batched<ConfigProvider,
+                                             is_dynamic,
+                                             engine_type,
+                                             T,
+                                             Distribution>,
+                        ConfigProvider,
+                        T,
+                        is_dynamic>(dim3(config.blocks, rows),
+                                    dim3(config.threads),
+                                    0,
+                                    m_stream,
+                                    seeds + first,
+                                    offsets == nullptr ? nullptr : offsets + first,
+                                    get_default_seed(),
+                                    engines_size,
+                                    data + first * pitch,
+                                    data_size,
+                                    pitch,
+                                    distribution);
+                });
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_normal_batched(T*                        data,
+                                           size_t                    data_size,
+                                           size_t                    pitch,
+                                           const unsigned long long* seeds,
+                                           const unsigned long long* offsets,
+                                           size_t                    batch_size,
+                                           T                         mean,
+                                           T                         stddev) const
+    {
+        mrg_engine_normal_distribution<T, engine_type> distribution(mean, stddev);
+        return generate_batched(data, data_size, pitch, seeds, offsets, batch_size, distribution);
+    }
+
     template<class T>
     rocrand_status generate_uniform(T* data, size_t data_size)
     {
@@ -423,6 +974,33 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    /// Generates \p width * \p height values like generate() and stores them in the rows of
+    /// a 2-D array with \p pitch elements per row.
+    template<class T, class Distribution = mrg_engine_uniform_distribution<T, engine_type>>
+    rocrand_status generate_2d(T*           data,
+                               size_t       width,
+                               size_t       height,
+                               size_t       pitch,
+                               Distribution distribution = Distribution())
+    {
+        return generate_output(pitched_output<T>{data, width, pitch}, width * height, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_2d(T* data, size_t width, size_t height, size_t pitch)
+    {
+        mrg_engine_uniform_distribution<T, engine_type> distribution;
+        return generate_2d(data, width, height, pitch, distribution);
+    }
+
+    template<class T>
+    rocrand_status
+        generate_normal_2d(T* data, size_t width, size_t height, size_t pitch, T mean, T stddev)
+    {
+        mrg_engine_normal_distribution<T, engine_type> distribution(mean, stddev);
+        return generate_2d(data, width, height, pitch, distribution);
+    }
+
     template<class T>
     rocrand_status generate_log_normal(T* data, size_t data_size, T mean, T stddev)
     {
@@ -430,6 +1008,40 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        mrg_engine_exponential_distribution<T, engine_type> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T* data, size_t data_size, T shape, T scale)
+    {
+        mrg_engine_gamma_distribution<T, engine_type> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T* data, size_t data_size, T alpha, T beta)
+    {
+        mrg_engine_beta_distribution<T, engine_type> distribution(alpha, beta);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status
+        generate_binomial(unsigned int* data, size_t data_size, unsigned int n, double p)
+    {
+        mrg_engine_binomial_distribution<engine_type> distribution(n, p);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_geometric(unsigned int* data, size_t data_size, double p)
+    {
+        mrg_engine_geometric_distribution<engine_type> distribution(p);
+        return generate(data, data_size, distribution);
+    }
+
     rocrand_status generate_poisson(unsigned int* data, size_t data_size, double lambda)
     {
         auto result = m_poisson.get_distribution(lambda);
@@ -447,7 +1059,322 @@ public:
         return std::get<rocrand_status>(result);
     }
 
+    /// Generates the \p count requests of \p requests. Every launch generates up to
+    /// max_fused_requests requests with one load and store of every engine, the values are
+    /// the same as the ones of separate generations of the requests.
+    rocrand_status generate_fused(const rocrand_fused_request* requests, size_t count)
+    {
+        using distributions_type = mrg_fused_distributions<engine_type>;
+
+        if(m_order == ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE)
+        {
+            // The subsequence ordering has no engines that could be kept, every request is
+            // generated by its own launch
+            for(size_t i = 0; i < count; i++)
+            {
+                if(requests[i].output_data == nullptr || requests[i].n == 0)
+                {
+                    continue;
+                }
+                rocrand_status status = ROCRAND_STATUS_SUCCESS;
+                visit_fused_request<distributions_type>(
+                    requests[i],
+                    [&, this](auto output, auto distribution)
+                    { status = generate_output(output, requests[i].n, distribution); });
+                if(status != ROCRAND_STATUS_SUCCESS)
+                {
+                    return status;
+                }
+            }
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        const rocrand_ordering launch_order
+            = get_launch_ordering(m_order, system_type::is_device());
+
+        // The kernel is launched with the config of 32-bit values, the engines of every
+        // request are the ones of its value type
+        generator_config config;
+        const hipError_t error
+            = ConfigProvider::template host_config<unsigned int>(m_stream, launch_order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        // The host threads write the values of consecutive engines, next to each other
+        const unsigned int blocks
+            = get_launch_blocks<system_type>(config.threads, config.blocks, 0, 0);
+
+        return generate_fused_requests<ConfigProvider, distributions_type>(
+            m_stream,
+            get_sequence_ordering(m_order),
+            m_engines_size,
+            requests,
+            count,
+            m_start_engine_id,
+            [&, this](const fused_request_list& list)
+            {
+                return dynamic_dispatch(
+                    launch_order,
+                    [&, this](auto is_dynamic)
+                    {
+                        return system_type::template launch<
+                            generate_mrg_fused<ConfigProvider, is_dynamic, engine_type>,
+                            ConfigProvider,
+                            unsigned int,
+                            is_dynamic>(dim3(blocks),
+                                        dim3(config.threads),
+                                        0,
+                                        m_stream,
+                                        m_engines,
+                                        list);
+                    });
+            });
+    }
+
 private:
+    /// Returns the number of engines of the ordering \p order in \p engines_size.
+    rocrand_status get_engines_size(rocrand_ordering order, unsigned int& engines_size) const
+    {
+        if(order == ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE)
+        {
+            // Every tile creates its own engine
+            engines_size = 0;
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        hipError_t error
+            = get_least_common_grid_size<ConfigProvider>(m_stream,
+                                                         get_sequence_ordering(order),
+                                                         engines_size);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Allocates the engines for the current ordering without initializing their states.
+    rocrand_status allocate_engines()
+    {
+        const rocrand_status status = get_engines_size(m_order, m_engines_size);
+        if(status != ROCRAND_STATUS_SUCCESS || m_engines_size == 0)
+        {
+            // The subsequence ordering has no engines to allocate
+            return status;
+        }
+
+        if(m_engines != nullptr)
+        {
+            system_type::free(m_engines);
+        }
+        return system_type::alloc(&m_engines, m_engines_size);
+    }
+
+    generator_state_header get_state_header() const
+    {
+        generator_state_header header
+            = make_generator_state_header<engine_type>(type(), m_order, m_engines_size, m_offset);
+        header.seed[0] = m_seed;
+        if(m_order == ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE)
+        {
+            header.position[0] = static_cast<unsigned int>(m_position);
+            header.position[1] = static_cast<unsigned int>(m_position >> 32);
+        }
+        else
+        {
+            header.position[0] = m_start_engine_id;
+        }
+        return header;
+    }
+
+    template<class Output, class Distribution>
+    rocrand_status
+        generate_subsequences(Output data, size_t data_size, Distribution distribution)
+    {
+        using T = typename Output::value_type;
+
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        // The values do not depend on the grid, so the device launches the tuned configs
+        const rocrand_ordering launch_order
+            = get_launch_ordering(m_order, system_type::is_device());
+
+        generator_config config;
+        const hipError_t error
+            = ConfigProvider::template host_config<T>(m_stream, launch_order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        if(data.data == nullptr || data_size == 0)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // Every host thread writes whole tiles
+        const unsigned int blocks
+            = get_launch_blocks<system_type>(config.threads, config.blocks, 0, 0);
+
+        status = dynamic_dispatch(
+            launch_order,
+            [&, this](auto is_dynamic)
+            {
+                return system_type::template launch<
+                    generate_mrg_subsequences<ConfigProvider,
+                                              is_dynamic,
+                                              engine_type,
+                                              Output,
+                                              Distribution>,
+                    ConfigProvider,
+                    T,
+                    is_dynamic>(dim3(blocks),
+                                dim3(config.threads),
+                                0,
+                                m_stream,
+                                m_seed,
+                                m_subsequences.first,
+                                m_subsequence_length,
+                                m_position,
+                                data,
+                                data_size,
+                                distribution);
+            });
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        m_position += data_size;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class Output, class Distribution>
+    rocrand_status generate_output(Output data, size_t data_size, Distribution distribution)
+    {
+        using T = typename Output::value_type;
+
+        if(m_order == ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE)
+        {
+            return generate_subsequences(data, data_size, distribution);
+        }
+
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        const rocrand_ordering launch_order
+            = get_launch_ordering(m_order, system_type::is_device());
+
+        generator_config sequence_config;
+        hipError_t       error
+            = ConfigProvider::template host_config<T>(m_stream,
+                                                      get_sequence_ordering(m_order),
+                                                      sequence_config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        const unsigned int num_engines = sequence_config.threads * sequence_config.blocks;
+
+        if(m_order == ROCRAND_ORDERING_PSEUDO_PORTABLE && data.data != nullptr)
+        {
+            status = autotune_portable_blocks<type(), T, ConfigProvider, system_type>(
+                m_stream,
+                m_engines,
+                m_engines_size,
+                [&, this](dim3 blocks, dim3 threads, engine_type* engines, T* scratch, size_t n)
+                {
+                    return system_type::template launch<
+                        generate_mrg<ConfigProvider,
+                                     true,
+                                     engine_type,
+                                     dense_output<T>,
+                                     Distribution>,
+                        ConfigProvider,
+                        T,
+                        true>(blocks,
+                              threads,
+                              0,
+                              m_stream,
+                              engines,
+                              0U,
+                              num_engines,
+                              dense_output<T>{scratch},
+                              n,
+                              distribution);
+                });
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+
+        generator_config config;
+        error = ConfigProvider::template host_config<T>(m_stream, launch_order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        if(data.data == nullptr)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // The host threads write the values of consecutive engines, next to each other
+        const unsigned int blocks
+            = get_launch_blocks<system_type>(config.threads, config.blocks, 0, 0);
+
+        status = dynamic_dispatch(
+            launch_order,
+            [&, this](auto is_dynamic)
+            {
+                return system_type::template launch<
+                    generate_mrg<ConfigProvider, is_dynamic, engine_type, Output, Distribution>,
+                    ConfigProvider,
+                    T,
+                    is_dynamic>(dim3(blocks),
+                                dim3(config.threads),
+                                0,
+                                m_stream,
+                                m_engines,
+                                m_start_engine_id,
+                                num_engines,
+                                data,
+                                data_size,
+                                distribution);
+            });
+
+        // Check kernel status
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        // Generating data_size values will use this many distributions
+        const auto touched_engines
+            = (data_size + Distribution::output_width - 1) / Distribution::output_width;
+
+        m_start_engine_id = (m_start_engine_id + touched_engines) % m_engines_size;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     constexpr static unsigned long long int get_default_seed()
     {
         if constexpr(std::is_same_v<engine_type, rocrand_device::mrg31k3p_engine>)
@@ -466,6 +1393,11 @@ private:
     unsigned int m_start_engine_id     = 0;
 
     unsigned long long m_seed;
+    subsequence_range  m_subsequences;
+
+    // Values per subsequence and position in the stream of ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE
+    unsigned long long m_subsequence_length = mrg_default_subsequence_length;
+    unsigned long long m_position           = 0;
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager_t m_poisson;
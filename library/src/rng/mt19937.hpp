@@ -55,6 +55,8 @@
 #include "common.hpp"
 #include "config_types.hpp"
 #include "distributions.hpp"
+#include "engine_state_cache.hpp"
+#include "generator_state.hpp"
 #include "generator_type.hpp"
 #include "mt19937_octo_engine.hpp"
 #include "system.hpp"
@@ -68,7 +70,9 @@
 
 #include <hip/hip_runtime.h>
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 namespace rocrand_impl::host
 {
@@ -80,6 +84,74 @@ unsigned int wrap_n(unsigned int i)
     return i - (i < mt19937_constants::n ? 0 : mt19937_constants::n);
 }
 
+/// Host version of jump_ahead_mt19937 for the engine \p engine_id.
+///
+/// The jump polynomial p(x) = sum p_i * x^i is applied to the state as the sum of
+/// T^i(state) for all set p_i, where T is one step of the recurrence. T^i(state) is the
+/// window [i, i + n) of the sequence that continues the state, so the sequence is generated
+/// once and the windows are added with XORs of contiguous ranges that the compiler
+/// vectorizes, instead of the single-value steps of the device version.
+inline void jump_ahead_mt19937_host(unsigned int engine_id,
+                                    unsigned int* __restrict__ engines,
+                                    unsigned long long seed,
+                                    const unsigned int* __restrict__ jump)
+{
+    constexpr unsigned int n    = mt19937_constants::n;
+    constexpr unsigned int m    = mt19937_constants::m;
+    constexpr unsigned int mexp = mt19937_constants::mexp;
+
+    std::vector<unsigned int> sequence(mexp + n);
+    unsigned int              state[n];
+
+    // Initialize state 0 (engine_id = 0) used as a base for all engines.
+    const unsigned int seedu = (seed >> 32) ^ seed;
+    state[0]                 = seedu;
+    for(unsigned int i = 1; i < n; i++)
+    {
+        state[i] = 1812433253 * (state[i - 1] ^ (state[i - 1] >> 30)) + i;
+    }
+
+    // Jump ahead by engine_id * 2 ^ 1000 using precomputed polynomials for jumps of
+    // i * 2 ^ 1000 and mt19937_jumps_radix * i * 2 ^ 1000 values
+    // where i is in range [1; mt19937_jumps_radix).
+    unsigned int e = engine_id;
+    for(unsigned int r = 0; r < mt19937_jumps_radixes; r++)
+    {
+        const unsigned int radix = e % mt19937_jumps_radix;
+        e /= mt19937_jumps_radix;
+        if(radix == 0)
+        {
+            continue;
+        }
+
+        std::copy(state, state + n, sequence.begin());
+        for(unsigned int i = 0; i < mexp; i++)
+        {
+            const unsigned int y = (sequence[i] & mt19937_constants::upper_mask)
+                                   | (sequence[i + 1] & mt19937_constants::lower_mask);
+            sequence[i + n] = sequence[i + m] ^ (y >> 1)
+                              ^ ((y & 0x1U) ? mt19937_constants::matrix_a : 0);
+        }
+
+        std::fill_n(state, n, 0U);
+        const unsigned int* pf
+            = jump + (r * (mt19937_jumps_radix - 1) + radix - 1) * mt19937_p_size;
+        for(unsigned int pfi = 0; pfi < mexp; pfi++)
+        {
+            if((pf[pfi / 32] >> (pfi % 32)) & 1)
+            {
+                const unsigned int* window = sequence.data() + pfi;
+                for(unsigned int i = 0; i < n; i++)
+                {
+                    state[i] ^= window[i];
+                }
+            }
+        }
+    }
+
+    std::copy(state, state + n, engines + engine_id * n);
+}
+
 // Config is not actually used for kernel launch here, but is needed to check the number of generators
 // As this kernel is not dependent on any type just use void for the config, as mt19937 is not tuned for types independently, so all configs are the same for different types.
 template<unsigned int jump_ahead_thread_count, class ConfigProvider, bool IsDynamic>
@@ -87,21 +159,11 @@ __forceinline__ __host__ __device__
 void jump_ahead_mt19937(dim3 block_idx,
                         dim3 thread_idx,
                         dim3 /*grid_dim*/,
-                        [[maybe_unused]] dim3 block_dim,
+                        dim3 /*block_dim*/,
                         unsigned int* __restrict__ engines,
                         unsigned long long seed,
                         const unsigned int* __restrict__ jump)
 {
-#if defined(__HIP_DEVICE_COMPILE__)
-    static constexpr bool isDevice = true;
-#else
-    static constexpr bool isDevice = false;
-    if(thread_idx.x > 0)
-    {
-        return;
-    }
-#endif
-
     constexpr generator_config config = ConfigProvider::template device_config<void>(IsDynamic);
     constexpr unsigned int     GeneratorCount
         = config.threads * config.blocks / mt19937_octo_engine::threads_per_generator;
@@ -109,24 +171,23 @@ void jump_ahead_mt19937(dim3 block_idx,
                       && mt19937_jumps_radixes == 2,
                   "Not enough rocrand_h_mt19937_jump values to initialize all generators");
 
+#if !defined(__HIP_DEVICE_COMPILE__)
+    // The first thread of the block computes the whole engine
+    if(thread_idx.x == 0)
+    {
+        jump_ahead_mt19937_host(block_idx.x, engines, seed, jump);
+    }
+#else
     constexpr unsigned int block_size       = jump_ahead_thread_count;
     constexpr unsigned int items_per_thread = (mt19937_constants::n + block_size - 1) / block_size;
     constexpr unsigned int tail_n = mt19937_constants::n - (items_per_thread - 1) * block_size;
 
-#if defined(__HIP_DEVICE_COMPILE__)
     __shared__ unsigned int temp[mt19937_constants::n];
     unsigned int            state[items_per_thread];
 
-#else
-    unsigned int temp[mt19937_constants::n];
-    unsigned int states[block_size][items_per_thread];
-#endif
-
     // Initialize state 0 (engine_id = 0) used as a base for all engines.
     // It uses a recurrence relation so one thread calculates all n values.
-#if defined(__HIP_DEVICE_COMPILE__)
     if(thread_idx.x == 0)
-#endif
     {
         const unsigned int seedu = (seed >> 32) ^ seed;
         temp[0]                  = seedu;
@@ -135,30 +196,17 @@ void jump_ahead_mt19937(dim3 block_idx,
             temp[i] = 1812433253 * (temp[i - 1] ^ (temp[i - 1] >> 30)) + i;
         }
     }
+    __syncthreads();
 
-    system::syncthreads<isDevice>{}();
-
-    // clang-format off
+    const unsigned int j = thread_idx.x;
     for(unsigned int i = 0; i < items_per_thread; i++)
     {
-#if defined(__HIP_DEVICE_COMPILE__)
-        unsigned int& j = thread_idx.x;
-#else
-        for(unsigned int j = 0; j < block_dim.x; ++j)
+        if(i < items_per_thread - 1 || j < tail_n) // Check only for the last iteration
         {
-            auto& state = states[j];
-#endif
-            if(i < items_per_thread - 1 || j < tail_n) // Check only for the last iteration
-            {
-                state[i] = temp[i * block_size + j];
-            }
-#if !defined(__HIP_DEVICE_COMPILE__)
+            state[i] = temp[i * block_size + j];
         }
-#endif
     }
-    // clang-format on
-
-    system::syncthreads<isDevice>{}();
+    __syncthreads();
 
     const unsigned int engine_id = block_idx.x;
 
@@ -166,7 +214,6 @@ void jump_ahead_mt19937(dim3 block_idx,
     // i * 2 ^ 1000 and mt19937_jumps_radix * i * 2 ^ 1000 values
     // where i is in range [1; mt19937_jumps_radix).
     unsigned int e = engine_id;
-    // clang-format off
     for(unsigned int r = 0; r < mt19937_jumps_radixes; r++)
     {
         const unsigned int radix = e % mt19937_jumps_radix;
@@ -179,24 +226,18 @@ void jump_ahead_mt19937(dim3 block_idx,
         // Compute jumping ahead with standard Horner method
 
         unsigned int ptr = 0;
-#if defined(__HIP_DEVICE_COMPILE__)
         for(unsigned int i = thread_idx.x; i < mt19937_constants::n; i += block_size)
-#else
-        for(unsigned int i = 0; i < mt19937_constants::n; ++i)
-#endif
         {
             temp[i] = 0;
         }
-        system::syncthreads<isDevice>{}();
+        __syncthreads();
 
         const unsigned int* pf
             = jump + (r * (mt19937_jumps_radix - 1) + radix - 1) * mt19937_p_size;
         for(int pfi = mt19937_constants::mexp - 1; pfi >= 0; pfi--)
         {
             // Generate next state
-#if defined(__HIP_DEVICE_COMPILE__)
             if(thread_idx.x == 0)
-#endif
             {
                 unsigned int t0 = temp[ptr];
                 unsigned int t1 = temp[wrap_n(ptr + 1)];
@@ -205,7 +246,7 @@ void jump_ahead_mt19937(dim3 block_idx,
                     = (t0 & mt19937_constants::upper_mask) | (t1 & mt19937_constants::lower_mask);
                 temp[ptr] = tm ^ (y >> 1) ^ ((y & 0x1U) ? mt19937_constants::matrix_a : 0);
             }
-            system::syncthreads<isDevice>{}();
+            __syncthreads();
             ptr = wrap_n(ptr + 1);
 
             if((pf[pfi / 32] >> (pfi % 32)) & 1)
@@ -213,65 +254,35 @@ void jump_ahead_mt19937(dim3 block_idx,
                 // Add state to temp
                 for(unsigned int i = 0; i < items_per_thread; i++)
                 {
-#if defined(__HIP_DEVICE_COMPILE__)
-                    unsigned int& j = thread_idx.x;
-#else
-                    for(unsigned int j = 0; j < block_dim.x; ++j)
+                    if(i < items_per_thread - 1 || j < tail_n)
                     {
-                        auto& state = states[j];
-#endif
-                        if(i < items_per_thread - 1 || j < tail_n)
-                        {
-                            temp[wrap_n(ptr + i * block_size + j)] ^= state[i];
-                        }
-#if !defined(__HIP_DEVICE_COMPILE__)
+                        temp[wrap_n(ptr + i * block_size + j)] ^= state[i];
                     }
-#endif
                 }
-                system::syncthreads<isDevice>{}();
+                __syncthreads();
             }
         }
 
         // Jump of the next power of 2 will be applied to the current state
-#if defined(__HIP_DEVICE_COMPILE__)
-        unsigned int& j = thread_idx.x;
-#else
-        for(unsigned int j = 0; j < block_dim.x; ++j)
+        for(unsigned int i = 0; i < items_per_thread; i++)
         {
-            auto& state = states[j];
-#endif
-            for(unsigned int i = 0; i < items_per_thread; i++)
+            if(i < items_per_thread - 1 || j < tail_n)
             {
-                if(i < items_per_thread - 1 || j < tail_n)
-                {
-                    state[i] = temp[wrap_n(ptr + i * block_size + j)];
-                }
+                state[i] = temp[wrap_n(ptr + i * block_size + j)];
             }
-#if !defined(__HIP_DEVICE_COMPILE__)
         }
-#endif
-        system::syncthreads<isDevice>{}();
+        __syncthreads();
     }
 
     // Save state
     for(unsigned int i = 0; i < items_per_thread; i++)
     {
-#if defined(__HIP_DEVICE_COMPILE__)
-        unsigned int& j = thread_idx.x;
-#else
-        for(unsigned int j = 0; j < block_dim.x; ++j)
+        if(i < items_per_thread - 1 || j < tail_n)
         {
-            auto& state = states[j];
-#endif
-            if(i < items_per_thread - 1 || j < tail_n)
-            {
-                engines[engine_id * mt19937_constants::n + i * block_size + j] = state[i];
-            }
-#if !defined(__HIP_DEVICE_COMPILE__)
+            engines[engine_id * mt19937_constants::n + i * block_size + j] = state[i];
         }
-#endif
     }
-    // clang-format on
+#endif
 }
 
 // This kernel is not explicitly tuned, but uses the same configs as the generate-kernels.
@@ -798,114 +809,138 @@ public:
             return ROCRAND_STATUS_SUCCESS;
         }
 
-        // TODO: make a version for generators that don't support per-type specialization of the configs and use that one
-        // For now: just use the void config, assuming that all configs are the same
         generator_config config;
-        hipError_t err = ConfigProvider::template host_config<void>(m_stream, m_order, config);
-        if(err != hipSuccess)
+        rocrand_status   status = allocate_engines(config);
+        if(status != ROCRAND_STATUS_SUCCESS)
         {
-            return ROCRAND_STATUS_INTERNAL_ERROR;
+            return status;
         }
-        m_generator_count = config.threads * config.blocks / threads_per_generator;
 
-        if(m_engines != nullptr)
+        const size_t engines_bytes = get_engines_words() * sizeof(unsigned int);
+
+        // Computing the engines takes much longer than copying them, so the engines of
+        // recurring seeds are copied from the process-wide cache if it is enabled.
+        const engine_state_key cache_key{type(),
+                                         m_seed,
+                                         m_order,
+                                         config.threads,
+                                         config.blocks,
+                                         system_type::is_device()};
+        engine_state_cache&    cache = engine_state_cache::instance();
+
+        bool cached;
+        status = cache.load<system_type>(cache_key, m_engines, engines_bytes, cached);
+        if(status != ROCRAND_STATUS_SUCCESS)
         {
-            system_type::free(m_engines);
+            return status;
         }
-        // Allocate device random number engines
-        rocrand_status status
-            = system_type::alloc(&m_engines,
-                                 m_generator_count * mt19937_constants::n * sizeof(unsigned int));
+        if(!cached)
+        {
+            status = init_engines(config);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+            status = cache.store(cache_key, m_engines, engines_bytes, m_stream);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+
+        status = m_poisson.init();
         if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
         }
 
-        unsigned int* d_engines{};
-        status
-            = system_type::alloc(&d_engines,
-                                 m_generator_count * mt19937_constants::n * sizeof(unsigned int));
+        m_engines_initialized = true;
+        m_start_input         = 0;
+        m_prev_input_width    = 0;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status get_state_size(size_t& size)
+    {
+        const rocrand_status status = init();
         if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
         }
+        size = get_generator_state_size(get_state_header());
+        return ROCRAND_STATUS_SUCCESS;
+    }
 
-        unsigned int* d_mt19937_jump{};
-        status = system_type::alloc(&d_mt19937_jump, sizeof(rocrand_h_mt19937_jump));
+    rocrand_status save_state(void* state)
+    {
+        const rocrand_status status = init();
         if(status != ROCRAND_STATUS_SUCCESS)
         {
-            system_type::free(d_engines);
             return status;
         }
+        return save_generator_state<system_type>(get_state_header(), m_engines, state, m_stream);
+    }
 
-        status = system_type::memcpy(d_mt19937_jump,
-                                     rocrand_h_mt19937_jump,
-                                     sizeof(rocrand_h_mt19937_jump),
-                                     hipMemcpyHostToDevice);
+    rocrand_status load_state(const void* state)
+    {
+        generator_state_header header;
+        rocrand_status         status
+            = read_generator_state_header(state, type(), m_stream, header);
         if(status != ROCRAND_STATUS_SUCCESS)
         {
-            system_type::free(d_engines);
-            system_type::free(d_mt19937_jump);
-            return ROCRAND_STATUS_INTERNAL_ERROR;
+            return status;
         }
 
-        dynamic_dispatch(
-            m_order,
-            [&, this](auto is_dynamic)
+        // The layout is checked before the ordering and the engines are changed
+        generator_config config;
+        unsigned int     generator_count;
+        status = get_generator_count(header.order, config, generator_count);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = check_generator_state_layout<unsigned int>(header,
+                                                            generator_count * mt19937_constants::n);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if(header.order != m_order)
+        {
+            status = set_order(header.order);
+            if(status != ROCRAND_STATUS_SUCCESS)
             {
-                status = system_type::template launch<
+                return status;
+            }
+        }
 
-                    jump_ahead_mt19937<jump_ahead_thread_count, ConfigProvider, is_dynamic>,
-                    static_block_size_config_provider<jump_ahead_thread_count>>(
-                    dim3(m_generator_count),
-                    dim3(jump_ahead_thread_count),
-                    0,
-                    m_stream,
-                    d_engines,
-                    m_seed,
-                    d_mt19937_jump);
-            });
+        // The engines are only allocated, their states are loaded below
+        m_engines_initialized = false;
+        status                = allocate_engines(config);
         if(status != ROCRAND_STATUS_SUCCESS)
         {
-            system_type::free(d_engines);
-            system_type::free(d_mt19937_jump);
             return status;
         }
-
-        system_type::free(d_mt19937_jump);
-
-        // This kernel is not actually tuned for ordering, but config is needed for device-side compile time check of the generator count
-        dynamic_dispatch(
-            m_order,
-            [&, this](auto is_dynamic)
-            {
-                status
-                    = system_type::template launch<init_engines_mt19937<ConfigProvider, is_dynamic>,
-                                                   ConfigProvider>(dim3(config.blocks),
-                                                                   dim3(config.threads),
-                                                                   0,
-                                                                   m_stream,
-                                                                   m_engines,
-                                                                   d_engines);
-            });
+        status = load_generator_state<unsigned int, system_type>(state,
+                                                                 get_engines_words(),
+                                                                 m_engines,
+                                                                 m_stream);
         if(status != ROCRAND_STATUS_SUCCESS)
         {
-            system_type::free(d_engines);
             return status;
         }
-
-        system_type::free(d_engines);
-
         status = m_poisson.init();
         if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
         }
 
+        m_seed                = header.seed[0];
+        m_offset              = header.offset;
+        m_start_input         = header.position[0];
+        m_prev_input_width    = header.position[1];
         m_engines_initialized = true;
-        m_start_input         = 0;
-        m_prev_input_width    = 0;
-
         return ROCRAND_STATUS_SUCCESS;
     }
 
@@ -1086,6 +1121,40 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T* data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T* data, size_t data_size, T alpha, T beta)
+    {
+        beta_distribution<T> distribution(alpha, beta);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status
+        generate_binomial(unsigned int* data, size_t data_size, unsigned int n, double p)
+    {
+        binomial_distribution<> distribution(n, p);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_geometric(unsigned int* data, size_t data_size, double p)
+    {
+        geometric_distribution<> distribution(p);
+        return generate(data, data_size, distribution);
+    }
+
     rocrand_status generate_poisson(unsigned int* data, size_t data_size, double lambda)
     {
         auto result = m_poisson.get_distribution(lambda);
@@ -1101,6 +1170,143 @@ public:
     }
 
 private:
+    /// Returns the launch configuration of the ordering \p order in \p config and the number
+    /// of engines that it runs in \p generator_count.
+    rocrand_status get_generator_count(rocrand_ordering  order,
+                                       generator_config& config,
+                                       unsigned int&     generator_count) const
+    {
+        // TODO: make a version for generators that don't support per-type specialization of the configs and use that one
+        // For now: just use the void config, assuming that all configs are the same
+        hipError_t err = ConfigProvider::template host_config<void>(m_stream, order, config);
+        if(err != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        generator_count = config.threads * config.blocks / threads_per_generator;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Allocates the engines for the current ordering without initializing their states and
+    /// returns the launch configuration in \p config.
+    rocrand_status allocate_engines(generator_config& config)
+    {
+        const rocrand_status status = get_generator_count(m_order, config, m_generator_count);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        if(m_engines != nullptr)
+        {
+            system_type::free(m_engines);
+        }
+        // Allocate device random number engines
+        return system_type::alloc(&m_engines,
+                                  m_generator_count * mt19937_constants::n * sizeof(unsigned int));
+    }
+
+    /// Computes the engines of m_seed: every engine jumps ahead of the previous one, and the
+    /// engines are then rearranged for the launch configuration \p config.
+    rocrand_status init_engines(const generator_config& config)
+    {
+        unsigned int*  d_engines{};
+        rocrand_status status
+            = system_type::alloc(&d_engines,
+                                 m_generator_count * mt19937_constants::n * sizeof(unsigned int));
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        unsigned int* d_mt19937_jump{};
+        status = system_type::alloc(&d_mt19937_jump, sizeof(rocrand_h_mt19937_jump));
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            system_type::free(d_engines);
+            return status;
+        }
+
+        status = system_type::memcpy(d_mt19937_jump,
+                                     rocrand_h_mt19937_jump,
+                                     sizeof(rocrand_h_mt19937_jump),
+                                     hipMemcpyHostToDevice);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            system_type::free(d_engines);
+            system_type::free(d_mt19937_jump);
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        dynamic_dispatch(
+            m_order,
+            [&, this](auto is_dynamic)
+            {
+                status = system_type::template launch<
+
+                    jump_ahead_mt19937<jump_ahead_thread_count, ConfigProvider, is_dynamic>,
+                    static_block_size_config_provider<jump_ahead_thread_count>>(
+                    dim3(m_generator_count),
+                    dim3(jump_ahead_thread_count),
+                    0,
+                    m_stream,
+                    d_engines,
+                    m_seed,
+                    d_mt19937_jump);
+            });
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            system_type::free(d_engines);
+            system_type::free(d_mt19937_jump);
+            return status;
+        }
+
+        system_type::free(d_mt19937_jump);
+
+        // This kernel is not actually tuned for ordering, but config is needed for device-side compile time check of the generator count
+        dynamic_dispatch(
+            m_order,
+            [&, this](auto is_dynamic)
+            {
+                status
+                    = system_type::template launch<init_engines_mt19937<ConfigProvider, is_dynamic>,
+                                                   ConfigProvider>(dim3(config.blocks),
+                                                                   dim3(config.threads),
+                                                                   0,
+                                                                   m_stream,
+                                                                   m_engines,
+                                                                   d_engines);
+            });
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            system_type::free(d_engines);
+            return status;
+        }
+
+        system_type::free(d_engines);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    unsigned int get_engines_words() const
+    {
+        return m_generator_count * mt19937_constants::n;
+    }
+
+    generator_state_header get_state_header() const
+    {
+        // The states of all engines are stored as one array of words
+        generator_state_header header
+            = make_generator_state_header<unsigned int>(type(),
+                                                        m_order,
+                                                        get_engines_words(),
+                                                        m_offset);
+        header.seed[0]     = m_seed;
+        header.position[0] = m_start_input;
+        header.position[1] = m_prev_input_width;
+        return header;
+    }
+
     bool          m_engines_initialized = false;
     unsigned int* m_engines             = nullptr;
     // The index of the next unused input across all engines (where "input" is `input_width`
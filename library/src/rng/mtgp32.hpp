@@ -60,6 +60,8 @@
 #include "config/mtgp32_config.hpp"
 #include "config_types.hpp"
 #include "distributions.hpp"
+#include "engine_state_cache.hpp"
+#include "generator_state.hpp"
 #include "generator_type.hpp"
 #include "system.hpp"
 #include "utils/cpp_utils.hpp"
@@ -95,6 +97,30 @@ struct mtgp32_device_engine : ::rocrand_device::mtgp32_engine
     }
 };
 
+/// Initializes one engine per thread, the engines are expanded from \p seed like the ones of
+/// rocrand_make_state_mtgp32() but without building them on the host first.
+__host__ __device__ inline void init_mtgp32_engines(dim3 block_idx,
+                                                    dim3 thread_idx,
+                                                    dim3 /*grid_dim*/,
+                                                    dim3                      block_dim,
+                                                    mtgp32_device_engine*     engines,
+                                                    const mtgp32_fast_params* params,
+                                                    const unsigned int        engines_size,
+                                                    unsigned long long        seed)
+{
+    const unsigned int engine_id = block_idx.x * block_dim.x + thread_idx.x;
+    if(engine_id < engines_size)
+    {
+        seed = seed ^ (seed >> 32);
+        ::rocrand_device::rocrand_mtgp32_init_engine(engines[engine_id],
+                                                     params[engine_id],
+                                                     params[0].mask,
+                                                     static_cast<unsigned int>(seed) + engine_id
+                                                         + 1,
+                                                     engine_id);
+    }
+}
+
 template<class T, class Distribution, unsigned int BlockSize>
 __host__ void generate(unsigned int (&input)[BlockSize][Distribution::input_width],
                        T (&output)[BlockSize][Distribution::output_width],
@@ -331,11 +357,15 @@ public:
         , m_engines_initialized(other.m_engines_initialized)
         , m_engines(other.m_engines)
         , m_engines_size(other.m_engines_size)
+        , m_params(other.m_params)
+        , m_params_size(other.m_params_size)
         , m_seed(other.m_seed)
         , m_poisson(std::move(other.m_poisson))
     {
         other.m_engines_initialized = false;
         other.m_engines             = nullptr;
+        other.m_params              = nullptr;
+        other.m_params_size         = 0;
     }
 
     mtgp32_generator_template& operator=(const mtgp32_generator_template&) = delete;
@@ -346,11 +376,15 @@ public:
         m_engines_initialized          = other.m_engines_initialized;
         m_engines                      = other.m_engines;
         m_engines_size                 = other.m_engines_size;
+        m_params                       = other.m_params;
+        m_params_size                  = other.m_params_size;
         m_seed                         = other.m_seed;
         m_poisson                      = std::move(other.m_poisson);
 
         other.m_engines_initialized = false;
         other.m_engines             = nullptr;
+        other.m_params              = nullptr;
+        other.m_params_size         = 0;
 
         return *this;
     }
@@ -362,6 +396,11 @@ public:
             system_type::free(m_engines);
             m_engines = nullptr;
         }
+        if(m_params != nullptr)
+        {
+            system_type::free(m_params);
+            m_params = nullptr;
+        }
     }
 
     static constexpr rocrand_rng_type type()
@@ -434,43 +473,131 @@ public:
         }
 
         generator_config config;
-        // Assuming that the config is the same for every type.
-        hipError_t error
-            = ConfigProvider::template host_config<unsigned int>(m_stream, m_order, config);
-        if(error != hipSuccess)
+        rocrand_status   status = allocate_engines(config);
+        if(status != ROCRAND_STATUS_SUCCESS)
         {
-            return ROCRAND_STATUS_INTERNAL_ERROR;
+            return status;
         }
-        m_engines_size = config.blocks;
 
-        if (m_engines_size > mtgpdc_params_11213_num)
+        const size_t engines_bytes = m_engines_size * sizeof(engine_type);
+
+        // The engines of recurring seeds are copied from the process-wide cache if it is
+        // enabled, see engine_state_cache.
+        const engine_state_key cache_key{type(),
+                                         m_seed,
+                                         m_order,
+                                         config.threads,
+                                         config.blocks,
+                                         system_type::is_device()};
+        engine_state_cache&    cache = engine_state_cache::instance();
+
+        bool cached;
+        status = cache.load<system_type>(cache_key, m_engines, engines_bytes, cached);
+        if(status != ROCRAND_STATUS_SUCCESS)
         {
-            return ROCRAND_STATUS_ALLOCATION_FAILED;
+            return status;
+        }
+        if(!cached)
+        {
+            status = init_engines();
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+            status = cache.store(cache_key, m_engines, engines_bytes, m_stream);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
         }
 
-        rocrand_status status = system_type::alloc(&m_engines, m_engines_size);
+        status = m_poisson.init();
         if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
         }
 
-        status = rocrand_make_state_mtgp32(m_engines,
-                                           mtgp32dc_params_fast_11213,
-                                           m_engines_size,
-                                           m_seed);
+        m_engines_initialized = true;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status get_state_size(size_t& size)
+    {
+        const rocrand_status status = init();
         if(status != ROCRAND_STATUS_SUCCESS)
         {
-            return ROCRAND_STATUS_ALLOCATION_FAILED;
+            return status;
+        }
+        size = get_generator_state_size(get_state_header());
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status save_state(void* state)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
         }
+        return save_generator_state<system_type>(get_state_header(), m_engines, state, m_stream);
+    }
 
+    rocrand_status load_state(const void* state)
+    {
+        generator_state_header header;
+        rocrand_status         status
+            = read_generator_state_header(state, type(), m_stream, header);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        // The layout is checked before the ordering and the engines are changed
+        generator_config config;
+        status = get_engines_config(header.order, config);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = check_generator_state_layout<engine_type>(header, config.blocks);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if(header.order != m_order)
+        {
+            status = set_order(header.order);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+
+        // The engines are only allocated, their states are loaded below
+        m_engines_initialized = false;
+        status                = allocate_engines(config);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = load_generator_state<engine_type, system_type>(state,
+                                                                m_engines_size,
+                                                                m_engines,
+                                                                m_stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
         status = m_poisson.init();
         if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
         }
 
+        m_seed                = header.seed[0];
+        m_offset              = header.offset;
         m_engines_initialized = true;
-
         return ROCRAND_STATUS_SUCCESS;
     }
 
@@ -565,6 +692,40 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T* data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T* data, size_t data_size, T alpha, T beta)
+    {
+        beta_distribution<T> distribution(alpha, beta);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status
+        generate_binomial(unsigned int* data, size_t data_size, unsigned int n, double p)
+    {
+        binomial_distribution<> distribution(n, p);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_geometric(unsigned int* data, size_t data_size, double p)
+    {
+        geometric_distribution<> distribution(p);
+        return generate(data, data_size, distribution);
+    }
+
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
         // For an unknown reason, on CUDA, the initialization of the engines must precede
@@ -591,10 +752,101 @@ public:
     }
 
 private:
+    /// Returns the launch configuration of the ordering \p order in \p config. Every block
+    /// runs one engine.
+    rocrand_status get_engines_config(rocrand_ordering order, generator_config& config) const
+    {
+        // Assuming that the config is the same for every type.
+        hipError_t error
+            = ConfigProvider::template host_config<unsigned int>(m_stream, order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        if(config.blocks > mtgpdc_params_11213_num)
+        {
+            return ROCRAND_STATUS_ALLOCATION_FAILED;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Allocates the engines for the current ordering without initializing their states and
+    /// returns the launch configuration in \p config.
+    rocrand_status allocate_engines(generator_config& config)
+    {
+        const rocrand_status status = get_engines_config(m_order, config);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        m_engines_size = config.blocks;
+
+        if(m_engines != nullptr)
+        {
+            system_type::free(m_engines);
+        }
+        return system_type::alloc(&m_engines, m_engines_size);
+    }
+
+    /// Computes the engines of m_seed from their parameters.
+    rocrand_status init_engines()
+    {
+        // The parameters do not depend on the seed, so they are copied only once and the
+        // engines of later seeds are initialized without any transfer from the host.
+        if(m_params_size < m_engines_size)
+        {
+            if(m_params != nullptr)
+            {
+                system_type::free(m_params);
+                m_params_size = 0;
+            }
+            rocrand_status status = system_type::alloc(&m_params, m_engines_size);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+            status = system_type::memcpy(m_params,
+                                         mtgp32dc_params_fast_11213,
+                                         sizeof(mtgp32_fast_params) * m_engines_size,
+                                         hipMemcpyHostToDevice);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+            m_params_size = m_engines_size;
+        }
+
+        constexpr unsigned int init_threads = ROCRAND_DEFAULT_MAX_BLOCK_SIZE;
+        const unsigned int     init_blocks  = (m_engines_size + init_threads - 1) / init_threads;
+
+        return system_type::template launch<init_mtgp32_engines,
+                                            static_block_size_config_provider<init_threads>>(
+            dim3(init_blocks),
+            dim3(init_threads),
+            0,
+            m_stream,
+            m_engines,
+            m_params,
+            m_engines_size,
+            m_seed);
+    }
+
+    generator_state_header get_state_header() const
+    {
+        generator_state_header header
+            = make_generator_state_header<engine_type>(type(), m_order, m_engines_size, m_offset);
+        header.seed[0] = m_seed;
+        return header;
+    }
+
     bool         m_engines_initialized = false;
     engine_type* m_engines             = nullptr;
     unsigned int m_engines_size        = false;
 
+    // Parameters of the engines, copied from the host once
+    mtgp32_fast_params* m_params      = nullptr;
+    unsigned int        m_params_size = 0;
+
     unsigned long long m_seed;
 
     // For caching of Poisson for consecutive generations with the same lambda
@@ -103,16 +103,18 @@ struct philox4x32_10_device_engine : public ::rocrand_device::philox4x32_10_engi
     // m_state from base class
 };
 
-template<typename T, typename Distribution>
+template<typename Output, typename Distribution>
 __host__ __device__ __forceinline__ void generate_philox(dim3                        block_idx,
                                                          dim3                        thread_idx,
                                                          dim3                        grid_dim,
                                                          dim3                        block_dim,
                                                          philox4x32_10_device_engine engine,
-                                                         T*                          data,
+                                                         Output                      data,
                                                          const size_t                n,
                                                          Distribution                distribution)
 {
+    using T = typename Output::value_type;
+
     constexpr unsigned int input_width  = Distribution::input_width;
     constexpr unsigned int output_width = Distribution::output_width;
 
@@ -120,20 +122,16 @@ __host__ __device__ __forceinline__ void generate_philox(dim3
     constexpr unsigned int output_per_thread = 4 / input_width;
     constexpr unsigned int full_output_width = output_per_thread * output_width;
 
-    using vec_type = aligned_vec_type<T, output_per_thread * output_width>;
-
     const unsigned int thread_id = block_idx.x * block_dim.x + thread_idx.x;
     const unsigned int stride    = grid_dim.x * block_dim.x;
 
     unsigned int input[input_width];
     T            output[output_per_thread][output_width];
 
-    const uintptr_t uintptr = reinterpret_cast<uintptr_t>(data);
-    const size_t    misalignment
-        = (full_output_width - uintptr / sizeof(T) % full_output_width) % full_output_width;
-    const unsigned int head_size = cpp_utils::min(n, misalignment);
-    const unsigned int tail_size = (n - head_size) % full_output_width;
-    const size_t       vec_n     = (n - head_size) / full_output_width;
+    const size_t       misalignment = data.template misalignment<full_output_width>();
+    const unsigned int head_size    = cpp_utils::min(n, misalignment);
+    const unsigned int tail_size    = (n - head_size) % full_output_width;
+    const size_t       vec_n        = (n - head_size) / full_output_width;
 
     const unsigned int engine_offset = 4 * thread_id + (thread_id == 0 ? 0 : head_size);
     engine.discard(engine_offset);
@@ -164,9 +162,8 @@ __host__ __device__ __forceinline__ void generate_philox(dim3
         }
     }
 
-    // Save multiple values as one vec_type
-    vec_type* vec_data = reinterpret_cast<vec_type*>(data + misalignment);
-    size_t    index    = thread_id;
+    // Save multiple values as one vector
+    size_t index = thread_id;
     while(index < vec_n)
     {
         const uint4        v     = engine.next4_leap(stride);
@@ -179,7 +176,8 @@ __host__ __device__ __forceinline__ void generate_philox(dim3
             }
             distribution(input, output[s]);
         }
-        vec_data[index] = *reinterpret_cast<vec_type*>(output);
+        data.template store<full_output_width>(misalignment + index * full_output_width,
+                                               &output[0][0]);
         // Next position
         index += stride;
     }
@@ -213,6 +211,34 @@ __host__ __device__ __forceinline__ void generate_philox(dim3
     }
 }
 
+template<typename T, typename Distribution>
+__host__ __device__ __forceinline__ void
+    generate_philox_batched(dim3                      block_idx,
+                            dim3                      thread_idx,
+                            dim3                      grid_dim,
+                            dim3                      block_dim,
+                            const unsigned long long* seeds,
+                            const unsigned long long* offsets,
+                            T*                        data,
+                            const size_t              n,
+                            const size_t              pitch,
+                            Distribution              distribution)
+{
+    // Every row of the grid generates the values of one seed
+    const size_t                      batch_index = block_idx.y;
+    const philox4x32_10_device_engine engine(seeds[batch_index],
+                                             0,
+                                             offsets == nullptr ? 0 : offsets[batch_index]);
+    generate_philox(block_idx,
+                    thread_idx,
+                    grid_dim,
+                    block_dim,
+                    engine,
+                    dense_output<T>{data + batch_index * pitch},
+                    n,
+                    distribution);
+}
+
 template<typename System, typename ConfigProvider>
 class philox4x32_10_generator_template : public generator_impl_base
 {
@@ -288,74 +314,62 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    rocrand_status init()
+    /// Divides the subsequences of this generator into the ranges \p parts of itself and
+    /// \p count children without changing it, see subsequence_range. All values of a generator come from its first subsequence.
+    rocrand_status split(unsigned int count, subsequence_range* parts) const
     {
-        if(m_engines_initialized)
-            return ROCRAND_STATUS_SUCCESS;
-
-        m_engine = engine_type{m_seed, 0, m_offset};
-
-        rocrand_status status = m_poisson.init();
-        if(status != ROCRAND_STATUS_SUCCESS)
-        {
-            return status;
-        }
+        return m_subsequences.split(1, count, parts);
+    }
 
-        m_engines_initialized = true;
-        return ROCRAND_STATUS_SUCCESS;
+    /// Keeps only \p subsequences, the first part of a split() whose children were created.
+    void keep_subsequences(const subsequence_range& subsequences)
+    {
+        m_subsequences = subsequences;
     }
 
-    template<typename T, typename Distribution = uniform_distribution<T>>
-    rocrand_status generate(T* data, size_t data_size, Distribution distribution = Distribution())
+    /// Makes this generator a child of \p parent that uses \p subsequences.
+    rocrand_status fork_from(const philox4x32_10_generator_template& parent,
+                             const subsequence_range&                subsequences)
     {
-        rocrand_status status = init();
+        rocrand_status status = set_stream(parent.m_stream);
         if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
         }
-        generator_config config;
-        const hipError_t error = ConfigProvider::template host_config<T>(m_stream, m_order, config);
-        if(error != hipSuccess)
+        status = set_order(parent.m_order);
+        if(status != ROCRAND_STATUS_SUCCESS)
         {
-            return ROCRAND_STATUS_INTERNAL_ERROR;
+            return status;
         }
+        m_seed         = parent.m_seed;
+        m_subsequences = subsequences;
+        reset();
+        return ROCRAND_STATUS_SUCCESS;
+    }
 
-        if(data == nullptr)
-        {
+    rocrand_status init()
+    {
+        if(m_engines_initialized)
             return ROCRAND_STATUS_SUCCESS;
-        }
 
-        status = dynamic_dispatch(
-            m_order,
-            [&, this](auto is_dynamic)
-            {
-                return system_type::template launch<generate_philox<T, Distribution>,
-                                                    ConfigProvider,
-                                                    T,
-                                                    is_dynamic>(dim3(config.blocks),
-                                                                dim3(config.threads),
-                                                                0,
-                                                                m_stream,
-                                                                m_engine,
-                                                                data,
-                                                                data_size,
-                                                                distribution);
-            });
+        m_engine = engine_type{m_seed, m_subsequences.first, m_offset};
+
+        rocrand_status status = m_poisson.init();
         if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
         }
 
-        // Generating data_size values will use this many distributions
-        const auto num_applied_generators = (data_size + Distribution::output_width - 1)
-                                            / Distribution::output_width
-                                            * Distribution::input_width;
-
-        m_engine.discard(num_applied_generators);
-
+        m_engines_initialized = true;
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    template<typename T, typename Distribution = uniform_distribution<T>>
+    rocrand_status generate(T* data, size_t data_size, Distribution distribution = Distribution())
+    {
+        return generate_output(dense_output<T>{data}, data_size, distribution);
+    }
+
     rocrand_status generate(unsigned long long* data, size_t data_size)
     {
         // Cannot generate 64-bit values with this generator.
@@ -374,6 +388,89 @@ public:
         return ROCRAND_STATUS_TYPE_ERROR;
     }
 
+    /// Generates \p data_size values starting at \p first_index of the stream of the seed.
+    /// The offset and the state of the generator are neither used nor changed.
+    rocrand_status
+        generate_range(unsigned int* data, unsigned long long first_index, size_t data_size) const
+    {
+        return launch_generate(engine_type{m_seed, m_subsequences.first, first_index},
+                               dense_output<unsigned int>{data},
+                               data_size,
+                               uniform_distribution<unsigned int>());
+    }
+
+    /// Generates \p data_size values for each of the \p batch_size seeds in \p seeds. The
+    /// values of seed i are stored at <tt>data + i * pitch</tt> and are the same as the ones
+    /// generated after setting the seed to <tt>seeds[i]</tt> and the offset to
+    /// <tt>offsets[i]</tt> (or 0 if \p offsets is nullptr). \p seeds and \p offsets must be
+    /// accessible by the kernels like \p data. The state of the generator is not used.
+    template<class T, class Distribution = uniform_distribution<T>>
+    rocrand_status generate_batched(T*                        data,
+                                    size_t                    data_size,
+                                    size_t                    pitch,
+                                    const unsigned long long* seeds,
+                                    const unsigned long long* offsets,
+                                    size_t                    batch_size,
+                                    Distribution              distribution = Distribution()) const
+    {
+        generator_config config;
+        const hipError_t error = ConfigProvider::template host_config<T>(m_stream, m_order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        if(data == nullptr)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        for(size_t first = 0; first < batch_size; first += max_batch_grid_rows)
+        {
+            const unsigned int rows
+                = static_cast<unsigned int>(std::min(batch_size - first, max_batch_grid_rows));
+
+            const rocrand_status status = dynamic_dispatch(
+                m_order,
+                [&, this](auto is_dynamic)
+                {
+                    return system_type::template launch<generate_philox_batched<T, Distribution>,
+                                                        ConfigProvider,
+                                                        T,
+                                                        is_dynamic>(
+                        dim3(config.blocks, rows),
+                        dim3(config.threads),
+                        0,
+                        m_stream,
+                        seeds + first,
+                        offsets == nullptr ? nullptr : offsets + first,
+                        data + first * pitch,
+                        data_size,
+                        pitch,
+                        distribution);
+                });
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_normal_batched(T*                        data,
+                                           size_t                    data_size,
+                                           size_t                    pitch,
+                                           const unsigned long long* seeds,
+                                           const unsigned long long* offsets,
+                                           size_t                    batch_size,
+                                           T                         mean,
+                                           T                         stddev) const
+    {
+        normal_distribution<T> distribution(mean, stddev);
+        return generate_batched(data, data_size, pitch, seeds, offsets, batch_size, distribution);
+    }
+
     template<class T>
     rocrand_status generate_uniform(T* data, size_t data_size)
     {
@@ -388,6 +485,33 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    /// Generates \p width * \p height values like generate() and stores them in the rows of
+    /// a 2-D array with \p pitch elements per row.
+    template<class T, class Distribution = uniform_distribution<T>>
+    rocrand_status generate_2d(T*           data,
+                               size_t       width,
+                               size_t       height,
+                               size_t       pitch,
+                               Distribution distribution = Distribution())
+    {
+        return generate_output(pitched_output<T>{data, width, pitch}, width * height, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_2d(T* data, size_t width, size_t height, size_t pitch)
+    {
+        uniform_distribution<T> distribution;
+        return generate_2d(data, width, height, pitch, distribution);
+    }
+
+    template<class T>
+    rocrand_status
+        generate_normal_2d(T* data, size_t width, size_t height, size_t pitch, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev);
+        return generate_2d(data, width, height, pitch, distribution);
+    }
+
     template<class T>
     rocrand_status generate_log_normal(T* data, size_t data_size, T mean, T stddev)
     {
@@ -395,6 +519,40 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T* data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T* data, size_t data_size, T alpha, T beta)
+    {
+        beta_distribution<T> distribution(alpha, beta);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status
+        generate_binomial(unsigned int* data, size_t data_size, unsigned int n, double p)
+    {
+        binomial_distribution<> distribution(n, p);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_geometric(unsigned int* data, size_t data_size, double p)
+    {
+        geometric_distribution<> distribution(p);
+        return generate(data, data_size, distribution);
+    }
+
     rocrand_status generate_poisson(unsigned int* data, size_t data_size, double lambda)
     {
         auto result = m_poisson.get_distribution(lambda);
@@ -410,10 +568,73 @@ public:
     }
 
 private:
+    template<class Output, class Distribution>
+    rocrand_status generate_output(Output data, size_t data_size, Distribution distribution)
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = launch_generate(m_engine, data, data_size, distribution);
+        if(status != ROCRAND_STATUS_SUCCESS || data.data == nullptr)
+        {
+            return status;
+        }
+
+        // Generating data_size values will use this many distributions
+        const auto num_applied_generators = (data_size + Distribution::output_width - 1)
+                                            / Distribution::output_width
+                                            * Distribution::input_width;
+
+        m_engine.discard(num_applied_generators);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<typename Output, typename Distribution>
+    rocrand_status launch_generate(const engine_type& engine,
+                                   Output             data,
+                                   size_t             data_size,
+                                   Distribution       distribution) const
+    {
+        using T = typename Output::value_type;
+
+        generator_config config;
+        const hipError_t error = ConfigProvider::template host_config<T>(m_stream, m_order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        if(data.data == nullptr)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        return dynamic_dispatch(
+            m_order,
+            [&, this](auto is_dynamic)
+            {
+                return system_type::template launch<generate_philox<Output, Distribution>,
+                                                    ConfigProvider,
+                                                    T,
+                                                    is_dynamic>(dim3(config.blocks),
+                                                                dim3(config.threads),
+                                                                0,
+                                                                m_stream,
+                                                                engine,
+                                                                data,
+                                                                data_size,
+                                                                distribution);
+            });
+    }
+
     bool        m_engines_initialized = false;
     engine_type m_engine;
 
     unsigned long long m_seed;
+    subsequence_range  m_subsequences;
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager_t m_poisson;
@@ -0,0 +1,676 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+/*
+Copyright 2010-2011, D. E. Shaw Research.
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are
+met:
+
+* Redistributions of source code must retain the above copyright
+  notice, this list of conditions, and the following disclaimer.
+
+* Redistributions in binary form must reproduce the above copyright
+  notice, this list of conditions, and the following disclaimer in the
+  documentation and/or other materials provided with the distribution.
+
+* Neither the name of D. E. Shaw Research nor the names of its
+  contributors may be used to endorse or promote products derived from
+  this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#ifndef ROCRAND_RNG_PHILOX4X64_10_H_
+#define ROCRAND_RNG_PHILOX4X64_10_H_
+
+#include "config/philox4_64_10_config.hpp"
+
+#include "common.hpp"
+#include "config_types.hpp"
+#include "distributions.hpp"
+#include "generator_type.hpp"
+#include "system.hpp"
+#include "utils/cpp_utils.hpp"
+
+#include <rocrand/rocrand.h>
+#include <rocrand/rocrand_philox4x64_10.h>
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace rocrand_impl::host
+{
+struct philox4x64_10_device_engine : public ::rocrand_device::philox4x64_10_engine
+{
+    typedef ::rocrand_device::philox4x64_10_engine base_type;
+    typedef base_type::philox4x64_10_state         state_type;
+
+    __forceinline__ philox4x64_10_device_engine() = default;
+
+    __forceinline__ __device__ __host__
+        philox4x64_10_device_engine(const unsigned long long seed,
+                                    const unsigned long long subsequence,
+                                    const unsigned long long offset)
+        : base_type(seed, subsequence, offset)
+    {}
+
+    __forceinline__ __device__ __host__ ulonglong4 next4_leap(unsigned int leap)
+    {
+        ulonglong4 ret = m_state.result;
+        if(m_state.substate > 0)
+        {
+            const ulonglong4 next_counter = this->bump_counter(m_state.counter);
+            const ulonglong4 next         = this->ten_rounds(next_counter, m_state.key);
+            ret                      = this->interleave(ret, next);
+        }
+
+        this->discard_state(leap);
+        m_state.result = this->ten_rounds(m_state.counter, m_state.key);
+        return ret;
+    }
+
+    // m_state from base class
+};
+
+template<typename T, typename Distribution>
+__host__ __device__ __forceinline__ void
+    generate_philox4x64(dim3                        block_idx,
+                        dim3                        thread_idx,
+                        dim3                        grid_dim,
+                        dim3                        block_dim,
+                        philox4x64_10_device_engine engine,
+                        T*                          data,
+                        const size_t                n,
+                        Distribution                distribution)
+{
+    constexpr unsigned int input_width  = Distribution::input_width;
+    constexpr unsigned int output_width = Distribution::output_width;
+
+    static_assert(4 % input_width == 0 && input_width <= 4, "Incorrect input_width");
+    constexpr unsigned int output_per_thread = 4 / input_width;
+    constexpr unsigned int full_output_width = output_per_thread * output_width;
+
+    using vec_type = aligned_vec_type<T, output_per_thread * output_width>;
+
+    const unsigned int thread_id = block_idx.x * block_dim.x + thread_idx.x;
+    const unsigned int stride    = grid_dim.x * block_dim.x;
+
+    unsigned long long input[input_width];
+    T                  output[output_per_thread][output_width];
+
+    const uintptr_t uintptr = reinterpret_cast<uintptr_t>(data);
+    const size_t    misalignment
+        = (full_output_width - uintptr / sizeof(T) % full_output_width) % full_output_width;
+    const unsigned int head_size = cpp_utils::min(n, misalignment);
+    const unsigned int tail_size = (n - head_size) % full_output_width;
+    const size_t       vec_n     = (n - head_size) / full_output_width;
+
+    const unsigned int engine_offset
+        = 4 * thread_id + (thread_id == 0 ? 0 : head_size / output_width * input_width);
+    engine.discard(engine_offset);
+
+    // If data is not aligned by sizeof(vec_type)
+    if(thread_id == 0 && head_size > 0)
+    {
+        for(unsigned int s = 0; s < output_per_thread; ++s)
+        {
+            if(s * output_width >= head_size)
+            {
+                break;
+            }
+
+            for(unsigned int i = 0; i < input_width; ++i)
+            {
+                input[i] = engine();
+            }
+            distribution(input, output[s]);
+
+            for(unsigned int o = 0; o < output_width; ++o)
+            {
+                if(s * output_width + o < head_size)
+                {
+                    data[s * output_width + o] = output[s][o];
+                }
+            }
+        }
+    }
+
+    // Save multiple values as one vec_type
+    vec_type* vec_data = reinterpret_cast<vec_type*>(data + misalignment);
+    size_t    index    = thread_id;
+    while(index < vec_n)
+    {
+        const ulonglong4         v     = engine.next4_leap(stride);
+        const unsigned long long vs[4] = {v.x, v.y, v.z, v.w};
+        for(unsigned int s = 0; s < output_per_thread; s++)
+        {
+            for(unsigned int i = 0; i < input_width; i++)
+            {
+                input[i] = vs[s * input_width + i];
+            }
+            distribution(input, output[s]);
+        }
+        vec_data[index] = *reinterpret_cast<vec_type*>(output);
+        // Next position
+        index += stride;
+    }
+
+    // Check if we need to save tail.
+    // Those numbers should be generated by the thread that would
+    // save next vec_type.
+    if(index == vec_n && tail_size > 0)
+    {
+        for(unsigned int s = 0; s < output_per_thread; ++s)
+        {
+            if(s * output_width >= tail_size)
+            {
+                break;
+            }
+
+            for(unsigned int i = 0; i < input_width; ++i)
+            {
+                input[i] = engine();
+            }
+            distribution(input, output[s]);
+
+            for(unsigned int o = 0; o < output_width; ++o)
+            {
+                if(s * output_width + o < tail_size)
+                {
+                    data[n - tail_size + s * output_width + o] = output[s][o];
+                }
+            }
+        }
+    }
+}
+
+template<typename T, typename Distribution>
+__host__ __device__ __forceinline__ void
+    generate_philox4x64_batched(dim3                      block_idx,
+                                dim3                      thread_idx,
+                                dim3                      grid_dim,
+                                dim3                      block_dim,
+                                const unsigned long long* seeds,
+                                const unsigned long long* offsets,
+                                T*                        data,
+                                const size_t              n,
+                                const size_t              pitch,
+                                Distribution              distribution)
+{
+    // Every row of the grid generates the values of one seed
+    const size_t                      batch_index = block_idx.y;
+    const philox4x64_10_device_engine engine(seeds[batch_index],
+                                             0,
+                                             offsets == nullptr ? 0 : offsets[batch_index]);
+    generate_philox4x64(block_idx,
+                        thread_idx,
+                        grid_dim,
+                        block_dim,
+                        engine,
+                        data + batch_index * pitch,
+                        n,
+                        distribution);
+}
+
+template<typename System, typename ConfigProvider>
+class philox4x64_10_generator_template : public generator_impl_base
+{
+public:
+    using base_type   = generator_impl_base;
+    using engine_type = philox4x64_10_device_engine;
+    using system_type = System;
+    using poisson_distribution_manager_t
+        = poisson_distribution_manager<DISCRETE_METHOD_ALIAS, system_type>;
+    using poisson_distribution_t = typename poisson_distribution_manager_t::distribution_t;
+    using poisson_approx_distribution_t =
+        typename poisson_distribution_manager_t::approx_distribution_t;
+
+    philox4x64_10_generator_template(unsigned long long seed   = 0,
+                                     unsigned long long offset = 0,
+                                     rocrand_ordering   order  = ROCRAND_ORDERING_PSEUDO_DEFAULT,
+                                     hipStream_t        stream = 0)
+        : base_type(order, offset, stream), m_seed(seed)
+    {}
+
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_PHILOX4_64_10;
+    }
+
+    void reset() override final
+    {
+        m_engines_initialized = false;
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    void set_seed(unsigned long long seed)
+    {
+        m_seed = seed;
+        reset();
+    }
+
+    unsigned long long get_seed() const
+    {
+        return m_seed;
+    }
+
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        if(!system_type::is_device() && order == ROCRAND_ORDERING_PSEUDO_DYNAMIC)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        static constexpr std::array supported_orderings{
+            ROCRAND_ORDERING_PSEUDO_DEFAULT,
+            ROCRAND_ORDERING_PSEUDO_DYNAMIC,
+            ROCRAND_ORDERING_PSEUDO_BEST,
+            ROCRAND_ORDERING_PSEUDO_LEGACY,
+        };
+        if(std::find(supported_orderings.begin(), supported_orderings.end(), order)
+           == supported_orderings.end())
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_order = order;
+        reset();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status set_stream(hipStream_t stream)
+    {
+        const rocrand_status status = m_poisson.set_stream(stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        base_type::set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Divides the subsequences of this generator into the ranges \p parts of itself and
+    /// \p count children without changing it, see subsequence_range. All values of a generator come from its first subsequence.
+    rocrand_status split(unsigned int count, subsequence_range* parts) const
+    {
+        return m_subsequences.split(1, count, parts);
+    }
+
+    /// Keeps only \p subsequences, the first part of a split() whose children were created.
+    void keep_subsequences(const subsequence_range& subsequences)
+    {
+        m_subsequences = subsequences;
+    }
+
+    /// Makes this generator a child of \p parent that uses \p subsequences.
+    rocrand_status fork_from(const philox4x64_10_generator_template& parent,
+                             const subsequence_range&                subsequences)
+    {
+        rocrand_status status = set_stream(parent.m_stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = set_order(parent.m_order);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        m_seed         = parent.m_seed;
+        m_subsequences = subsequences;
+        reset();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        if(m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        m_engine = engine_type{m_seed, m_subsequences.first, m_offset};
+
+        rocrand_status status = m_poisson.init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<typename T, typename Distribution = uniform_distribution<T, unsigned long long>>
+    rocrand_status generate(T* data, size_t data_size, Distribution distribution = Distribution())
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = launch_generate(m_engine, data, data_size, distribution);
+        if(status != ROCRAND_STATUS_SUCCESS || data == nullptr)
+        {
+            return status;
+        }
+
+        // Generating data_size values will use this many distributions
+        const auto num_applied_generators = (data_size + Distribution::output_width - 1)
+                                            / Distribution::output_width
+                                            * Distribution::input_width;
+
+        m_engine.discard(num_applied_generators);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate(unsigned long long* data, size_t data_size)
+    {
+        uniform_distribution<unsigned long long, unsigned long long> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    /// Generates \p data_size 32-bit values starting at \p first_index of the stream of
+    /// the seed. The offset and the state of the generator are neither used nor changed.
+    rocrand_status
+        generate_range(unsigned int* data, unsigned long long first_index, size_t data_size) const
+    {
+        // Every 64-bit value gives two 32-bit values, the lower half first. The generate
+        // kernel stores the halves of a value at 8-byte aligned addresses, so it is only used
+        // if that agrees with first_index, the other halves are computed by generate_halves.
+        const bool aligned
+            = reinterpret_cast<std::uintptr_t>(data) % sizeof(unsigned long long) == 0;
+        if(aligned != (first_index % 2 == 0))
+        {
+            return launch_generate_halves(
+                engine_type{m_seed, m_subsequences.first, first_index / 2},
+                data,
+                data_size,
+                first_index % 2);
+        }
+        if(first_index % 2 == 1 && data_size > 0)
+        {
+            const rocrand_status status = launch_generate_halves(
+                engine_type{m_seed, m_subsequences.first, first_index / 2}, data, 1, 1);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+            data++;
+            data_size--;
+            first_index++;
+        }
+        return launch_generate(engine_type{m_seed, m_subsequences.first, first_index / 2},
+                               data,
+                               data_size,
+                               uniform_distribution<unsigned int, unsigned long long>());
+    }
+
+    /// Generates \p data_size values for each of the \p batch_size seeds in \p seeds. The
+    /// values of seed i are stored at <tt>data + i * pitch</tt> and are the same as the ones
+    /// generated after setting the seed to <tt>seeds[i]</tt> and the offset to
+    /// <tt>offsets[i]</tt> (or 0 if \p offsets is nullptr). \p seeds and \p offsets must be
+    /// accessible by the kernels like \p data. The state of the generator is not used.
+    template<class T, class Distribution = uniform_distribution<T, unsigned long long>>
+    rocrand_status generate_batched(T*                        data,
+                                    size_t                    data_size,
+                                    size_t                    pitch,
+                                    const unsigned long long* seeds,
+                                    const unsigned long long* offsets,
+                                    size_t                    batch_size,
+                                    Distribution              distribution = Distribution()) const
+    {
+        generator_config config;
+        const hipError_t error = ConfigProvider::template host_config<T>(m_stream, m_order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        if(data == nullptr)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        for(size_t first = 0; first < batch_size; first += max_batch_grid_rows)
+        {
+            const unsigned int rows
+                = static_cast<unsigned int>(std::min(batch_size - first, max_batch_grid_rows));
+
+            const rocrand_status status = dynamic_dispatch(
+                m_order,
+                [&, this](auto is_dynamic)
+                {
+                    return system_type::template launch<
+                        generate_philox4x64_batched<T, Distribution>,
+                        ConfigProvider,
+                        T,
+                        is_dynamic>(
+                        dim3(config.blocks, rows),
+                        dim3(config.threads),
+                        0,
+                        m_stream,
+                        seeds + first,
+                        offsets == nullptr ? nullptr : offsets + first,
+                        data + first * pitch,
+                        data_size,
+                        pitch,
+                        distribution);
+                });
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_normal_batched(T*                        data,
+                                           size_t                    data_size,
+                                           size_t                    pitch,
+                                           const unsigned long long* seeds,
+                                           const unsigned long long* offsets,
+                                           size_t                    batch_size,
+                                           T                         mean,
+                                           T                         stddev) const
+    {
+        normal_distribution<T, unsigned long long> distribution(mean, stddev);
+        return generate_batched(data, data_size, pitch, seeds, offsets, batch_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T* data, size_t data_size)
+    {
+        uniform_distribution<T, unsigned long long> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T* data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T, unsigned long long> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T* data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T, unsigned long long> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T, unsigned long long> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T* data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T, unsigned long long> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T* data, size_t data_size, T alpha, T beta)
+    {
+        beta_distribution<T, unsigned long long> distribution(alpha, beta);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status
+        generate_binomial(unsigned int* data, size_t data_size, unsigned int n, double p)
+    {
+        binomial_distribution<unsigned long long> distribution(n, p);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_geometric(unsigned int* data, size_t data_size, double p)
+    {
+        geometric_distribution<unsigned long long> distribution(p);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_poisson(unsigned int* data, size_t data_size, double lambda)
+    {
+        auto result = m_poisson.get_distribution(lambda);
+        if(auto* dis = std::get_if<poisson_distribution_t>(&result))
+        {
+            return generate(data, data_size, *dis);
+        }
+        if(auto* dis = std::get_if<poisson_approx_distribution_t>(&result))
+        {
+            return generate(data, data_size, *dis);
+        }
+        return std::get<rocrand_status>(result);
+    }
+
+private:
+    template<typename T, typename Distribution>
+    rocrand_status launch_generate(const engine_type& engine,
+                                   T*                 data,
+                                   size_t             data_size,
+                                   Distribution       distribution) const
+    {
+        generator_config config;
+        const hipError_t error = ConfigProvider::template host_config<T>(m_stream, m_order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        if(data == nullptr)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        return dynamic_dispatch(
+            m_order,
+            [&, this](auto is_dynamic)
+            {
+                return system_type::template launch<generate_philox4x64<T, Distribution>,
+                                                    ConfigProvider,
+                                                    T,
+                                                    is_dynamic>(dim3(config.blocks),
+                                                                dim3(config.threads),
+                                                                0,
+                                                                m_stream,
+                                                                engine,
+                                                                data,
+                                                                data_size,
+                                                                distribution);
+            });
+    }
+
+    rocrand_status launch_generate_halves(const engine_type& engine,
+                                          unsigned int*      data,
+                                          size_t             data_size,
+                                          unsigned int       first_half) const
+    {
+        generator_config config;
+        const hipError_t error
+            = ConfigProvider::template host_config<unsigned int>(m_stream, m_order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        if(data == nullptr)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        return dynamic_dispatch(
+            m_order,
+            [&, this](auto is_dynamic)
+            {
+                return system_type::template launch<generate_halves<engine_type>,
+                                                    ConfigProvider,
+                                                    unsigned int,
+                                                    is_dynamic>(dim3(config.blocks),
+                                                                dim3(config.threads),
+                                                                0,
+                                                                m_stream,
+                                                                engine,
+                                                                data,
+                                                                data_size,
+                                                                first_half);
+            });
+    }
+
+    bool        m_engines_initialized = false;
+    engine_type m_engine;
+
+    unsigned long long m_seed;
+    subsequence_range  m_subsequences;
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager_t m_poisson;
+
+    // m_seed from base_type
+    // m_offset from base_type
+};
+
+using philox4x64_10_generator
+    = philox4x64_10_generator_template<system::device_system,
+                                       default_config_provider<ROCRAND_RNG_PSEUDO_PHILOX4_64_10>>;
+
+template<bool UseHostFunc>
+using philox4x64_10_generator_host
+    = philox4x64_10_generator_template<system::host_system<UseHostFunc>,
+                                       default_config_provider<ROCRAND_RNG_PSEUDO_PHILOX4_64_10>>;
+
+} // namespace rocrand_impl::host
+
+#endif // ROCRAND_RNG_PHILOX4X64_10_H_
@@ -45,9 +45,11 @@
 #include <hip/hip_runtime.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace rocrand_impl::host
 {
@@ -68,27 +70,28 @@ Engine create_engine(const Constant*           vectors,
     }
 };
 
-// Use compiler-defined macro to only define the kernel once, for host and device compilation.
-#ifdef __HIP_DEVICE_COMPILE__
-template<unsigned int OutputPerThread,
-         bool         Scrambled,
-         class Engine,
-         class Constant,
-         class T,
-         class Distribution>
-void generate_sobol_host(dim3,
-                         dim3,
-                         dim3,
-                         dim3,
-                         T*,
-                         const size_t,
-                         const Constant*,
-                         const Constant*,
-                         const unsigned int,
-                         Distribution)
-{}
+/// \brief Returns the index of value \p i in the shared tiles of generate_sobol_kernel and
+/// generate_sobol_point_major_kernel. One padding element every 32 values keeps the runs of
+/// adjacent threads in different banks.
+__forceinline__ __host__ __device__ constexpr unsigned int sobol_padded_tile_index(unsigned int i)
+{
+    return i + i / 32;
+}
 
-template<unsigned int OutputPerThread,
+// Use compiler-defined macro to only define the kernel body for device compilation. Host
+// generators use generate_sobol_host, which walks the sequence in a different order.
+#ifdef __HIP_DEVICE_COMPILE__
+/// \brief Generates Sobol points in the default dimension-major layout.
+///
+/// Every block handles tiles of <tt>block_size * PointsPerThread</tt> consecutive points of
+/// dimension \p blockIdx.y, and every thread computes a run of \p PointsPerThread consecutive
+/// points of the tile with one direction-vector read per point. Only the first point of the
+/// thread is skipped ahead to with its Gray code, later tiles are reached with the strided
+/// discard (leap frog), which requires the number of tiles of the grid to be a power of 2.
+/// The runs are staged through shared memory, so the block stores the tile with contiguous
+/// vectors of \p OutputWidth values.
+template<unsigned int PointsPerThread,
+         unsigned int OutputWidth,
          bool         Scrambled,
          class Engine,
          class Constant,
@@ -102,8 +105,93 @@ __global__
                                                              const Constant*    scramble_constants,
                                                              const unsigned int offset,
                                                              Distribution       distribution)
+{
+    constexpr unsigned int vector_size = sizeof(Constant) == 4 ? 32 : 64;
+    constexpr unsigned int tile_size   = block_size * PointsPerThread;
+    using vec_type                     = aligned_vec_type<T, OutputWidth>;
+
+    __shared__ Constant shared_vectors[vector_size];
+    __shared__ T        tile[sobol_padded_tile_index(tile_size)];
+
+    const unsigned int dimension = blockIdx.y;
+    if(threadIdx.x < vector_size)
+    {
+        shared_vectors[threadIdx.x] = direction_vectors[dimension * vector_size + threadIdx.x];
+    }
+    __syncthreads();
+
+    const Constant scramble_constant = Scrambled ? scramble_constants[dimension] : 0;
+
+    data += dimension * n;
+
+    const uintptr_t    uintptr = reinterpret_cast<uintptr_t>(data);
+    const unsigned int misalignment
+        = (OutputWidth - uintptr / sizeof(T) % OutputWidth) % OutputWidth;
+
+    const size_t tiles         = (n + tile_size - 1) / tile_size;
+    const size_t tile_stride   = gridDim.x;
+    const size_t thread_offset = threadIdx.x * PointsPerThread;
+
+    Engine engine = create_engine<Scrambled, Engine>(shared_vectors,
+                                                     scramble_constant,
+                                                     offset + blockIdx.x * tile_size
+                                                         + thread_offset);
+
+    // All distributions generate one output from one input
+    // Generation of, for example, 2 shorts from 1 uint or
+    // 2 floats from 2 uints using Box-Muller transformation
+    // is impossible because the resulting sequence is not
+    // quasi-random anymore.
+
+    for(size_t t = blockIdx.x; t < tiles; t += tile_stride)
+    {
+        const size_t       tile_first = t * tile_size;
+        const unsigned int tile_n
+            = static_cast<unsigned int>(cpp_utils::min(n - tile_first, size_t{tile_size}));
+
+        const Engine engine_copy = engine;
+        for(unsigned int i = 0; i < PointsPerThread && thread_offset + i < tile_n; i++)
+        {
+            tile[sobol_padded_tile_index(thread_offset + i)] = distribution(engine.current());
+            engine.discard();
+        }
+        // Restore from a copy and use fast discard_stride with power of 2 stride
+        engine = engine_copy;
+        engine.discard_stride(tile_stride * tile_size);
+        __syncthreads();
+
+        // tile_first is a multiple of OutputWidth, so the first aligned value of the tile is
+        // the first aligned value of the output
+        const unsigned int head_size  = cpp_utils::min(misalignment, tile_n);
+        const unsigned int vec_n      = (tile_n - head_size) / OutputWidth;
+        const unsigned int tail_first = head_size + vec_n * OutputWidth;
+
+        vec_type* vec_data = reinterpret_cast<vec_type*>(data + tile_first + head_size);
+        for(unsigned int v = threadIdx.x; v < vec_n; v += block_size)
+        {
+            T output[OutputWidth];
+            for(unsigned int i = 0; i < OutputWidth; i++)
+            {
+                output[i] = tile[sobol_padded_tile_index(head_size + v * OutputWidth + i)];
+            }
+            vec_data[v] = *reinterpret_cast<vec_type*>(output);
+        }
+        // Values before the first and after the last vector of the tile
+        if(threadIdx.x < head_size)
+        {
+            data[tile_first + threadIdx.x] = tile[sobol_padded_tile_index(threadIdx.x)];
+        }
+        if(threadIdx.x < tile_n - tail_first)
+        {
+            data[tile_first + tail_first + threadIdx.x]
+                = tile[sobol_padded_tile_index(tail_first + threadIdx.x)];
+        }
+        __syncthreads();
+    }
+}
 #else
-template<unsigned int OutputPerThread,
+template<unsigned int PointsPerThread,
+         unsigned int OutputWidth,
          bool         Scrambled,
          class Engine,
          class Constant,
@@ -113,150 +201,472 @@ template<unsigned int OutputPerThread,
 __global__ __launch_bounds__(block_size) void generate_sobol_kernel(
     T*, const size_t, const Constant*, const Constant*, const unsigned int, Distribution)
 {}
+#endif
 
-template<unsigned int OutputPerThread,
+#ifdef __HIP_DEVICE_COMPILE__
+/// \brief Generates Sobol points in point-major layout, i.e. <tt>data[point * dimensions + d]</tt>.
+///
+/// Every block handles \p dimensions_per_block consecutive dimensions and tiles of
+/// \p tile_points consecutive points. Thread \p t computes dimension
+/// <tt>t % dimensions_per_block</tt> of run <tt>t / dimensions_per_block</tt> of the tile,
+/// the <tt>block_size / dimensions_per_block</tt> runs split the points of the tile evenly.
+/// Like in generate_sobol_kernel, only the first point of a run is skipped ahead to with its
+/// Gray code and later tiles are reached with the strided discard (leap frog), so
+/// \p tile_points and the number of tiles of the grid must be powers of 2. The tile is staged
+/// through shared memory as <tt>[points][dimensions_per_block]</tt>, and all threads of the
+/// block store its rows, which are contiguous in the output if the block handles all
+/// dimensions. <tt>tile_points * dimensions_per_block</tt> must not exceed
+/// <tt>block_size * PointsPerThread</tt>.
+template<unsigned int PointsPerThread,
          bool         Scrambled,
          class Engine,
          class Constant,
          class T,
+         class Distribution,
+         int block_size>
+__global__ __launch_bounds__(block_size) void generate_sobol_point_major_kernel(
+    T*                 data,
+    const size_t       n,
+    const unsigned int dimensions,
+    const unsigned int dimensions_per_block,
+    const unsigned int tile_points,
+    const Constant*    direction_vectors,
+    const Constant*    scramble_constants,
+    const unsigned int offset,
+    Distribution       distribution)
+{
+    constexpr unsigned int vector_size = sizeof(Constant) == 4 ? 32 : 64;
+    constexpr unsigned int tile_size   = block_size * PointsPerThread;
+
+    __shared__ T tile[sobol_padded_tile_index(tile_size)];
+
+    const unsigned int first_dimension = blockIdx.y * dimensions_per_block;
+    const unsigned int block_dimensions
+        = cpp_utils::min(dimensions_per_block, dimensions - first_dimension);
+
+    const unsigned int dimension_lane = threadIdx.x % dimensions_per_block;
+    const unsigned int run            = threadIdx.x / dimensions_per_block;
+    const unsigned int runs           = block_size / dimensions_per_block;
+    const bool         generates      = run < runs && dimension_lane < block_dimensions;
+    // The runs differ in length by at most one point
+    const unsigned int run_first = run * tile_points / runs;
+    const unsigned int run_last  = (run + 1) * tile_points / runs;
+
+    const unsigned int dimension = first_dimension + (generates ? dimension_lane : 0);
+    const Constant     scramble_constant = Scrambled ? scramble_constants[dimension] : 0;
+    Engine             engine            = create_engine<Scrambled, Engine>(direction_vectors
+                                                                 + dimension * vector_size,
+                                                             scramble_constant,
+                                                             offset + blockIdx.x * tile_points
+                                                                 + run_first);
+
+    const size_t tiles       = (n + tile_points - 1) / tile_points;
+    const size_t tile_stride = gridDim.x;
+
+    for(size_t t = blockIdx.x; t < tiles; t += tile_stride)
+    {
+        const size_t       tile_first = t * tile_points;
+        const unsigned int tile_n
+            = static_cast<unsigned int>(cpp_utils::min(n - tile_first, size_t{tile_points}));
+
+        if(generates)
+        {
+            const Engine       engine_copy = engine;
+            const unsigned int last        = cpp_utils::min(run_last, tile_n);
+            for(unsigned int point = run_first; point < last; point++)
+            {
+                tile[sobol_padded_tile_index(point * dimensions_per_block + dimension_lane)]
+                    = distribution(engine.current());
+                engine.discard();
+            }
+            // Restore from a copy and use fast discard_stride with power of 2 stride
+            engine = engine_copy;
+            engine.discard_stride(tile_stride * tile_points);
+        }
+        __syncthreads();
+
+        T* tile_data = data + tile_first * dimensions + first_dimension;
+        for(unsigned int i = threadIdx.x; i < tile_n * dimensions_per_block; i += block_size)
+        {
+            const unsigned int point = i / dimensions_per_block;
+            const unsigned int lane  = i - point * dimensions_per_block;
+            if(lane < block_dimensions)
+            {
+                tile_data[point * dimensions + lane] = tile[sobol_padded_tile_index(i)];
+            }
+        }
+        __syncthreads();
+    }
+}
+#else
+template<unsigned int PointsPerThread,
+         bool         Scrambled,
+         class Engine,
+         class Constant,
+         class T,
+         class Distribution,
+         int block_size>
+__global__ __launch_bounds__(block_size) void generate_sobol_point_major_kernel(T*,
+                                                                              const size_t,
+                                                                              const unsigned int,
+                                                                              const unsigned int,
+                                                                              const unsigned int,
+                                                                              const Constant*,
+                                                                              const Constant*,
+                                                                              const unsigned int,
+                                                                              Distribution)
+{}
+#endif
+
+/// \brief Returns the index of the rightmost zero bit of \p x, i.e. the index of the direction
+/// vector that is XOR'ed into the state when stepping from point \p x to point <tt>x + 1</tt>.
+template<class Constant>
+__forceinline__ __host__ __device__
+unsigned int sobol_rightmost_zero_bit(Constant x)
+{
+    constexpr unsigned int vector_size = sizeof(Constant) == 4 ? 32 : 64;
+    unsigned int           z           = 0;
+    // The last point of the sequence has no successor, clamp to stay inside the vectors.
+    while((x & 1) && z < vector_size - 1)
+    {
+        x >>= 1;
+        z++;
+    }
+    return z;
+}
+
+/// \brief Point-blocked Sobol generation for the host.
+///
+/// Unlike the device kernel, which leap-frogs through the sequence so that writes are
+/// coalesced, every emulated block computes a run of \p PointsPerBlock consecutive points
+/// for \p DimensionsPerBlock dimensions. The state is skipped ahead once, using the Gray code
+/// of the first point, after which every point costs a single XOR per dimension. The index of
+/// that XOR only depends on the point, so the inner loop runs over a transposed copy of the
+/// direction vectors and is vectorized across dimensions. The output is identical to that of
+/// generate_sobol_kernel, or generate_sobol_point_major_kernel if \p PointMajor is set.
+///
+/// Launch with <tt>grid_dim.x = ceil(n / PointsPerBlock)</tt>,
+/// <tt>grid_dim.y = ceil(dimensions / DimensionsPerBlock)</tt> and a single thread per block.
+template<unsigned int PointsPerBlock,
+         unsigned int DimensionsPerBlock,
+         bool         PointMajor,
+         bool         Scrambled,
+         class Constant,
+         class T,
          class Distribution>
-void generate_sobol_host(dim3               block_idx,
-                         dim3               thread_idx,
-                         dim3               grid_dim,
-                         dim3               block_dim,
-                         T*                 data,
+void generate_sobol_host(dim3 block_idx,
+                         dim3 /*thread_idx*/,
+                         dim3 /*grid_dim*/,
+                         dim3 /*block_dim*/,
+                         T* __restrict__ data,
                          const size_t       n,
+                         const unsigned int dimensions,
                          const Constant*    direction_vectors,
                          const Constant*    scramble_constants,
                          const unsigned int offset,
                          Distribution       distribution)
-#endif
 {
-#ifdef __HIP_DEVICE_COMPILE__
-    dim3 block_idx  = blockIdx;
-    dim3 thread_idx = threadIdx;
-    dim3 grid_dim   = gridDim;
-    dim3 block_dim  = blockDim;
-#endif
-    constexpr unsigned int output_per_thread  = OutputPerThread;
-    constexpr bool         use_shared_vectors = Engine::uses_shared_vectors();
-    using vec_type                            = aligned_vec_type<T, output_per_thread>;
+    constexpr unsigned int vector_size = sizeof(Constant) == 4 ? 32 : 64;
 
-    const unsigned int dimension = block_idx.y;
-    const unsigned int engine_id = block_idx.x * block_dim.x + thread_idx.x;
-    const unsigned int stride    = grid_dim.x * block_dim.x;
-    size_t             index     = engine_id;
+    const size_t       first_point     = static_cast<size_t>(block_idx.x) * PointsPerBlock;
+    const size_t       last_point      = std::min(n, first_point + PointsPerBlock);
+    const unsigned int first_dimension = block_idx.y * DimensionsPerBlock;
+    const unsigned int dimension_count
+        = std::min(DimensionsPerBlock, dimensions - first_dimension);
+
+    // Direction vectors transposed to [bit][dimension]. Unused dimensions of the last block
+    // are zero so the XOR loops below can always run over all DimensionsPerBlock lanes.
+    Constant vectors[vector_size][DimensionsPerBlock] = {};
+    Constant scramble[DimensionsPerBlock]             = {};
+    Constant state[DimensionsPerBlock]                = {};
+    for(unsigned int d = 0; d < dimension_count; d++)
+    {
+        const Constant* dimension_vectors
+            = direction_vectors + (first_dimension + d) * vector_size;
+        for(unsigned int bit = 0; bit < vector_size; bit++)
+        {
+            vectors[bit][d] = dimension_vectors[bit];
+        }
+        if constexpr(Scrambled)
+        {
+            scramble[d] = scramble_constants[first_dimension + d];
+        }
+    }
 
-    // Each thread of the current block uses the same direction vectors
-    // (the dimension is determined by blockIdx.y)
-    constexpr unsigned int vector_size = sizeof(Constant) == 4 ? 32 : 64;
-    const Constant*        vectors_ptr = [=]
+    // Skip ahead to the first point of the block
+    Constant       index = static_cast<Constant>(offset) + static_cast<Constant>(first_point);
+    const Constant gray  = index ^ (index >> 1);
+    for(unsigned int bit = 0; bit < vector_size; bit++)
     {
-        if constexpr(use_shared_vectors)
+        if((gray >> bit) & 1)
         {
-#ifdef __HIP_PLATFORM_AMD__
-            // On AMD GPUs we must use a constexpr size shared array for performance.
-            // But this code won't compile with NVCC, because we are in a __host__ __device__
-            // function.
-            __shared__ Constant shared_vectors[vector_size];
-#else
-            // NVCC won't accept extern __shared__ Constant shared_bytes[];
-            // Thereby we must resort to aliasing.
-            extern __shared__ unsigned char shared_bytes[];
-            auto* shared_vectors = reinterpret_cast<Constant*>(&shared_bytes[0]);
-#endif
-            if(thread_idx.x < vector_size)
+            for(unsigned int d = 0; d < DimensionsPerBlock; d++)
             {
-                shared_vectors[thread_idx.x]
-                    = direction_vectors[dimension * vector_size + thread_idx.x];
+                state[d] ^= vectors[bit][d];
             }
-            system::syncthreads<true>{}();
-            return shared_vectors;
         }
-        else
+    }
+
+    for(size_t i = first_point; i < last_point; i++)
+    {
+        for(unsigned int d = 0; d < dimension_count; d++)
         {
-            return direction_vectors + dimension * vector_size;
+            const size_t output_index = PointMajor ? i * dimensions + first_dimension + d
+                                                   : (first_dimension + d) * n + i;
+            data[output_index] = distribution(state[d] ^ scramble[d]);
         }
-    }();
 
-    const Constant scramble_constant = Scrambled ? scramble_constants[dimension] : 0;
+        const Constant* next_vectors = vectors[sobol_rightmost_zero_bit(index)];
+        for(unsigned int d = 0; d < DimensionsPerBlock; d++)
+        {
+            state[d] ^= next_vectors[d];
+        }
+        index++;
+    }
+}
 
-    data += dimension * n;
+/// \brief Returns the state of a Sobol sequence after skipping ahead to the point whose Gray code
+/// is \p gray, i.e. the XOR of the direction vectors selected by its bits.
+template<class Constant>
+__forceinline__ __host__ __device__
+Constant sobol_gray_code_state(const Constant* vectors, Constant gray)
+{
+    Constant     state = 0;
+    unsigned int bit   = 0;
+    while(gray != 0)
+    {
+        if(gray & 1)
+        {
+            state ^= vectors[bit];
+        }
+        gray >>= 1;
+        bit++;
+    }
+    return state;
+}
 
-    // All distributions generate one output from one input
-    // Generation of, for example, 2 shorts from 1 uint or
-    // 2 floats from 2 uints using Box-Muller transformation
-    // is impossible because the resulting sequence is not
-    // quasi-random anymore.
+/// \brief Returns the offset of the paths in the scratch memory of a block of
+/// generate_sobol_brownian_bridge_kernel, which starts with the states of the dimensions.
+template<class Constant>
+__forceinline__ __host__ __device__
+size_t sobol_brownian_bridge_paths_offset(const unsigned int dimensions)
+{
+    return (dimensions * sizeof(Constant) + 15) / 16 * 16;
+}
 
-    if constexpr(output_per_thread == 1)
-    {
-        const unsigned int engine_offset = engine_id * output_per_thread;
-        Engine             engine        = create_engine<Scrambled, Engine>(vectors_ptr,
-                                                         scramble_constant,
-                                                         offset + engine_offset);
+#ifdef __HIP_DEVICE_COMPILE__
+/// \brief Generates the increments of Wiener paths constructed by a Brownian bridge that is driven
+/// by Sobol normals, without storing the normals themselves.
+///
+/// Every path corresponds to one Sobol point, and dimension \c i of the point drives step \c i of
+/// the bridge construction. Every block constructs tiles of \p block_size consecutive paths, one
+/// per thread. The tiles are aligned to \p block_size in the sequence, so the Gray code of point
+/// <tt>tile + t</tt> is the one of the tile XOR'ed with the one of \c t. The states of the tile
+/// are kept per dimension and advanced to the next tile of the block with the strided discard
+/// (leap frog), which requires the number of blocks to be a power of 2. The points of the paths
+/// of a tile are built in \p scratch, or in dynamic shared memory if \p scratch is null, with
+/// the paths of adjacent threads next to each other, and the block stores their increments to
+/// consecutive elements of the output. Step \c s of path \c p is stored to
+/// <tt>data[p * dimensions + s]</tt> if \p point_major is set and to <tt>data[s * n + p]</tt>
+/// otherwise.
+template<bool Scrambled, class Constant, class T, int block_size>
+__global__ __launch_bounds__(block_size) void generate_sobol_brownian_bridge_kernel(
+    T*                             data,
+    const size_t                   n,
+    const unsigned int             dimensions,
+    const Constant*                direction_vectors,
+    const Constant*                scramble_constants,
+    const brownian_bridge_step<T>* steps,
+    const T                        sqrt_time_step,
+    const bool                     point_major,
+    const unsigned int             offset,
+    unsigned char*                 scratch,
+    const size_t                   scratch_stride)
+{
+    constexpr unsigned int vector_size = sizeof(Constant) == 4 ? 32 : 64;
+
+    extern __shared__ unsigned char shared_bytes[];
+    unsigned char* block_scratch
+        = scratch == nullptr ? shared_bytes : scratch + blockIdx.x * scratch_stride;
+    Constant* states = reinterpret_cast<Constant*>(block_scratch);
+    T*        paths  = reinterpret_cast<T*>(
+        block_scratch + sobol_brownian_bridge_paths_offset<Constant>(dimensions));
 
-        while(index < n)
+    const sobol_normal_distribution<T> distribution(T(0), T(1));
+
+    const unsigned int lane      = threadIdx.x;
+    const Constant     lane_gray = lane ^ (lane >> 1);
+
+    const unsigned long long first       = offset;
+    const unsigned long long last        = first + n;
+    const unsigned long long tile_stride = static_cast<unsigned long long>(gridDim.x) * block_size;
+
+    unsigned long long tile = first / block_size * block_size + blockIdx.x * block_size;
+    if(tile < last)
+    {
+        // Skip ahead to the first tile of the block
+        const Constant point = static_cast<Constant>(tile);
+        const Constant gray  = point ^ (point >> 1);
+        for(unsigned int d = lane; d < dimensions; d += block_size)
         {
-            data[index] = distribution(engine.current());
-            engine.discard_stride(stride);
-            index += stride;
+            const Constant state
+                = sobol_gray_code_state(direction_vectors + d * vector_size, gray);
+            states[d] = Scrambled ? state ^ scramble_constants[d] : state;
         }
     }
-    else
-    {
-        const uintptr_t uintptr   = reinterpret_cast<uintptr_t>(data);
-        const size_t misalignment = (output_per_thread - uintptr / sizeof(T)) % output_per_thread;
-        const unsigned int head_size    = cpp_utils::min(n, misalignment);
-        const unsigned int tail_size = (n - head_size) % output_per_thread;
-        const size_t       vec_n     = (n - head_size) / output_per_thread;
 
-        const unsigned int engine_offset
-            = engine_id * output_per_thread
-              + (engine_id == 0 ? 0 : head_size); // The first engine writes head_size values
-        Engine engine = create_engine<Scrambled, Engine>(vectors_ptr,
-                                                         scramble_constant,
-                                                         offset + engine_offset);
+    for(; tile < last; tile += tile_stride)
+    {
+        __syncthreads();
 
-        if(engine_id == 0)
+        const unsigned long long point = tile + lane;
+        if(point >= first && point < last)
+        {
+            construct_brownian_bridge(
+                steps,
+                dimensions,
+                sqrt_time_step,
+                paths + lane,
+                block_size,
+                [&](const unsigned int dimension)
+                {
+                    // XOR'ing the direction vectors into the scrambled state keeps it scrambled
+                    return distribution(
+                        states[dimension]
+                        ^ sobol_gray_code_state(direction_vectors + dimension * vector_size,
+                                                lane_gray));
+                });
+        }
+        __syncthreads();
+
+        // The paths of the tile are stored next to each other in both layouts
+        const unsigned int first_lane = tile < first ? static_cast<unsigned int>(first - tile) : 0;
+        const unsigned int count
+            = static_cast<unsigned int>(cpp_utils::min(last, tile + block_size) - tile)
+              - first_lane;
+        const size_t index = tile + first_lane - first;
+        if(point_major)
         {
-            // If data is not aligned by sizeof(vec_type)
-            for(unsigned int o = 0; o < head_size; o++)
+            T* tile_data = data + index * dimensions;
+            for(size_t e = lane; e < size_t{count} * dimensions; e += block_size)
             {
-                data[o] = distribution(engine.current());
-                engine.discard();
+                const unsigned int path = static_cast<unsigned int>(e / dimensions);
+                const unsigned int step = static_cast<unsigned int>(e % dimensions);
+                const T* lane_path      = paths + first_lane + path;
+                tile_data[e]            = lane_path[step * block_size]
+                               - (step == 0 ? T(0) : lane_path[(step - 1) * block_size]);
             }
         }
-
-        vec_type* vec_data = reinterpret_cast<vec_type*>(data + misalignment);
-        while(index < vec_n)
+        else if(lane < count)
         {
-            Engine engine_copy = engine;
-
-            T output[output_per_thread];
-            for(unsigned int i = 0; i < output_per_thread; i++)
+            const T* lane_path = paths + first_lane + lane;
+            T        previous  = T(0);
+            for(unsigned int step = 0; step < dimensions; step++)
             {
-                output[i] = distribution(engine.current());
-                engine.discard();
+                const T value                 = lane_path[step * block_size];
+                data[step * n + index + lane] = value - previous;
+                previous                      = value;
             }
+        }
+
+        // Advance the states to the next tile of the block, see
+        // sobol32_engine::discard_state_power2
+        const Constant     point_of_tile = static_cast<Constant>(tile);
+        const Constant     stride        = static_cast<Constant>(tile_stride);
+        const unsigned int stride_bit    = sobol_rightmost_zero_bit(~stride) - 1;
+        const unsigned int carry_bit = sobol_rightmost_zero_bit(point_of_tile | (stride - 1));
+        for(unsigned int d = lane; d < dimensions; d += block_size)
+        {
+            const Constant* vectors = direction_vectors + d * vector_size;
+            states[d] ^= vectors[stride_bit] ^ vectors[carry_bit];
+        }
+    }
+}
+#else
+template<bool Scrambled, class Constant, class T, int block_size>
+__global__ __launch_bounds__(block_size) void generate_sobol_brownian_bridge_kernel(
+    T*,
+    const size_t,
+    const unsigned int,
+    const Constant*,
+    const Constant*,
+    const brownian_bridge_step<T>*,
+    const T,
+    const bool,
+    const unsigned int,
+    unsigned char*,
+    const size_t)
+{}
+#endif
+
+/// \brief Host counterpart of generate_sobol_brownian_bridge_kernel.
+///
+/// Every emulated block constructs \p PointsPerBlock consecutive paths. The state of all
+/// dimensions is skipped ahead once, after which moving to the next path costs one XOR per
+/// dimension. Every path is constructed in a buffer of the block before its increments are
+/// stored to <tt>data[p * path_stride + s * step_stride]</tt>. Launch with
+/// <tt>grid_dim.x = ceil(n / PointsPerBlock)</tt> and a single thread per block.
+template<unsigned int PointsPerBlock, bool Scrambled, class Constant, class T>
+void generate_sobol_brownian_bridge_host(dim3 block_idx,
+                                         dim3 /*thread_idx*/,
+                                         dim3 /*grid_dim*/,
+                                         dim3 /*block_dim*/,
+                                         T*                             data,
+                                         const size_t                   n,
+                                         const unsigned int             dimensions,
+                                         const Constant*                direction_vectors,
+                                         const Constant*                scramble_constants,
+                                         const brownian_bridge_step<T>* steps,
+                                         const T                        sqrt_time_step,
+                                         const size_t                   path_stride,
+                                         const size_t                   step_stride,
+                                         const unsigned int             offset)
+{
+    constexpr unsigned int vector_size = sizeof(Constant) == 4 ? 32 : 64;
 
-            vec_data[index] = *reinterpret_cast<vec_type*>(output);
+    const sobol_normal_distribution<T> distribution(T(0), T(1));
 
-            // Restore from a copy and use fast discard_stride with power of 2 stride
-            engine = engine_copy;
-            engine.discard_stride(stride * output_per_thread);
-            index += stride;
+    const size_t first_point = static_cast<size_t>(block_idx.x) * PointsPerBlock;
+    const size_t last_point  = std::min(n, first_point + PointsPerBlock);
+
+    Constant       index = static_cast<Constant>(offset) + static_cast<Constant>(first_point);
+    const Constant gray  = index ^ (index >> 1);
+
+    std::vector<Constant> state(dimensions);
+    for(unsigned int d = 0; d < dimensions; d++)
+    {
+        state[d] = sobol_gray_code_state(direction_vectors + d * vector_size, gray);
+        if constexpr(Scrambled)
+        {
+            state[d] ^= scramble_constants[d];
+        }
+    }
+
+    std::vector<T> path(dimensions);
+    for(size_t i = first_point; i < last_point; i++)
+    {
+        construct_brownian_bridge(steps,
+                                  dimensions,
+                                  sqrt_time_step,
+                                  path.data(),
+                                  1,
+                                  [&](const unsigned int dimension)
+                                  { return distribution(state[dimension]); });
+
+        T previous = T(0);
+        for(unsigned int s = 0; s < dimensions; s++)
+        {
+            data[i * path_stride + s * step_stride] = path[s] - previous;
+            previous                                = path[s];
         }
 
-        if(index == vec_n)
+        // XOR'ing the direction vector into the scrambled state keeps it scrambled
+        const unsigned int bit = sobol_rightmost_zero_bit(index);
+        for(unsigned int d = 0; d < dimensions; d++)
         {
-            // Fill tail values (up to output_per_thread-1)
-            for(unsigned int o = 0; o < tail_size; o++)
-            {
-                data[n - tail_size + o] = distribution(engine.current());
-                engine.discard();
-            }
+            state[d] ^= direction_vectors[d * vector_size + bit];
         }
+        index++;
     }
 }
 
@@ -617,6 +1027,20 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    rocrand_status set_layout(rocrand_quasi_random_layout layout) override final
+    {
+        if(layout != ROCRAND_QUASI_RANDOM_LAYOUT_DIMENSION_MAJOR
+           && layout != ROCRAND_QUASI_RANDOM_LAYOUT_POINT_MAJOR)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+
+        // The layout only changes where the values are stored, the state is unaffected
+        m_layout = layout;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status set_stream(hipStream_t stream)
     {
         const rocrand_status status = m_poisson.set_stream(stream);
@@ -674,26 +1098,7 @@ public:
             return ROCRAND_STATUS_SUCCESS;
         }
 
-        constexpr uint32_t threads    = 256;
-        constexpr uint32_t max_blocks = 4096;
-        constexpr uint32_t shared_mem_bytes
-#ifdef __HIP_PLATFORM_AMD__
-            // On AMD GPUs we must resort to static shared memory for performance.
-            = 0;
-#else
-            = system_type::is_device() ? ((Is64 ? 64 : 32) * sizeof(constant_type)) : 0;
-#endif
-
-        const size_t       size             = data_size / m_dimensions;
-        constexpr uint32_t output_per_block = threads * output_per_thread;
-        const uint32_t     blocks
-            = std::min(max_blocks,
-                       static_cast<uint32_t>((size + output_per_block - 1) / output_per_block));
-
-        // blocks_x must be power of 2 because strided discard (leap frog)
-        // supports only power of 2 jumps
-        const uint32_t blocks_x = next_power2((blocks + m_dimensions - 1) / m_dimensions);
-        const uint32_t blocks_y = m_dimensions;
+        const size_t size = data_size / m_dimensions;
 
         // Bypass the generalized launching mechanism for host and device, as it would introduce a level of
         //   indirection for the device (the __global__ function calls a __device__ function). This causes
@@ -701,20 +1106,75 @@ public:
         //   on specific data types (e.g. uchar) and architectures (e.g. gfx908).
         if constexpr(system_type::is_device())
         {
-            generate_sobol_kernel<output_per_thread,
-                                  Scrambled,
-                                  engine_type,
-                                  constant_type,
-                                  T,
-                                  Distribution,
-                                  threads>
-                <<<dim3(blocks_x, blocks_y), dim3(threads), shared_mem_bytes, m_stream>>>(
-                    data,
-                    size,
-                    m_direction_vectors,
-                    m_scramble_constants,
-                    m_current_offset,
-                    distribution);
+            constexpr uint32_t threads    = 256;
+            constexpr uint32_t max_blocks = 4096;
+
+            if(m_layout == ROCRAND_QUASI_RANDOM_LAYOUT_POINT_MAJOR)
+            {
+                // The dimensions are split evenly into blocks of at most 32 dimensions, and each
+                // block handles tiles of a power of 2 points, see generate_sobol_point_major_kernel.
+                const uint32_t blocks_y             = (m_dimensions + 31) / 32;
+                const uint32_t dimensions_per_block = (m_dimensions + blocks_y - 1) / blocks_y;
+                const uint32_t runs                 = threads / dimensions_per_block;
+                uint32_t       tile_points          = 1;
+                while(tile_points * 2 <= runs * device_points_per_thread)
+                {
+                    tile_points *= 2;
+                }
+                const uint32_t blocks = static_cast<uint32_t>(
+                    std::min(size_t{max_blocks},
+                             (size + tile_points - 1) / tile_points * blocks_y));
+
+                // blocks_x must be power of 2 because strided discard (leap frog)
+                // supports only power of 2 jumps
+                const uint32_t blocks_x = next_power2((blocks + blocks_y - 1) / blocks_y);
+
+                generate_sobol_point_major_kernel<device_points_per_thread,
+                                                  Scrambled,
+                                                  engine_type,
+                                                  constant_type,
+                                                  T,
+                                                  Distribution,
+                                                  threads>
+                    <<<dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream>>>(
+                        data,
+                        size,
+                        m_dimensions,
+                        dimensions_per_block,
+                        tile_points,
+                        m_direction_vectors,
+                        m_scramble_constants,
+                        m_current_offset,
+                        distribution);
+            }
+            else
+            {
+                constexpr uint32_t output_per_block = threads * device_points_per_thread;
+                const uint32_t     blocks           = std::min(
+                    max_blocks,
+                    static_cast<uint32_t>((size + output_per_block - 1) / output_per_block));
+
+                // blocks_x must be power of 2 because strided discard (leap frog)
+                // supports only power of 2 jumps
+                const uint32_t blocks_x = next_power2((blocks + m_dimensions - 1) / m_dimensions);
+                const uint32_t blocks_y = m_dimensions;
+
+                generate_sobol_kernel<device_points_per_thread,
+                                      output_per_thread,
+                                      Scrambled,
+                                      engine_type,
+                                      constant_type,
+                                      T,
+                                      Distribution,
+                                      threads>
+                    <<<dim3(blocks_x, blocks_y), dim3(threads), 0, m_stream>>>(
+                        data,
+                        size,
+                        m_direction_vectors,
+                        m_scramble_constants,
+                        m_current_offset,
+                        distribution);
+            }
             if(hipGetLastError() != hipSuccess)
             {
                 return ROCRAND_STATUS_LAUNCH_FAILURE;
@@ -722,26 +1182,44 @@ public:
         }
         else
         {
-            using block_size_provider = static_block_size_config_provider<threads>;
-            status = system_type::template launch<generate_sobol_host<output_per_thread,
-                                                                      Scrambled,
-                                                                      engine_type,
-                                                                      constant_type,
-                                                                      T,
-                                                                      Distribution>,
-                                                  block_size_provider>(dim3(blocks_x, blocks_y),
-                                                                       dim3(threads),
-                                                                       shared_mem_bytes,
-                                                                       m_stream,
-                                                                       data,
-                                                                       size,
-                                                                       m_direction_vectors,
-                                                                       m_scramble_constants,
-                                                                       m_current_offset,
-                                                                       distribution);
-            if(status != ROCRAND_STATUS_SUCCESS)
+            // Each emulated block computes a run of consecutive points for a tile of dimensions,
+            // see generate_sobol_host.
+            const uint32_t blocks_x = static_cast<uint32_t>(
+                (size + host_points_per_block - 1) / host_points_per_block);
+            const uint32_t blocks_y
+                = (m_dimensions + host_dimensions_per_block - 1) / host_dimensions_per_block;
+
+            if(blocks_x > 0)
             {
-                return status;
+                const auto launch = [&](auto point_major)
+                {
+                    return system_type::template launch<
+                        generate_sobol_host<host_points_per_block,
+                                            host_dimensions_per_block,
+                                            decltype(point_major)::value,
+                                            Scrambled,
+                                            constant_type,
+                                            T,
+                                            Distribution>,
+                        static_block_size_config_provider<1>>(dim3(blocks_x, blocks_y),
+                                                              dim3(1),
+                                                              0,
+                                                              m_stream,
+                                                              data,
+                                                              size,
+                                                              m_dimensions,
+                                                              m_direction_vectors,
+                                                              m_scramble_constants,
+                                                              m_current_offset,
+                                                              distribution);
+                };
+                status = m_layout == ROCRAND_QUASI_RANDOM_LAYOUT_POINT_MAJOR
+                             ? launch(std::true_type{})
+                             : launch(std::false_type{});
+                if(status != ROCRAND_STATUS_SUCCESS)
+                {
+                    return status;
+                }
             }
         }
 
@@ -771,6 +1249,26 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        sobol_exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status
+        generate_binomial(unsigned int* data, size_t data_size, unsigned int n, double p)
+    {
+        sobol_binomial_distribution distribution(n, p);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_geometric(unsigned int* data, size_t data_size, double p)
+    {
+        sobol_geometric_distribution distribution(p);
+        return generate(data, data_size, distribution);
+    }
+
     template<class T>
     rocrand_status generate_poisson(T* data, size_t data_size, double lambda)
     {
@@ -788,6 +1286,136 @@ public:
         return std::get<rocrand_status>(result);
     }
 
+    template<class T>
+    rocrand_status generate_brownian_bridge(T* data, size_t data_size, T time_step)
+    {
+        if(data_size % m_dimensions != 0)
+        {
+            return ROCRAND_STATUS_LENGTH_NOT_MULTIPLE;
+        }
+
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        if(data == nullptr || data_size == 0)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        const brownian_bridge_step<T>* steps;
+        if constexpr(std::is_same_v<T, float>)
+        {
+            status = m_bridge_float.get_steps(m_dimensions, &steps);
+        }
+        else
+        {
+            status = m_bridge_double.get_steps(m_dimensions, &steps);
+        }
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        // Every point of the sequence is a path, and every dimension is a time step
+        const size_t size        = data_size / m_dimensions;
+        const bool   point_major = m_layout == ROCRAND_QUASI_RANDOM_LAYOUT_POINT_MAJOR;
+        const size_t path_stride = point_major ? m_dimensions : 1;
+        const size_t step_stride = point_major ? 1 : size;
+        const T      sqrt_time_step = std::sqrt(time_step);
+
+        if constexpr(system_type::is_device())
+        {
+            constexpr uint32_t threads    = 64;
+            constexpr uint32_t max_blocks = 4096;
+
+            // Tiles of paths are aligned to the number of threads in the sequence
+            const size_t tiles = (m_current_offset % threads + size + threads - 1) / threads;
+            // blocks must be power of 2 because strided discard (leap frog)
+            // supports only power of 2 jumps
+            uint32_t blocks
+                = static_cast<uint32_t>(next_power2(std::min(size_t{max_blocks}, tiles)));
+            if(blocks > tiles)
+            {
+                blocks /= 2;
+            }
+
+            const size_t scratch_stride
+                = sobol_brownian_bridge_paths_offset<constant_type>(m_dimensions)
+                  + size_t{m_dimensions} * threads * sizeof(T);
+            unsigned char* scratch          = nullptr;
+            uint32_t       shared_mem_bytes = 0;
+            if(scratch_stride <= max_bridge_shared_bytes)
+            {
+                shared_mem_bytes = static_cast<uint32_t>(scratch_stride);
+            }
+            else
+            {
+                status = std::is_same_v<T, float>
+                             ? m_bridge_float.get_scratch(blocks * scratch_stride, &scratch)
+                             : m_bridge_double.get_scratch(blocks * scratch_stride, &scratch);
+                if(status != ROCRAND_STATUS_SUCCESS)
+                {
+                    return status;
+                }
+            }
+
+            generate_sobol_brownian_bridge_kernel<Scrambled, constant_type, T, threads>
+                <<<dim3(blocks), dim3(threads), shared_mem_bytes, m_stream>>>(data,
+                                                                              size,
+                                                                              m_dimensions,
+                                                                              m_direction_vectors,
+                                                                              m_scramble_constants,
+                                                                              steps,
+                                                                              sqrt_time_step,
+                                                                              point_major,
+                                                                              m_current_offset,
+                                                                              scratch,
+                                                                              scratch_stride);
+            if(hipGetLastError() != hipSuccess)
+            {
+                return ROCRAND_STATUS_LAUNCH_FAILURE;
+            }
+        }
+        else
+        {
+            const uint32_t blocks
+                = static_cast<uint32_t>((size + host_paths_per_block - 1) / host_paths_per_block);
+            if(blocks > 0)
+            {
+                status = system_type::template launch<
+                    generate_sobol_brownian_bridge_host<host_paths_per_block,
+                                                        Scrambled,
+                                                        constant_type,
+                                                        T>,
+                    static_block_size_config_provider<1>>(dim3(blocks),
+                                                          dim3(1),
+                                                          0,
+                                                          m_stream,
+                                                          data,
+                                                          size,
+                                                          m_dimensions,
+                                                          m_direction_vectors,
+                                                          m_scramble_constants,
+                                                          steps,
+                                                          sqrt_time_step,
+                                                          path_stride,
+                                                          step_stride,
+                                                          m_current_offset);
+                if(status != ROCRAND_STATUS_SUCCESS)
+                {
+                    return status;
+                }
+            }
+        }
+
+        m_current_offset += size;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
 private:
     static const constant_accessor& get_constants()
     {
@@ -797,17 +1425,34 @@ private:
         return accessor;
     }
 
-    bool                 m_initialized        = false;
-    unsigned int         m_dimensions         = 1;
-    unsigned int         m_current_offset     = 0;
-    const constant_type* m_direction_vectors  = nullptr;
-    const constant_type* m_scramble_constants = nullptr;
+    bool                        m_initialized        = false;
+    unsigned int                m_dimensions         = 1;
+    unsigned int                m_current_offset     = 0;
+    rocrand_quasi_random_layout m_layout             = ROCRAND_QUASI_RANDOM_LAYOUT_DIMENSION_MAJOR;
+    const constant_type*        m_direction_vectors  = nullptr;
+    const constant_type*        m_scramble_constants = nullptr;
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager_t m_poisson;
 
+    // For caching of Brownian bridge steps for consecutive generations with the same dimensions
+    brownian_bridge_manager<system_type, float>  m_bridge_float;
+    brownian_bridge_manager<system_type, double> m_bridge_double;
+
     // m_offset from base_type
 
+    /// Number of consecutive points computed by one thread of the device kernel per tile.
+    static constexpr inline unsigned int device_points_per_thread = 8;
+    /// Number of consecutive points computed by one emulated block of the host generator.
+    static constexpr inline unsigned int host_points_per_block = 4096;
+    /// Number of dimensions computed together by one emulated block of the host generator.
+    static constexpr inline unsigned int host_dimensions_per_block = 16;
+    /// Number of consecutive paths constructed by one emulated block of the host generator.
+    static constexpr inline unsigned int host_paths_per_block = 256;
+    /// Largest shared memory used by the paths of a block of the device Brownian bridge kernel,
+    /// larger bridges are constructed in global scratch memory so the occupancy stays high.
+    static constexpr inline size_t max_bridge_shared_bytes = 16384;
+
     static size_t next_power2(size_t x)
     {
         size_t power = 1;
@@ -0,0 +1,417 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#ifndef ROCRAND_RNG_SQUARES_H_
+#define ROCRAND_RNG_SQUARES_H_
+
+#include "config/squares_config.hpp"
+
+#include "common.hpp"
+#include "config_types.hpp"
+#include "distributions.hpp"
+#include "generator_type.hpp"
+#include "system.hpp"
+#include "utils/cpp_utils.hpp"
+
+#include <rocrand/rocrand.h>
+#include <rocrand/rocrand_squares.h>
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+
+namespace rocrand_impl::host
+{
+
+// Every application of the distribution reads its inputs at a counter that only
+// depends on its index, so each thread computes its values without any state and
+// the result does not depend on the launch configuration.
+template<typename T, typename Distribution>
+__host__ __device__ __forceinline__ void generate_squares(dim3                           block_idx,
+                                                          dim3                           thread_idx,
+                                                          dim3                           grid_dim,
+                                                          dim3                           block_dim,
+                                                          rocrand_device::squares_engine engine,
+                                                          T*                             data,
+                                                          const size_t                   n,
+                                                          Distribution distribution)
+{
+    constexpr unsigned int input_width  = Distribution::input_width;
+    constexpr unsigned int output_width = Distribution::output_width;
+
+    const size_t thread_id = block_idx.x * block_dim.x + thread_idx.x;
+    const size_t stride    = grid_dim.x * block_dim.x;
+
+    const unsigned long long key     = engine.key();
+    const unsigned long long counter = engine.counter();
+
+    unsigned int input[input_width];
+    T            output[output_width];
+
+    const size_t applications = (n + output_width - 1) / output_width;
+    for(size_t index = thread_id; index < applications; index += stride)
+    {
+        for(unsigned int i = 0; i < input_width; i++)
+        {
+            input[i] = rocrand_device::detail::squares32(key, counter + index * input_width + i);
+        }
+        distribution(input, output);
+
+        for(unsigned int o = 0; o < output_width; o++)
+        {
+            if(index * output_width + o < n)
+            {
+                data[index * output_width + o] = output[o];
+            }
+        }
+    }
+}
+
+template<typename System, typename ConfigProvider>
+class squares_generator_template : public generator_impl_base
+{
+public:
+    using base_type   = generator_impl_base;
+    using engine_type = rocrand_device::squares_engine;
+    using system_type = System;
+    using poisson_distribution_manager_t
+        = poisson_distribution_manager<DISCRETE_METHOD_ALIAS, system_type>;
+    using poisson_distribution_t = typename poisson_distribution_manager_t::distribution_t;
+    using poisson_approx_distribution_t =
+        typename poisson_distribution_manager_t::approx_distribution_t;
+
+    squares_generator_template(unsigned long long seed   = ROCRAND_SQUARES_DEFAULT_SEED,
+                               unsigned long long offset = 0,
+                               rocrand_ordering   order  = ROCRAND_ORDERING_PSEUDO_DEFAULT,
+                               hipStream_t        stream = 0)
+        : base_type(order, offset, stream), m_seed(seed)
+    {}
+
+    static constexpr rocrand_rng_type type()
+    {
+        return ROCRAND_RNG_PSEUDO_SQUARES;
+    }
+
+    void reset() override final
+    {
+        m_engines_initialized = false;
+    }
+
+    /// Changes seed to \p seed and resets generator state.
+    void set_seed(unsigned long long seed)
+    {
+        m_seed = seed;
+        reset();
+    }
+
+    unsigned long long get_seed() const
+    {
+        return m_seed;
+    }
+
+    rocrand_status set_order(rocrand_ordering order)
+    {
+        if(!system_type::is_device() && order == ROCRAND_ORDERING_PSEUDO_DYNAMIC)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        static constexpr std::array supported_orderings{
+            ROCRAND_ORDERING_PSEUDO_DEFAULT,
+            ROCRAND_ORDERING_PSEUDO_DYNAMIC,
+            ROCRAND_ORDERING_PSEUDO_BEST,
+            ROCRAND_ORDERING_PSEUDO_LEGACY,
+        };
+        if(std::find(supported_orderings.begin(), supported_orderings.end(), order)
+           == supported_orderings.end())
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_order = order;
+        reset();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status set_host_launch_blocks(unsigned int blocks) override final
+    {
+        if(system_type::is_device())
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+        if(blocks == 0 || blocks > max_host_launch_blocks)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_host_launch_blocks = blocks;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status set_stream(hipStream_t stream)
+    {
+        const rocrand_status status = m_poisson.set_stream(stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        base_type::set_stream(stream);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Divides the subsequences of this generator into the ranges \p parts of itself and
+    /// \p count children without changing it, see subsequence_range. All values of a generator come from its first subsequence.
+    rocrand_status split(unsigned int count, subsequence_range* parts) const
+    {
+        return m_subsequences.split(1, count, parts);
+    }
+
+    /// Keeps only \p subsequences, the first part of a split() whose children were created.
+    void keep_subsequences(const subsequence_range& subsequences)
+    {
+        m_subsequences = subsequences;
+    }
+
+    /// Makes this generator a child of \p parent that uses \p subsequences.
+    rocrand_status fork_from(const squares_generator_template& parent,
+                             const subsequence_range&          subsequences)
+    {
+        rocrand_status status = set_stream(parent.m_stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = set_order(parent.m_order);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        m_seed               = parent.m_seed;
+        m_subsequences       = subsequences;
+        m_host_launch_blocks = parent.m_host_launch_blocks;
+        reset();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        if(m_engines_initialized)
+            return ROCRAND_STATUS_SUCCESS;
+
+        m_engine = engine_type{m_seed, m_subsequences.first, m_offset};
+
+        rocrand_status status = m_poisson.init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        m_engines_initialized = true;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<typename T, typename Distribution = uniform_distribution<T>>
+    rocrand_status generate(T* data, size_t data_size, Distribution distribution = Distribution())
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = launch_generate(m_engine, data, data_size, distribution);
+        if(status != ROCRAND_STATUS_SUCCESS || data == nullptr)
+        {
+            return status;
+        }
+
+        // Generating data_size values will use this many distributions
+        const auto num_applied_generators = (data_size + Distribution::output_width - 1)
+                                            / Distribution::output_width
+                                            * Distribution::input_width;
+
+        m_engine.discard(num_applied_generators);
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status generate(unsigned long long* data, size_t data_size)
+    {
+        // Cannot generate 64-bit values with this generator.
+        (void)data;
+        (void)data_size;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    template<typename Distribution>
+    rocrand_status generate(unsigned long long* data, size_t data_size, Distribution distribution)
+    {
+        // Cannot generate 64-bit values with this generator.
+        (void)data;
+        (void)data_size;
+        (void)distribution;
+        return ROCRAND_STATUS_TYPE_ERROR;
+    }
+
+    /// Generates \p data_size values starting at \p first_index of the stream of the seed.
+    /// The offset and the state of the generator are neither used nor changed.
+    rocrand_status
+        generate_range(unsigned int* data, unsigned long long first_index, size_t data_size) const
+    {
+        return launch_generate(engine_type{m_seed, m_subsequences.first, first_index},
+                               data,
+                               data_size,
+                               uniform_distribution<unsigned int>());
+    }
+
+    template<class T>
+    rocrand_status generate_uniform(T* data, size_t data_size)
+    {
+        uniform_distribution<T> distribution;
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_normal(T* data, size_t data_size, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_log_normal(T* data, size_t data_size, T mean, T stddev)
+    {
+        log_normal_distribution<T> distribution(mean, stddev);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T* data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T* data, size_t data_size, T alpha, T beta)
+    {
+        beta_distribution<T> distribution(alpha, beta);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status
+        generate_binomial(unsigned int* data, size_t data_size, unsigned int n, double p)
+    {
+        binomial_distribution<> distribution(n, p);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_geometric(unsigned int* data, size_t data_size, double p)
+    {
+        geometric_distribution<> distribution(p);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_poisson(unsigned int* data, size_t data_size, double lambda)
+    {
+        auto result = m_poisson.get_distribution(lambda);
+        if(auto* dis = std::get_if<poisson_distribution_t>(&result))
+        {
+            return generate(data, data_size, *dis);
+        }
+        if(auto* dis = std::get_if<poisson_approx_distribution_t>(&result))
+        {
+            return generate(data, data_size, *dis);
+        }
+        return std::get<rocrand_status>(result);
+    }
+
+private:
+    template<typename T, typename Distribution>
+    rocrand_status launch_generate(const engine_type& engine,
+                                   T*                 data,
+                                   size_t             data_size,
+                                   Distribution       distribution) const
+    {
+        generator_config config;
+        const hipError_t error = ConfigProvider::template host_config<T>(m_stream, m_order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        if(data == nullptr)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // Every thread writes the values of one call of the distribution to every row of the grid
+        const unsigned int blocks
+            = get_launch_blocks<system_type>(config.threads,
+                                             config.blocks,
+                                             data_size * sizeof(T),
+                                             Distribution::output_width * sizeof(T));
+
+        return dynamic_dispatch(
+            m_order,
+            [&, this](auto is_dynamic)
+            {
+                return system_type::template launch<generate_squares<T, Distribution>,
+                                                    ConfigProvider,
+                                                    T,
+                                                    is_dynamic>(dim3(blocks),
+                                                                dim3(config.threads),
+                                                                0,
+                                                                m_stream,
+                                                                engine,
+                                                                data,
+                                                                data_size,
+                                                                distribution);
+            });
+    }
+
+    bool        m_engines_initialized = false;
+    engine_type m_engine;
+
+    unsigned long long m_seed;
+    subsequence_range  m_subsequences;
+
+    // For caching of Poisson for consecutive generations with the same lambda
+    poisson_distribution_manager_t m_poisson;
+
+    // m_seed from base_type
+    // m_offset from base_type
+};
+
+using squares_generator
+    = squares_generator_template<system::device_system,
+                                 default_config_provider<ROCRAND_RNG_PSEUDO_SQUARES>>;
+
+template<bool UseHostFunc>
+using squares_generator_host
+    = squares_generator_template<system::host_system<UseHostFunc>,
+                                 default_config_provider<ROCRAND_RNG_PSEUDO_SQUARES>>;
+
+} // namespace rocrand_impl::host
+
+#endif // ROCRAND_RNG_SQUARES_H_
@@ -24,8 +24,10 @@
 /// rocRAND supports running generators on both the device and the host.
 /// Since the generators should generate the same results on both of these,
 /// generation kernels are "launched" with the same number of blocks, threads, etc,
-/// on the host as they are on the GPU. This file contains abstraction to help with
-/// making code generic for both of these "systems".
+/// on the host as they are on the GPU. Generators whose values do not depend on the number
+/// of blocks launch fewer blocks on the host, see \ref host_system::get_launch_blocks.
+/// This file contains abstraction to help with making code generic for both of these
+/// "systems".
 
 #ifndef ROCRAND_RNG_SYSTEM_H_
 #define ROCRAND_RNG_SYSTEM_H_
@@ -44,8 +46,12 @@
 #endif
 #include <cstring>
 #include <new>
+#include <thread>
 
 #include <stdint.h>
+#if __has_include(<unistd.h>)
+    #include <unistd.h>
+#endif
 
 namespace rocrand_impl::system
 {
@@ -71,6 +77,43 @@ inline rocrand_status is_stream_blocking(hipStream_t stream, bool& is_blocking)
     return ROCRAND_STATUS_SUCCESS;
 }
 
+/// The number of blocks that every worker thread of the host runs, so the workers stay busy
+/// when some blocks take longer than others.
+inline constexpr unsigned int host_blocks_per_worker = 4;
+
+/// The size of the cache lines of the host, and of the L2 cache of hosts that do not report it.
+inline constexpr size_t host_cache_line_size       = 64;
+inline constexpr size_t host_default_l2_cache_size = size_t{1} << 20;
+
+struct host_hardware_info
+{
+    /// The number of worker threads that run the blocks of a launch.
+    unsigned int workers;
+    /// The size of the L2 cache of one core.
+    size_t l2_cache_size;
+};
+
+inline const host_hardware_info& get_host_hardware_info()
+{
+    static const host_hardware_info info = []
+    {
+        host_hardware_info result{1, host_default_l2_cache_size};
+#ifdef ROCRAND_USE_PARALLEL_STL
+        // Otherwise the blocks run one after another
+        result.workers = std::max(1u, std::thread::hardware_concurrency());
+#endif
+#if defined(_SC_LEVEL2_CACHE_SIZE)
+        const long l2_cache_size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+        if(l2_cache_size > 0)
+        {
+            result.l2_cache_size = static_cast<size_t>(l2_cache_size);
+        }
+#endif
+        return result;
+    }();
+    return info;
+}
+
 } // namespace detail
 
 /// \tparam UseHostFunc If true, launching will enqueue the kernel in the stream. Otherwise,
@@ -118,6 +161,34 @@ struct host_system
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    /// Returns the number of blocks of \p threads threads that generators launch on the host
+    /// instead of the \p max_blocks blocks of their config, if the number of blocks does not
+    /// change the generated values. Every worker thread of the host runs a few blocks.
+    ///
+    /// The threads of a block run one after another, and when every thread writes one vector
+    /// of \p vector_bytes bytes of every row of <tt>blocks * threads</tt> vectors, the next
+    /// thread writes next to these vectors. More blocks are launched if the \p size_bytes bytes
+    /// written by the launch are so many rows that the cache lines written by a thread would
+    /// not be in the L2 cache anymore when the next thread writes them. \p vector_bytes is 0 if
+    /// the threads write contiguous values.
+    static unsigned int get_launch_blocks(const unsigned int threads,
+                                          const unsigned int max_blocks,
+                                          const size_t       size_bytes,
+                                          const size_t       vector_bytes)
+    {
+        const detail::host_hardware_info& info = detail::get_host_hardware_info();
+
+        size_t blocks = size_t{info.workers} * detail::host_blocks_per_worker;
+        if(vector_bytes > 0)
+        {
+            const size_t max_rows   = info.l2_cache_size / detail::host_cache_line_size;
+            const size_t min_grid   = size_bytes / vector_bytes / max_rows;
+            const size_t min_blocks = (min_grid + threads - 1) / threads;
+            blocks                  = std::max(blocks, min_blocks);
+        }
+        return static_cast<unsigned int>(std::clamp<size_t>(blocks, 1, max_blocks));
+    }
+
     template<typename... UserArgs>
     struct KernelArgs
     {
@@ -299,6 +370,15 @@ struct device_system
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    /// The device launches the \p max_blocks blocks of the config.
+    static unsigned int get_launch_blocks(const unsigned int /*threads*/,
+                                          const unsigned int max_blocks,
+                                          const size_t /*size_bytes*/,
+                                          const size_t /*vector_bytes*/)
+    {
+        return max_blocks;
+    }
+
     template<auto Kernel,
              typename ConfigProvider
              = host::static_block_size_config_provider<ROCRAND_DEFAULT_MAX_BLOCK_SIZE>,
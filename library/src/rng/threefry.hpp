@@ -41,6 +41,8 @@
 
 #include <hip/hip_runtime.h>
 
+#include <algorithm>
+#include <cstdint>
 #include <type_traits>
 
 namespace rocrand_impl::host
@@ -197,6 +199,32 @@ __host__ __device__ __forceinline__ void generate_threefry(dim3         block_id
     }
 }
 
+template<class Engine, class T, class Distribution>
+__host__ __device__ __forceinline__ void
+    generate_threefry_batched(dim3                      block_idx,
+                              dim3                      thread_idx,
+                              dim3                      grid_dim,
+                              dim3                      block_dim,
+                              const unsigned long long* seeds,
+                              const unsigned long long* offsets,
+                              T*                        data,
+                              const size_t              n,
+                              const size_t              pitch,
+                              Distribution              distribution)
+{
+    // Every row of the grid generates the values of one seed
+    const size_t batch_index = block_idx.y;
+    const Engine engine(seeds[batch_index], 0, offsets == nullptr ? 0 : offsets[batch_index]);
+    generate_threefry(block_idx,
+                      thread_idx,
+                      grid_dim,
+                      block_dim,
+                      engine,
+                      data + batch_index * pitch,
+                      n,
+                      distribution);
+}
+
 template<class System, class Engine, class ConfigProvider>
 class threefry_generator_template : public generator_impl_base
 {
@@ -293,6 +321,39 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    /// Divides the subsequences of this generator into the ranges \p parts of itself and
+    /// \p count children without changing it, see subsequence_range. All values of a generator come from its first subsequence.
+    rocrand_status split(unsigned int count, subsequence_range* parts) const
+    {
+        return m_subsequences.split(1, count, parts);
+    }
+
+    /// Keeps only \p subsequences, the first part of a split() whose children were created.
+    void keep_subsequences(const subsequence_range& subsequences)
+    {
+        m_subsequences = subsequences;
+    }
+
+    /// Makes this generator a child of \p parent that uses \p subsequences.
+    rocrand_status fork_from(const threefry_generator_template& parent,
+                             const subsequence_range&           subsequences)
+    {
+        rocrand_status status = set_stream(parent.m_stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = set_order(parent.m_order);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        m_seed         = parent.m_seed;
+        m_subsequences = subsequences;
+        reset();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status init()
     {
         if(m_engines_initialized)
@@ -300,7 +361,7 @@ public:
             return ROCRAND_STATUS_SUCCESS;
         }
 
-        m_engine = engine_type{m_seed, 0, m_offset};
+        m_engine = engine_type{m_seed, m_subsequences.first, m_offset};
 
         rocrand_status status = m_poisson.init();
         if(status != ROCRAND_STATUS_SUCCESS)
@@ -329,38 +390,10 @@ public:
                 return status;
             }
 
-            generator_config                       config;
-            const hipError_t                       error
-                = ConfigProvider::template host_config<T>(m_stream, m_order, config);
-            if(error != hipSuccess)
-            {
-                return ROCRAND_STATUS_INTERNAL_ERROR;
-            }
-
-            if(data == nullptr)
-            {
-                return ROCRAND_STATUS_SUCCESS;
-            }
-
-            status = dynamic_dispatch(m_order,
-                                      [&, this](auto is_dynamic)
-                                      {
-                                          return system_type::template launch<
-                                              generate_threefry<engine_type, T, Distribution>,
-                                              ConfigProvider,
-                                              T,
-                                              is_dynamic>(dim3(config.blocks),
-                                                          dim3(config.threads),
-                                                          0,
-                                                          m_stream,
-                                                          m_engine,
-                                                          data,
-                                                          data_size,
-                                                          distribution);
-                                      });
+            status = launch_generate(m_engine, data, data_size, distribution);
 
             // Check kernel status
-            if(status != ROCRAND_STATUS_SUCCESS)
+            if(status != ROCRAND_STATUS_SUCCESS || data == nullptr)
             {
                 return status;
             }
@@ -387,6 +420,126 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    /// Generates \p data_size 32-bit values starting at \p first_index of the stream of
+    /// the seed. The offset and the state of the generator are neither used nor changed.
+    rocrand_status
+        generate_range(unsigned int* data, unsigned long long first_index, size_t data_size) const
+    {
+        if constexpr(std::is_same_v<scalar_type, unsigned int>)
+        {
+            return launch_generate(engine_type{m_seed, m_subsequences.first, first_index},
+                                   data,
+                                   data_size,
+                                   uniform_distribution<unsigned int, unsigned int>());
+        }
+        else
+        {
+            // Every 64-bit value gives two 32-bit values, the lower half first. The generate
+            // kernel stores the halves of a value at 8-byte aligned addresses, so it is only used
+            // if that agrees with first_index, the other halves are computed by generate_halves.
+            const bool aligned
+                = reinterpret_cast<std::uintptr_t>(data) % sizeof(unsigned long long) == 0;
+            if(aligned != (first_index % 2 == 0))
+            {
+                return launch_generate_halves(
+                    engine_type{m_seed, m_subsequences.first, first_index / 2},
+                    data,
+                    data_size,
+                    first_index % 2);
+            }
+            if(first_index % 2 == 1 && data_size > 0)
+            {
+                const rocrand_status status = launch_generate_halves(
+                    engine_type{m_seed, m_subsequences.first, first_index / 2}, data, 1, 1);
+                if(status != ROCRAND_STATUS_SUCCESS)
+                {
+                    return status;
+                }
+                data++;
+                data_size--;
+                first_index++;
+            }
+            return launch_generate(engine_type{m_seed, m_subsequences.first, first_index / 2},
+                                   data,
+                                   data_size,
+                                   uniform_distribution<unsigned int, unsigned long long>());
+        }
+    }
+
+    /// Generates \p data_size values for each of the \p batch_size seeds in \p seeds. The
+    /// values of seed i are stored at <tt>data + i * pitch</tt> and are the same as the ones
+    /// generated after setting the seed to <tt>seeds[i]</tt> and the offset to
+    /// <tt>offsets[i]</tt> (or 0 if \p offsets is nullptr). \p seeds and \p offsets must be
+    /// accessible by the kernels like \p data. The state of the generator is not used.
+    template<class T, class Distribution = uniform_distribution<T, scalar_type>>
+    rocrand_status generate_batched(T*                        data,
+                                    size_t                    data_size,
+                                    size_t                    pitch,
+                                    const unsigned long long* seeds,
+                                    const unsigned long long* offsets,
+                                    size_t                    batch_size,
+                                    Distribution              distribution = Distribution()) const
+    {
+        generator_config config;
+        const hipError_t error = ConfigProvider::template host_config<T>(m_stream, m_order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        if(data == nullptr)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        for(size_t first = 0; first < batch_size; first += max_batch_grid_rows)
+        {
+            const unsigned int rows
+                = static_cast<unsigned int>(std::min(batch_size - first, max_batch_grid_rows));
+
+            const rocrand_status status = dynamic_dispatch(
+                m_order,
+                [&, this](auto is_dynamic)
+                {
+                    return system_type::template launch<
+                        generate_threefry_batched<engine_type, T, Distribution>,
+                        ConfigProvider,
+                        T,
+                        is_dynamic>(
+                        dim3(config.blocks, rows),
+                        dim3(config.threads),
+                        0,
+                        m_stream,
+                        seeds + first,
+                        offsets == nullptr ? nullptr : offsets + first,
+                        data + first * pitch,
+                        data_size,
+                        pitch,
+                        distribution);
+                });
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    template<class T>
+    rocrand_status generate_normal_batched(T*                        data,
+                                           size_t                    data_size,
+                                           size_t                    pitch,
+                                           const unsigned long long* seeds,
+                                           const unsigned long long* offsets,
+                                           size_t                    batch_size,
+                                           T                         mean,
+                                           T                         stddev) const
+    {
+        constexpr unsigned int input_width = normal_distribution_max_input_width<type(), T>;
+        normal_distribution<T, scalar_type, input_width> distribution(mean, stddev);
+        return generate_batched(data, data_size, pitch, seeds, offsets, batch_size, distribution);
+    }
+
     template<class T>
     rocrand_status generate_uniform(T* data, size_t data_size)
     {
@@ -410,6 +563,40 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T, scalar_type> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T* data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T, scalar_type> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T* data, size_t data_size, T alpha, T beta)
+    {
+        beta_distribution<T, scalar_type> distribution(alpha, beta);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status
+        generate_binomial(unsigned int* data, size_t data_size, unsigned int n, double p)
+    {
+        binomial_distribution<scalar_type> distribution(n, p);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_geometric(unsigned int* data, size_t data_size, double p)
+    {
+        geometric_distribution<scalar_type> distribution(p);
+        return generate(data, data_size, distribution);
+    }
+
     template<class T>
     rocrand_status generate_poisson(T* data, size_t data_size, double lambda)
     {
@@ -426,10 +613,87 @@ public:
     }
 
 private:
+    template<class T, class Distribution>
+    rocrand_status launch_generate(const engine_type& engine,
+                                   T*                 data,
+                                   size_t             data_size,
+                                   Distribution       distribution) const
+    {
+        generator_config config;
+        const hipError_t error = ConfigProvider::template host_config<T>(m_stream, m_order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        if(data == nullptr)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        return dynamic_dispatch(
+            m_order,
+            [&, this](auto is_dynamic)
+            {
+                return system_type::template launch<generate_threefry<engine_type, T, Distribution>,
+                                                    ConfigProvider,
+                                                    T,
+                                                    is_dynamic>(dim3(config.blocks),
+                                                                dim3(config.threads),
+                                                                0,
+                                                                m_stream,
+                                                                engine,
+                                                                data,
+                                                                data_size,
+                                                                distribution);
+            });
+    }
+
+    rocrand_status launch_generate_halves(const engine_type& engine,
+                                          unsigned int*      data,
+                                          size_t             data_size,
+                                          unsigned int       first_half) const
+    {
+        generator_config config;
+        const hipError_t error
+            = ConfigProvider::template host_config<unsigned int>(m_stream, m_order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        if(data == nullptr)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        return dynamic_dispatch(
+            m_order,
+            [&, this](auto is_dynamic)
+            {
+                return system_type::template launch<generate_halves<engine_type>,
+                                                    ConfigProvider,
+                                                    unsigned int,
+                                                    is_dynamic>(dim3(config.blocks),
+                                                                dim3(config.threads),
+                                                                0,
+                                                                m_stream,
+                                                                engine,
+                                                                data,
+                                                                data_size,
+                                                                first_half);
+            });
+    }
+
     bool        m_engines_initialized = false;
     engine_type m_engine;
 
     unsigned long long m_seed;
+    // The subsequence of Threefry2x32 is the upper word of its 64-bit counter
+    subsequence_range m_subsequences{
+        0,
+        sizeof(typename engine_type::state_vector_type) == 2 * sizeof(unsigned int) ? 1ULL << 32
+                                                                                    : ~0ULL};
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager_t m_poisson;
@@ -23,9 +23,12 @@
 
 #include "config/xorwow_config.hpp"
 
+#include "autotune.hpp"
 #include "common.hpp"
 #include "config_types.hpp"
 #include "distributions.hpp"
+#include "fused.hpp"
+#include "generator_state.hpp"
 #include "generator_type.hpp"
 #include "system.hpp"
 #include "utils/cpp_utils.hpp"
@@ -40,7 +43,44 @@
 namespace rocrand_impl::host
 {
 
-typedef ::rocrand_device::xorwow_engine xorwow_device_engine;
+/// Skip ahead of all engines by the same offset. The jump polynomial is computed once on the
+/// host, so every engine evaluates it once instead of walking the jump matrices digit by digit.
+struct xorwow_offset_jump
+{
+    unsigned long long offset;
+    unsigned int       polynomial[5];
+
+    explicit xorwow_offset_jump(unsigned long long offset) : offset(offset)
+    {
+        ::rocrand_device::detail::xorwow_jump_polynomial(offset, 0, polynomial);
+    }
+};
+
+struct xorwow_device_engine : public ::rocrand_device::xorwow_engine
+{
+    typedef ::rocrand_device::xorwow_engine base_type;
+
+    __forceinline__ xorwow_device_engine() = default;
+
+    __forceinline__ __device__ __host__ xorwow_device_engine(const unsigned long long seed,
+                                                             const unsigned long long subsequence,
+                                                             const unsigned long long offset)
+        : base_type(seed, subsequence, offset)
+    {}
+
+    /// Same as the engine constructed with offset \p jump.offset.
+    __forceinline__ __device__ __host__ xorwow_device_engine(const unsigned long long  seed,
+                                                             const unsigned long long  subsequence,
+                                                             const xorwow_offset_jump& jump)
+        : base_type(seed, subsequence, 0)
+    {
+        this->jump(jump.offset, jump.polynomial);
+        // Apply n steps to Weyl sequence value as well
+        m_state.d += static_cast<unsigned int>(jump.offset) * 362437;
+    }
+
+    // m_state from base class
+};
 
 __host__ __device__ inline void init_xorwow_engines(dim3 block_idx,
                                                     dim3 thread_idx,
@@ -49,52 +89,46 @@ __host__ __device__ inline void init_xorwow_engines(dim3 block_idx,
                                                     xorwow_device_engine* engines,
                                                     const unsigned int    start_engine_id,
                                                     const unsigned int    engines_size,
+                                                    unsigned long long    subsequence,
                                                     unsigned long long    seed,
-                                                    unsigned long long    offset)
+                                                    xorwow_offset_jump    offset)
 {
     const unsigned int engine_id = block_idx.x * block_dim.x + thread_idx.x;
     if(engine_id < engines_size)
     {
-        engines[engine_id]
-            = xorwow_device_engine(seed, engine_id, offset + (engine_id < start_engine_id ? 1 : 0));
+        xorwow_device_engine engine(seed, subsequence + engine_id, offset);
+        if(engine_id < start_engine_id)
+        {
+            // These engines start one number later
+            (void)engine.next();
+        }
+        engines[engine_id] = engine;
     }
 }
 
-template<class ConfigProvider, bool IsDynamic, class T, class Distribution>
-__host__ __device__ __forceinline__ void generate_xorwow(dim3 block_idx,
-                                         dim3 thread_idx,
-                                         dim3 grid_dim,
-                                         dim3 /*block_dim*/,
-                                         xorwow_device_engine* engines,
-                                         const unsigned int    start_engine_id,
-                                         T*                    data,
-                                         const size_t          n,
-                                         Distribution          distribution)
+/// Generates the values of engine \p id of \p stride engines that interleave their values.
+template<class Output, class Distribution>
+__host__ __device__ __forceinline__ void generate_xorwow_values(const unsigned int    id,
+                                                                const unsigned int    stride,
+                                                                xorwow_device_engine& engine,
+                                                                Output                data,
+                                                                const size_t          n,
+                                                                Distribution distribution)
 {
-    static_assert(is_single_tile_config<ConfigProvider, T>(IsDynamic),
-                  "This kernel should only be used with single tile configs");
-    constexpr unsigned int BlockSize    = get_block_size<ConfigProvider, T>(IsDynamic);
+    using T = typename Output::value_type;
+
     constexpr unsigned int input_width  = Distribution::input_width;
     constexpr unsigned int output_width = Distribution::output_width;
 
-    using vec_type = aligned_vec_type<T, output_width>;
-
-    const unsigned int thread_id    = block_idx.x * BlockSize + thread_idx.x;
-    const uintptr_t uintptr   = reinterpret_cast<uintptr_t>(data);
-    const size_t misalignment = (output_width - uintptr / sizeof(T) % output_width) % output_width;
+    const size_t       misalignment = data.template misalignment<output_width>();
     const unsigned int head_size    = cpp_utils::min(n, misalignment);
-    const unsigned int tail_size = (n - head_size) % output_width;
-    const size_t       vec_n     = (n - head_size) / output_width;
-
-    vec_type*            vec_data    = reinterpret_cast<vec_type*>(data + misalignment);
-    const unsigned int   num_engines = grid_dim.x * BlockSize;
-    const unsigned int   engine_id   = (thread_id + start_engine_id) % num_engines;
-    xorwow_device_engine engine      = engines[engine_id];
+    const unsigned int tail_size    = (n - head_size) % output_width;
+    const size_t       vec_n        = (n - head_size) / output_width;
 
     unsigned int input[input_width];
     T            output[output_width];
 
-    size_t index = thread_id;
+    size_t index = id;
     while(index < vec_n)
     {
         for(unsigned int i = 0; i < input_width; i++)
@@ -110,9 +144,9 @@ __host__ __device__ __forceinline__ void generate_xorwow(dim3 block_idx,
         // Here we add s_waitcnt vmcnt(0)
         __builtin_amdgcn_s_waitcnt(/*vmcnt*/ 0 | (/*exp_cnt*/ 0x7 << 4) | (/*lgkmcnt*/ 0xf << 8));
 #endif
-        vec_data[index] = *reinterpret_cast<vec_type*>(output);
+        data.template store<output_width>(misalignment + index * output_width, output);
         // Next position
-        index += num_engines;
+        index += stride;
     }
 
     // Check if we need to save head and tail.
@@ -155,9 +189,71 @@ __host__ __device__ __forceinline__ void generate_xorwow(dim3 block_idx,
             }
         }
     }
+}
 
-    // Save engine with its state
-    engines[engine_id] = engine;
+template<class ConfigProvider, bool IsDynamic, class Output, class Distribution>
+__host__ __device__ __forceinline__ void generate_xorwow(dim3 block_idx,
+                                         dim3 thread_idx,
+                                         dim3 grid_dim,
+                                         dim3 /*block_dim*/,
+                                         xorwow_device_engine* engines,
+                                         const unsigned int    start_engine_id,
+                                         const unsigned int    num_engines,
+                                         Output                data,
+                                         const size_t          n,
+                                         Distribution          distribution)
+{
+    using T = typename Output::value_type;
+
+    static_assert(is_single_tile_config<ConfigProvider, T>(IsDynamic),
+                  "This kernel should only be used with single tile configs");
+    constexpr unsigned int BlockSize = get_block_size<ConfigProvider, T>(IsDynamic);
+
+    const unsigned int thread_id = block_idx.x * BlockSize + thread_idx.x;
+
+    // The sequence is defined by num_engines engines and every engine is run by one thread,
+    // so the launch config does not change the values.
+    const unsigned int stride = grid_dim.x * BlockSize;
+    const virtual_engine_range range = get_virtual_engine_range(thread_id, stride, num_engines);
+    for(unsigned int virtual_id = range.first; virtual_id < range.last;
+        virtual_id += range.step)
+    {
+        const unsigned int   engine_id = (virtual_id + start_engine_id) % num_engines;
+        xorwow_device_engine engine    = engines[engine_id];
+
+        generate_xorwow_values(virtual_id, num_engines, engine, data, n, distribution);
+
+        // Save engine with its state
+        engines[engine_id] = engine;
+    }
+}
+
+/// Generates all requests of \p requests with one load and store of every engine, see
+/// run_fused_requests.
+template<class ConfigProvider, bool IsDynamic>
+__host__ __device__ __forceinline__ void generate_xorwow_fused(dim3 block_idx,
+                                                               dim3 thread_idx,
+                                                               dim3 grid_dim,
+                                                               dim3 /*block_dim*/,
+                                                               xorwow_device_engine* engines,
+                                                               fused_request_list    requests)
+{
+    static_assert(is_single_tile_config<ConfigProvider, unsigned int>(IsDynamic),
+                  "This kernel should only be used with single tile configs");
+    constexpr unsigned int BlockSize = get_block_size<ConfigProvider, unsigned int>(IsDynamic);
+
+    run_fused_requests<default_fused_distributions>(
+        block_idx.x * BlockSize + thread_idx.x,
+        grid_dim.x * BlockSize,
+        engines,
+        requests,
+        [](const unsigned int    id,
+           const unsigned int    stride,
+           xorwow_device_engine& engine,
+           auto                  data,
+           const size_t          n,
+           auto                  distribution)
+        { generate_xorwow_values(id, stride, engine, data, n, distribution); });
 }
 
 template<class System, class ConfigProvider>
@@ -189,6 +285,7 @@ public:
         , m_start_engine_id(other.m_start_engine_id)
         , m_engines_size(other.m_engines_size)
         , m_seed(other.m_seed)
+        , m_subsequences(other.m_subsequences)
         , m_poisson(std::move(other.m_poisson))
     {
         other.m_engines_initialized = false;
@@ -205,6 +302,7 @@ public:
         m_start_engine_id              = other.m_start_engine_id;
         m_engines_size                 = other.m_engines_size;
         m_seed                         = other.m_seed;
+        m_subsequences                 = other.m_subsequences;
         m_poisson                      = std::move(other.m_poisson);
 
         other.m_engines_initialized = false;
@@ -256,6 +354,7 @@ public:
             ROCRAND_ORDERING_PSEUDO_BEST,
             ROCRAND_ORDERING_PSEUDO_LEGACY,
             ROCRAND_ORDERING_PSEUDO_SEEDED,
+            ROCRAND_ORDERING_PSEUDO_PORTABLE,
         };
         if(std::find(supported_orderings.begin(), supported_orderings.end(), order)
            == supported_orderings.end())
@@ -267,6 +366,20 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    rocrand_status set_host_launch_blocks(unsigned int blocks) override final
+    {
+        if(system_type::is_device())
+        {
+            return ROCRAND_STATUS_TYPE_ERROR;
+        }
+        if(blocks == 0 || blocks > max_host_launch_blocks)
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+        m_host_launch_blocks = blocks;
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     rocrand_status set_stream(hipStream_t stream)
     {
         const rocrand_status status = m_poisson.set_stream(stream);
@@ -278,32 +391,64 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    rocrand_status init()
+    /// Divides the subsequences of this generator into the ranges \p parts of itself and
+    /// \p count children without changing it, see subsequence_range. The engines of this generator keep their subsequences.
+    rocrand_status split(unsigned int count, subsequence_range* parts) const
     {
-        if (m_engines_initialized)
-        {
-            return ROCRAND_STATUS_SUCCESS;
-        }
-
-        hipError_t error
-            = get_least_common_grid_size<ConfigProvider>(m_stream, m_order, m_engines_size);
+        unsigned int engines_size;
+        hipError_t   error
+            = get_least_common_grid_size<ConfigProvider>(m_stream,
+                                                         get_sequence_ordering(m_order),
+                                                         engines_size);
         if(error != hipSuccess)
         {
             return ROCRAND_STATUS_INTERNAL_ERROR;
         }
+        return m_subsequences.split(engines_size, count, parts);
+    }
 
-        m_start_engine_id = m_offset % m_engines_size;
+    /// Keeps only \p subsequences, the first part of a split() whose children were created.
+    void keep_subsequences(const subsequence_range& subsequences)
+    {
+        m_subsequences = subsequences;
+    }
 
-        if(m_engines != nullptr)
+    /// Makes this generator a child of \p parent that uses \p subsequences.
+    rocrand_status fork_from(const xorwow_generator_template& parent,
+                             const subsequence_range&         subsequences)
+    {
+        rocrand_status status = set_stream(parent.m_stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
         {
-            system_type::free(m_engines);
+            return status;
+        }
+        status = set_order(parent.m_order);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        m_seed               = parent.m_seed;
+        m_subsequences       = subsequences;
+        m_host_launch_blocks = parent.m_host_launch_blocks;
+        reset();
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    rocrand_status init()
+    {
+        if (m_engines_initialized)
+        {
+            return ROCRAND_STATUS_SUCCESS;
         }
-        rocrand_status status = system_type::alloc(&m_engines, m_engines_size);
+
+        rocrand_status status = allocate_engines();
         if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
         }
 
+        m_start_engine_id = m_offset % m_engines_size;
+
         constexpr unsigned int init_threads = ROCRAND_DEFAULT_MAX_BLOCK_SIZE;
         const unsigned int     init_blocks  = (m_engines_size + init_threads - 1) / init_threads;
 
@@ -316,8 +461,9 @@ public:
             m_engines,
             m_start_engine_id,
             m_engines_size,
+            m_subsequences.first,
             m_seed,
-            m_offset / m_engines_size);
+            xorwow_offset_jump(m_offset / m_engines_size));
         if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
@@ -333,64 +479,93 @@ public:
         return ROCRAND_STATUS_SUCCESS;
     }
 
-    template<class T, class Distribution = uniform_distribution<T> >
-    rocrand_status generate(T * data, size_t data_size,
-                            Distribution distribution = Distribution())
+    rocrand_status get_state_size(size_t& size)
     {
-        rocrand_status status = init();
-        if (status != ROCRAND_STATUS_SUCCESS)
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
         {
             return status;
         }
+        size = get_generator_state_size(get_state_header());
+        return ROCRAND_STATUS_SUCCESS;
+    }
 
-        generator_config config;
-        const hipError_t error = ConfigProvider::template host_config<T>(m_stream, m_order, config);
-        if(error != hipSuccess)
+    rocrand_status save_state(void* state)
+    {
+        const rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
         {
-            return ROCRAND_STATUS_INTERNAL_ERROR;
+            return status;
         }
+        return save_generator_state<system_type>(get_state_header(), m_engines, state, m_stream);
+    }
 
-        if(data == nullptr)
+    rocrand_status load_state(const void* state)
+    {
+        generator_state_header header;
+        rocrand_status         status
+            = read_generator_state_header(state, type(), m_stream, header);
+        if(status != ROCRAND_STATUS_SUCCESS)
         {
-            return ROCRAND_STATUS_SUCCESS;
+            return status;
         }
 
-        status
-            = dynamic_dispatch(m_order,
-                               [&, this](auto is_dynamic)
-                               {
-                                   return system_type::template launch<
-
-                                       generate_xorwow<ConfigProvider, is_dynamic, T, Distribution>,
-                                       ConfigProvider,
-                                       T,
-                                       is_dynamic>(dim3(config.blocks),
-                                                   dim3(config.threads),
-                                                   0,
-                                                   m_stream,
-                                                   m_engines,
-                                                   m_start_engine_id,
-                                                   data,
-                                                   data_size,
-                                                   distribution);
-                               });
-
-        // Check kernel status
+        // The layout is checked before the ordering and the engines are changed
+        unsigned int engines_size;
+        status = get_engines_size(header.order, engines_size);
         if(status != ROCRAND_STATUS_SUCCESS)
         {
-            return ROCRAND_STATUS_LAUNCH_FAILURE;
+            return status;
+        }
+        status = check_generator_state_layout<engine_type>(header, engines_size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if(header.order != m_order)
+        {
+            status = set_order(header.order);
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
         }
 
-        // Generating data_size values will use this many distributions
-        const auto touched_engines =
-            (data_size + Distribution::output_width - 1) /
-            Distribution::output_width;
-
-        m_start_engine_id = (m_start_engine_id + touched_engines) % m_engines_size;
+        // The engines are only allocated, their states are loaded below
+        m_engines_initialized = false;
+        status                = allocate_engines();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = load_generator_state<engine_type, system_type>(state,
+                                                                m_engines_size,
+                                                                m_engines,
+                                                                m_stream);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        status = m_poisson.init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
 
+        m_seed                = header.seed[0];
+        m_offset              = header.offset;
+        m_start_engine_id     = header.position[0];
+        m_engines_initialized = true;
         return ROCRAND_STATUS_SUCCESS;
     }
 
+    template<class T, class Distribution = uniform_distribution<T> >
+    rocrand_status generate(T * data, size_t data_size,
+                            Distribution distribution = Distribution())
+    {
+        return generate_output(dense_output<T>{data}, data_size, distribution);
+    }
+
     rocrand_status generate(unsigned long long* data, size_t data_size)
     {
         // Cannot generate 64-bit values with this generator.
@@ -423,6 +598,33 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    /// Generates \p width * \p height values like generate() and stores them in the rows of
+    /// a 2-D array with \p pitch elements per row.
+    template<class T, class Distribution = uniform_distribution<T>>
+    rocrand_status generate_2d(T*           data,
+                               size_t       width,
+                               size_t       height,
+                               size_t       pitch,
+                               Distribution distribution = Distribution())
+    {
+        return generate_output(pitched_output<T>{data, width, pitch}, width * height, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_uniform_2d(T* data, size_t width, size_t height, size_t pitch)
+    {
+        uniform_distribution<T> distribution;
+        return generate_2d(data, width, height, pitch, distribution);
+    }
+
+    template<class T>
+    rocrand_status
+        generate_normal_2d(T* data, size_t width, size_t height, size_t pitch, T mean, T stddev)
+    {
+        normal_distribution<T> distribution(mean, stddev);
+        return generate_2d(data, width, height, pitch, distribution);
+    }
+
     template<class T>
     rocrand_status generate_log_normal(T * data, size_t data_size, T mean, T stddev)
     {
@@ -430,6 +632,40 @@ public:
         return generate(data, data_size, distribution);
     }
 
+    template<class T>
+    rocrand_status generate_exponential(T* data, size_t data_size, T lambda)
+    {
+        exponential_distribution<T> distribution(lambda);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_gamma(T* data, size_t data_size, T shape, T scale)
+    {
+        gamma_distribution<T> distribution(shape, scale);
+        return generate(data, data_size, distribution);
+    }
+
+    template<class T>
+    rocrand_status generate_beta(T* data, size_t data_size, T alpha, T beta)
+    {
+        beta_distribution<T> distribution(alpha, beta);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status
+        generate_binomial(unsigned int* data, size_t data_size, unsigned int n, double p)
+    {
+        binomial_distribution<> distribution(n, p);
+        return generate(data, data_size, distribution);
+    }
+
+    rocrand_status generate_geometric(unsigned int* data, size_t data_size, double p)
+    {
+        geometric_distribution<> distribution(p);
+        return generate(data, data_size, distribution);
+    }
+
     rocrand_status generate_poisson(unsigned int * data, size_t data_size, double lambda)
     {
         auto result = m_poisson.get_distribution(lambda);
@@ -444,13 +680,215 @@ public:
         return std::get<rocrand_status>(result);
     }
 
+    /// Generates the \p count requests of \p requests. Every launch generates up to
+    /// max_fused_requests requests with one load and store of every engine, the values are
+    /// the same as the ones of separate generations of the requests.
+    rocrand_status generate_fused(const rocrand_fused_request* requests, size_t count)
+    {
+        rocrand_status status = init();
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        const rocrand_ordering launch_order
+            = get_launch_ordering(m_order, system_type::is_device());
+
+        // The kernel is launched with the config of 32-bit values, the engines of every
+        // request are the ones of its value type
+        generator_config config;
+        const hipError_t error
+            = ConfigProvider::template host_config<unsigned int>(m_stream, launch_order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        // The host threads write the values of consecutive engines, next to each other
+        const unsigned int blocks
+            = get_launch_blocks<system_type>(config.threads, config.blocks, 0, 0);
+
+        return generate_fused_requests<ConfigProvider, default_fused_distributions>(
+            m_stream,
+            get_sequence_ordering(m_order),
+            m_engines_size,
+            requests,
+            count,
+            m_start_engine_id,
+            [&, this](const fused_request_list& list)
+            {
+                status = dynamic_dispatch(
+                    launch_order,
+                    [&, this](auto is_dynamic)
+                    {
+                        return system_type::template launch<
+                            generate_xorwow_fused<ConfigProvider, is_dynamic>,
+                            ConfigProvider,
+                            unsigned int,
+                            is_dynamic>(dim3(blocks),
+                                        dim3(config.threads),
+                                        0,
+                                        m_stream,
+                                        m_engines,
+                                        list);
+                    });
+                return status == ROCRAND_STATUS_SUCCESS ? status : ROCRAND_STATUS_LAUNCH_FAILURE;
+            });
+    }
+
 private:
+    /// Returns the number of engines of the ordering \p order in \p engines_size.
+    rocrand_status get_engines_size(rocrand_ordering order, unsigned int& engines_size) const
+    {
+        hipError_t error
+            = get_least_common_grid_size<ConfigProvider>(m_stream,
+                                                         get_sequence_ordering(order),
+                                                         engines_size);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    /// Allocates the engines for the current ordering without initializing their states.
+    rocrand_status allocate_engines()
+    {
+        const rocrand_status status = get_engines_size(m_order, m_engines_size);
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        if(m_engines != nullptr)
+        {
+            system_type::free(m_engines);
+        }
+        return system_type::alloc(&m_engines, m_engines_size);
+    }
+
+    generator_state_header get_state_header() const
+    {
+        generator_state_header header
+            = make_generator_state_header<engine_type>(type(), m_order, m_engines_size, m_offset);
+        header.seed[0]     = m_seed;
+        header.position[0] = m_start_engine_id;
+        return header;
+    }
+
+    template<class Output, class Distribution>
+    rocrand_status generate_output(Output data, size_t data_size, Distribution distribution)
+    {
+        using T = typename Output::value_type;
+
+        rocrand_status status = init();
+        if (status != ROCRAND_STATUS_SUCCESS)
+        {
+            return status;
+        }
+
+        const rocrand_ordering launch_order
+            = get_launch_ordering(m_order, system_type::is_device());
+
+        generator_config sequence_config;
+        hipError_t       error
+            = ConfigProvider::template host_config<T>(m_stream,
+                                                      get_sequence_ordering(m_order),
+                                                      sequence_config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        const unsigned int num_engines = sequence_config.threads * sequence_config.blocks;
+
+        if(m_order == ROCRAND_ORDERING_PSEUDO_PORTABLE && data.data != nullptr)
+        {
+            status = autotune_portable_blocks<type(), T, ConfigProvider, system_type>(
+                m_stream,
+                m_engines,
+                m_engines_size,
+                [&, this](dim3 blocks, dim3 threads, engine_type* engines, T* scratch, size_t n)
+                {
+                    return system_type::template launch<
+                        generate_xorwow<ConfigProvider, true, dense_output<T>, Distribution>,
+                        ConfigProvider,
+                        T,
+                        true>(blocks,
+                              threads,
+                              0,
+                              m_stream,
+                              engines,
+                              0U,
+                              num_engines,
+                              dense_output<T>{scratch},
+                              n,
+                              distribution);
+                });
+            if(status != ROCRAND_STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+
+        generator_config config;
+        error = ConfigProvider::template host_config<T>(m_stream, launch_order, config);
+        if(error != hipSuccess)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+
+        if(data.data == nullptr)
+        {
+            return ROCRAND_STATUS_SUCCESS;
+        }
+
+        // The host threads write the values of consecutive engines, next to each other
+        const unsigned int blocks
+            = get_launch_blocks<system_type>(config.threads, config.blocks, 0, 0);
+
+        status = dynamic_dispatch(
+            launch_order,
+            [&, this](auto is_dynamic)
+            {
+                return system_type::template launch<
+                    generate_xorwow<ConfigProvider, is_dynamic, Output, Distribution>,
+                    ConfigProvider,
+                    T,
+                    is_dynamic>(dim3(blocks),
+                                dim3(config.threads),
+                                0,
+                                m_stream,
+                                m_engines,
+                                m_start_engine_id,
+                                num_engines,
+                                data,
+                                data_size,
+                                distribution);
+            });
+
+        // Check kernel status
+        if(status != ROCRAND_STATUS_SUCCESS)
+        {
+            return ROCRAND_STATUS_LAUNCH_FAILURE;
+        }
+
+        // Generating data_size values will use this many distributions
+        const auto touched_engines =
+            (data_size + Distribution::output_width - 1) /
+            Distribution::output_width;
+
+        m_start_engine_id = (m_start_engine_id + touched_engines) % m_engines_size;
+
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
     bool         m_engines_initialized = false;
     engine_type* m_engines             = nullptr;
     unsigned int m_start_engine_id     = 0;
     unsigned int m_engines_size        = 0;
 
     unsigned long long m_seed;
+    subsequence_range  m_subsequences;
 
     // For caching of Poisson for consecutive generations with the same lambda
     poisson_distribution_manager_t m_poisson;
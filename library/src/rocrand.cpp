@@ -22,12 +22,31 @@
 
 #include "rng/distribution/discrete.hpp"
 #include "rng/distribution/poisson.hpp"
+#include "rng/engine_state_cache.hpp"
+#include "rng/fused.hpp"
 #include "rng/generator_type.hpp"
 #include "rng/generator_types.hpp"
 
 #include <new>
 #include <rocrand/rocrand.h>
 
+namespace
+{
+
+// Checks the layout of a 2-D output and converts its pitch to elements.
+template<class T>
+rocrand_status get_pitch(size_t pitch_bytes, size_t width, size_t height, size_t& pitch)
+{
+    if(pitch_bytes % sizeof(T) != 0 || (height > 1 && pitch_bytes / sizeof(T) < width))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    pitch = pitch_bytes / sizeof(T);
+    return ROCRAND_STATUS_SUCCESS;
+}
+
+} // namespace
+
 template<bool UseHostFunc>
 rocrand_status create_generator_host(rocrand_generator* generator, rocrand_rng_type rng_type)
 {
@@ -61,6 +80,24 @@ rocrand_status create_generator_host(rocrand_generator* generator, rocrand_rng_t
             case ROCRAND_RNG_PSEUDO_THREEFRY4_64_20:
                 *generator = new generator_type<threefry4x64_20_generator_host<UseHostFunc>>();
                 break;
+            case ROCRAND_RNG_PSEUDO_PHILOX4_64_10:
+                *generator = new generator_type<philox4x64_10_generator_host<UseHostFunc>>();
+                break;
+            case ROCRAND_RNG_PSEUDO_XOSHIRO256PP:
+                *generator = new generator_type<xoshiro256pp_generator_host<UseHostFunc>>();
+                break;
+            case ROCRAND_RNG_PSEUDO_XOROSHIRO128SS:
+                *generator = new generator_type<xoroshiro128ss_generator_host<UseHostFunc>>();
+                break;
+            case ROCRAND_RNG_PSEUDO_PCG64_DXSM:
+                *generator = new generator_type<pcg64_dxsm_generator_host<UseHostFunc>>();
+                break;
+            case ROCRAND_RNG_PSEUDO_SQUARES:
+                *generator = new generator_type<squares_generator_host<UseHostFunc>>();
+                break;
+            case ROCRAND_RNG_PSEUDO_ARS:
+                *generator = new generator_type<ars_generator_host<UseHostFunc>>();
+                break;
             case ROCRAND_RNG_QUASI_DEFAULT:
             case ROCRAND_RNG_QUASI_SOBOL32:
                 *generator = new generator_type<sobol32_generator_host<UseHostFunc>>();
@@ -168,6 +205,21 @@ rocrand_status ROCRANDAPI rocrand_create_generator(rocrand_generator* generator,
             case ROCRAND_RNG_PSEUDO_THREEFRY4_64_20:
                 *generator = new generator_type<threefry4x64_20_generator>();
                 break;
+            case ROCRAND_RNG_PSEUDO_PHILOX4_64_10:
+                *generator = new generator_type<philox4x64_10_generator>();
+                break;
+            case ROCRAND_RNG_PSEUDO_XOSHIRO256PP:
+                *generator = new generator_type<xoshiro256pp_generator>();
+                break;
+            case ROCRAND_RNG_PSEUDO_XOROSHIRO128SS:
+                *generator = new generator_type<xoroshiro128ss_generator>();
+                break;
+            case ROCRAND_RNG_PSEUDO_PCG64_DXSM:
+                *generator = new generator_type<pcg64_dxsm_generator>();
+                break;
+            case ROCRAND_RNG_PSEUDO_SQUARES:
+                *generator = new generator_type<squares_generator>();
+                break;
             default:
                 return ROCRAND_STATUS_TYPE_ERROR;
         }
@@ -233,6 +285,85 @@ rocrand_status ROCRANDAPI rocrand_generate_long_long(rocrand_generator       gen
     return generator->generate_long(output_data, n);
 }
 
+rocrand_status ROCRANDAPI rocrand_generate_range(rocrand_generator  generator,
+                                                 unsigned int*      output_data,
+                                                 unsigned long long first_index,
+                                                 size_t             n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    return generator->generate_int_range(output_data, first_index, n);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_batched(rocrand_generator         generator,
+                                                   unsigned int*             output_data,
+                                                   size_t                    n,
+                                                   size_t                    pitch_bytes,
+                                                   const unsigned long long* seeds,
+                                                   const unsigned long long* offsets,
+                                                   size_t                    batch_size)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(batch_size > 0 && seeds == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    size_t               pitch;
+    const rocrand_status status = get_pitch<unsigned int>(pitch_bytes, n, batch_size, pitch);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    return generator->generate_int_batched(output_data, n, pitch, seeds, offsets, batch_size);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_2d(rocrand_generator generator,
+                                              unsigned int*     output_data,
+                                              size_t            pitch_bytes,
+                                              size_t            width,
+                                              size_t            height)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    size_t               pitch;
+    const rocrand_status status = get_pitch<unsigned int>(pitch_bytes, width, height, pitch);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    return generator->generate_int_2d(output_data, width, height, pitch);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_strided(rocrand_generator generator,
+                                                   unsigned int*     output_data,
+                                                   size_t            stride,
+                                                   size_t            n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(stride == 0 && n > 1)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Every value is a row of its own
+    return generator->generate_int_2d(output_data, 1, n, stride);
+}
+
 rocrand_status ROCRANDAPI rocrand_generate_char(rocrand_generator generator,
                                                 unsigned char*    output_data,
                                                 size_t            n)
@@ -293,6 +424,84 @@ rocrand_status ROCRANDAPI rocrand_generate_uniform_half(rocrand_generator genera
     return generator->generate_uniform_half(output_data, n);
 }
 
+rocrand_status ROCRANDAPI rocrand_generate_uniform_2d(rocrand_generator generator,
+                                                      float*            output_data,
+                                                      size_t            pitch_bytes,
+                                                      size_t            width,
+                                                      size_t            height)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    size_t               pitch;
+    const rocrand_status status = get_pitch<float>(pitch_bytes, width, height, pitch);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    return generator->generate_uniform_float_2d(output_data, width, height, pitch);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_uniform_double_2d(rocrand_generator generator,
+                                                             double*           output_data,
+                                                             size_t            pitch_bytes,
+                                                             size_t            width,
+                                                             size_t            height)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    size_t               pitch;
+    const rocrand_status status = get_pitch<double>(pitch_bytes, width, height, pitch);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    return generator->generate_uniform_double_2d(output_data, width, height, pitch);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_uniform_strided(rocrand_generator generator,
+                                                           float*            output_data,
+                                                           size_t            stride,
+                                                           size_t            n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(stride == 0 && n > 1)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Every value is a row of its own
+    return generator->generate_uniform_float_2d(output_data, 1, n, stride);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_uniform_double_strided(rocrand_generator generator,
+                                                                  double*           output_data,
+                                                                  size_t            stride,
+                                                                  size_t            n)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(stride == 0 && n > 1)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Every value is a row of its own
+    return generator->generate_uniform_double_2d(output_data, 1, n, stride);
+}
+
 rocrand_status ROCRANDAPI rocrand_generate_normal(
     rocrand_generator generator, float* output_data, size_t n, float mean, float stddev)
 {
@@ -315,6 +524,128 @@ rocrand_status ROCRANDAPI rocrand_generate_normal_double(
     return generator->generate_normal_double(output_data, n, mean, stddev);
 }
 
+rocrand_status ROCRANDAPI rocrand_generate_normal_batched(rocrand_generator         generator,
+                                                          float*                    output_data,
+                                                          size_t                    n,
+                                                          size_t                    pitch_bytes,
+                                                          const unsigned long long* seeds,
+                                                          const unsigned long long* offsets,
+                                                          size_t                    batch_size,
+                                                          float                     mean,
+                                                          float                     stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(batch_size > 0 && seeds == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    size_t               pitch;
+    const rocrand_status status = get_pitch<float>(pitch_bytes, n, batch_size, pitch);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    return generator->generate_normal_float_batched(output_data,
+                                                    n,
+                                                    pitch,
+                                                    seeds,
+                                                    offsets,
+                                                    batch_size,
+                                                    mean,
+                                                    stddev);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_normal_2d(rocrand_generator generator,
+                                                     float*            output_data,
+                                                     size_t            pitch_bytes,
+                                                     size_t            width,
+                                                     size_t            height,
+                                                     float             mean,
+                                                     float             stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    size_t               pitch;
+    const rocrand_status status = get_pitch<float>(pitch_bytes, width, height, pitch);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    return generator->generate_normal_float_2d(output_data, width, height, pitch, mean, stddev);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_normal_double_2d(rocrand_generator generator,
+                                                            double*           output_data,
+                                                            size_t            pitch_bytes,
+                                                            size_t            width,
+                                                            size_t            height,
+                                                            double            mean,
+                                                            double            stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    size_t               pitch;
+    const rocrand_status status = get_pitch<double>(pitch_bytes, width, height, pitch);
+    if(status != ROCRAND_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    return generator->generate_normal_double_2d(output_data, width, height, pitch, mean, stddev);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_normal_strided(rocrand_generator generator,
+                                                          float*            output_data,
+                                                          size_t            stride,
+                                                          size_t            n,
+                                                          float             mean,
+                                                          float             stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(stride == 0 && n > 1)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Every value is a row of its own
+    return generator->generate_normal_float_2d(output_data, 1, n, stride, mean, stddev);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_normal_double_strided(rocrand_generator generator,
+                                                                 double*           output_data,
+                                                                 size_t            stride,
+                                                                 size_t            n,
+                                                                 double            mean,
+                                                                 double            stddev)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(stride == 0 && n > 1)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    // Every value is a row of its own
+    return generator->generate_normal_double_2d(output_data, 1, n, stride, mean, stddev);
+}
+
 rocrand_status ROCRANDAPI rocrand_generate_normal_half(
     rocrand_generator generator, half* output_data, size_t n, half mean, half stddev)
 {
@@ -376,6 +707,192 @@ rocrand_status ROCRANDAPI rocrand_generate_poisson(rocrand_generator generator,
     return generator->generate_poisson(output_data, n, lambda);
 }
 
+rocrand_status ROCRANDAPI rocrand_generate_binomial(rocrand_generator generator,
+                                                    unsigned int*     output_data,
+                                                    size_t            n,
+                                                    unsigned int      trials,
+                                                    double            p)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(p >= 0.0 && p <= 1.0))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->generate_binomial(output_data, n, trials, p);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_geometric(rocrand_generator generator,
+                                                     unsigned int*     output_data,
+                                                     size_t            n,
+                                                     double            p)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(p > 0.0 && p <= 1.0))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->generate_geometric(output_data, n, p);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_exponential(rocrand_generator generator,
+                                                       float*            output_data,
+                                                       size_t            n,
+                                                       float             lambda)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(lambda > 0.0f))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->generate_exponential_float(output_data, n, lambda);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_exponential_double(rocrand_generator generator,
+                                                              double*           output_data,
+                                                              size_t            n,
+                                                              double            lambda)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(lambda > 0.0))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->generate_exponential_double(output_data, n, lambda);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_gamma(
+    rocrand_generator generator, float* output_data, size_t n, float shape, float scale)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(shape > 0.0f) || !(scale > 0.0f))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->generate_gamma_float(output_data, n, shape, scale);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_gamma_double(
+    rocrand_generator generator, double* output_data, size_t n, double shape, double scale)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(shape > 0.0) || !(scale > 0.0))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->generate_gamma_double(output_data, n, shape, scale);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_beta(
+    rocrand_generator generator, float* output_data, size_t n, float alpha, float beta)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(alpha > 0.0f) || !(beta > 0.0f))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->generate_beta_float(output_data, n, alpha, beta);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_beta_double(
+    rocrand_generator generator, double* output_data, size_t n, double alpha, double beta)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(alpha > 0.0) || !(beta > 0.0))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->generate_beta_double(output_data, n, alpha, beta);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_brownian_bridge(rocrand_generator generator,
+                                                           float*            output_data,
+                                                           size_t            n,
+                                                           float             time_step)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(time_step > 0.0f))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->generate_brownian_bridge_float(output_data, n, time_step);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_brownian_bridge_double(rocrand_generator generator,
+                                                                  double*           output_data,
+                                                                  size_t            n,
+                                                                  double            time_step)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(!(time_step > 0.0))
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->generate_brownian_bridge_double(output_data, n, time_step);
+}
+
+rocrand_status ROCRANDAPI rocrand_generate_fused(rocrand_generator            generator,
+                                                 const rocrand_fused_request* requests,
+                                                 size_t                       count)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(requests == NULL && count > 0)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+    for(size_t i = 0; i < count; i++)
+    {
+        if(!rocrand_impl::host::is_fused_distribution(requests[i].distribution))
+        {
+            return ROCRAND_STATUS_OUT_OF_RANGE;
+        }
+    }
+
+    return generator->generate_fused(requests, count);
+}
+
 rocrand_status ROCRANDAPI rocrand_initialize_generator(rocrand_generator generator)
 {
     if(generator == NULL)
@@ -437,6 +954,28 @@ rocrand_status ROCRANDAPI rocrand_set_ordering(rocrand_generator generator, rocr
     return generator->set_order(order);
 }
 
+rocrand_status ROCRANDAPI rocrand_set_subsequence_length(rocrand_generator  generator,
+                                                         unsigned long long length)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    return generator->set_subsequence_length(length);
+}
+
+rocrand_status ROCRANDAPI rocrand_set_host_launch_blocks(rocrand_generator generator,
+                                                         unsigned int      blocks)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    return generator->set_host_launch_blocks(blocks);
+}
+
 rocrand_status ROCRANDAPI rocrand_set_quasi_random_generator_dimensions(rocrand_generator generator,
                                                                         unsigned int dimensions)
 {
@@ -448,6 +987,92 @@ rocrand_status ROCRANDAPI rocrand_set_quasi_random_generator_dimensions(rocrand_
     return generator->set_dimensions(dimensions);
 }
 
+rocrand_status ROCRANDAPI rocrand_set_quasi_random_layout(rocrand_generator           generator,
+                                                          rocrand_quasi_random_layout layout)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+
+    return generator->set_layout(layout);
+}
+
+rocrand_status ROCRANDAPI rocrand_get_state_size(rocrand_generator generator, size_t* size)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(size == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->get_state_size(*size);
+}
+
+rocrand_status ROCRANDAPI rocrand_save_state(rocrand_generator generator, void* state)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(state == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->save_state(state);
+}
+
+rocrand_status ROCRANDAPI rocrand_load_state(rocrand_generator generator, const void* state)
+{
+    if(generator == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(state == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    return generator->load_state(state);
+}
+
+rocrand_status ROCRANDAPI rocrand_generator_split(rocrand_generator  parent,
+                                                  unsigned int       count,
+                                                  rocrand_generator* children)
+{
+    if(parent == NULL)
+    {
+        return ROCRAND_STATUS_NOT_CREATED;
+    }
+    if(count == 0 || children == NULL)
+    {
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    }
+
+    try
+    {
+        return parent->split(count, children);
+    }
+    catch(const std::bad_alloc& e)
+    {
+        return ROCRAND_STATUS_INTERNAL_ERROR;
+    }
+    catch(rocrand_status status)
+    {
+        return status;
+    }
+}
+
+rocrand_status ROCRANDAPI rocrand_set_engine_state_cache_size(size_t size)
+{
+    rocrand_impl::host::engine_state_cache::instance().set_max_size(size);
+    return ROCRAND_STATUS_SUCCESS;
+}
+
 rocrand_status ROCRANDAPI rocrand_get_version(int* version)
 {
     if(version == NULL)
@@ -76,6 +76,12 @@ ROCRAND_RNG_PSEUDO_THREEFRY2_32_20 = 408
 ROCRAND_RNG_PSEUDO_THREEFRY2_64_20 = 409
 ROCRAND_RNG_PSEUDO_THREEFRY4_32_20 = 410
 ROCRAND_RNG_PSEUDO_THREEFRY4_64_20 = 411
+ROCRAND_RNG_PSEUDO_PHILOX4_64_10 = 412
+ROCRAND_RNG_PSEUDO_XOSHIRO256PP = 413
+ROCRAND_RNG_PSEUDO_XOROSHIRO128SS = 414
+ROCRAND_RNG_PSEUDO_PCG64_DXSM = 415
+ROCRAND_RNG_PSEUDO_SQUARES = 416
+ROCRAND_RNG_PSEUDO_ARS = 417
 ROCRAND_RNG_QUASI_DEFAULT = 500
 ROCRAND_RNG_QUASI_SOBOL32 = 501
 ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32 = 502
@@ -381,6 +387,18 @@ class PRNG(RNG):
     """THREEFRY4_32_20 pseudo-random generator type"""
     THREEFRY4_64_20 = ROCRAND_RNG_PSEUDO_THREEFRY4_64_20
     """THREEFRY4_64_20 pseudo-random generator type"""
+    PHILOX4_64_10   = ROCRAND_RNG_PSEUDO_PHILOX4_64_10
+    """PHILOX_4x64 (10 rounds) pseudo-random generator type"""
+    XOSHIRO256PP    = ROCRAND_RNG_PSEUDO_XOSHIRO256PP
+    """XOSHIRO256PP (xoshiro256++) pseudo-random generator type"""
+    XOROSHIRO128SS  = ROCRAND_RNG_PSEUDO_XOROSHIRO128SS
+    """XOROSHIRO128SS (xoroshiro128**) pseudo-random generator type"""
+    PCG64_DXSM      = ROCRAND_RNG_PSEUDO_PCG64_DXSM
+    """PCG64_DXSM (NumPy's PCG64DXSM) pseudo-random generator type"""
+    SQUARES         = ROCRAND_RNG_PSEUDO_SQUARES
+    """SQUARES (counter-based) pseudo-random generator type"""
+    ARS             = ROCRAND_RNG_PSEUDO_ARS
+    """ARS (AES rounds, counter-based) pseudo-random generator type, host only"""
 
     def __init__(self, rngtype=DEFAULT, seed=None, offset=None, stream=None, is_host=False):
         """Creates a new pseudo-random number generator.
@@ -404,6 +422,12 @@ class PRNG(RNG):
         * :const:`THREEFRY2_64_20`
         * :const:`THREEFRY4_32_20`
         * :const:`THREEFRY4_64_20`
+        * :const:`PHILOX4_64_10`
+        * :const:`XOSHIRO256PP`
+        * :const:`XOROSHIRO128SS`
+        * :const:`PCG64_DXSM`
+        * :const:`SQUARES`
+        * :const:`ARS` (only with **is_host**)
 
         :param rngtype: Type of pseudo-random number generator to create
         :param seed:    Initial seed value
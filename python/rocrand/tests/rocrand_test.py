@@ -68,6 +68,11 @@ make_test(TestCtorPRNG, "THREEFRY2_32_20", rngtype=PRNG.THREEFRY2_32_20)
 make_test(TestCtorPRNG, "THREEFRY2_64_20", rngtype=PRNG.THREEFRY2_64_20)
 make_test(TestCtorPRNG, "THREEFRY4_32_20", rngtype=PRNG.THREEFRY4_32_20)
 make_test(TestCtorPRNG, "THREEFRY4_64_20", rngtype=PRNG.THREEFRY4_64_20)
+make_test(TestCtorPRNG, "PHILOX4_64_10",   rngtype=PRNG.PHILOX4_64_10)
+make_test(TestCtorPRNG, "XOSHIRO256PP",    rngtype=PRNG.XOSHIRO256PP)
+make_test(TestCtorPRNG, "XOROSHIRO128SS",  rngtype=PRNG.XOROSHIRO128SS)
+make_test(TestCtorPRNG, "PCG64_DXSM",      rngtype=PRNG.PCG64_DXSM)
+make_test(TestCtorPRNG, "SQUARES",         rngtype=PRNG.SQUARES)
 
 class TestCtorPRNGMT(TestRNGBase):
     def test_ctor(self):
@@ -126,6 +131,11 @@ make_test(TestParamsPRNG, "THREEFRY2_32_20", rngtype=PRNG.THREEFRY2_32_20)
 make_test(TestParamsPRNG, "THREEFRY2_64_20", rngtype=PRNG.THREEFRY2_64_20)
 make_test(TestParamsPRNG, "THREEFRY4_32_20", rngtype=PRNG.THREEFRY4_32_20)
 make_test(TestParamsPRNG, "THREEFRY4_64_20", rngtype=PRNG.THREEFRY4_64_20)
+make_test(TestParamsPRNG, "PHILOX4_64_10",   rngtype=PRNG.PHILOX4_64_10)
+make_test(TestParamsPRNG, "XOSHIRO256PP",    rngtype=PRNG.XOSHIRO256PP)
+make_test(TestParamsPRNG, "XOROSHIRO128SS",  rngtype=PRNG.XOROSHIRO128SS)
+make_test(TestParamsPRNG, "PCG64_DXSM",      rngtype=PRNG.PCG64_DXSM)
+make_test(TestParamsPRNG, "SQUARES",         rngtype=PRNG.SQUARES)
 
 class TestParamsPRNGMT(TestRNGBase):
     def setUp(self):
@@ -315,6 +325,17 @@ make_test(TestGenerate, "PRNG" + "THREEFRY2_32_20",        klass=PRNG, rngtype=P
 make_test(TestGenerate, "PRNG" + "THREEFRY2_64_20",        klass=PRNG, rngtype=PRNG.THREEFRY2_64_20,    is_host=False)
 make_test(TestGenerate, "PRNG" + "THREEFRY4_32_20",        klass=PRNG, rngtype=PRNG.THREEFRY4_32_20,    is_host=False)
 make_test(TestGenerate, "PRNG" + "THREEFRY4_64_20",        klass=PRNG, rngtype=PRNG.THREEFRY4_64_20,    is_host=False)
+make_test(TestGenerate, "PRNG" + "PHILOX4_64_10",          klass=PRNG, rngtype=PRNG.PHILOX4_64_10,      is_host=False)
+make_test(TestGenerate, "PRNG" + "PHILOX4_64_10_host",     klass=PRNG, rngtype=PRNG.PHILOX4_64_10,      is_host=True)
+make_test(TestGenerate, "PRNG" + "XOSHIRO256PP",           klass=PRNG, rngtype=PRNG.XOSHIRO256PP,       is_host=False)
+make_test(TestGenerate, "PRNG" + "XOSHIRO256PP_host",      klass=PRNG, rngtype=PRNG.XOSHIRO256PP,       is_host=True)
+make_test(TestGenerate, "PRNG" + "XOROSHIRO128SS",         klass=PRNG, rngtype=PRNG.XOROSHIRO128SS,     is_host=False)
+make_test(TestGenerate, "PRNG" + "XOROSHIRO128SS_host",    klass=PRNG, rngtype=PRNG.XOROSHIRO128SS,     is_host=True)
+make_test(TestGenerate, "PRNG" + "PCG64_DXSM",             klass=PRNG, rngtype=PRNG.PCG64_DXSM,         is_host=False)
+make_test(TestGenerate, "PRNG" + "PCG64_DXSM_host",        klass=PRNG, rngtype=PRNG.PCG64_DXSM,         is_host=True)
+make_test(TestGenerate, "PRNG" + "SQUARES",                klass=PRNG, rngtype=PRNG.SQUARES,            is_host=False)
+make_test(TestGenerate, "PRNG" + "SQUARES_host",           klass=PRNG, rngtype=PRNG.SQUARES,            is_host=True)
+make_test(TestGenerate, "PRNG" + "ARS_host",               klass=PRNG, rngtype=PRNG.ARS,                is_host=True)
 
 
 if __name__ == "__main__":
@@ -52,7 +52,7 @@ def load_benchmark_result_json(path: str) -> DataFrame:
 
     # Extract the groups of the regex match to a DataFrame
     
-    name_regex = r'^(?P<generator>\S+?)_(?P<distribution>uniform|normal|log_normal|poisson)_(?P<value_type>(unsigned_)?(int|short|char|long_long|float|half|double))_t(?P<block_size>\d+)_b(?P<grid_size>\d+)'
+    name_regex = r'^(?P<generator>\S+?)_(?P<distribution>uniform|normal|log_normal|poisson|exponential|gamma|beta)_(?P<value_type>(unsigned_)?(int|short|char|long_long|float|half|double))_t(?P<block_size>\d+)_b(?P<grid_size>\d+)'
 
     extracted_data = benchmark_data['name'].str.extract(name_regex)
     extracted_data['block_size'] = extracted_data['block_size'].astype(int)
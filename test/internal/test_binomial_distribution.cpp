@@ -0,0 +1,241 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+#include <cmath>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <rng/distribution/binomial.hpp>
+#include <rng/distribution/geometric.hpp>
+
+using namespace rocrand_impl::host;
+
+template<class Distribution, class = void>
+struct has_sampler : std::false_type
+{};
+
+template<class Distribution>
+struct has_sampler<Distribution, std::void_t<decltype(Distribution::sampler)>> : std::true_type
+{};
+
+template<class Distribution, class Dis>
+std::vector<unsigned int> generate_values(const Distribution& d, Dis& dis, const size_t size)
+{
+    std::mt19937_64 gen(4321);
+
+    constexpr unsigned int input_width  = Distribution::input_width;
+    constexpr unsigned int output_width = Distribution::output_width;
+
+    std::vector<unsigned int> values;
+    while(values.size() < size)
+    {
+        typename Dis::result_type input[input_width];
+        unsigned int              output[output_width];
+        for(unsigned int j = 0; j < input_width; j++)
+        {
+            input[j] = dis(gen);
+        }
+        d(input, output);
+        if constexpr(has_sampler<Distribution>::value)
+        {
+            for(unsigned int j = 0; j < output_width; j++)
+            {
+                // The distribution makes further attempts until one is accepted
+                EXPECT_FALSE(d.sampler.is_rejected(output[j]));
+            }
+        }
+        values.insert(values.end(), output, output + output_width);
+    }
+    return values;
+}
+
+double binomial_pmf(const unsigned int n, const double p, const unsigned int k)
+{
+    return std::exp(std::lgamma(n + 1.0) - std::lgamma(k + 1.0) - std::lgamma(n - k + 1.0)
+                    + k * std::log(p) + (n - k) * std::log1p(-p));
+}
+
+// Chi-squared test of the histogram of the values against the probability mass function,
+// neighboring bins are merged until their expected count is at least 20.
+void check_binomial(const std::vector<unsigned int>& values, const unsigned int n, const double p)
+{
+    std::vector<double> histogram(n + 1, 0.0);
+    for(const unsigned int v : values)
+    {
+        ASSERT_LE(v, n);
+        histogram[v]++;
+    }
+
+    double chi_squared = 0.0;
+    int    bins        = 0;
+    double expected    = 0.0;
+    double observed    = 0.0;
+    for(unsigned int k = 0; k <= n; k++)
+    {
+        expected += binomial_pmf(n, p, k) * values.size();
+        observed += histogram[k];
+        if(expected >= 20.0 || (k == n && expected > 0.0))
+        {
+            chi_squared += (observed - expected) * (observed - expected) / expected;
+            bins++;
+            expected = 0.0;
+            observed = 0.0;
+        }
+    }
+    // Critical value of the chi-squared distribution for a significance level of 0.001
+    const double dof      = std::max(bins - 1, 1);
+    const double critical = dof + 3.09 * std::sqrt(2.0 * dof) + 4.0;
+    EXPECT_LT(chi_squared, critical);
+}
+
+template<class Input>
+struct binomial_distribution_tests : public ::testing::Test
+{
+    using input_type = Input;
+};
+
+using binomial_distribution_test_types = ::testing::Types<unsigned int, unsigned long long>;
+
+TYPED_TEST_SUITE(binomial_distribution_tests, binomial_distribution_test_types);
+
+TYPED_TEST(binomial_distribution_tests, binomial_test)
+{
+    using Input = typename TestFixture::input_type;
+
+    std::uniform_int_distribution<Input> dis;
+    // Inversion, BTRD with the recursive evaluation and with the squeeze, and the complementary
+    // probability of both methods
+    const std::pair<unsigned int, double> params[]
+        = {{1, 0.5}, {10, 0.3}, {40, 0.5}, {300, 0.2}, {3000, 0.6}, {25, 0.97}};
+    for(const auto& [n, p] : params)
+    {
+        SCOPED_TRACE(testing::Message() << "with n = " << n << ", p = " << p);
+
+        binomial_distribution<Input> d(n, p);
+        check_binomial(generate_values(d, dis, 200000), n, p);
+    }
+}
+
+TEST(binomial_distribution_tests, degenerate_test)
+{
+    std::uniform_int_distribution<unsigned int> dis;
+    for(const unsigned int v : generate_values(binomial_distribution<>(0, 0.5), dis, 1000))
+    {
+        ASSERT_EQ(v, 0U);
+    }
+    for(const unsigned int v : generate_values(binomial_distribution<>(100, 0.0), dis, 1000))
+    {
+        ASSERT_EQ(v, 0U);
+    }
+    for(const unsigned int v : generate_values(binomial_distribution<>(100, 1.0), dis, 1000))
+    {
+        ASSERT_EQ(v, 100U);
+    }
+}
+
+TEST(binomial_distribution_tests, mrg_test)
+{
+    std::uniform_int_distribution<unsigned int> dis(1, ROCRAND_MRG32K3A_M1);
+
+    mrg_engine_binomial_distribution<rocrand_state_mrg32k3a> d(500, 0.1);
+    check_binomial(generate_values(d, dis, 200000), 500, 0.1);
+}
+
+TEST(binomial_distribution_tests, sobol_test)
+{
+    // Single-value inversion for small n * p and the normal approximation for large n * p
+    const std::pair<unsigned int, double> params[] = {{30, 0.4}, {900, 0.75}};
+    for(const auto& [n, p] : params)
+    {
+        SCOPED_TRACE(testing::Message() << "with n = " << n << ", p = " << p);
+
+        sobol_binomial_distribution d(n, p);
+        std::vector<unsigned int>   values;
+        // Equally spaced values stand in for a low-discrepancy sequence
+        const unsigned int size = 100000;
+        for(unsigned int i = 0; i < size; i++)
+        {
+            values.push_back(d(static_cast<unsigned int>((i + 0.5) / size * 4294967296.0)));
+        }
+        double mean = 0.0;
+        for(const unsigned int v : values)
+        {
+            ASSERT_LE(v, n);
+            mean += v;
+        }
+        mean /= size;
+        EXPECT_NEAR(mean, n * p, 0.01 * n * p);
+    }
+}
+
+TEST(binomial_distribution_tests, rejected_value_test)
+{
+    // The largest n with a probability close to 1 returns the value that marks rejected
+    // attempts for other parameters
+    std::uniform_int_distribution<unsigned int> dis;
+    const unsigned int                          n = ~0u;
+    for(const unsigned int v : generate_values(binomial_distribution<>(n, 1.0), dis, 1000))
+    {
+        ASSERT_EQ(v, n);
+    }
+    double mean = 0.0;
+    for(const unsigned int v : generate_values(binomial_distribution<>(n, 1.0 - 1e-9), dis, 10000))
+    {
+        ASSERT_LE(n - v, 40U);
+        mean += n - v;
+    }
+    mean /= 10000;
+    EXPECT_NEAR(mean, n * 1e-9, 0.2);
+}
+
+TEST(binomial_distribution_tests, geometric_test)
+{
+    std::uniform_int_distribution<unsigned int> dis;
+    for(const double p : {1.0, 0.5, 0.1, 0.001})
+    {
+        SCOPED_TRACE(testing::Message() << "with p = " << p);
+
+        geometric_distribution<> d(p);
+        const std::vector<unsigned int> values = generate_values(d, dis, 200000);
+
+        double mean = 0.0;
+        for(const unsigned int v : values)
+        {
+            ASSERT_GE(v, 1U);
+            mean += v;
+        }
+        mean /= values.size();
+
+        double var = 0.0;
+        for(const unsigned int v : values)
+        {
+            var += (v - mean) * (v - mean);
+        }
+        var /= values.size();
+
+        EXPECT_NEAR(mean, 1.0 / p, 0.02 / p);
+        EXPECT_NEAR(var, (1.0 - p) / (p * p), 0.05 / (p * p));
+    }
+}
@@ -0,0 +1,106 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+#include <random>
+
+#include <rng/distribution/exponential.hpp>
+
+using namespace rocrand_impl::host;
+
+template<class T, class Distribution, class Dis>
+void test_exponential_moments(Distribution& d, Dis& dis, const T lambda)
+{
+    std::mt19937 gen(1234);
+
+    constexpr unsigned int input_width = Distribution::input_width;
+
+    const size_t size = 40000;
+    double       mean = 0.0;
+    double       sq   = 0.0;
+    for(size_t i = 0; i < size; i++)
+    {
+        typename Dis::result_type input[input_width];
+        T                         output[1];
+        for(unsigned int j = 0; j < input_width; j++)
+        {
+            input[j] = dis(gen);
+        }
+        d(input, output);
+        ASSERT_GE(output[0], T(0));
+        mean += output[0];
+        sq += output[0] * output[0];
+    }
+    mean /= size;
+    const double std = std::sqrt(sq / size - mean * mean);
+
+    EXPECT_NEAR(1.0 / lambda, mean, 0.05 / lambda);
+    EXPECT_NEAR(1.0 / lambda, std, 0.05 / lambda);
+}
+
+TEST(exponential_distribution_tests, float_test)
+{
+    std::uniform_int_distribution<unsigned int> dis;
+    exponential_distribution<float>             d(2.0f);
+    test_exponential_moments(d, dis, 2.0f);
+}
+
+TEST(exponential_distribution_tests, double_test)
+{
+    std::uniform_int_distribution<unsigned int> dis;
+    exponential_distribution<double>            d(0.5);
+    test_exponential_moments(d, dis, 0.5);
+}
+
+TEST(exponential_distribution_tests, float_ull_test)
+{
+    std::uniform_int_distribution<unsigned long long>   dis;
+    exponential_distribution<float, unsigned long long> d(2.0f);
+    test_exponential_moments(d, dis, 2.0f);
+}
+
+TEST(exponential_distribution_tests, double_ull_test)
+{
+    std::uniform_int_distribution<unsigned long long>    dis;
+    exponential_distribution<double, unsigned long long> d(0.5);
+    test_exponential_moments(d, dis, 0.5);
+}
+
+TEST(exponential_distribution_tests, mrg_test)
+{
+    std::uniform_int_distribution<unsigned int> dis(1, ROCRAND_MRG32K3A_M1);
+    mrg_engine_exponential_distribution<double, rocrand_state_mrg32k3a> d(3.0);
+    test_exponential_moments(d, dis, 3.0);
+}
+
+TEST(exponential_distribution_tests, extreme_inputs_test)
+{
+    exponential_distribution<float> d(1.0f);
+    for(const unsigned int v : {0U, 1U, 0xFFFFFFFFU})
+    {
+        const unsigned int input[1] = {v};
+        float              output[1];
+        d(input, output);
+        EXPECT_TRUE(std::isfinite(output[0]));
+        EXPECT_GE(output[0], 0.0f);
+    }
+}
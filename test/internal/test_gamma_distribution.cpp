@@ -0,0 +1,217 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+#include <random>
+#include <vector>
+
+#include <rng/distribution/beta.hpp>
+#include <rng/distribution/gamma.hpp>
+
+using namespace rocrand_impl::host;
+
+template<class T, class Distribution, class Dis>
+std::vector<T> generate_values(const Distribution& d, Dis& dis, const size_t size)
+{
+    std::mt19937 gen(4321);
+
+    constexpr unsigned int input_width  = Distribution::input_width;
+    constexpr unsigned int output_width = Distribution::output_width;
+
+    std::vector<T> values;
+    while(values.size() < size)
+    {
+        typename Dis::result_type input[input_width];
+        T                         output[output_width];
+        for(unsigned int j = 0; j < input_width; j++)
+        {
+            input[j] = dis(gen);
+        }
+        d(input, output);
+        for(unsigned int j = 0; j < output_width; j++)
+        {
+            // The distribution makes further attempts until one is accepted
+            EXPECT_FALSE(d.sampler.is_rejected(output[j]));
+        }
+        values.insert(values.end(), output, output + output_width);
+    }
+    return values;
+}
+
+template<class T>
+void check_moments(const std::vector<T>& values, const double mean, const double var)
+{
+    double actual_mean = 0.0;
+    for(const T v : values)
+    {
+        ASSERT_TRUE(std::isfinite(v));
+        actual_mean += v;
+    }
+    actual_mean /= values.size();
+
+    double actual_var = 0.0;
+    for(const T v : values)
+    {
+        actual_var += (v - actual_mean) * (v - actual_mean);
+    }
+    actual_var /= values.size();
+
+    EXPECT_NEAR(mean, actual_mean, mean * 0.05);
+    EXPECT_NEAR(var, actual_var, var * 0.1);
+}
+
+template<class T, class Input>
+struct gamma_distribution_test_type
+{
+    using value_type = T;
+    using input_type = Input;
+};
+
+template<class TestType>
+struct gamma_distribution_tests : public ::testing::Test
+{
+    using value_type = typename TestType::value_type;
+    using input_type = typename TestType::input_type;
+};
+
+using gamma_distribution_test_types
+    = ::testing::Types<gamma_distribution_test_type<float, unsigned int>,
+                       gamma_distribution_test_type<double, unsigned int>,
+                       gamma_distribution_test_type<float, unsigned long long>,
+                       gamma_distribution_test_type<double, unsigned long long>>;
+
+TYPED_TEST_SUITE(gamma_distribution_tests, gamma_distribution_test_types);
+
+TYPED_TEST(gamma_distribution_tests, gamma_test)
+{
+    using T     = typename TestFixture::value_type;
+    using Input = typename TestFixture::input_type;
+
+    std::uniform_int_distribution<Input> dis;
+    for(const double shape : {0.1, 0.5, 1.0, 3.0, 50.0})
+    {
+        SCOPED_TRACE(testing::Message() << "with shape = " << shape);
+
+        const double                 scale = 1.5;
+        gamma_distribution<T, Input> d(shape, scale);
+        const std::vector<T>         values = generate_values<T>(d, dis, 40000);
+        for(const T v : values)
+        {
+            ASSERT_GE(v, T(0));
+        }
+        check_moments(values, shape * scale, shape * scale * scale);
+    }
+}
+
+TYPED_TEST(gamma_distribution_tests, beta_test)
+{
+    using T     = typename TestFixture::value_type;
+    using Input = typename TestFixture::input_type;
+
+    std::uniform_int_distribution<Input> dis;
+    for(const auto& [alpha, beta] : {std::pair{0.5, 0.5},
+                                     std::pair{2.0, 5.0},
+                                     std::pair{5.0, 2.0},
+                                     std::pair{0.2, 1.0},
+                                     std::pair{3.0, 0.4}})
+    {
+        SCOPED_TRACE(testing::Message() << "with alpha = " << alpha << ", beta = " << beta);
+
+        beta_distribution<T, Input> d(alpha, beta);
+        const std::vector<T>        values = generate_values<T>(d, dis, 40000);
+        for(const T v : values)
+        {
+            ASSERT_GE(v, T(0));
+            ASSERT_LE(v, T(1));
+        }
+        check_moments(values,
+                      alpha / (alpha + beta),
+                      alpha * beta / ((alpha + beta) * (alpha + beta) * (alpha + beta + 1)));
+    }
+}
+
+TEST(gamma_distribution_tests, mrg_test)
+{
+    std::uniform_int_distribution<unsigned int> dis(1, ROCRAND_MRG31K3P_M1);
+
+    mrg_engine_gamma_distribution<float, rocrand_state_mrg31k3p> gamma(0.7f, 2.0f);
+    check_moments(generate_values<float>(gamma, dis, 40000), 0.7 * 2.0, 0.7 * 2.0 * 2.0);
+
+    mrg_engine_beta_distribution<double, rocrand_state_mrg31k3p> beta(2.0, 3.0);
+    check_moments(generate_values<double>(beta, dis, 40000), 2.0 / 5.0, 6.0 / (25.0 * 6.0));
+}
+
+TEST(gamma_distribution_tests, acceptance_test)
+{
+    // Most outputs are accepted in the first attempt, which uses the inputs of the distribution
+    std::mt19937                                gen(1234);
+    std::uniform_int_distribution<unsigned int> dis;
+
+    const auto acceptance = [&](const auto& d)
+    {
+        unsigned int accepted = 0;
+        for(unsigned int i = 0; i < 10000; i++)
+        {
+            const float u = rocrand_device::detail::uniform_distribution(dis(gen));
+            const float v = rocrand_device::detail::uniform_distribution(dis(gen));
+            accepted += d.sampler.is_rejected(d.sampler.attempt(u, v)) ? 0 : 1;
+        }
+        return accepted / 10000.0;
+    };
+
+    EXPECT_GT(acceptance(gamma_distribution<float>(0.3f, 1.0f)), 0.7);
+    EXPECT_GT(acceptance(gamma_distribution<float>(3.0f, 1.0f)), 0.9);
+    EXPECT_GT(acceptance(beta_distribution<float>(0.5f, 0.5f)), 0.5);
+    EXPECT_GT(acceptance(beta_distribution<float>(2.0f, 5.0f)), 0.7);
+}
+
+TEST(gamma_distribution_tests, retry_test)
+{
+    // The further attempts of a rejected output only depend on the inputs of the first attempt
+    std::mt19937                                gen(1234);
+    std::uniform_int_distribution<unsigned int> dis;
+
+    const gamma_distribution<float> d(0.3f, 1.0f);
+
+    std::vector<float> retried;
+    while(retried.size() < 20000)
+    {
+        const unsigned int input[2] = {dis(gen), dis(gen)};
+        const float        u        = rocrand_device::detail::uniform_distribution(input[0]);
+        const float        v        = rocrand_device::detail::uniform_distribution(input[1]);
+        if(!d.sampler.is_rejected(d.sampler.attempt(u, v)))
+        {
+            continue;
+        }
+
+        float output[1];
+        float again[1];
+        d(input, output);
+        d(input, again);
+        ASSERT_FALSE(d.sampler.is_rejected(output[0]));
+        ASSERT_EQ(output[0], again[0]);
+        retried.push_back(output[0]);
+    }
+
+    // The further attempts follow the distribution
+    check_moments(retried, 0.3, 0.3);
+}
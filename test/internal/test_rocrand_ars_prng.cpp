@@ -0,0 +1,185 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+#include <rocrand/rocrand.h>
+
+#include <rng/ars.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using rocrand_impl::host::ars_generate_blocks_scalar;
+using rocrand_impl::host::ars_generator_host;
+
+namespace
+{
+
+std::vector<unsigned int> ars_reference(const unsigned long long key,
+                                        const unsigned long long offset,
+                                        const size_t             size)
+{
+    const unsigned long long first_block = offset / 4;
+    const size_t             blocks      = (offset % 4 + size + 3) / 4;
+
+    std::vector<unsigned int> values(blocks * 4);
+    ars_generate_blocks_scalar(key, first_block, blocks, values.data());
+    return std::vector<unsigned int>(values.begin() + offset % 4,
+                                     values.begin() + offset % 4 + size);
+}
+
+} // namespace
+
+// Reference values of the portable implementation. They match the AES-NI implementation,
+// which uses the AES round instructions directly, see implementations_test.
+TEST(ars_prng_tests, known_answer_test)
+{
+    struct known_answer
+    {
+        unsigned long long key;
+        unsigned long long block;
+        unsigned int       values[4];
+    };
+
+    const known_answer known_answers[] = {
+        {                 0ULL,         0ULL, {0x7ecce06f, 0x7cdc3bca, 0x15513c87, 0x29d24c9b}},
+        {                 0ULL, 123456789ULL, {0x3738fe02, 0x45379500, 0x14266a6d, 0xbfba229a}},
+        {0xdeadbeefcafebabeULL,         0ULL, {0x2138eb46, 0x03977b9d, 0xcb6898b4, 0x9c29ad4e}},
+        {0xdeadbeefcafebabeULL, 123456789ULL, {0x9ca2e09c, 0x728c55d5, 0xc997b1a3, 0x207ab85c}},
+    };
+
+    for(const known_answer& k : known_answers)
+    {
+        unsigned int values[4];
+        ars_generate_blocks_scalar(k.key, k.block, 1, values);
+        for(unsigned int i = 0; i < 4; i++)
+        {
+            EXPECT_EQ(values[i], k.values[i]);
+        }
+    }
+}
+
+// All implementations supported by the CPU must produce the same values.
+TEST(ars_prng_tests, implementations_test)
+{
+#ifdef ROCRAND_ARS_X86_AES
+    const unsigned long long keys[]         = {0ULL, 0xdeadbeefcafebabeULL};
+    const unsigned long long first_blocks[] = {0ULL, 5ULL, 0xFFFFFFFFFFFFFFF0ULL};
+    const size_t             sizes[]        = {1, 7, 8, 37};
+
+    for(const unsigned long long key : keys)
+    {
+        for(const unsigned long long first_block : first_blocks)
+        {
+            for(const size_t blocks : sizes)
+            {
+                std::vector<unsigned int> expected(blocks * 4);
+                ars_generate_blocks_scalar(key, first_block, blocks, expected.data());
+
+                if(__builtin_cpu_supports("aes"))
+                {
+                    std::vector<unsigned int> values(blocks * 4);
+                    rocrand_impl::host::ars_generate_blocks_aesni(key,
+                                                                  first_block,
+                                                                  blocks,
+                                                                  values.data());
+                    assert_eq(values, expected);
+                }
+                if(__builtin_cpu_supports("vaes") && __builtin_cpu_supports("avx2"))
+                {
+                    std::vector<unsigned int> values(blocks * 4);
+                    rocrand_impl::host::ars_generate_blocks_vaes(key,
+                                                                 first_block,
+                                                                 blocks,
+                                                                 values.data());
+                    assert_eq(values, expected);
+                }
+            }
+        }
+    }
+#else
+    GTEST_SKIP() << "AES instructions are not available on this platform";
+#endif
+}
+
+// Element i of the output is the value at offset + i of the stream keyed by the seed
+TEST(ars_prng_tests, generator_test)
+{
+    const unsigned long long seed      = 9876ULL;
+    const unsigned long long offsets[] = {0ULL, 1ULL, 3ULL, 1234ULL};
+    const size_t             sizes[]   = {1, 3, 12345};
+
+    for(const unsigned long long offset : offsets)
+    {
+        for(const size_t size : sizes)
+        {
+            ars_generator_host<true> g;
+            g.set_seed(seed);
+            g.set_offset(offset);
+
+            std::vector<unsigned int> values(size);
+            ROCRAND_CHECK(g.generate(values.data(), size));
+            assert_eq(values, ars_reference(seed, offset, size));
+
+            // The next call continues the stream
+            ROCRAND_CHECK(g.generate(values.data(), size));
+            assert_eq(values, ars_reference(seed, offset + size, size));
+        }
+    }
+}
+
+TEST(ars_prng_tests, generate_range_test)
+{
+    const unsigned long long seed          = 9876ULL;
+    const unsigned long long first_index[] = {0ULL, 3ULL, 0x100000001ULL};
+    const size_t             size          = 12345;
+
+    ars_generator_host<true> g;
+    g.set_seed(seed);
+    g.set_offset(17);
+
+    std::vector<unsigned int> values(size);
+    for(const unsigned long long first : first_index)
+    {
+        ROCRAND_CHECK(g.generate_range(values.data(), first, size));
+        assert_eq(values, ars_reference(seed, first, size));
+    }
+
+    // The offset is still used by generate()
+    ROCRAND_CHECK(g.generate(values.data(), size));
+    assert_eq(values, ars_reference(seed, 17, size));
+}
+
+TEST(ars_prng_tests, generate_ulonglong_test)
+{
+    ars_generator_host<true> g;
+
+    std::vector<unsigned long long> values(16);
+    EXPECT_EQ(g.generate(values.data(), values.size()), ROCRAND_STATUS_TYPE_ERROR);
+}
+
+TEST(ars_prng_tests, set_order_test)
+{
+    ars_generator_host<true> g;
+    EXPECT_EQ(g.set_order(ROCRAND_ORDERING_PSEUDO_DYNAMIC), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(g.set_order(ROCRAND_ORDERING_PSEUDO_LEGACY), ROCRAND_STATUS_SUCCESS);
+}
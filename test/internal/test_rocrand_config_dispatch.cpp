@@ -18,11 +18,17 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#include "rng/autotune_cache.hpp"
 #include "rng/common.hpp"
 #include "rng/config_types.hpp"
 #include "test_common.hpp"
 #include <gtest/gtest.h>
 
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
 __global__ void write_target_arch(rocrand_impl::host::target_arch* dest_arch)
 {
     constexpr auto arch = rocrand_impl::host::get_device_arch();
@@ -287,3 +293,60 @@ TEST(rocrand_config_dispatch_tests, config_selection)
     ASSERT_EQ(config.threads, h_output[1]);
 }
 #endif // USE_DEVICE_DISPATCH
+
+TEST(rocrand_config_dispatch_tests, autotune_cache_file)
+{
+    const std::string path
+        = (std::filesystem::temp_directory_path() / "rocrand_autotune_cache_test.txt").string();
+    std::remove(path.c_str());
+
+    int device_id;
+    HIP_CHECK(hipGetDevice(&device_id));
+
+    unsigned int blocks = 0;
+    bool         found;
+    {
+        rocrand_impl::host::autotune_cache cache(path);
+        ASSERT_TRUE(cache.is_enabled());
+        HIP_CHECK(cache.find(device_id, ROCRAND_RNG_PSEUDO_XORWOW, "f32", 1000, blocks, found));
+        ASSERT_FALSE(found);
+
+        HIP_CHECK(cache.store(device_id, ROCRAND_RNG_PSEUDO_XORWOW, "f32", 123));
+        HIP_CHECK(cache.store(device_id, ROCRAND_RNG_PSEUDO_XORWOW, "f32", 456));
+        HIP_CHECK(cache.store(device_id, ROCRAND_RNG_PSEUDO_MRG32K3A, "u32", 789));
+    }
+    {
+        // Lines that cannot be parsed are ignored
+        std::ofstream file(path, std::ios::app);
+        file << "garbage\n\tnot a number\n";
+    }
+
+    // A new process reads the tuned configs from the file, later lines replace earlier ones
+    rocrand_impl::host::autotune_cache cache(path);
+    HIP_CHECK(cache.find(device_id, ROCRAND_RNG_PSEUDO_XORWOW, "f32", 1000, blocks, found));
+    ASSERT_TRUE(found);
+    ASSERT_EQ(blocks, 456U);
+    HIP_CHECK(cache.find(device_id, ROCRAND_RNG_PSEUDO_MRG32K3A, "u32", 1000, blocks, found));
+    ASSERT_TRUE(found);
+    ASSERT_EQ(blocks, 789U);
+    HIP_CHECK(cache.find(device_id, ROCRAND_RNG_PSEUDO_XORWOW, "f64", 1000, blocks, found));
+    ASSERT_FALSE(found);
+
+    // Entries for more blocks than the configs can use are clamped
+    HIP_CHECK(cache.find(device_id, ROCRAND_RNG_PSEUDO_MRG32K3A, "u32", 100, blocks, found));
+    ASSERT_TRUE(found);
+    ASSERT_EQ(blocks, 100U);
+    HIP_CHECK(cache.store(device_id, ROCRAND_RNG_PSEUDO_XORWOW, "u32", 0));
+    HIP_CHECK(cache.find(device_id, ROCRAND_RNG_PSEUDO_XORWOW, "u32", 1000, blocks, found));
+    ASSERT_TRUE(found);
+    ASSERT_EQ(blocks, 1U);
+
+    // Entries of 0 blocks are not read from the file
+    rocrand_impl::host::autotune_cache reloaded_cache(path);
+    HIP_CHECK(
+        reloaded_cache.find(device_id, ROCRAND_RNG_PSEUDO_XORWOW, "u32", 1000, blocks, found));
+    ASSERT_FALSE(found);
+
+    ASSERT_FALSE(rocrand_impl::host::autotune_cache("").is_enabled());
+    std::remove(path.c_str());
+}
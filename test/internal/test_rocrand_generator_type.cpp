@@ -118,6 +118,38 @@ struct dummy_generator : generator_impl_base
     unsigned long long m_seed  = 0;
 };
 
+/// Splits like the generators, but creating the child with index \p failing_child fails.
+struct splittable_generator : dummy_generator
+{
+    rocrand_status split(unsigned int count, subsequence_range* parts) const
+    {
+        return m_subsequences.split(1, count, parts);
+    }
+
+    void keep_subsequences(const subsequence_range& subsequences)
+    {
+        m_subsequences = subsequences;
+    }
+
+    rocrand_status fork_from(const splittable_generator& parent,
+                             const subsequence_range&    subsequences)
+    {
+        (void)parent;
+        if(subsequences.first / subsequences.size == failing_child + 1)
+        {
+            return ROCRAND_STATUS_INTERNAL_ERROR;
+        }
+        m_subsequences = subsequences;
+        forked.push_back(subsequences);
+        return ROCRAND_STATUS_SUCCESS;
+    }
+
+    subsequence_range m_subsequences;
+
+    static inline unsigned int                   failing_child = ~0u;
+    static inline std::vector<subsequence_range> forked;
+};
+
 TEST(rocrand_generator_type_tests, rocrand_generator)
 {
     rocrand_generator g = NULL;
@@ -133,6 +165,16 @@ TEST(rocrand_generator_type_tests, rocrand_generator)
     EXPECT_EQ(gg->get_seed(), 0ULL);
     EXPECT_EQ(gg->get_stream(), (hipStream_t)(0));
     EXPECT_EQ(gg->set_dimensions(123), ROCRAND_STATUS_TYPE_ERROR);
+    EXPECT_EQ(gg->generate_int_range(nullptr, 0, 123), ROCRAND_STATUS_TYPE_ERROR);
+    EXPECT_EQ(gg->generate_int_batched(nullptr, 123, 123, nullptr, nullptr, 2),
+              ROCRAND_STATUS_TYPE_ERROR);
+    EXPECT_EQ(gg->generate_int_2d(nullptr, 123, 2, 123), ROCRAND_STATUS_TYPE_ERROR);
+    size_t state_size;
+    EXPECT_EQ(gg->get_state_size(state_size), ROCRAND_STATUS_TYPE_ERROR);
+    EXPECT_EQ(gg->save_state(nullptr), ROCRAND_STATUS_TYPE_ERROR);
+    rocrand_generator child;
+    EXPECT_EQ(gg->split(1, &child), ROCRAND_STATUS_TYPE_ERROR);
+    EXPECT_EQ(gg->generate_fused(nullptr, 0), ROCRAND_STATUS_TYPE_ERROR);
     delete g;
 }
 
@@ -159,3 +201,32 @@ TEST(rocrand_generator_type_tests, generate_test)
     std::vector<unsigned short> expected(output.size(), 0xAAAA);
     EXPECT_EQ(expected, output);
 }
+
+// The parent keeps its subsequences if creating any child fails.
+TEST(rocrand_generator_type_tests, split_failure_test)
+{
+    generator_type<splittable_generator> g;
+    rocrand_generator                    children[3];
+
+    splittable_generator::forked.clear();
+    splittable_generator::failing_child = 1;
+    EXPECT_EQ(g.split(3, children), ROCRAND_STATUS_INTERNAL_ERROR);
+
+    splittable_generator::forked.clear();
+    splittable_generator::failing_child = ~0u;
+    ASSERT_EQ(g.split(3, children), ROCRAND_STATUS_SUCCESS);
+    ASSERT_EQ(splittable_generator::forked.size(), 3U);
+    for(unsigned int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(splittable_generator::forked[i].first, (i + 1) * (~0ULL / 4));
+        EXPECT_EQ(splittable_generator::forked[i].size, ~0ULL / 4);
+        delete children[i];
+    }
+
+    // The second split divides the part that the parent kept
+    splittable_generator::forked.clear();
+    ASSERT_EQ(g.split(1, children), ROCRAND_STATUS_SUCCESS);
+    ASSERT_EQ(splittable_generator::forked.size(), 1U);
+    EXPECT_EQ(splittable_generator::forked[0].first, (~0ULL / 4) / 2);
+    delete children[0];
+}
@@ -36,7 +36,8 @@ using rocrand_impl::host::lfsr113_generator;
 // Generator API tests
 using lfsr113_generator_prng_tests_types = ::testing::Types<
     generator_prng_tests_params<lfsr113_generator, ROCRAND_ORDERING_PSEUDO_DEFAULT>,
-    generator_prng_tests_params<lfsr113_generator, ROCRAND_ORDERING_PSEUDO_DYNAMIC>>;
+    generator_prng_tests_params<lfsr113_generator, ROCRAND_ORDERING_PSEUDO_DYNAMIC>,
+    generator_prng_tests_params<lfsr113_generator, ROCRAND_ORDERING_PSEUDO_PORTABLE>>;
 
 using lfsr113_generator_prng_offset_tests_types = ::testing::Types<
     generator_prng_offset_tests_params<unsigned int,
@@ -56,10 +57,21 @@ INSTANTIATE_TYPED_TEST_SUITE_P(lfsr113_generator,
                                generator_prng_continuity_tests,
                                lfsr113_generator_prng_tests_types);
 
+INSTANTIATE_TYPED_TEST_SUITE_P(lfsr113_generator,
+                               generator_prng_split_tests,
+                               lfsr113_generator_prng_tests_types);
+
 INSTANTIATE_TYPED_TEST_SUITE_P(lfsr113_generator,
                                generator_prng_offset_tests,
                                lfsr113_generator_prng_offset_tests_types);
 
+TEST(lfsr113_generator_portable_tests, same_as_default_test)
+{
+    portable_ordering_test<
+        rocrand_impl::host::lfsr113_generator_template<rocrand_impl::system::device_system,
+                                                       portable_test_config_provider>>();
+}
+
 // lfsr113-specific generator API tests
 template<class Params>
 struct lfsr113_generator_prng_tests : public testing::Test
@@ -203,7 +215,20 @@ TYPED_TEST(lfsr113_generator_prng_tests, different_seed_uint4_test)
 
 // Engine API tests
 struct lfsr113_engine_api_tests : public lfsr113_generator::engine_type
-{};
+{
+    using lfsr113_generator::engine_type::engine_type;
+
+    // Same as discard() and discard_subsequence() with ROCRAND_RUNTIME_JUMP_POLYNOMIALS
+    void discard_runtime(unsigned long long offset)
+    {
+        jump_polynomial(offset, 0);
+    }
+
+    void discard_subsequence_runtime(unsigned int subsequence)
+    {
+        jump_polynomial(subsequence, 55);
+    }
+};
 
 TEST(lfsr113_engine_api_tests, discard_test)
 {
@@ -271,3 +296,72 @@ TEST(lfsr113_engine_api_tests, discard_sequence_test)
 
     EXPECT_EQ(engine1(), engine2());
 }
+
+TEST(lfsr113_engine_api_tests, runtime_jump_polynomial_test)
+{
+    const uint4 seed = {1234567U, 12345678U, 123456789U, 1234567890U};
+
+    const unsigned long long offsets[]
+        = {1ULL, 31ULL, 32ULL, 583ULL, 10313475ULL, 5356446450ULL, 0xdeadbeefcafebabeULL, ~0ULL};
+
+    for(auto offset : offsets)
+    {
+        lfsr113_engine_api_tests engine1(seed, 0, 0);
+        lfsr113_engine_api_tests engine2(seed, 0, 0);
+
+        engine1.discard(offset);
+        engine2.discard_runtime(offset);
+
+        EXPECT_EQ(engine1(), engine2());
+
+        engine1.discard_subsequence(static_cast<unsigned int>(offset));
+        engine2.discard_subsequence_runtime(static_cast<unsigned int>(offset));
+
+        EXPECT_EQ(engine1(), engine2());
+    }
+}
+
+// The engines skip offset / engines_size numbers, check offsets for which it does not fit
+// in 32 bits.
+TEST(lfsr113_engine_api_tests, large_offset_test)
+{
+    using generator_t = lfsr113_generator;
+    using engine_t    = generator_t::engine_type;
+
+    const uint4 seed = {1234567U, 12345678U, 123456789U, 1234567890U};
+    constexpr size_t size = 1313;
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(&data, sizeof(unsigned int) * size));
+
+    const unsigned long long offsets[] = {(1ULL << 40) + 3ULL, (1ULL << 52) + 1234567ULL};
+    for(const unsigned long long offset : offsets)
+    {
+        SCOPED_TRACE(::testing::Message() << "with offset=" << offset);
+
+        generator_t g;
+        ROCRAND_CHECK(g.set_seed_uint4(seed));
+        ROCRAND_CHECK(g.set_offset(offset));
+        ROCRAND_CHECK(g.generate_uniform(data, size));
+
+        unsigned int host_data[size];
+        HIP_CHECK(hipMemcpy(host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+
+        // The number of engines is part of the saved state
+        size_t state_size;
+        ROCRAND_CHECK(g.get_state_size(state_size));
+        const unsigned long long engines_size
+            = (state_size - sizeof(rocrand_impl::host::generator_state_header)) / sizeof(engine_t);
+
+        for(size_t i = 0; i < size; i += 97)
+        {
+            const unsigned long long index     = offset + i;
+            const unsigned int       engine_id = static_cast<unsigned int>(index % engines_size);
+            const unsigned long long position  = index / engines_size;
+            engine_t engine(seed, engine_id, position);
+            ASSERT_EQ(host_data[i], engine());
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+}
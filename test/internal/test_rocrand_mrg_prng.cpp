@@ -30,6 +30,7 @@
 #include <gtest/gtest.h>
 
 #include <stdexcept>
+#include <vector>
 
 using rocrand_impl::host::mrg31k3p_generator;
 using rocrand_impl::host::mrg32k3a_generator;
@@ -38,8 +39,10 @@ using rocrand_impl::host::mrg32k3a_generator;
 using mrg_generator_prng_tests_types = ::testing::Types<
     generator_prng_tests_params<mrg31k3p_generator, ROCRAND_ORDERING_PSEUDO_DEFAULT>,
     generator_prng_tests_params<mrg31k3p_generator, ROCRAND_ORDERING_PSEUDO_DYNAMIC>,
+    generator_prng_tests_params<mrg31k3p_generator, ROCRAND_ORDERING_PSEUDO_PORTABLE>,
     generator_prng_tests_params<mrg32k3a_generator, ROCRAND_ORDERING_PSEUDO_DEFAULT>,
-    generator_prng_tests_params<mrg32k3a_generator, ROCRAND_ORDERING_PSEUDO_DYNAMIC>>;
+    generator_prng_tests_params<mrg32k3a_generator, ROCRAND_ORDERING_PSEUDO_DYNAMIC>,
+    generator_prng_tests_params<mrg32k3a_generator, ROCRAND_ORDERING_PSEUDO_PORTABLE>>;
 
 using mrg_generator_prng_offset_tests_types = ::testing::Types<
     generator_prng_offset_tests_params<unsigned int,
@@ -65,10 +68,26 @@ INSTANTIATE_TYPED_TEST_SUITE_P(rocrand_mrg,
                                generator_prng_continuity_tests,
                                mrg_generator_prng_tests_types);
 
+INSTANTIATE_TYPED_TEST_SUITE_P(rocrand_mrg,
+                               generator_prng_split_tests,
+                               mrg_generator_prng_tests_types);
+
 INSTANTIATE_TYPED_TEST_SUITE_P(rocrand_mrg,
                                generator_prng_offset_tests,
                                mrg_generator_prng_offset_tests_types);
 
+TEST(mrg_generator_portable_tests, same_as_default_test)
+{
+    portable_ordering_test<
+        rocrand_impl::host::mrg_generator_template<rocrand_impl::system::device_system,
+                                                   rocrand_device::mrg31k3p_engine,
+                                                   portable_test_config_provider>>();
+    portable_ordering_test<
+        rocrand_impl::host::mrg_generator_template<rocrand_impl::system::device_system,
+                                                   rocrand_device::mrg32k3a_engine,
+                                                   portable_test_config_provider>>();
+}
+
 // mrg-specific generator API tests
 template<class Params>
 struct mrg_generator_prng_tests : public ::testing::Test
@@ -229,3 +248,92 @@ TYPED_TEST(mrg_prng_engine_tests, discard_subsequence_test)
 
     EXPECT_EQ(engine1(), engine2());
 }
+
+TYPED_TEST(mrg_prng_engine_tests, subsequence_ordering_test)
+{
+    using mrg_type    = typename TestFixture::mrg_type;
+    using engine_type = typename mrg_type::engine_type;
+
+    const unsigned long long seed   = 34567ULL;
+    const unsigned long long offset = 17ULL;
+    const unsigned long long length = 1000ULL;
+    const size_t             size   = 5 * length + 123;
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(&data, sizeof(*data) * (size + 1)));
+
+    mrg_type g;
+    g.set_seed(seed);
+    ROCRAND_CHECK(g.set_order(ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE));
+    EXPECT_EQ(g.set_subsequence_length(0), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(g.set_subsequence_length(length));
+    ROCRAND_CHECK(g.set_offset(offset));
+
+    // The second call continues the first one and is not aligned to the vectors
+    const size_t first_size = 777;
+    ROCRAND_CHECK(g.generate(data, first_size));
+    ROCRAND_CHECK(g.generate(data + first_size + 1, size - first_size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(size + 1);
+    HIP_CHECK(hipMemcpy(host_data.data(),
+                        data,
+                        sizeof(*data) * (size + 1),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+
+    rocrand_impl::host::mrg_engine_uniform_distribution<unsigned int, engine_type> distribution;
+    for(size_t i = 0; i < size; i++)
+    {
+        // Value j of block s is value j of subsequence s
+        const unsigned long long position = offset + i;
+        engine_type engine(seed, position / length, position % length);
+
+        unsigned int input[1] = {engine()};
+        unsigned int output[1];
+        distribution(input, output);
+
+        const size_t index = i < first_size ? i : i + 1;
+        ASSERT_EQ(host_data[index], output[0]) << "at " << i;
+    }
+}
+
+TYPED_TEST(mrg_prng_engine_tests, subsequence_ordering_default_length_test)
+{
+    using mrg_type    = typename TestFixture::mrg_type;
+    using engine_type = typename mrg_type::engine_type;
+
+    const unsigned long long seed   = 34567ULL;
+    const unsigned long long length = rocrand_impl::host::mrg_default_subsequence_length;
+    // The values around the end of the first subsequence
+    const unsigned long long offset = length - 1000;
+    const size_t             size   = 2345;
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(&data, sizeof(*data) * size));
+
+    // The length does not have to be set
+    mrg_type g;
+    g.set_seed(seed);
+    ROCRAND_CHECK(g.set_order(ROCRAND_ORDERING_PSEUDO_SUBSEQUENCE));
+    ROCRAND_CHECK(g.set_offset(offset));
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, sizeof(*data) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+
+    rocrand_impl::host::mrg_engine_uniform_distribution<unsigned int, engine_type> distribution;
+    for(size_t i = 0; i < size; i++)
+    {
+        const unsigned long long position = offset + i;
+        engine_type engine(seed, position / length, position % length);
+
+        unsigned int input[1] = {engine()};
+        unsigned int output[1];
+        distribution(input, output);
+
+        ASSERT_EQ(host_data[i], output[0]) << "at " << i;
+    }
+}
@@ -1196,3 +1196,56 @@ TYPED_TEST(mt19937_generator_engine_tests, jump_ahead_test)
     HIP_CHECK(hipFree(d_mt19937_jump));
     HIP_CHECK(hipFree(d_engines1));
 }
+
+// Engines that are copied from the engine state cache continue like engines that are computed.
+TYPED_TEST(mt19937_generator_engine_tests, engine_state_cache_test)
+{
+    using generator_t = typename TestFixture::generator_t;
+
+    constexpr size_t             size = 54321;
+    constexpr unsigned long long seed = 0x9e3779b97f4a7c15ULL;
+
+    // The cache is disabled by default
+    auto&        cache         = rocrand_impl::host::engine_state_cache::instance();
+    const size_t previous_size = cache.get_max_size();
+    cache.set_max_size(size_t{256} << 20);
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(&data, size * sizeof(unsigned int)));
+
+    std::vector<unsigned int> computed(size);
+    std::vector<unsigned int> cached(size);
+    {
+        // A seed that no other test uses, so the engines are computed
+        generator_t g;
+        g.set_seed(seed);
+        ROCRAND_CHECK(g.generate(data, size));
+        HIP_CHECK(
+            hipMemcpy(computed.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    }
+    {
+        generator_t g;
+        g.set_seed(seed);
+        ROCRAND_CHECK(g.generate(data, size));
+        HIP_CHECK(
+            hipMemcpy(cached.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    }
+    assert_eq(cached, computed);
+
+    // Another seed is not taken from the cache
+    generator_t g;
+    g.set_seed(seed + 1);
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipMemcpy(cached.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    EXPECT_NE(cached, computed);
+
+    // Disabling the cache frees the states, the engines are computed again
+    cache.set_max_size(0);
+    g.set_seed(seed);
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipMemcpy(cached.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    assert_eq(cached, computed);
+
+    cache.set_max_size(previous_size);
+    HIP_CHECK(hipFree(data));
+}
@@ -29,6 +29,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstring>
+#include <vector>
+
 using rocrand_impl::host::mtgp32_generator;
 
 // Generator API tests
@@ -45,3 +48,92 @@ INSTANTIATE_TYPED_TEST_SUITE_P(mtgp32_generator,
 // INSTANTIATE_TYPED_TEST_SUITE_P(rocrand_mtgp32,
 //                                generator_prng_continuity_tests,
 //                                rocrand_mtgp32_generator_prng_tests_types);
+
+// The engines are initialized by a kernel, they must be the same as the ones
+// made by rocrand_make_state_mtgp32 on the host.
+TEST(mtgp32_generator_engine_tests, init_engines_test)
+{
+    using rocrand_impl::host::generator_state_header;
+    using engine_type = mtgp32_generator::engine_type;
+
+    mtgp32_generator g;
+    for(const unsigned long long seed : {0ULL, 0x123456789abcdefULL, 0xfffffffffULL})
+    {
+        g.set_seed(seed);
+
+        size_t state_size;
+        ROCRAND_CHECK(g.get_state_size(state_size));
+        const size_t engines_size
+            = (state_size - sizeof(generator_state_header)) / sizeof(engine_type);
+
+        unsigned char* d_state;
+        HIP_CHECK(hipMallocHelper(&d_state, state_size));
+        ROCRAND_CHECK(g.save_state(d_state));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<unsigned char> state(state_size);
+        HIP_CHECK(hipMemcpy(state.data(), d_state, state_size, hipMemcpyDeviceToHost));
+        HIP_CHECK(hipFree(d_state));
+
+        std::vector<engine_type> expected(engines_size);
+        ROCRAND_CHECK(rocrand_make_state_mtgp32(expected.data(),
+                                                mtgp32dc_params_fast_11213,
+                                                engines_size,
+                                                seed));
+
+        EXPECT_EQ(std::memcmp(state.data() + sizeof(generator_state_header),
+                              expected.data(),
+                              engines_size * sizeof(engine_type)),
+                  0);
+    }
+}
+
+TEST(mtgp32_generator_engine_tests, engine_state_cache_test)
+{
+    constexpr size_t             size = 54321;
+    constexpr unsigned long long seed = 0x9e3779b97f4a7c15ULL;
+
+    // The cache is disabled by default
+    auto&        cache         = rocrand_impl::host::engine_state_cache::instance();
+    const size_t previous_size = cache.get_max_size();
+    cache.set_max_size(size_t{256} << 20);
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(&data, size * sizeof(unsigned int)));
+
+    std::vector<unsigned int> computed(size);
+    std::vector<unsigned int> cached(size);
+    {
+        // A seed that no other test uses, so the engines are computed
+        mtgp32_generator g;
+        g.set_seed(seed);
+        ROCRAND_CHECK(g.generate(data, size));
+        HIP_CHECK(
+            hipMemcpy(computed.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    }
+    {
+        mtgp32_generator g;
+        g.set_seed(seed);
+        ROCRAND_CHECK(g.generate(data, size));
+        HIP_CHECK(
+            hipMemcpy(cached.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    }
+    assert_eq(cached, computed);
+
+    // Another seed is not taken from the cache
+    mtgp32_generator g;
+    g.set_seed(seed + 1);
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipMemcpy(cached.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    EXPECT_NE(cached, computed);
+
+    // Disabling the cache frees the states, the engines are computed again
+    cache.set_max_size(0);
+    g.set_seed(seed);
+    ROCRAND_CHECK(g.generate(data, size));
+    HIP_CHECK(hipMemcpy(cached.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    assert_eq(cached, computed);
+
+    cache.set_max_size(previous_size);
+    HIP_CHECK(hipFree(data));
+}
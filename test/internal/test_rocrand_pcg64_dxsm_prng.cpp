@@ -0,0 +1,177 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+#include "test_rocrand_prng.hpp"
+#include <rocrand/rocrand.h>
+
+#include <rng/pcg64_dxsm.hpp>
+
+#include <gtest/gtest.h>
+
+using rocrand_impl::host::pcg64_dxsm_generator;
+
+// Generator API tests
+using pcg64_dxsm_generator_prng_tests_types = ::testing::Types<
+    generator_prng_tests_params<pcg64_dxsm_generator, ROCRAND_ORDERING_PSEUDO_DEFAULT>,
+    generator_prng_tests_params<pcg64_dxsm_generator, ROCRAND_ORDERING_PSEUDO_DYNAMIC>>;
+
+using pcg64_dxsm_generator_prng_offset_tests_types
+    = ::testing::Types<generator_prng_offset_tests_params<unsigned long long,
+                                                          pcg64_dxsm_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DEFAULT>,
+                       generator_prng_offset_tests_params<unsigned long long,
+                                                          pcg64_dxsm_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DYNAMIC>,
+                       generator_prng_offset_tests_params<float,
+                                                          pcg64_dxsm_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DEFAULT>,
+                       generator_prng_offset_tests_params<float,
+                                                          pcg64_dxsm_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DYNAMIC>>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(pcg64_dxsm_generator,
+                               generator_prng_tests,
+                               pcg64_dxsm_generator_prng_tests_types);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(pcg64_dxsm_generator,
+                               generator_prng_continuity_tests,
+                               pcg64_dxsm_generator_prng_tests_types);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(pcg64_dxsm_generator,
+                               generator_prng_offset_tests,
+                               pcg64_dxsm_generator_prng_offset_tests_types);
+
+// Engine API tests
+
+// Reference values from NumPy:
+// b = numpy.random.PCG64DXSM(seed).jumped(subsequence)
+// b.advance(offset)
+// b.random_raw(4)
+TEST(pcg64_dxsm_engine_api_tests, numpy_known_answer_test)
+{
+    using engine_t = pcg64_dxsm_generator::engine_type;
+
+    struct known_answer
+    {
+        unsigned long long seed;
+        unsigned long long subsequence;
+        unsigned long long offset;
+        unsigned long long values[4];
+    };
+
+    const known_answer known_answers[] = {
+        {             0ULL,       0ULL,                    0ULL,
+         {0xd97e4a147f788a70ULL,
+         0x8dfa7bce56e3a253ULL,
+         0x13556ed9f53d3c10ULL,
+         0x55dbf1c241341e98ULL}},
+        {         12345ULL,       0ULL,                    0ULL,
+         {0xee9ce7d91fd0146fULL,
+         0x5666c45f046a0883ULL,
+         0x378c2161cf28e2bdULL,
+         0x5a4af4efd795681eULL}},
+        {         12345ULL,       3ULL,                 1000ULL,
+         {0xe919fda09dc85164ULL,
+         0xd445021ff06fb4a7ULL,
+         0xa963eb084b62bf29ULL,
+         0x44d470967e4d4875ULL}},
+        {0xdeadbeefcafeULL, 123456ULL, 9223372036854775813ULL,
+         {0x391c45d28b5c6031ULL,
+         0xecf4419837e58b37ULL,
+         0xd0bb2f41f80add21ULL,
+         0xb8fa75c85d6276aaULL}},
+    };
+
+    for(const known_answer& k : known_answers)
+    {
+        engine_t engine(k.seed, k.subsequence, k.offset);
+        for(unsigned long long value : k.values)
+        {
+            EXPECT_EQ(engine(), value);
+        }
+    }
+}
+
+TEST(pcg64_dxsm_engine_api_tests, discard_test)
+{
+    using engine_t = pcg64_dxsm_generator::engine_type;
+
+    const unsigned long long seed = 1234567ULL;
+    engine_t                 engine1(seed, 0, 678U);
+    engine_t                 engine2(seed, 0, 677U);
+
+    // Check next() function
+    (void)engine2.next();
+
+    EXPECT_EQ(engine1(), engine2());
+
+    // Check discard() function
+    (void)engine1.next();
+    engine2.discard();
+
+    EXPECT_EQ(engine1(), engine2());
+
+    // Check discard(offset) function
+    const unsigned int offsets[]
+        = {1U, 4U, 37U, 583U, 7452U, 21032U, 35678U, 66778U, 10313475U, 82120230U};
+
+    for(auto offset : offsets)
+    {
+        for(unsigned int i = 0; i < offset; i++)
+        {
+            (void)engine1.next();
+        }
+        engine2.discard(offset);
+
+        EXPECT_EQ(engine1(), engine2());
+    }
+}
+
+TEST(pcg64_dxsm_engine_api_tests, discard_sequence_test)
+{
+    using engine_t = pcg64_dxsm_generator::engine_type;
+
+    const unsigned long long seed = 1234567ULL;
+    engine_t                 engine1(seed, 0, 444U);
+    engine_t                 engine2(seed, 123U, 444U);
+
+    engine1.discard_subsequence(123U);
+
+    EXPECT_EQ(engine1(), engine2());
+
+    engine1.discard(5356446450ULL);
+    engine1.discard_subsequence(123U);
+    engine1.discard(30000000006ULL);
+
+    engine2.discard_subsequence(3U);
+    engine2.discard(35356446456ULL);
+    engine2.discard_subsequence(120U);
+
+    EXPECT_EQ(engine1(), engine2());
+
+    engine1.discard_subsequence(3456000U);
+    engine1.discard_subsequence(1000005U);
+
+    engine2.discard_subsequence(4456005U);
+
+    EXPECT_EQ(engine1(), engine2());
+}
@@ -0,0 +1,265 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+#include "test_rocrand_prng.hpp"
+#include <rocrand/rocrand.h>
+
+#include <rng/philox4x64_10.hpp>
+
+#include <gtest/gtest.h>
+
+using rocrand_impl::host::philox4x64_10_generator;
+
+// Generator API tests
+using philox4x64_10_generator_prng_tests_types = ::testing::Types<
+    generator_prng_tests_params<philox4x64_10_generator, ROCRAND_ORDERING_PSEUDO_DEFAULT>,
+    generator_prng_tests_params<philox4x64_10_generator, ROCRAND_ORDERING_PSEUDO_DYNAMIC>>;
+
+using philox4x64_10_generator_prng_offset_tests_types
+    = ::testing::Types<generator_prng_offset_tests_params<unsigned long long,
+                                                          philox4x64_10_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DEFAULT>,
+                       generator_prng_offset_tests_params<unsigned long long,
+                                                          philox4x64_10_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DYNAMIC>,
+                       generator_prng_offset_tests_params<float,
+                                                          philox4x64_10_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DEFAULT>,
+                       generator_prng_offset_tests_params<float,
+                                                          philox4x64_10_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DYNAMIC>>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(philox4x64_10_generator,
+                               generator_prng_tests,
+                               philox4x64_10_generator_prng_tests_types);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(philox4x64_10_generator,
+                               generator_prng_continuity_tests,
+                               philox4x64_10_generator_prng_tests_types);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(philox4x64_10_generator,
+                               generator_prng_split_tests,
+                               philox4x64_10_generator_prng_tests_types);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(philox4x64_10_generator,
+                               generator_prng_offset_tests,
+                               philox4x64_10_generator_prng_offset_tests_types);
+
+// philox4x64_10-specific generator API tests
+TEST(philox4x64_10_generator_prng_tests, uniform_ulonglong_test)
+{
+    const size_t        size = 1313;
+    unsigned long long* data;
+    HIP_CHECK(hipMallocHelper(&data, sizeof(unsigned long long) * (size + 1)));
+
+    philox4x64_10_generator g;
+    ROCRAND_CHECK(g.generate_uniform(data + 1, size));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    unsigned long long host_data[size];
+    HIP_CHECK(
+        hipMemcpy(host_data, data + 1, sizeof(unsigned long long) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.;
+    for(size_t i = 0; i < size; i++)
+    {
+        mean += host_data[i] / static_cast<double>(size);
+    }
+    ASSERT_NEAR(mean, static_cast<double>(ULLONG_MAX / 2), static_cast<double>(ULLONG_MAX / 20));
+
+    HIP_CHECK(hipFree(data));
+}
+
+TEST(philox4x64_10_generator_prng_tests, continuity_uniform_ullong_test)
+{
+    typedef unsigned long long int output_t;
+
+    continuity_test<output_t, philox4x64_10_generator>(
+        [](philox4x64_10_generator& g, output_t* data, size_t s) { g.generate_uniform(data, s); },
+        ROCRAND_ORDERING_PSEUDO_DEFAULT,
+        rocrand_impl::host::uniform_distribution<output_t, unsigned long long int>::output_width);
+}
+
+// Engine API tests
+class philox4x64_10_engine_type_test : public philox4x64_10_generator::engine_type
+{
+public:
+    __host__ philox4x64_10_engine_type_test() : philox4x64_10_generator::engine_type(0, 0, 0) {}
+
+    __host__ state_type& internal_state_ref()
+    {
+        return m_state;
+    }
+
+    __host__ ulonglong4 rounds(ulonglong4 counter, ulonglong2 key)
+    {
+        return this->ten_rounds(counter, key);
+    }
+};
+
+// Known answer tests from Random123 (kat_vectors, philox4x64 with 10 rounds)
+TEST(philox4x64_10_prng_state_tests, known_answer_test)
+{
+    philox4x64_10_engine_type_test engine;
+
+    ulonglong4 result = engine.rounds(ulonglong4{0ULL, 0ULL, 0ULL, 0ULL}, ulonglong2{0ULL, 0ULL});
+    EXPECT_EQ(result.x, 0x16554d9eca36314cULL);
+    EXPECT_EQ(result.y, 0xdb20fe9d672d0fdcULL);
+    EXPECT_EQ(result.z, 0xd7e772cee186176bULL);
+    EXPECT_EQ(result.w, 0x7e68b68aec7ba23bULL);
+
+    result = engine.rounds(ulonglong4{ULLONG_MAX, ULLONG_MAX, ULLONG_MAX, ULLONG_MAX},
+                           ulonglong2{ULLONG_MAX, ULLONG_MAX});
+    EXPECT_EQ(result.x, 0x87b092c3013fe90bULL);
+    EXPECT_EQ(result.y, 0x438c3c67be8d0224ULL);
+    EXPECT_EQ(result.z, 0x9cc7d7c69cd777b6ULL);
+    EXPECT_EQ(result.w, 0xa09caebf594f0ba0ULL);
+
+    result = engine.rounds(ulonglong4{0x243f6a8885a308d3ULL,
+                                      0x13198a2e03707344ULL,
+                                      0xa4093822299f31d0ULL,
+                                      0x082efa98ec4e6c89ULL},
+                           ulonglong2{0x452821e638d01377ULL, 0xbe5466cf34e90c6cULL});
+    EXPECT_EQ(result.x, 0xa528f45403e61d95ULL);
+    EXPECT_EQ(result.y, 0x38c72dbd566e9788ULL);
+    EXPECT_EQ(result.z, 0xa5a1610e72fd18b5ULL);
+    EXPECT_EQ(result.w, 0x57bd43b5e52b7fe6ULL);
+}
+
+TEST(philox4x64_10_prng_state_tests, seed_test)
+{
+    philox4x64_10_engine_type_test              engine;
+    philox4x64_10_engine_type_test::state_type& state = engine.internal_state_ref();
+
+    EXPECT_EQ(state.counter.x, 0ULL);
+    EXPECT_EQ(state.counter.y, 0ULL);
+    EXPECT_EQ(state.counter.z, 0ULL);
+    EXPECT_EQ(state.counter.w, 0ULL);
+    EXPECT_EQ(state.substate, 0U);
+
+    engine.discard(1 * 4ULL);
+    EXPECT_EQ(state.counter.x, 1ULL);
+    EXPECT_EQ(state.counter.y, 0ULL);
+    EXPECT_EQ(state.counter.z, 0ULL);
+    EXPECT_EQ(state.counter.w, 0ULL);
+    EXPECT_EQ(state.substate, 0U);
+
+    engine.seed(3331, 0, 5 * 4ULL + 3);
+    EXPECT_EQ(state.key.x, 3331ULL);
+    EXPECT_EQ(state.key.y, 0ULL);
+    EXPECT_EQ(state.counter.x, 5ULL);
+    EXPECT_EQ(state.counter.y, 0ULL);
+    EXPECT_EQ(state.counter.z, 0ULL);
+    EXPECT_EQ(state.counter.w, 0ULL);
+    EXPECT_EQ(state.substate, 3U);
+}
+
+// Check if the philox state counter is calculated correctly during
+// random number generation.
+TEST(philox4x64_10_prng_state_tests, discard_test)
+{
+    philox4x64_10_engine_type_test              engine;
+    philox4x64_10_engine_type_test::state_type& state = engine.internal_state_ref();
+
+    engine.discard(ULLONG_MAX);
+    engine.discard(ULLONG_MAX);
+    engine.discard(ULLONG_MAX);
+    engine.discard(ULLONG_MAX);
+    EXPECT_EQ(state.counter.x, ULLONG_MAX);
+    EXPECT_EQ(state.counter.y, 0ULL);
+    EXPECT_EQ(state.counter.z, 0ULL);
+    EXPECT_EQ(state.counter.w, 0ULL);
+    EXPECT_EQ(state.substate, 0U);
+
+    engine.discard(2 * 4ULL);
+    EXPECT_EQ(state.counter.x, 1ULL);
+    EXPECT_EQ(state.counter.y, 1ULL);
+    EXPECT_EQ(state.counter.z, 0ULL);
+    EXPECT_EQ(state.counter.w, 0ULL);
+    EXPECT_EQ(state.substate, 0U);
+
+    state.counter.x = ULLONG_MAX;
+    state.counter.y = ULLONG_MAX;
+    state.counter.z = ULLONG_MAX;
+    state.counter.w = 0ULL;
+    engine.discard(1 * 4ULL);
+    EXPECT_EQ(state.counter.x, 0ULL);
+    EXPECT_EQ(state.counter.y, 0ULL);
+    EXPECT_EQ(state.counter.z, 0ULL);
+    EXPECT_EQ(state.counter.w, 1ULL);
+    EXPECT_EQ(state.substate, 0U);
+
+    state.counter.x = 123ULL;
+    state.counter.y = 456ULL;
+    state.counter.z = 789ULL;
+    state.counter.w = 999ULL;
+    engine.discard(2);
+    engine.discard(3);
+    EXPECT_EQ(state.counter.x, 124ULL);
+    EXPECT_EQ(state.counter.y, 456ULL);
+    EXPECT_EQ(state.counter.z, 789ULL);
+    EXPECT_EQ(state.counter.w, 999ULL);
+    EXPECT_EQ(state.substate, 1U);
+}
+
+TEST(philox4x64_10_prng_state_tests, discard_sequence_test)
+{
+    philox4x64_10_engine_type_test              engine;
+    philox4x64_10_engine_type_test::state_type& state = engine.internal_state_ref();
+
+    engine.discard_subsequence(ULLONG_MAX);
+    EXPECT_EQ(state.counter.x, 0ULL);
+    EXPECT_EQ(state.counter.y, 0ULL);
+    EXPECT_EQ(state.counter.z, ULLONG_MAX);
+    EXPECT_EQ(state.counter.w, 0ULL);
+
+    engine.discard_subsequence(ULLONG_MAX);
+    EXPECT_EQ(state.counter.x, 0ULL);
+    EXPECT_EQ(state.counter.y, 0ULL);
+    EXPECT_EQ(state.counter.z, ULLONG_MAX - 1);
+    EXPECT_EQ(state.counter.w, 1ULL);
+
+    engine.discard_subsequence(2);
+    EXPECT_EQ(state.counter.x, 0ULL);
+    EXPECT_EQ(state.counter.y, 0ULL);
+    EXPECT_EQ(state.counter.z, 0ULL);
+    EXPECT_EQ(state.counter.w, 2ULL);
+}
+
+// Values returned one by one and in blocks of four must match
+TEST(philox4x64_10_prng_state_tests, next4_test)
+{
+    for(unsigned long long offset = 0; offset < 8; ++offset)
+    {
+        philox4x64_10_generator::engine_type engine0(1234, 5, offset);
+        philox4x64_10_generator::engine_type engine1(1234, 5, offset);
+
+        for(int i = 0; i < 5; ++i)
+        {
+            const ulonglong4 v = engine0.next4();
+            EXPECT_EQ(v.x, engine1());
+            EXPECT_EQ(v.y, engine1());
+            EXPECT_EQ(v.z, engine1());
+            EXPECT_EQ(v.w, engine1());
+        }
+    }
+}
@@ -56,6 +56,10 @@ INSTANTIATE_TYPED_TEST_SUITE_P(philox4x32_10_generator,
                                generator_prng_continuity_tests,
                                philox_generator_prng_tests_types);
 
+INSTANTIATE_TYPED_TEST_SUITE_P(philox4x32_10_generator,
+                               generator_prng_split_tests,
+                               philox_generator_prng_tests_types);
+
 INSTANTIATE_TYPED_TEST_SUITE_P(philox4x32_10_generator,
                                generator_prng_offset_tests,
                                philox_generator_prng_offset_tests_types);
@@ -217,3 +221,41 @@ TEST(philox_prng_state_tests, discard_sequence_test)
     EXPECT_EQ(state.counter.z, 0U);
     EXPECT_EQ(state.counter.w, 6U);
 }
+
+// Split tests
+
+// A child of a split generator produces the values of the engine at its first subsequence.
+TEST(philox_prng_split_tests, child_subsequence_test)
+{
+    using rocrand_impl::host::subsequence_range;
+
+    constexpr size_t             size = 1313;
+    constexpr unsigned long long seed = 0xdeadbeefbeefULL;
+
+    philox4x32_10_generator parent;
+    parent.set_seed(seed);
+
+    subsequence_range parts[4];
+    ROCRAND_CHECK(parent.split(3, parts));
+    EXPECT_EQ(parts[0].first, 0ULL);
+    EXPECT_EQ(parts[1].first, ~0ULL / 4);
+    EXPECT_EQ(parts[3].first, 3 * (~0ULL / 4));
+
+    philox4x32_10_generator child;
+    ROCRAND_CHECK(child.fork_from(parent, parts[2]));
+    EXPECT_EQ(child.get_seed(), seed);
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(&data, sizeof(unsigned int) * size));
+    ROCRAND_CHECK(child.generate(data, size));
+
+    std::vector<unsigned int> output(size);
+    HIP_CHECK(hipMemcpy(output.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    HIP_CHECK(hipFree(data));
+
+    philox4x32_10_generator::engine_type engine(seed, parts[2].first, 0);
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(output[i], engine());
+    }
+}
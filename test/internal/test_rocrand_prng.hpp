@@ -39,6 +39,7 @@
 #include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <iterator>
 #include <numeric>
 #include <stdexcept>
 #include <type_traits>
@@ -287,7 +288,7 @@ TYPED_TEST_P(generator_prng_tests, poisson_test)
 {
     const size_t  size = 1313;
     unsigned int* data;
-    HIP_CHECK(hipMallocHelper(&data, sizeof(unsigned int) * size));
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
 
     auto g = TestFixture::get_generator();
     ROCRAND_CHECK(g.generate_poisson(data, size, 5.5));
@@ -325,7 +326,7 @@ TYPED_TEST_P(generator_prng_tests, state_progress_test)
     // Device data
     const size_t  size = 1025;
     unsigned int* data;
-    HIP_CHECK(hipMallocHelper(&data, sizeof(unsigned int) * size));
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
 
     // Generator
     auto g0 = TestFixture::get_generator();
@@ -367,7 +368,7 @@ TYPED_TEST_P(generator_prng_tests, same_seed_test)
     // Device side data
     const size_t  size = 1024;
     unsigned int* data;
-    HIP_CHECK(hipMallocHelper(&data, sizeof(unsigned int) * size));
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
 
     // Generators
     auto g0 = TestFixture::get_generator(), g1 = TestFixture::get_generator();
@@ -408,7 +409,7 @@ void different_seed_impl(rocrand_ordering         ordering,
     // Device side data
     const size_t  size = 1024;
     unsigned int* data;
-    HIP_CHECK(hipMallocHelper(&data, sizeof(unsigned int) * size));
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
 
     // Generators
     Generator g0, g1;
@@ -743,6 +744,156 @@ TYPED_TEST_P(generator_prng_offset_tests, offsets_test)
     }
 }
 
+//
+// Generator host API split tests
+//
+template<class Params>
+struct generator_prng_split_tests : public generator_prng_tests<Params>
+{};
+
+TYPED_TEST_SUITE_P(generator_prng_split_tests);
+
+// The parts of a split are adjacent and disjoint, the parent keeps the first one and continues
+// its sequence, and every child produces the sequence of the parent skipped ahead to the first
+// subsequence of its part.
+TYPED_TEST_P(generator_prng_split_tests, split_test)
+{
+    using generator_t = typename TestFixture::generator_t;
+    using rocrand_impl::host::subsequence_range;
+
+    constexpr size_t             size  = 12345;
+    constexpr unsigned int       count = 3;
+    constexpr unsigned long long seed  = 0xdeadbeefbeefULL;
+
+    unsigned int* data;
+    HIP_CHECK(hipMalloc(&data, sizeof(unsigned int) * size));
+
+    auto generate = [&](generator_t& g, std::vector<unsigned int>& output)
+    {
+        output.resize(size);
+        ROCRAND_CHECK(g.generate(data, size));
+        HIP_CHECK(
+            hipMemcpy(output.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    };
+
+    std::vector<unsigned int> expected0, expected1;
+    auto                      reference = TestFixture::get_generator();
+    reference.set_seed(seed);
+    generate(reference, expected0);
+    generate(reference, expected1);
+
+    std::vector<unsigned int> output0, output1;
+    auto                      parent = TestFixture::get_generator();
+    parent.set_seed(seed);
+    generate(parent, output0);
+
+    subsequence_range parts[count + 1];
+    ROCRAND_CHECK(parent.split(count, parts));
+    for(unsigned int i = 0; i < count; i++)
+    {
+        ASSERT_GT(parts[i].size, 0ULL);
+        ASSERT_EQ(parts[i].first + parts[i].size, parts[i + 1].first);
+        ASSERT_EQ(parts[i].size, parts[i + 1].size);
+    }
+
+    // The parts of the children do not overlap with the subsequences that the parent uses
+    parent.keep_subsequences(parts[0]);
+    generate(parent, output1);
+    ASSERT_EQ(output0, expected0);
+    ASSERT_EQ(output1, expected1);
+
+    for(unsigned int i = 1; i <= count; i++)
+    {
+        SCOPED_TRACE(::testing::Message() << "with child=" << i);
+
+        auto child = TestFixture::get_generator();
+        ROCRAND_CHECK(child.fork_from(parent, parts[i]));
+
+        // The parent's stream, skipped ahead to the first subsequence of the part
+        auto skipped = TestFixture::get_generator();
+        skipped.set_seed(seed);
+        skipped.keep_subsequences(subsequence_range{parts[i].first, parts[i].size});
+
+        std::vector<unsigned int> output, expected;
+        generate(child, output);
+        generate(skipped, expected);
+        ASSERT_EQ(output, expected);
+        ASSERT_NE(output, expected0);
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+/// Launches the dynamic ordering with a grid that does not divide the grid of the default
+/// ordering, so some threads run several engines with ROCRAND_ORDERING_PSEUDO_PORTABLE.
+struct portable_test_config_provider
+{
+    template<class T>
+    __host__ __device__ static constexpr rocrand_impl::host::generator_config
+        device_config(const bool is_dynamic)
+    {
+        return is_dynamic ? rocrand_impl::host::generator_config{64, 7}
+                          : rocrand_impl::host::generator_config{256, 64};
+    }
+
+    template<class T>
+    static hipError_t host_config(const hipStream_t /*stream*/,
+                                  const rocrand_ordering               ordering,
+                                  rocrand_impl::host::generator_config& config)
+    {
+        config = device_config<T>(rocrand_impl::host::is_ordering_dynamic(ordering));
+        return hipSuccess;
+    }
+};
+
+/// Checks that ROCRAND_ORDERING_PSEUDO_PORTABLE generates the values of
+/// ROCRAND_ORDERING_PSEUDO_DEFAULT in consecutive calls with misaligned outputs.
+template<class Generator>
+void portable_ordering_test()
+{
+    const unsigned long long seed   = 0xdeadbeefbeefULL;
+    const unsigned long long offset = 12345;
+    const size_t             sizes[] = {1, 16384 * 2 + 3, 100000, 777};
+
+    Generator g0, g1;
+    ROCRAND_CHECK(g0.set_order(ROCRAND_ORDERING_PSEUDO_DEFAULT));
+    ROCRAND_CHECK(g1.set_order(ROCRAND_ORDERING_PSEUDO_PORTABLE));
+    for(Generator* g : {&g0, &g1})
+    {
+        g->set_seed(seed);
+        g->set_offset(offset);
+    }
+
+    const size_t max_size = 100000;
+    float*       data0;
+    float*       data1;
+    HIP_CHECK(hipMallocHelper(&data0, sizeof(float) * (max_size + 1)));
+    HIP_CHECK(hipMallocHelper(&data1, sizeof(float) * (max_size + 1)));
+
+    for(size_t i = 0; i < std::size(sizes); i++)
+    {
+        // Odd calls start at a misaligned address to generate heads and tails
+        const size_t size = sizes[i];
+        ROCRAND_CHECK(g0.generate_uniform(data0 + i % 2, size));
+        ROCRAND_CHECK(g1.generate_uniform(data1 + i % 2, size));
+
+        std::vector<float> host_data0(size);
+        std::vector<float> host_data1(size);
+        HIP_CHECK(hipMemcpy(host_data0.data(),
+                            data0 + i % 2,
+                            sizeof(float) * size,
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(host_data1.data(),
+                            data1 + i % 2,
+                            sizeof(float) * size,
+                            hipMemcpyDeviceToHost));
+        ASSERT_EQ(host_data0, host_data1);
+    }
+
+    HIP_CHECK(hipFree(data0));
+    HIP_CHECK(hipFree(data1));
+}
+
 REGISTER_TYPED_TEST_SUITE_P(generator_prng_tests,
                             init_test,
                             uniform_uint_test,
@@ -772,4 +923,7 @@ GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(generator_prng_continuity_tests);
 REGISTER_TYPED_TEST_SUITE_P(generator_prng_offset_tests, offsets_test);
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(generator_prng_offset_tests);
 
+REGISTER_TYPED_TEST_SUITE_P(generator_prng_split_tests, split_test);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(generator_prng_split_tests);
+
 #endif // ROCRAND_TEST_INTERNAL_TEST_ROCRAND_PRNG_HPP_
@@ -0,0 +1,197 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// ROCRAND_RUNTIME_JUMP_POLYNOMIALS changes the definitions of inline functions of the engines,
+// so it must be defined the same way in every translation unit of a program. This test is a
+// separate executable that is built with it.
+#define ROCRAND_RUNTIME_JUMP_POLYNOMIALS
+
+#include <rocrand/rocrand_lfsr113.h>
+#include <rocrand/rocrand_xorwow.h>
+
+// The engines do not use the jump matrices in this mode, here they are the reference.
+#include <rocrand/rocrand_lfsr113_precomputed.h>
+#include <rocrand/rocrand_xorwow_precomputed.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+static_assert(XORWOW_JUMP_LOG2 == 2 && LFSR113_JUMP_LOG2 == 2, "Unexpected jump matrices");
+
+// Jumps the state \p x ahead by \p v steps with the jump matrices of the table version.
+template<unsigned int N, unsigned int Matrices, unsigned int Size>
+void table_jump(unsigned int (&x)[N],
+                unsigned long long v,
+                const unsigned int (&jump_matrices)[Matrices][Size])
+{
+    for(unsigned int mi = 0; v > 0; mi++, v >>= 2)
+    {
+        for(unsigned int s = 0; s < (v & 3); s++)
+        {
+            unsigned int r[N] = {};
+            for(unsigned int i = 0; i < N; i++)
+            {
+                for(unsigned int j = 0; j < 32; j++)
+                {
+                    const unsigned int mask = 0U - ((x[i] >> j) & 1U);
+                    for(unsigned int k = 0; k < N; k++)
+                    {
+                        r[k] ^= mask & jump_matrices[mi][(i * 32 + j) * N + k];
+                    }
+                }
+            }
+            for(unsigned int k = 0; k < N; k++)
+            {
+                x[k] = r[k];
+            }
+        }
+    }
+}
+
+class xorwow_engine_test : public rocrand_device::xorwow_engine
+{
+public:
+    using rocrand_device::xorwow_engine::xorwow_engine;
+
+    void expect_state(const unsigned int (&x)[5], unsigned int d) const
+    {
+        for(unsigned int i = 0; i < 5; i++)
+        {
+            EXPECT_EQ(m_state.x[i], x[i]);
+        }
+        EXPECT_EQ(m_state.d, d);
+    }
+
+    void get_state(unsigned int (&x)[5], unsigned int& d) const
+    {
+        for(unsigned int i = 0; i < 5; i++)
+        {
+            x[i] = m_state.x[i];
+        }
+        d = m_state.d;
+    }
+};
+
+class lfsr113_engine_test : public rocrand_device::lfsr113_engine
+{
+public:
+    using rocrand_device::lfsr113_engine::lfsr113_engine;
+
+    void expect_state(const unsigned int (&z)[4]) const
+    {
+        EXPECT_EQ(m_state.z.x, z[0]);
+        EXPECT_EQ(m_state.z.y, z[1]);
+        EXPECT_EQ(m_state.z.z, z[2]);
+        EXPECT_EQ(m_state.z.w, z[3]);
+    }
+
+    void get_state(unsigned int (&z)[4]) const
+    {
+        z[0] = m_state.z.x;
+        z[1] = m_state.z.y;
+        z[2] = m_state.z.z;
+        z[3] = m_state.z.w;
+    }
+};
+
+constexpr unsigned long long offsets[] = {0ULL,
+                                          1ULL,
+                                          31ULL,
+                                          32ULL,
+                                          159ULL,
+                                          160ULL,
+                                          161ULL,
+                                          4567ULL,
+                                          123456789ULL,
+                                          (1ULL << 40) + 12345ULL,
+                                          ~0ULL};
+
+constexpr unsigned int subsequences[]
+    = {0U, 1U, 2U, 3U, 4U, 123U, 65536U, 1234567U, 0x80000000U, ~0U};
+
+} // namespace
+
+TEST(rocrand_runtime_jump_polynomials_tests, xorwow_discard_test)
+{
+    for(const unsigned long long offset : offsets)
+    {
+        SCOPED_TRACE(::testing::Message() << "with offset=" << offset);
+
+        xorwow_engine_test engine(0x1234567890abcdefULL, 5, 678);
+        unsigned int       x[5];
+        unsigned int       d;
+        engine.get_state(x, d);
+
+        engine.discard(offset);
+        table_jump(x, offset, h_xorwow_jump_matrices);
+        engine.expect_state(x, d + static_cast<unsigned int>(offset) * 362437);
+    }
+}
+
+TEST(rocrand_runtime_jump_polynomials_tests, xorwow_discard_subsequence_test)
+{
+    for(const unsigned long long subsequence : subsequences)
+    {
+        SCOPED_TRACE(::testing::Message() << "with subsequence=" << subsequence);
+
+        xorwow_engine_test engine(0x1234567890abcdefULL, 5, 678);
+        unsigned int       x[5];
+        unsigned int       d;
+        engine.get_state(x, d);
+
+        engine.discard_subsequence(subsequence);
+        table_jump(x, subsequence, h_xorwow_sequence_jump_matrices);
+        engine.expect_state(x, d);
+    }
+}
+
+TEST(rocrand_runtime_jump_polynomials_tests, lfsr113_discard_test)
+{
+    for(const unsigned long long offset : offsets)
+    {
+        SCOPED_TRACE(::testing::Message() << "with offset=" << offset);
+
+        lfsr113_engine_test engine({0x12345678U, 0x9abcdef0U, 0x0fedcba9U, 0x87654321U}, 5, 678);
+        unsigned int        z[4];
+        engine.get_state(z);
+
+        engine.discard(offset);
+        table_jump(z, offset, h_lfsr113_jump_matrices);
+        engine.expect_state(z);
+    }
+}
+
+TEST(rocrand_runtime_jump_polynomials_tests, lfsr113_discard_subsequence_test)
+{
+    for(const unsigned int subsequence : subsequences)
+    {
+        SCOPED_TRACE(::testing::Message() << "with subsequence=" << subsequence);
+
+        lfsr113_engine_test engine({0x12345678U, 0x9abcdef0U, 0x0fedcba9U, 0x87654321U}, 5, 678);
+        unsigned int        z[4];
+        engine.get_state(z);
+
+        engine.discard_subsequence(subsequence);
+        table_jump(z, subsequence, h_lfsr113_sequence_jump_matrices);
+        engine.expect_state(z);
+    }
+}
@@ -660,6 +660,166 @@ TYPED_TEST_P(sobol_qrng_tests, continuity_test)
     }
 }
 
+// Check that the point-major layout stores the same values as the dimension-major layout,
+// transposed, and that it continues the sequence over subsequent generations. The dimensions
+// above 32 are split into blocks of different numbers of dimensions.
+TYPED_TEST_P(sobol_qrng_tests, point_major_layout_test)
+{
+    using generator_t = typename TestFixture::generator_t;
+
+    constexpr unsigned int    dimensions_list[] = {1, 3, 17, 32, 33, 45, 47, 100};
+    const std::vector<size_t> sizes({1, 100, 4097, 65536});
+
+    for(const unsigned int dimensions : dimensions_list)
+    {
+        SCOPED_TRACE(testing::Message() << "with dimensions = " << dimensions);
+
+        generator_t g0 = TestFixture::get_generator();
+        generator_t g1 = TestFixture::get_generator();
+        ROCRAND_CHECK(g0.set_dimensions(dimensions));
+        ROCRAND_CHECK(g1.set_dimensions(dimensions));
+        ROCRAND_CHECK(g1.set_layout(ROCRAND_QUASI_RANDOM_LAYOUT_POINT_MAJOR));
+
+        for(const size_t size : sizes)
+        {
+            SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+            const size_t  data_size = size * dimensions;
+            unsigned int* data0;
+            unsigned int* data1;
+            HIP_CHECK(hipMalloc(&data0, sizeof(unsigned int) * data_size));
+            HIP_CHECK(hipMalloc(&data1, sizeof(unsigned int) * data_size));
+
+            ROCRAND_CHECK(g0.generate(data0, data_size));
+            ROCRAND_CHECK(g1.generate(data1, data_size));
+
+            std::vector<unsigned int> host_data0(data_size);
+            std::vector<unsigned int> host_data1(data_size);
+            HIP_CHECK(hipMemcpy(host_data0.data(),
+                                data0,
+                                sizeof(unsigned int) * data_size,
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipMemcpy(host_data1.data(),
+                                data1,
+                                sizeof(unsigned int) * data_size,
+                                hipMemcpyDeviceToHost));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            for(unsigned int d = 0; d < dimensions; d++)
+            {
+                for(size_t i = 0; i < size; i++)
+                {
+                    ASSERT_EQ(host_data0[d * size + i], host_data1[i * dimensions + d]);
+                }
+            }
+
+            HIP_CHECK(hipFree(data0));
+            HIP_CHECK(hipFree(data1));
+        }
+    }
+
+    generator_t g = TestFixture::get_generator();
+    EXPECT_EQ(g.set_layout(static_cast<rocrand_quasi_random_layout>(0)),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+}
+
+TYPED_TEST_P(sobol_qrng_tests, brownian_bridge_test)
+{
+    using generator_t = typename TestFixture::generator_t;
+
+    constexpr unsigned int dimensions_list[] = {1, 3, 17, 64};
+    constexpr size_t       paths             = 1000;
+    constexpr float        time_step         = 0.25f;
+
+    for(const unsigned int dimensions : dimensions_list)
+    {
+        SCOPED_TRACE(testing::Message() << "with dimensions = " << dimensions);
+
+        const std::vector<rocrand_impl::host::brownian_bridge_step<float>> steps
+            = rocrand_impl::host::create_brownian_bridge_steps<float>(dimensions);
+
+        for(const rocrand_quasi_random_layout layout :
+            {ROCRAND_QUASI_RANDOM_LAYOUT_DIMENSION_MAJOR, ROCRAND_QUASI_RANDOM_LAYOUT_POINT_MAJOR})
+        {
+            SCOPED_TRACE(testing::Message() << "with layout = " << layout);
+
+            generator_t g0 = TestFixture::get_generator();
+            generator_t g1 = TestFixture::get_generator();
+            ROCRAND_CHECK(g0.set_dimensions(dimensions));
+            ROCRAND_CHECK(g1.set_dimensions(dimensions));
+            ROCRAND_CHECK(g0.set_layout(ROCRAND_QUASI_RANDOM_LAYOUT_POINT_MAJOR));
+            ROCRAND_CHECK(g1.set_layout(layout));
+
+            const size_t data_size = paths * dimensions;
+            float*       normals;
+            float*       increments;
+            HIP_CHECK(hipMalloc(&normals, sizeof(float) * data_size));
+            HIP_CHECK(hipMalloc(&increments, sizeof(float) * data_size));
+
+            // Two generations check that the offset is advanced
+            for(int generation = 0; generation < 2; generation++)
+            {
+                ROCRAND_CHECK(g0.generate_normal(normals, data_size, 0.0f, 1.0f));
+                ROCRAND_CHECK(g1.generate_brownian_bridge(increments, data_size, time_step));
+
+                std::vector<float> host_normals(data_size);
+                std::vector<float> host_increments(data_size);
+                HIP_CHECK(hipMemcpy(host_normals.data(),
+                                    normals,
+                                    sizeof(float) * data_size,
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipMemcpy(host_increments.data(),
+                                    increments,
+                                    sizeof(float) * data_size,
+                                    hipMemcpyDeviceToHost));
+                HIP_CHECK(hipDeviceSynchronize());
+
+                std::vector<float> expected(dimensions);
+                for(size_t p = 0; p < paths; p++)
+                {
+                    const float* point = &host_normals[p * dimensions];
+                    rocrand_impl::host::construct_brownian_bridge(steps.data(),
+                                                                  dimensions,
+                                                                  std::sqrt(time_step),
+                                                                  expected.data(),
+                                                                  1,
+                                                                  [&](unsigned int d)
+                                                                  { return point[d]; });
+                    for(unsigned int s = dimensions - 1; s > 0; s--)
+                    {
+                        expected[s] -= expected[s - 1];
+                    }
+
+                    float end_point = 0.0f;
+                    for(unsigned int s = 0; s < dimensions; s++)
+                    {
+                        const float actual
+                            = layout == ROCRAND_QUASI_RANDOM_LAYOUT_POINT_MAJOR
+                                  ? host_increments[p * dimensions + s]
+                                  : host_increments[s * paths + p];
+                        ASSERT_NEAR(actual, expected[s], 1e-4f * (1.0f + std::abs(expected[s])));
+                        end_point += actual;
+                    }
+                    // The first dimension determines the end point of the path
+                    ASSERT_NEAR(end_point,
+                                std::sqrt(time_step * dimensions) * point[0],
+                                1e-4f * dimensions * (1.0f + std::abs(point[0])));
+                }
+            }
+
+            HIP_CHECK(hipFree(normals));
+            HIP_CHECK(hipFree(increments));
+        }
+    }
+
+    generator_t g = TestFixture::get_generator();
+    ROCRAND_CHECK(g.set_dimensions(3));
+    float* data;
+    HIP_CHECK(hipMalloc(&data, sizeof(float) * 10));
+    EXPECT_EQ(g.generate_brownian_bridge(data, 10, time_step), ROCRAND_STATUS_LENGTH_NOT_MULTIPLE);
+    HIP_CHECK(hipFree(data));
+}
+
 REGISTER_TYPED_TEST_SUITE_P(sobol_qrng_tests,
                             init_test,
                             uniform_uint_test,
@@ -676,6 +836,8 @@ REGISTER_TYPED_TEST_SUITE_P(sobol_qrng_tests,
                             discard_test,
                             discard_stride_test,
                             offsets_test,
-                            continuity_test);
+                            continuity_test,
+                            point_major_layout_test,
+                            brownian_bridge_test);
 
 #endif // ROCRAND_TEST_INTERNAL_TEST_ROCRAND_SOBOL_QRNG_HPP_
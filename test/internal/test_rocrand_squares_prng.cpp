@@ -0,0 +1,205 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+#include "test_rocrand_prng.hpp"
+#include <rocrand/rocrand.h>
+#include <rocrand/rocrand_squares.h>
+
+#include <rng/squares.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using rocrand_impl::host::squares_generator;
+
+// Generator API tests
+using squares_generator_prng_tests_types = ::testing::Types<
+    generator_prng_tests_params<squares_generator, ROCRAND_ORDERING_PSEUDO_DEFAULT>,
+    generator_prng_tests_params<squares_generator, ROCRAND_ORDERING_PSEUDO_DYNAMIC>>;
+
+using squares_generator_prng_offset_tests_types
+    = ::testing::Types<generator_prng_offset_tests_params<unsigned int,
+                                                          squares_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DEFAULT>,
+                       generator_prng_offset_tests_params<unsigned int,
+                                                          squares_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DYNAMIC>,
+                       generator_prng_offset_tests_params<float,
+                                                          squares_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DEFAULT>,
+                       generator_prng_offset_tests_params<float,
+                                                          squares_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DYNAMIC>>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(squares_generator,
+                               generator_prng_tests,
+                               squares_generator_prng_tests_types);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(squares_generator,
+                               generator_prng_continuity_tests,
+                               squares_generator_prng_tests_types);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(squares_generator,
+                               generator_prng_split_tests,
+                               squares_generator_prng_tests_types);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(squares_generator,
+                               generator_prng_offset_tests,
+                               squares_generator_prng_offset_tests_types);
+
+// Engine API tests
+TEST(squares_engine_api_tests, key_test)
+{
+    for(unsigned long long stream = 0; stream < 10000; stream++)
+    {
+        const unsigned long long key = rocrand_device::detail::squares_key(stream);
+
+        // Odd, all digits non-zero and neighbouring digits differ
+        EXPECT_EQ(key & 1, 1U);
+        unsigned int prev = 0;
+        for(int i = 60; i >= 0; i -= 4)
+        {
+            const unsigned int digit = (key >> i) & 0xF;
+            EXPECT_NE(digit, 0U);
+            EXPECT_NE(digit, prev);
+            prev = digit;
+        }
+    }
+}
+
+TEST(squares_engine_api_tests, random_access_test)
+{
+    using engine_t = squares_generator::engine_type;
+
+    const unsigned long long seed        = 1234567ULL;
+    const unsigned long long subsequence = 89ULL;
+    const unsigned long long offset      = 0xFFFFFFFFFFFFFF00ULL;
+    const unsigned long long key         = rocrand_squares_key(seed, subsequence);
+
+    engine_t engine(seed, subsequence, offset);
+    EXPECT_EQ(engine.key(), key);
+    // The counter wraps around after 2^64 numbers
+    for(unsigned long long i = 0; i < 512; i++)
+    {
+        EXPECT_EQ(engine(), rocrand_squares32(key, offset + i));
+    }
+}
+
+TEST(squares_engine_api_tests, squares64_test)
+{
+    const unsigned long long key = rocrand_squares_key(0, 0);
+    for(unsigned long long counter = 0; counter < 1000; counter++)
+    {
+        // The upper half of the 64-bit output is the 32-bit output
+        EXPECT_EQ(rocrand_squares64(key, counter) >> 32, rocrand_squares32(key, counter));
+    }
+}
+
+TEST(squares_engine_api_tests, generator_random_access_test)
+{
+    const unsigned long long seed   = 9876ULL;
+    const unsigned long long offset = 1234ULL;
+    const size_t             size   = 12345;
+
+    squares_generator g;
+    g.set_seed(seed);
+    g.set_offset(offset);
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(&data, sizeof(unsigned int) * size));
+    ROCRAND_CHECK(g.generate(data, size));
+
+    std::vector<unsigned int> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, sizeof(unsigned int) * size, hipMemcpyDefault));
+    HIP_CHECK(hipFree(data));
+
+    // Element i of the output is the value at counter offset + i
+    const unsigned long long key = rocrand_squares_key(seed, 0);
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(host_data[i], rocrand_squares32(key, offset + i));
+    }
+}
+
+TEST(squares_engine_api_tests, discard_test)
+{
+    using engine_t = squares_generator::engine_type;
+
+    const unsigned long long seed = 1234567ULL;
+    engine_t                 engine1(seed, 0, 678U);
+    engine_t                 engine2(seed, 0, 677U);
+
+    // Check next() function
+    (void)engine2.next();
+
+    EXPECT_EQ(engine1(), engine2());
+
+    // Check discard() function
+    (void)engine1.next();
+    engine2.discard();
+
+    EXPECT_EQ(engine1(), engine2());
+
+    // Check discard(offset) function
+    const unsigned int offsets[]
+        = {1U, 4U, 37U, 583U, 7452U, 21032U, 35678U, 66778U, 10313475U, 82120230U};
+
+    for(auto offset : offsets)
+    {
+        for(unsigned int i = 0; i < offset; i++)
+        {
+            (void)engine1.next();
+        }
+        engine2.discard(offset);
+
+        EXPECT_EQ(engine1(), engine2());
+    }
+}
+
+TEST(squares_engine_api_tests, discard_sequence_test)
+{
+    using engine_t = squares_generator::engine_type;
+
+    const unsigned long long seed = 1234567ULL;
+    engine_t                 engine1(seed, 0, 444U);
+    engine_t                 engine2(seed, 123U, 444U);
+
+    engine1.discard_subsequence(123U);
+
+    EXPECT_EQ(engine1(), engine2());
+
+    engine1.discard(5356446450ULL);
+    engine1.discard_subsequence(123U);
+    engine1.discard(30000000006ULL);
+
+    engine2.discard_subsequence(3U);
+    engine2.discard(35356446456ULL);
+    engine2.discard_subsequence(120U);
+
+    EXPECT_EQ(engine1(), engine2());
+
+    // Different subsequences use different keys
+    engine_t engine3(seed, 0, 0);
+    engine_t engine4(seed, 1, 0);
+    EXPECT_NE(engine3.key(), engine4.key());
+}
@@ -52,6 +52,10 @@ INSTANTIATE_TYPED_TEST_SUITE_P(threefry2x32_20_generator,
                                generator_prng_continuity_tests,
                                threefry2x32_20_generator_prng_tests_types);
 
+INSTANTIATE_TYPED_TEST_SUITE_P(threefry2x32_20_generator,
+                               generator_prng_split_tests,
+                               threefry2x32_20_generator_prng_tests_types);
+
 INSTANTIATE_TYPED_TEST_SUITE_P(threefry2x32_20_generator,
                                generator_prng_offset_tests,
                                threefry2x32_20_generator_prng_offset_tests_types);
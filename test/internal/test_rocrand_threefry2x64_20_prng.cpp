@@ -53,6 +53,10 @@ INSTANTIATE_TYPED_TEST_SUITE_P(threefry2x64_20_generator,
                                generator_prng_continuity_tests,
                                threefry2x64_20_generator_prng_tests_types);
 
+INSTANTIATE_TYPED_TEST_SUITE_P(threefry2x64_20_generator,
+                               generator_prng_split_tests,
+                               threefry2x64_20_generator_prng_tests_types);
+
 INSTANTIATE_TYPED_TEST_SUITE_P(threefry2x64_20_generator,
                                generator_prng_offset_tests,
                                threefry2x64_20_generator_prng_offset_tests_types);
@@ -53,6 +53,10 @@ INSTANTIATE_TYPED_TEST_SUITE_P(threefry4x32_20_generator,
                                generator_prng_continuity_tests,
                                threefry4x32_20_generator_prng_tests_types);
 
+INSTANTIATE_TYPED_TEST_SUITE_P(threefry4x32_20_generator,
+                               generator_prng_split_tests,
+                               threefry4x32_20_generator_prng_tests_types);
+
 INSTANTIATE_TYPED_TEST_SUITE_P(threefry4x32_20_generator,
                                generator_prng_offset_tests,
                                threefry4x32_20_generator_prng_offset_tests_types);
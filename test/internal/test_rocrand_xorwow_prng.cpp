@@ -32,7 +32,8 @@ using rocrand_impl::host::xorwow_generator;
 // Generator API tests
 using xorwow_generator_prng_tests_types = ::testing::Types<
     generator_prng_tests_params<xorwow_generator, ROCRAND_ORDERING_PSEUDO_DEFAULT>,
-    generator_prng_tests_params<xorwow_generator, ROCRAND_ORDERING_PSEUDO_DYNAMIC>>;
+    generator_prng_tests_params<xorwow_generator, ROCRAND_ORDERING_PSEUDO_DYNAMIC>,
+    generator_prng_tests_params<xorwow_generator, ROCRAND_ORDERING_PSEUDO_PORTABLE>>;
 
 using xorwow_generator_prng_offset_tests_types = ::testing::Types<
     generator_prng_offset_tests_params<unsigned int,
@@ -52,13 +53,39 @@ INSTANTIATE_TYPED_TEST_SUITE_P(xorwow_generator,
                                generator_prng_continuity_tests,
                                xorwow_generator_prng_tests_types);
 
+INSTANTIATE_TYPED_TEST_SUITE_P(xorwow_generator,
+                               generator_prng_split_tests,
+                               xorwow_generator_prng_tests_types);
+
 INSTANTIATE_TYPED_TEST_SUITE_P(xorwow_generator,
                                generator_prng_offset_tests,
                                xorwow_generator_prng_offset_tests_types);
 
+TEST(xorwow_generator_portable_tests, same_as_default_test)
+{
+    portable_ordering_test<
+        rocrand_impl::host::xorwow_generator_template<rocrand_impl::system::device_system,
+                                                      portable_test_config_provider>>();
+}
+
 // Engine API tests
 class xorwow_engine_type_test : public xorwow_generator::engine_type
-{};
+{
+public:
+    using xorwow_generator::engine_type::engine_type;
+
+    // Same as discard() and discard_subsequence() with ROCRAND_RUNTIME_JUMP_POLYNOMIALS
+    void discard_runtime(unsigned long long offset)
+    {
+        jump_polynomial(offset, 0);
+        m_state.d += static_cast<unsigned int>(offset) * 362437;
+    }
+
+    void discard_subsequence_runtime(unsigned long long subsequence)
+    {
+        jump_polynomial(subsequence, 67);
+    }
+};
 
 TEST(xorwow_engine_type_test, discard_test)
 {
@@ -120,3 +147,134 @@ TEST(xorwow_engine_type_test, discard_sequence_test)
 
     EXPECT_EQ(engine1(), engine2());
 }
+
+TEST(xorwow_engine_type_test, runtime_jump_polynomial_test)
+{
+    const unsigned long long seed = 1234567890123ULL;
+
+    const unsigned long long ds[] = {1ULL,
+                                     37ULL,
+                                     159ULL,
+                                     160ULL,
+                                     7452ULL,
+                                     82120230ULL,
+                                     5356446450ULL,
+                                     0xdeadbeefcafebabeULL,
+                                     ~0ULL};
+
+    for(auto d : ds)
+    {
+        xorwow_engine_type_test engine1(seed, 0, 0);
+        xorwow_engine_type_test engine2(seed, 0, 0);
+
+        engine1.discard(d);
+        engine2.discard_runtime(d);
+
+        EXPECT_EQ(engine1(), engine2());
+
+        engine1.discard_subsequence(d);
+        engine2.discard_subsequence_runtime(d);
+
+        EXPECT_EQ(engine1(), engine2());
+    }
+}
+
+// The engines skip offset / engines_size numbers, check offsets for which it does not fit
+// in 32 bits.
+TEST(xorwow_engine_type_test, large_offset_test)
+{
+    using generator_t = xorwow_generator;
+    using engine_t    = generator_t::engine_type;
+
+    const unsigned long long seed = 1234567890123ULL;
+    constexpr size_t size = 1313;
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(&data, sizeof(unsigned int) * size));
+
+    const unsigned long long offsets[] = {(1ULL << 40) + 3ULL, (1ULL << 52) + 1234567ULL};
+    for(const unsigned long long offset : offsets)
+    {
+        SCOPED_TRACE(::testing::Message() << "with offset=" << offset);
+
+        generator_t g;
+        g.set_seed(seed);
+        ROCRAND_CHECK(g.set_offset(offset));
+        ROCRAND_CHECK(g.generate_uniform(data, size));
+
+        unsigned int host_data[size];
+        HIP_CHECK(hipMemcpy(host_data, data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+
+        // The number of engines is part of the saved state
+        size_t state_size;
+        ROCRAND_CHECK(g.get_state_size(state_size));
+        const unsigned long long engines_size
+            = (state_size - sizeof(rocrand_impl::host::generator_state_header)) / sizeof(engine_t);
+
+        for(size_t i = 0; i < size; i += 97)
+        {
+            const unsigned long long index     = offset + i;
+            const unsigned int       engine_id = static_cast<unsigned int>(index % engines_size);
+            const unsigned long long position  = index / engines_size;
+            engine_t engine(seed, engine_id, position);
+            ASSERT_EQ(host_data[i], engine());
+        }
+    }
+
+    HIP_CHECK(hipFree(data));
+}
+
+// A state with the engines of another layout is rejected before the ordering or the engines
+// of the generator are changed, so the generator continues its own sequence.
+TEST(xorwow_generator_state_tests, layout_mismatch_test)
+{
+    using generator_t = xorwow_generator;
+    using header_t    = rocrand_impl::host::generator_state_header;
+
+    constexpr size_t size = 4099;
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(&data, sizeof(unsigned int) * size));
+
+    generator_t saved;
+    saved.set_seed(12345ULL);
+    ROCRAND_CHECK(saved.generate_uniform(data, size));
+
+    size_t state_size;
+    ROCRAND_CHECK(saved.get_state_size(state_size));
+    void* state;
+    HIP_CHECK(hipMallocHelper(&state, state_size));
+    ROCRAND_CHECK(saved.save_state(state));
+
+    // The state claims to be saved with the dynamic ordering and one more engine
+    header_t header;
+    HIP_CHECK(hipMemcpy(&header, state, sizeof(header_t), hipMemcpyDeviceToHost));
+    header.order = ROCRAND_ORDERING_PSEUDO_DYNAMIC;
+    header.engines_size++;
+    HIP_CHECK(hipMemcpy(state, &header, sizeof(header_t), hipMemcpyHostToDevice));
+
+    generator_t loaded;
+    generator_t expected;
+    loaded.set_seed(54321ULL);
+    expected.set_seed(54321ULL);
+    ROCRAND_CHECK(loaded.generate_uniform(data, 17));
+    ROCRAND_CHECK(expected.generate_uniform(data, 17));
+
+    EXPECT_EQ(loaded.load_state(state), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(loaded.get_order(), ROCRAND_ORDERING_PSEUDO_DEFAULT);
+
+    std::vector<unsigned int> output(size);
+    std::vector<unsigned int> expected_output(size);
+    ROCRAND_CHECK(loaded.generate_uniform(data, size));
+    HIP_CHECK(
+        hipMemcpy(output.data(), data, sizeof(unsigned int) * size, hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(expected.generate_uniform(data, size));
+    HIP_CHECK(hipMemcpy(expected_output.data(),
+                        data,
+                        sizeof(unsigned int) * size,
+                        hipMemcpyDeviceToHost));
+    assert_eq(output, expected_output);
+
+    HIP_CHECK(hipFree(state));
+    HIP_CHECK(hipFree(data));
+}
@@ -0,0 +1,362 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+#include "test_rocrand_prng.hpp"
+#include <rocrand/rocrand.h>
+
+#include <rng/xoshiro.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+using rocrand_impl::host::xoroshiro128ss_generator;
+using rocrand_impl::host::xoshiro256pp_generator;
+
+// Generator API tests
+using xoshiro_generator_prng_tests_types = ::testing::Types<
+    generator_prng_tests_params<xoshiro256pp_generator, ROCRAND_ORDERING_PSEUDO_DEFAULT>,
+    generator_prng_tests_params<xoshiro256pp_generator, ROCRAND_ORDERING_PSEUDO_DYNAMIC>,
+    generator_prng_tests_params<xoroshiro128ss_generator, ROCRAND_ORDERING_PSEUDO_DEFAULT>,
+    generator_prng_tests_params<xoroshiro128ss_generator, ROCRAND_ORDERING_PSEUDO_DYNAMIC>>;
+
+using xoshiro_generator_prng_offset_tests_types
+    = ::testing::Types<generator_prng_offset_tests_params<unsigned long long,
+                                                          xoshiro256pp_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DEFAULT>,
+                       generator_prng_offset_tests_params<unsigned long long,
+                                                          xoshiro256pp_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DYNAMIC>,
+                       generator_prng_offset_tests_params<float,
+                                                          xoshiro256pp_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DEFAULT>,
+                       generator_prng_offset_tests_params<unsigned long long,
+                                                          xoroshiro128ss_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DEFAULT>,
+                       generator_prng_offset_tests_params<unsigned long long,
+                                                          xoroshiro128ss_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DYNAMIC>,
+                       generator_prng_offset_tests_params<float,
+                                                          xoroshiro128ss_generator,
+                                                          ROCRAND_ORDERING_PSEUDO_DEFAULT>>;
+
+INSTANTIATE_TYPED_TEST_SUITE_P(xoshiro_generator,
+                               generator_prng_tests,
+                               xoshiro_generator_prng_tests_types);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(xoshiro_generator,
+                               generator_prng_continuity_tests,
+                               xoshiro_generator_prng_tests_types);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(xoshiro_generator,
+                               generator_prng_offset_tests,
+                               xoshiro_generator_prng_offset_tests_types);
+
+// Reference implementations by David Blackman and Sebastiano Vigna
+// (https://prng.di.unimi.it/), seeded with SplitMix64.
+namespace
+{
+
+unsigned long long reference_rotl(const unsigned long long x, const int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+unsigned long long reference_splitmix64(unsigned long long& x)
+{
+    unsigned long long z = (x += 0x9E3779B97F4A7C15ULL);
+    z                    = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z                    = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+struct xoshiro256pp_reference
+{
+    unsigned long long s[4];
+
+    explicit xoshiro256pp_reference(unsigned long long seed)
+    {
+        for(unsigned long long& v : s)
+        {
+            v = reference_splitmix64(seed);
+        }
+    }
+
+    unsigned long long next()
+    {
+        const unsigned long long result = reference_rotl(s[0] + s[3], 23) + s[0];
+        const unsigned long long t      = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = reference_rotl(s[3], 45);
+        return result;
+    }
+
+    void jump(const unsigned long long (&polynomial)[4])
+    {
+        unsigned long long t[4] = {0, 0, 0, 0};
+        for(unsigned long long word : polynomial)
+        {
+            for(int b = 0; b < 64; b++)
+            {
+                if(word & (1ULL << b))
+                {
+                    for(int i = 0; i < 4; i++)
+                    {
+                        t[i] ^= s[i];
+                    }
+                }
+                next();
+            }
+        }
+        std::copy(t, t + 4, s);
+    }
+
+    void jump()
+    {
+        jump({0x180ec6d33cfd0abaULL,
+              0xd5a61266f0c9392cULL,
+              0xa9582618e03fc9aaULL,
+              0x39abdc4529b1661cULL});
+    }
+
+    void long_jump()
+    {
+        jump({0x76e15d3efefdcbbfULL,
+              0xc5004e441c522fb3ULL,
+              0x77710069854ee241ULL,
+              0x39109bb02acbe635ULL});
+    }
+};
+
+struct xoroshiro128ss_reference
+{
+    unsigned long long s[2];
+
+    explicit xoroshiro128ss_reference(unsigned long long seed)
+    {
+        for(unsigned long long& v : s)
+        {
+            v = reference_splitmix64(seed);
+        }
+    }
+
+    unsigned long long next()
+    {
+        const unsigned long long s0     = s[0];
+        unsigned long long       s1     = s[1];
+        const unsigned long long result = reference_rotl(s0 * 5, 7) * 9;
+        s1 ^= s0;
+        s[0] = reference_rotl(s0, 24) ^ s1 ^ (s1 << 16);
+        s[1] = reference_rotl(s1, 37);
+        return result;
+    }
+
+    void jump(const unsigned long long (&polynomial)[2])
+    {
+        unsigned long long t[2] = {0, 0};
+        for(unsigned long long word : polynomial)
+        {
+            for(int b = 0; b < 64; b++)
+            {
+                if(word & (1ULL << b))
+                {
+                    t[0] ^= s[0];
+                    t[1] ^= s[1];
+                }
+                next();
+            }
+        }
+        s[0] = t[0];
+        s[1] = t[1];
+    }
+
+    void jump()
+    {
+        jump({0xdf900294d8f554a5ULL, 0x170865df4b3201fcULL});
+    }
+
+    void long_jump()
+    {
+        jump({0xd2a98b26625eee7bULL, 0xdddf9b1090aa7ac1ULL});
+    }
+};
+
+} // namespace
+
+// Engine API tests
+template<class Generator, class Reference>
+struct xoshiro_engine_params
+{
+    using engine_t    = typename Generator::engine_type;
+    using reference_t = Reference;
+};
+
+template<class Params>
+struct xoshiro_engine_api_tests : public ::testing::Test
+{
+    using engine_t    = typename Params::engine_t;
+    using reference_t = typename Params::reference_t;
+};
+
+using xoshiro_engine_api_tests_types
+    = ::testing::Types<xoshiro_engine_params<xoshiro256pp_generator, xoshiro256pp_reference>,
+                       xoshiro_engine_params<xoroshiro128ss_generator, xoroshiro128ss_reference>>;
+
+TYPED_TEST_SUITE(xoshiro_engine_api_tests, xoshiro_engine_api_tests_types);
+
+// The engines must produce the same sequence as the reference implementations
+TYPED_TEST(xoshiro_engine_api_tests, reference_test)
+{
+    using engine_t    = typename TestFixture::engine_t;
+    using reference_t = typename TestFixture::reference_t;
+
+    for(unsigned long long seed : {0ULL, 1ULL, 0xdeadbeefULL, 0x123456789abcdef0ULL})
+    {
+        engine_t    engine(seed, 0, 0);
+        reference_t reference(seed);
+        for(int i = 0; i < 1000; i++)
+        {
+            ASSERT_EQ(engine(), reference.next());
+        }
+    }
+}
+
+// A subsequence is one published jump, a sequence is one published long jump
+TYPED_TEST(xoshiro_engine_api_tests, reference_jump_test)
+{
+    using engine_t    = typename TestFixture::engine_t;
+    using reference_t = typename TestFixture::reference_t;
+
+    const unsigned long long seed = 1234567ULL;
+
+    engine_t    engine(seed, 3, 0);
+    reference_t reference(seed);
+    reference.jump();
+    reference.jump();
+    reference.jump();
+    for(int i = 0; i < 100; i++)
+    {
+        ASSERT_EQ(engine(), reference.next());
+    }
+
+    engine.discard_sequence(2);
+    reference.long_jump();
+    reference.long_jump();
+    for(int i = 0; i < 100; i++)
+    {
+        ASSERT_EQ(engine(), reference.next());
+    }
+}
+
+TYPED_TEST(xoshiro_engine_api_tests, discard_test)
+{
+    using engine_t = typename TestFixture::engine_t;
+
+    const unsigned long long seed = 1234567ULL;
+    engine_t                 engine1(seed, 0, 678U);
+    engine_t                 engine2(seed, 0, 677U);
+
+    // Check next() function
+    (void)engine2.next();
+
+    EXPECT_EQ(engine1(), engine2());
+
+    // Check discard() function
+    (void)engine1.next();
+    engine2.discard();
+
+    EXPECT_EQ(engine1(), engine2());
+
+    // Check discard(offset) function, including offsets that are
+    // skipped with the jump polynomials
+    const unsigned int offsets[]
+        = {1U, 4U, 37U, 255U, 256U, 583U, 7452U, 21032U, 35678U, 66778U, 10313475U};
+
+    for(auto offset : offsets)
+    {
+        for(unsigned int i = 0; i < offset; i++)
+        {
+            (void)engine1.next();
+        }
+        engine2.discard(offset);
+
+        EXPECT_EQ(engine1(), engine2());
+    }
+}
+
+TYPED_TEST(xoshiro_engine_api_tests, discard_sequence_test)
+{
+    using engine_t = typename TestFixture::engine_t;
+
+    const unsigned long long seed = 1234567ULL;
+    engine_t                 engine1(seed, 0, 444U);
+    engine_t                 engine2(seed, 123U, 444U);
+
+    engine1.discard_subsequence(123U);
+
+    EXPECT_EQ(engine1(), engine2());
+
+    engine1.discard(5356446450ULL);
+    engine1.discard_subsequence(123U);
+    engine1.discard(30000000006ULL);
+
+    engine2.discard_subsequence(3U);
+    engine2.discard(35356446456ULL);
+    engine2.discard_subsequence(120U);
+
+    EXPECT_EQ(engine1(), engine2());
+
+    engine1.discard_subsequence(3456000U);
+    engine1.discard_subsequence(1000005U);
+
+    engine2.discard_subsequence(4456005U);
+
+    EXPECT_EQ(engine1(), engine2());
+
+    engine1.discard_sequence(7U);
+    engine1.discard_sequence(5U);
+
+    engine2.discard_sequence(12U);
+
+    EXPECT_EQ(engine1(), engine2());
+}
+
+TEST(xoshiro_engine_api_tests, known_answer_test)
+{
+    xoshiro256pp_generator::engine_type   xoshiro256pp(0, 0, 0);
+    xoroshiro128ss_generator::engine_type xoroshiro128ss(0, 0, 0);
+
+    const unsigned long long xoshiro256pp_expected[]
+        = {0x53175d61490b23dfULL, 0x61da6f3dc380d507ULL, 0x5c0fdf91ec9a7bfcULL, 0x02eebf8c3bbe5e1aULL};
+    const unsigned long long xoroshiro128ss_expected[]
+        = {0xdec90d521e93e35dULL, 0x6d33ac6f18895e08ULL, 0xab21904eec6fa48aULL, 0x87afdbc188423fbeULL};
+
+    for(int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(xoshiro256pp(), xoshiro256pp_expected[i]);
+        EXPECT_EQ(xoroshiro128ss(), xoroshiro128ss_expected[i]);
+    }
+}
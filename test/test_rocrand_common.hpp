@@ -37,6 +37,11 @@ constexpr rocrand_rng_type rng_types[] = {ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
                                           ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
                                           ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
                                           ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+                                          ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+                                          ROCRAND_RNG_PSEUDO_XOSHIRO256PP,
+                                          ROCRAND_RNG_PSEUDO_XOROSHIRO128SS,
+                                          ROCRAND_RNG_PSEUDO_PCG64_DXSM,
+                                          ROCRAND_RNG_PSEUDO_SQUARES,
                                           ROCRAND_RNG_QUASI_SOBOL32,
                                           ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32,
                                           ROCRAND_RNG_QUASI_SOBOL64,
@@ -50,11 +55,16 @@ constexpr rocrand_rng_type int_rng_types[] = {ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
                                               ROCRAND_RNG_PSEUDO_LFSR113,
                                               ROCRAND_RNG_PSEUDO_THREEFRY2_32_20,
                                               ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
+                                              ROCRAND_RNG_PSEUDO_SQUARES,
                                               ROCRAND_RNG_QUASI_SOBOL32,
                                               ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32};
 
 constexpr rocrand_rng_type long_long_rng_types[] = {ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
                                                     ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+                                                    ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+                                                    ROCRAND_RNG_PSEUDO_XOSHIRO256PP,
+                                                    ROCRAND_RNG_PSEUDO_XOROSHIRO128SS,
+                                                    ROCRAND_RNG_PSEUDO_PCG64_DXSM,
                                                     ROCRAND_RNG_QUASI_SOBOL64,
                                                     ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64};
 
@@ -39,6 +39,7 @@ using GeneratorTypes = testing::Types<rocrand_cpp::lfsr113,
                                       rocrand_cpp::mt19937,
                                       rocrand_cpp::mtgp32,
                                       rocrand_cpp::philox4x32_10,
+                                      rocrand_cpp::philox4x64_10,
                                       rocrand_cpp::scrambled_sobol32,
                                       rocrand_cpp::scrambled_sobol64,
                                       rocrand_cpp::sobol32,
@@ -47,7 +48,11 @@ using GeneratorTypes = testing::Types<rocrand_cpp::lfsr113,
                                       rocrand_cpp::threefry2x64,
                                       rocrand_cpp::threefry4x32,
                                       rocrand_cpp::threefry4x64,
-                                      rocrand_cpp::xorwow>;
+                                      rocrand_cpp::xorwow,
+                                      rocrand_cpp::xoshiro256pp,
+                                      rocrand_cpp::xoroshiro128ss,
+                                      rocrand_cpp::pcg64_dxsm,
+                                      rocrand_cpp::squares>;
 
 TYPED_TEST_SUITE(rocrand_cpp_basic_tests, GeneratorTypes);
 
@@ -50,12 +50,17 @@ TEST(rocrand_cpp_wrapper, rocrand_prng_default_seed)
     EXPECT_EQ(rocrand_cpp::mt19937::default_seed, 0);
     EXPECT_EQ(rocrand_cpp::mtgp32::default_seed, 0);
     EXPECT_EQ(rocrand_cpp::philox4x32_10::default_seed, ROCRAND_PHILOX4x32_DEFAULT_SEED);
+    EXPECT_EQ(rocrand_cpp::philox4x64_10::default_seed, ROCRAND_PHILOX4x64_DEFAULT_SEED);
     // sobol generators don't support seeding
     EXPECT_EQ(rocrand_cpp::threefry2x32::default_seed, 0);
     EXPECT_EQ(rocrand_cpp::threefry2x64::default_seed, 0);
     EXPECT_EQ(rocrand_cpp::threefry4x32::default_seed, 0);
     EXPECT_EQ(rocrand_cpp::threefry4x64::default_seed, 0);
     EXPECT_EQ(rocrand_cpp::xorwow::default_seed, ROCRAND_XORWOW_DEFAULT_SEED);
+    EXPECT_EQ(rocrand_cpp::xoshiro256pp::default_seed, ROCRAND_XOSHIRO256PP_DEFAULT_SEED);
+    EXPECT_EQ(rocrand_cpp::xoroshiro128ss::default_seed, ROCRAND_XOROSHIRO128SS_DEFAULT_SEED);
+    EXPECT_EQ(rocrand_cpp::pcg64_dxsm::default_seed, ROCRAND_PCG64_DXSM_DEFAULT_SEED);
+    EXPECT_EQ(rocrand_cpp::squares::default_seed, ROCRAND_SQUARES_DEFAULT_SEED);
 }
 
 using Generators = testing::Types<rocrand_cpp::lfsr113,
@@ -64,6 +69,7 @@ using Generators = testing::Types<rocrand_cpp::lfsr113,
                                   rocrand_cpp::mt19937,
                                   rocrand_cpp::mtgp32,
                                   rocrand_cpp::philox4x32_10,
+                                  rocrand_cpp::philox4x64_10,
                                   rocrand_cpp::threefry2x32,
                                   rocrand_cpp::threefry2x64,
                                   rocrand_cpp::threefry4x32,
@@ -72,7 +78,11 @@ using Generators = testing::Types<rocrand_cpp::lfsr113,
                                   rocrand_cpp::scrambled_sobol64,
                                   rocrand_cpp::sobol32,
                                   rocrand_cpp::sobol64,
-                                  rocrand_cpp::xorwow>;
+                                  rocrand_cpp::xorwow,
+                                  rocrand_cpp::xoshiro256pp,
+                                  rocrand_cpp::xoroshiro128ss,
+                                  rocrand_cpp::pcg64_dxsm,
+                                  rocrand_cpp::squares>;
 
 using rocrand_cpp_distributions = test_utils::test_matrix<
     // Generators
@@ -82,6 +92,7 @@ using rocrand_cpp_distributions = test_utils::test_matrix<
                rocrand_cpp::mt19937,
                rocrand_cpp::mtgp32,
                rocrand_cpp::philox4x32_10,
+               rocrand_cpp::philox4x64_10,
                rocrand_cpp::threefry2x32,
                rocrand_cpp::threefry2x64,
                rocrand_cpp::threefry4x32,
@@ -90,7 +101,11 @@ using rocrand_cpp_distributions = test_utils::test_matrix<
                rocrand_cpp::scrambled_sobol64,
                rocrand_cpp::sobol32,
                rocrand_cpp::sobol64,
-               rocrand_cpp::xorwow>,
+               rocrand_cpp::xorwow,
+               rocrand_cpp::xoshiro256pp,
+               rocrand_cpp::xoroshiro128ss,
+               rocrand_cpp::pcg64_dxsm,
+               rocrand_cpp::squares>,
     // Distributions
     std::tuple<rocrand_cpp::uniform_int_distribution<unsigned char>,
                rocrand_cpp::uniform_int_distribution<unsigned short>,
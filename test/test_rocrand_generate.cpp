@@ -27,6 +27,11 @@
 #include "test_common.hpp"
 #include "test_rocrand_common.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <vector>
+
 class rocrand_generate_tests : public ::testing::TestWithParam<rocrand_rng_type> { };
 
 TEST_P(rocrand_generate_tests, int_test)
@@ -155,6 +160,38 @@ TEST(rocrand_generate_tests, neg_test)
 
     EXPECT_EQ(rocrand_generate_long_long(generator, static_cast<unsigned long long*>(data), size),
               ROCRAND_STATUS_NOT_CREATED);
+
+    EXPECT_EQ(rocrand_generate_range(generator, static_cast<unsigned int*>(data), 0, size),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    EXPECT_EQ(rocrand_generate_batched(generator,
+                                       static_cast<unsigned int*>(data),
+                                       size,
+                                       size * sizeof(unsigned int),
+                                       nullptr,
+                                       nullptr,
+                                       1),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    EXPECT_EQ(rocrand_generate_2d(generator,
+                                  static_cast<unsigned int*>(data),
+                                  size * sizeof(unsigned int),
+                                  size,
+                                  1),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    EXPECT_EQ(rocrand_generate_strided(generator, static_cast<unsigned int*>(data), 1, size),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    size_t state_size;
+    EXPECT_EQ(rocrand_get_state_size(generator, &state_size), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_save_state(generator, data), ROCRAND_STATUS_NOT_CREATED);
+    EXPECT_EQ(rocrand_load_state(generator, data), ROCRAND_STATUS_NOT_CREATED);
+
+    rocrand_generator child;
+    EXPECT_EQ(rocrand_generator_split(generator, 1, &child), ROCRAND_STATUS_NOT_CREATED);
+
+    EXPECT_EQ(rocrand_generate_fused(generator, nullptr, 0), ROCRAND_STATUS_NOT_CREATED);
 }
 
 INSTANTIATE_TEST_SUITE_P(rocrand_generate_tests,
@@ -198,3 +235,947 @@ TEST_P(rocrand_generate_long_long_tests, long_long_test)
 INSTANTIATE_TEST_SUITE_P(rocrand_generate_long_long_tests,
                          rocrand_generate_long_long_tests,
                          ::testing::ValuesIn(long_long_rng_types));
+
+constexpr rocrand_rng_type range_rng_types[] = {ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                                ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+                                                ROCRAND_RNG_PSEUDO_THREEFRY2_32_20,
+                                                ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+                                                ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
+                                                ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+                                                ROCRAND_RNG_PSEUDO_SQUARES};
+
+class rocrand_generate_range_tests : public ::testing::TestWithParam<rocrand_rng_type>
+{};
+
+// The values at [first_index, first_index + size) are the same as the ones generated
+// sequentially after setting the offset, and the state of the generator is not changed.
+TEST_P(rocrand_generate_range_tests, range_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    // Generators of 64-bit values give two 32-bit values per offset
+    const bool is_64bit = std::find(std::begin(long_long_rng_types),
+                                    std::end(long_long_rng_types),
+                                    rng_type)
+                          != std::end(long_long_rng_types);
+    const unsigned long long values_per_offset = is_64bit ? 2 : 1;
+
+    constexpr unsigned long long seed      = 0xAAAAAAAAAAAULL;
+    constexpr unsigned long long offsets[] = {0, 1, 3, 12345, 0x100000000ULL + 5};
+    constexpr size_t             size      = 12563;
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(&data, size * sizeof(unsigned int)));
+
+    std::vector<unsigned int> expected(size);
+    std::vector<unsigned int> actual(size);
+
+    for(const unsigned long long offset : offsets)
+    {
+        SCOPED_TRACE(testing::Message() << "with offset = " << offset);
+        const unsigned long long first = offset * values_per_offset;
+
+        ROCRAND_CHECK(rocrand_set_offset(generator, offset));
+        ROCRAND_CHECK(rocrand_generate(generator, data, size));
+        HIP_CHECK(hipMemcpy(expected.data(), data, size * sizeof(unsigned int), hipMemcpyDefault));
+
+        // The offset set here and the values generated after it are not used.
+        ROCRAND_CHECK(rocrand_set_offset(generator, 7));
+        ROCRAND_CHECK(rocrand_generate(generator, data, 12));
+        ROCRAND_CHECK(rocrand_generate_range(generator, data, first, size));
+        HIP_CHECK(hipMemcpy(actual.data(), data, size * sizeof(unsigned int), hipMemcpyDefault));
+        assert_eq(actual, expected);
+
+        // Unaligned output, and an odd first index for the generators of 64-bit values
+        ROCRAND_CHECK(rocrand_generate_range(generator, data + 1, first + 1, size - 1));
+        HIP_CHECK(hipMemcpy(actual.data(), data, size * sizeof(unsigned int), hipMemcpyDefault));
+        assert_eq(actual, expected);
+
+        // Unaligned output, and an even first index
+        ROCRAND_CHECK(rocrand_generate_range(generator, data + 1, first, size - 1));
+        HIP_CHECK(hipMemcpy(actual.data(), data, size * sizeof(unsigned int), hipMemcpyDefault));
+        assert_eq(std::vector<unsigned int>(actual.begin() + 1, actual.end()),
+                  std::vector<unsigned int>(expected.begin(), expected.end() - 1));
+
+        // Sequential generation continues where it stopped before the range calls
+        std::vector<unsigned int> continued(size);
+        ROCRAND_CHECK(rocrand_generate(generator, data, size));
+        HIP_CHECK(
+            hipMemcpy(continued.data(), data, size * sizeof(unsigned int), hipMemcpyDefault));
+        ROCRAND_CHECK(rocrand_generate_range(generator, data, 7 * values_per_offset + 12, size));
+        HIP_CHECK(hipMemcpy(actual.data(), data, size * sizeof(unsigned int), hipMemcpyDefault));
+        assert_eq(actual, continued);
+    }
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_generate_range_tests,
+                         rocrand_generate_range_tests,
+                         ::testing::ValuesIn(range_rng_types));
+
+TEST(rocrand_generate_range_tests, unsupported_test)
+{
+    constexpr rocrand_rng_type unsupported_rng_types[]
+        = {ROCRAND_RNG_PSEUDO_XORWOW, ROCRAND_RNG_PSEUDO_MTGP32, ROCRAND_RNG_QUASI_SOBOL32};
+
+    for(const rocrand_rng_type rng_type : unsupported_rng_types)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+        unsigned int* data;
+        HIP_CHECK(hipMallocHelper(&data, 256 * sizeof(unsigned int)));
+        EXPECT_EQ(rocrand_generate_range(generator, data, 0, 256), ROCRAND_STATUS_TYPE_ERROR);
+
+        HIP_CHECK(hipFree(data));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+}
+
+constexpr rocrand_rng_type batched_rng_types[] = {ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                                  ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+                                                  ROCRAND_RNG_PSEUDO_THREEFRY2_32_20,
+                                                  ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+                                                  ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
+                                                  ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+                                                  ROCRAND_RNG_PSEUDO_MRG31K3P,
+                                                  ROCRAND_RNG_PSEUDO_MRG32K3A};
+
+class rocrand_generate_batched_tests : public ::testing::TestWithParam<rocrand_rng_type>
+{};
+
+// Every sequence of the batch is the same as the one of a generator with its seed and offset.
+TEST_P(rocrand_generate_batched_tests, batched_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    const std::vector<unsigned long long> seeds   = {0, 1, 0xAAAAAAAAAAAULL, 12345, 1};
+    const std::vector<unsigned long long> offsets = {0, 17, 3, 0x100000000ULL + 5, 100001};
+    constexpr size_t                      size    = 12563;
+    constexpr size_t                      pitch   = size + 3;
+    constexpr float                       mean    = 5.0f;
+    constexpr float                       stddev  = 2.0f;
+    const size_t                          batch_size = seeds.size();
+
+    unsigned long long* d_seeds;
+    unsigned long long* d_offsets;
+    HIP_CHECK(hipMallocHelper(&d_seeds, batch_size * sizeof(unsigned long long)));
+    HIP_CHECK(hipMallocHelper(&d_offsets, batch_size * sizeof(unsigned long long)));
+    HIP_CHECK(hipMemcpy(d_seeds,
+                        seeds.data(),
+                        batch_size * sizeof(unsigned long long),
+                        hipMemcpyHostToDevice));
+    HIP_CHECK(hipMemcpy(d_offsets,
+                        offsets.data(),
+                        batch_size * sizeof(unsigned long long),
+                        hipMemcpyHostToDevice));
+
+    unsigned int* data;
+    float*        normal_data;
+    HIP_CHECK(hipMallocHelper(&data, batch_size * pitch * sizeof(unsigned int)));
+    HIP_CHECK(hipMallocHelper(&normal_data, batch_size * pitch * sizeof(float)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_generate_batched(generator,
+                                           data,
+                                           size,
+                                           pitch * sizeof(unsigned int),
+                                           d_seeds,
+                                           d_offsets,
+                                           batch_size));
+    ROCRAND_CHECK(rocrand_generate_normal_batched(generator,
+                                                  normal_data,
+                                                  size,
+                                                  pitch * sizeof(float),
+                                                  d_seeds,
+                                                  d_offsets,
+                                                  batch_size,
+                                                  mean,
+                                                  stddev));
+
+    std::vector<unsigned int> batched(batch_size * pitch);
+    std::vector<float>        normal_batched(batch_size * pitch);
+    HIP_CHECK(hipMemcpy(batched.data(),
+                        data,
+                        batch_size * pitch * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(normal_batched.data(),
+                        normal_data,
+                        batch_size * pitch * sizeof(float),
+                        hipMemcpyDeviceToHost));
+
+    std::vector<unsigned int> expected(size);
+    std::vector<float>        normal_expected(size);
+    for(size_t i = 0; i < batch_size; i++)
+    {
+        SCOPED_TRACE(testing::Message() << "with seed = " << seeds[i]);
+
+        rocrand_generator reference;
+        ROCRAND_CHECK(rocrand_create_generator(&reference, rng_type));
+        ROCRAND_CHECK(rocrand_set_seed(reference, seeds[i]));
+        ROCRAND_CHECK(rocrand_set_offset(reference, offsets[i]));
+        // The values of some generators depend on the alignment of the output, so the
+        // reference values are generated at the same addresses.
+        ROCRAND_CHECK(rocrand_generate(reference, data + i * pitch, size));
+        HIP_CHECK(hipMemcpy(expected.data(),
+                            data + i * pitch,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDefault));
+
+        ROCRAND_CHECK(rocrand_set_offset(reference, offsets[i]));
+        ROCRAND_CHECK(
+            rocrand_generate_normal(reference, normal_data + i * pitch, size, mean, stddev));
+        HIP_CHECK(hipMemcpy(normal_expected.data(),
+                            normal_data + i * pitch,
+                            size * sizeof(float),
+                            hipMemcpyDefault));
+        ROCRAND_CHECK(rocrand_destroy_generator(reference));
+
+        assert_eq(std::vector<unsigned int>(batched.begin() + i * pitch,
+                                            batched.begin() + i * pitch + size),
+                  expected);
+        assert_eq(std::vector<float>(normal_batched.begin() + i * pitch,
+                                     normal_batched.begin() + i * pitch + size),
+                  normal_expected);
+    }
+
+    // Without offsets all sequences start at offset 0
+    ROCRAND_CHECK(rocrand_generate_batched(generator,
+                                           data,
+                                           size,
+                                           pitch * sizeof(unsigned int),
+                                           d_seeds,
+                                           nullptr,
+                                           2));
+    HIP_CHECK(hipMemcpy(batched.data(),
+                        data,
+                        2 * pitch * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    ROCRAND_CHECK(rocrand_set_seed(generator, seeds[1]));
+    ROCRAND_CHECK(rocrand_generate(generator, data + pitch, size));
+    HIP_CHECK(
+        hipMemcpy(expected.data(), data + pitch, size * sizeof(unsigned int), hipMemcpyDefault));
+    assert_eq(std::vector<unsigned int>(batched.begin() + pitch, batched.begin() + pitch + size),
+              expected);
+
+    EXPECT_EQ(rocrand_generate_batched(generator,
+                                       data,
+                                       size,
+                                       (size - 1) * sizeof(unsigned int),
+                                       d_seeds,
+                                       d_offsets,
+                                       2),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    // The pitch must be a multiple of the size of the values
+    EXPECT_EQ(rocrand_generate_batched(generator,
+                                       data,
+                                       size,
+                                       pitch * sizeof(unsigned int) + 1,
+                                       d_seeds,
+                                       d_offsets,
+                                       2),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_generate_normal_batched(generator,
+                                              normal_data,
+                                              size,
+                                              pitch * sizeof(float) - 2,
+                                              d_seeds,
+                                              d_offsets,
+                                              2,
+                                              mean,
+                                              stddev),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(normal_data));
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(d_offsets));
+    HIP_CHECK(hipFree(d_seeds));
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_generate_batched_tests,
+                         rocrand_generate_batched_tests,
+                         ::testing::ValuesIn(batched_rng_types));
+
+TEST(rocrand_generate_batched_tests, unsupported_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_XORWOW));
+
+    unsigned long long* seeds;
+    unsigned int*       data;
+    HIP_CHECK(hipMallocHelper(&seeds, 2 * sizeof(unsigned long long)));
+    HIP_CHECK(hipMallocHelper(&data, 2 * 256 * sizeof(unsigned int)));
+    EXPECT_EQ(rocrand_generate_batched(generator,
+                                       data,
+                                       256,
+                                       256 * sizeof(unsigned int),
+                                       seeds,
+                                       nullptr,
+                                       2),
+              ROCRAND_STATUS_TYPE_ERROR);
+
+    HIP_CHECK(hipFree(data));
+    HIP_CHECK(hipFree(seeds));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+constexpr rocrand_rng_type output_2d_rng_types[] = {ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                                    ROCRAND_RNG_PSEUDO_XORWOW,
+                                                    ROCRAND_RNG_PSEUDO_MRG31K3P,
+                                                    ROCRAND_RNG_PSEUDO_MRG32K3A};
+
+class rocrand_generate_2d_tests : public ::testing::TestWithParam<rocrand_rng_type>
+{};
+
+// The rows of a 2-D output hold the same values as a dense output of the same generator.
+TEST_P(rocrand_generate_2d_tests, pitched_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    constexpr size_t width  = 1003;
+    constexpr size_t height = 17;
+    constexpr size_t pitch  = 1024;
+    constexpr size_t size   = width * height;
+    constexpr float  mean   = 5.0f;
+    constexpr float  stddev = 2.0f;
+
+    unsigned int* data;
+    float*        float_data;
+    unsigned int* dense_data;
+    float*        dense_float_data;
+    HIP_CHECK(hipMallocHelper(&data, height * pitch * sizeof(unsigned int)));
+    HIP_CHECK(hipMallocHelper(&float_data, height * pitch * sizeof(float)));
+    HIP_CHECK(hipMallocHelper(&dense_data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMallocHelper(&dense_float_data, size * sizeof(float)));
+
+    rocrand_generator generator;
+    rocrand_generator reference;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_create_generator(&reference, rng_type));
+
+    std::vector<unsigned int> output(height * pitch);
+    std::vector<float>        float_output(height * pitch);
+    std::vector<unsigned int> expected(size);
+    std::vector<float>        float_expected(size);
+
+    // Calls are repeated to check that the generator continues after the 2-D output
+    for(int call = 0; call < 2; call++)
+    {
+        SCOPED_TRACE(testing::Message() << "call = " << call);
+
+        ROCRAND_CHECK(
+            rocrand_generate_2d(generator, data, pitch * sizeof(unsigned int), width, height));
+        ROCRAND_CHECK(rocrand_generate(reference, dense_data, size));
+        HIP_CHECK(hipMemcpy(output.data(),
+                            data,
+                            height * pitch * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(expected.data(),
+                            dense_data,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        for(size_t y = 0; y < height; y++)
+        {
+            assert_eq(std::vector<unsigned int>(output.begin() + y * pitch,
+                                                output.begin() + y * pitch + width),
+                      std::vector<unsigned int>(expected.begin() + y * width,
+                                                expected.begin() + (y + 1) * width));
+        }
+
+        ROCRAND_CHECK(rocrand_generate_uniform_2d(generator,
+                                                  float_data,
+                                                  pitch * sizeof(float),
+                                                  width,
+                                                  height));
+        ROCRAND_CHECK(rocrand_generate_uniform(reference, dense_float_data, size));
+        HIP_CHECK(hipMemcpy(float_output.data(),
+                            float_data,
+                            height * pitch * sizeof(float),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(float_expected.data(),
+                            dense_float_data,
+                            size * sizeof(float),
+                            hipMemcpyDeviceToHost));
+        for(size_t y = 0; y < height; y++)
+        {
+            assert_eq(std::vector<float>(float_output.begin() + y * pitch,
+                                         float_output.begin() + y * pitch + width),
+                      std::vector<float>(float_expected.begin() + y * width,
+                                         float_expected.begin() + (y + 1) * width));
+        }
+
+        ROCRAND_CHECK(rocrand_generate_normal_2d(generator,
+                                                 float_data,
+                                                 pitch * sizeof(float),
+                                                 width,
+                                                 height,
+                                                 mean,
+                                                 stddev));
+        ROCRAND_CHECK(rocrand_generate_normal(reference, dense_float_data, size, mean, stddev));
+        HIP_CHECK(hipMemcpy(float_output.data(),
+                            float_data,
+                            height * pitch * sizeof(float),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipMemcpy(float_expected.data(),
+                            dense_float_data,
+                            size * sizeof(float),
+                            hipMemcpyDeviceToHost));
+        for(size_t y = 0; y < height; y++)
+        {
+            assert_eq(std::vector<float>(float_output.begin() + y * pitch,
+                                         float_output.begin() + y * pitch + width),
+                      std::vector<float>(float_expected.begin() + y * width,
+                                         float_expected.begin() + (y + 1) * width));
+        }
+    }
+
+    // Rows must not overlap and the pitch must be a multiple of the element size
+    EXPECT_EQ(rocrand_generate_2d(generator, data, (width - 1) * sizeof(unsigned int), width, 2),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_generate_2d(generator, data, pitch * sizeof(unsigned int) + 1, width, 2),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(reference));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(dense_float_data));
+    HIP_CHECK(hipFree(dense_data));
+    HIP_CHECK(hipFree(float_data));
+    HIP_CHECK(hipFree(data));
+}
+
+// Strided output, e.g. to one member of an array of structures.
+TEST_P(rocrand_generate_2d_tests, strided_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    constexpr size_t size   = 12563;
+    constexpr size_t stride = 3;
+
+    unsigned int* data;
+    unsigned int* dense_data;
+    HIP_CHECK(hipMallocHelper(&data, size * stride * sizeof(unsigned int)));
+    HIP_CHECK(hipMallocHelper(&dense_data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMemset(data, 0, size * stride * sizeof(unsigned int)));
+
+    rocrand_generator generator;
+    rocrand_generator reference;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_create_generator(&reference, rng_type));
+
+    ROCRAND_CHECK(rocrand_generate_strided(generator, data + 1, stride, size));
+    ROCRAND_CHECK(rocrand_generate(reference, dense_data, size));
+
+    std::vector<unsigned int> output(size * stride);
+    std::vector<unsigned int> expected(size);
+    HIP_CHECK(hipMemcpy(output.data(),
+                        data,
+                        size * stride * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipMemcpy(expected.data(),
+                        dense_data,
+                        size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    for(size_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(output[i * stride], 0U);
+        ASSERT_EQ(output[i * stride + 1], expected[i]);
+        ASSERT_EQ(output[i * stride + 2], 0U);
+    }
+
+    EXPECT_EQ(rocrand_generate_strided(generator, data, 0, size), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(reference));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(dense_data));
+    HIP_CHECK(hipFree(data));
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_generate_2d_tests,
+                         rocrand_generate_2d_tests,
+                         ::testing::ValuesIn(output_2d_rng_types));
+
+TEST(rocrand_generate_2d_tests, unsupported_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(&data, 2 * 256 * sizeof(unsigned int)));
+    EXPECT_EQ(rocrand_generate_2d(generator, data, 256 * sizeof(unsigned int), 128, 2),
+              ROCRAND_STATUS_TYPE_ERROR);
+    EXPECT_EQ(rocrand_generate_strided(generator, data, 2, 256), ROCRAND_STATUS_TYPE_ERROR);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+// Paths are only generated for positive time steps, NaN is rejected too.
+TEST(rocrand_generate_brownian_bridge_tests, time_step_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_QUASI_SOBOL32));
+    ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(generator, 4));
+
+    constexpr size_t size = 4 * 64;
+    float*           data;
+    double*          double_data;
+    HIP_CHECK(hipMallocHelper(&data, size * sizeof(float)));
+    HIP_CHECK(hipMallocHelper(&double_data, size * sizeof(double)));
+
+    for(const double time_step : {0.0, -1.0, std::numeric_limits<double>::quiet_NaN()})
+    {
+        SCOPED_TRACE(testing::Message() << "with time_step = " << time_step);
+        EXPECT_EQ(rocrand_generate_brownian_bridge(generator,
+                                                   data,
+                                                   size,
+                                                   static_cast<float>(time_step)),
+                  ROCRAND_STATUS_OUT_OF_RANGE);
+        EXPECT_EQ(rocrand_generate_brownian_bridge_double(generator, double_data, size, time_step),
+                  ROCRAND_STATUS_OUT_OF_RANGE);
+    }
+    ROCRAND_CHECK(rocrand_generate_brownian_bridge(generator, data, size, 0.5f));
+    ROCRAND_CHECK(rocrand_generate_brownian_bridge_double(generator, double_data, size, 0.5));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    HIP_CHECK(hipFree(double_data));
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+constexpr rocrand_rng_type state_rng_types[] = {ROCRAND_RNG_PSEUDO_XORWOW,
+                                                ROCRAND_RNG_PSEUDO_MRG31K3P,
+                                                ROCRAND_RNG_PSEUDO_MRG32K3A,
+                                                ROCRAND_RNG_PSEUDO_LFSR113,
+                                                ROCRAND_RNG_PSEUDO_MTGP32,
+                                                ROCRAND_RNG_PSEUDO_MT19937};
+
+class rocrand_state_tests : public ::testing::TestWithParam<rocrand_rng_type>
+{};
+
+// A generator that loads a saved state continues the sequence of the saved generator.
+TEST_P(rocrand_state_tests, save_load_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    constexpr size_t size       = 12563;
+    constexpr size_t first_size = 1001;
+    constexpr float  mean       = 5.0f;
+    constexpr float  stddev     = 2.0f;
+
+    unsigned int* data;
+    float*        normal_data;
+    HIP_CHECK(hipMallocHelper(&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipMallocHelper(&normal_data, size * sizeof(float)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 12345ULL));
+
+    size_t state_size;
+    ROCRAND_CHECK(rocrand_get_state_size(generator, &state_size));
+    void* state;
+    HIP_CHECK(hipMallocHelper(&state, state_size));
+
+    // Save the state in the middle of the sequence, including a cached normal value
+    ROCRAND_CHECK(rocrand_generate(generator, data, first_size));
+    ROCRAND_CHECK(rocrand_generate_normal(generator, normal_data, 3, mean, stddev));
+    ROCRAND_CHECK(rocrand_save_state(generator, state));
+
+    std::vector<unsigned int> expected(size);
+    std::vector<float>        normal_expected(size);
+    ROCRAND_CHECK(rocrand_generate(generator, data, size));
+    ROCRAND_CHECK(rocrand_generate_normal(generator, normal_data, size, mean, stddev));
+    HIP_CHECK(hipMemcpy(expected.data(), data, size * sizeof(unsigned int), hipMemcpyDefault));
+    HIP_CHECK(
+        hipMemcpy(normal_expected.data(), normal_data, size * sizeof(float), hipMemcpyDefault));
+
+    // Loading the state into another generator with another seed
+    rocrand_generator loaded;
+    ROCRAND_CHECK(rocrand_create_generator(&loaded, rng_type));
+    ROCRAND_CHECK(rocrand_set_seed(loaded, 1ULL));
+    ROCRAND_CHECK(rocrand_generate(loaded, data, 17));
+    ROCRAND_CHECK(rocrand_load_state(loaded, state));
+
+    std::vector<unsigned int> output(size);
+    std::vector<float>        normal_output(size);
+    ROCRAND_CHECK(rocrand_generate(loaded, data, size));
+    ROCRAND_CHECK(rocrand_generate_normal(loaded, normal_data, size, mean, stddev));
+    HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDefault));
+    HIP_CHECK(
+        hipMemcpy(normal_output.data(), normal_data, size * sizeof(float), hipMemcpyDefault));
+    assert_eq(output, expected);
+    assert_eq(normal_output, normal_expected);
+
+    // A state of another type of generator is rejected
+    rocrand_generator other;
+    ROCRAND_CHECK(rocrand_create_generator(
+        &other,
+        rng_type == ROCRAND_RNG_PSEUDO_XORWOW ? ROCRAND_RNG_PSEUDO_MRG32K3A
+                                              : ROCRAND_RNG_PSEUDO_XORWOW));
+    EXPECT_EQ(rocrand_load_state(other, state), ROCRAND_STATUS_TYPE_ERROR);
+    ROCRAND_CHECK(rocrand_destroy_generator(other));
+
+    EXPECT_EQ(rocrand_save_state(generator, nullptr), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_get_state_size(generator, nullptr), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(loaded));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(state));
+    HIP_CHECK(hipFree(normal_data));
+    HIP_CHECK(hipFree(data));
+}
+
+// The offset is part of the state: a generator that loads a state saved after generating from
+// a non-zero offset continues the sequence and restarts from the same offset when reseeded.
+TEST_P(rocrand_state_tests, save_load_offset_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    constexpr size_t             size   = 4099;
+    constexpr unsigned long long offset = 1234567ULL;
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(&data, size * sizeof(unsigned int)));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    ROCRAND_CHECK(rocrand_set_seed(generator, 12345ULL));
+    const rocrand_status offset_status = rocrand_set_offset(generator, offset);
+    ASSERT_TRUE(offset_status == ROCRAND_STATUS_SUCCESS
+                || offset_status == ROCRAND_STATUS_TYPE_ERROR);
+
+    size_t state_size;
+    ROCRAND_CHECK(rocrand_get_state_size(generator, &state_size));
+    void* state;
+    HIP_CHECK(hipMallocHelper(&state, state_size));
+
+    ROCRAND_CHECK(rocrand_generate(generator, data, 333));
+    ROCRAND_CHECK(rocrand_save_state(generator, state));
+
+    rocrand_generator loaded;
+    ROCRAND_CHECK(rocrand_create_generator(&loaded, rng_type));
+    ROCRAND_CHECK(rocrand_load_state(loaded, state));
+
+    std::vector<unsigned int> expected(size);
+    std::vector<unsigned int> output(size);
+    for(unsigned int i = 0; i < 2; i++)
+    {
+        ROCRAND_CHECK(rocrand_generate(generator, data, size));
+        HIP_CHECK(hipMemcpy(expected.data(), data, size * sizeof(unsigned int), hipMemcpyDefault));
+        ROCRAND_CHECK(rocrand_generate(loaded, data, size));
+        HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDefault));
+        assert_eq(output, expected);
+
+        // Reseeding restarts both generators from the offset
+        ROCRAND_CHECK(rocrand_set_seed(generator, 54321ULL));
+        ROCRAND_CHECK(rocrand_set_seed(loaded, 54321ULL));
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(loaded));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    HIP_CHECK(hipFree(state));
+    HIP_CHECK(hipFree(data));
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_state_tests,
+                         rocrand_state_tests,
+                         ::testing::ValuesIn(state_rng_types));
+
+TEST(rocrand_state_tests, unsupported_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+
+    size_t state_size;
+    EXPECT_EQ(rocrand_get_state_size(generator, &state_size), ROCRAND_STATUS_TYPE_ERROR);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+constexpr rocrand_rng_type split_rng_types[] = {ROCRAND_RNG_PSEUDO_XORWOW,
+                                                ROCRAND_RNG_PSEUDO_MRG31K3P,
+                                                ROCRAND_RNG_PSEUDO_MRG32K3A,
+                                                ROCRAND_RNG_PSEUDO_LFSR113,
+                                                ROCRAND_RNG_PSEUDO_PHILOX4_32_10,
+                                                ROCRAND_RNG_PSEUDO_PHILOX4_64_10,
+                                                ROCRAND_RNG_PSEUDO_THREEFRY2_32_20,
+                                                ROCRAND_RNG_PSEUDO_THREEFRY2_64_20,
+                                                ROCRAND_RNG_PSEUDO_THREEFRY4_32_20,
+                                                ROCRAND_RNG_PSEUDO_THREEFRY4_64_20,
+                                                ROCRAND_RNG_PSEUDO_SQUARES};
+
+class rocrand_split_tests : public ::testing::TestWithParam<rocrand_rng_type>
+{};
+
+// Splitting does not change the sequence of the parent, and the parent, the children and
+// the children of a child all produce different sequences.
+TEST_P(rocrand_split_tests, split_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    constexpr size_t       size  = 4567;
+    constexpr unsigned int count = 3;
+
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(&data, size * sizeof(unsigned int)));
+
+    auto generate = [&](rocrand_generator generator, std::vector<unsigned int>& output)
+    {
+        output.resize(size);
+        ROCRAND_CHECK(rocrand_generate(generator, data, size));
+        HIP_CHECK(hipMemcpy(output.data(), data, size * sizeof(unsigned int), hipMemcpyDefault));
+    };
+
+    rocrand_generator reference;
+    ROCRAND_CHECK(rocrand_create_generator(&reference, rng_type));
+    ROCRAND_CHECK(rocrand_set_seed(reference, 12345ULL));
+    std::vector<unsigned int> expected;
+    generate(reference, expected);
+    ROCRAND_CHECK(rocrand_destroy_generator(reference));
+
+    rocrand_generator parent;
+    ROCRAND_CHECK(rocrand_create_generator(&parent, rng_type));
+    ROCRAND_CHECK(rocrand_set_seed(parent, 12345ULL));
+
+    rocrand_generator children[count];
+    ROCRAND_CHECK(rocrand_generator_split(parent, count, children));
+    rocrand_generator grandchildren[count];
+    ROCRAND_CHECK(rocrand_generator_split(children[0], count, grandchildren));
+
+    std::vector<std::vector<unsigned int>> outputs(1 + 2 * count);
+    generate(parent, outputs[0]);
+    for(unsigned int i = 0; i < count; i++)
+    {
+        generate(children[i], outputs[1 + 2 * i]);
+        generate(grandchildren[i], outputs[2 + 2 * i]);
+    }
+    assert_eq(outputs[0], expected);
+
+    for(size_t i = 0; i < outputs.size(); i++)
+    {
+        for(size_t j = i + 1; j < outputs.size(); j++)
+        {
+            EXPECT_NE(outputs[i], outputs[j]);
+        }
+    }
+
+    EXPECT_EQ(rocrand_generator_split(parent, 0, children), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_generator_split(parent, count, nullptr), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    for(unsigned int i = 0; i < count; i++)
+    {
+        ROCRAND_CHECK(rocrand_destroy_generator(grandchildren[i]));
+        ROCRAND_CHECK(rocrand_destroy_generator(children[i]));
+    }
+    ROCRAND_CHECK(rocrand_destroy_generator(parent));
+    HIP_CHECK(hipFree(data));
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_split_tests,
+                         rocrand_split_tests,
+                         ::testing::ValuesIn(split_rng_types));
+
+TEST(rocrand_split_tests, unsupported_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_MT19937));
+
+    rocrand_generator child;
+    EXPECT_EQ(rocrand_generator_split(generator, 1, &child), ROCRAND_STATUS_TYPE_ERROR);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+constexpr rocrand_rng_type fused_rng_types[] = {ROCRAND_RNG_PSEUDO_XORWOW,
+                                                ROCRAND_RNG_PSEUDO_MRG31K3P,
+                                                ROCRAND_RNG_PSEUDO_MRG32K3A,
+                                                ROCRAND_RNG_PSEUDO_LFSR113};
+
+class rocrand_fused_tests : public ::testing::TestWithParam<rocrand_rng_type>
+{};
+
+// The values of a fused generation are the same as the ones of separate generations of the
+// requests, including requests that are misaligned, skipped or need more than one launch,
+// and the generator continues from the same position afterwards.
+TEST_P(rocrand_fused_tests, fused_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    struct request_desc
+    {
+        rocrand_fused_distribution distribution;
+        size_t                     n;
+        size_t                     misalignment;
+        double                     mean;
+        double                     stddev;
+    };
+    const std::vector<request_desc> descs = {
+        {    ROCRAND_FUSED_UNIFORM_FLOAT,  1001, 1, 0.0, 1.0},
+        {     ROCRAND_FUSED_NORMAL_FLOAT,  2003, 1, 1.5, 2.0},
+        {     ROCRAND_FUSED_UNIFORM_UINT,    77, 0, 0.0, 0.0},
+        {     ROCRAND_FUSED_UNIFORM_UINT,     0, 0, 0.0, 0.0},
+        {    ROCRAND_FUSED_NORMAL_DOUBLE,   999, 1, 0.0, 1.0},
+        {   ROCRAND_FUSED_UNIFORM_DOUBLE,     5, 0, 0.0, 0.0},
+        { ROCRAND_FUSED_LOG_NORMAL_FLOAT,   301, 1, 0.0, 0.5},
+        {ROCRAND_FUSED_LOG_NORMAL_DOUBLE,   300, 1, 0.0, 0.5},
+        {     ROCRAND_FUSED_NORMAL_FLOAT,     1, 1, 0.0, 1.0},
+        {    ROCRAND_FUSED_UNIFORM_FLOAT, 65536, 0, 0.0, 1.0},
+    };
+
+    auto value_size = [](rocrand_fused_distribution distribution) -> size_t
+    {
+        return distribution == ROCRAND_FUSED_UNIFORM_DOUBLE
+                       || distribution == ROCRAND_FUSED_NORMAL_DOUBLE
+                       || distribution == ROCRAND_FUSED_LOG_NORMAL_DOUBLE
+                   ? sizeof(double)
+                   : sizeof(float);
+    };
+    auto generate_separately = [](rocrand_generator generator, const rocrand_fused_request& r)
+    {
+        switch(r.distribution)
+        {
+            case ROCRAND_FUSED_UNIFORM_UINT:
+                return rocrand_generate(generator, static_cast<unsigned int*>(r.output_data), r.n);
+            case ROCRAND_FUSED_UNIFORM_FLOAT:
+                return rocrand_generate_uniform(generator, static_cast<float*>(r.output_data), r.n);
+            case ROCRAND_FUSED_UNIFORM_DOUBLE:
+                return rocrand_generate_uniform_double(generator,
+                                                       static_cast<double*>(r.output_data),
+                                                       r.n);
+            case ROCRAND_FUSED_NORMAL_FLOAT:
+                return rocrand_generate_normal(generator,
+                                               static_cast<float*>(r.output_data),
+                                               r.n,
+                                               static_cast<float>(r.mean),
+                                               static_cast<float>(r.stddev));
+            case ROCRAND_FUSED_NORMAL_DOUBLE:
+                return rocrand_generate_normal_double(generator,
+                                                      static_cast<double*>(r.output_data),
+                                                      r.n,
+                                                      r.mean,
+                                                      r.stddev);
+            case ROCRAND_FUSED_LOG_NORMAL_FLOAT:
+                return rocrand_generate_log_normal(generator,
+                                                   static_cast<float*>(r.output_data),
+                                                   r.n,
+                                                   static_cast<float>(r.mean),
+                                                   static_cast<float>(r.stddev));
+            case ROCRAND_FUSED_LOG_NORMAL_DOUBLE:
+                return rocrand_generate_log_normal_double(generator,
+                                                          static_cast<double*>(r.output_data),
+                                                          r.n,
+                                                          r.mean,
+                                                          r.stddev);
+        }
+        return ROCRAND_STATUS_OUT_OF_RANGE;
+    };
+
+    // Every output is allocated separately with room for its misalignment
+    std::vector<unsigned char*>        expected_data(descs.size());
+    std::vector<unsigned char*>        actual_data(descs.size());
+    std::vector<rocrand_fused_request> expected_requests(descs.size());
+    std::vector<rocrand_fused_request> actual_requests(descs.size());
+    for(size_t i = 0; i < descs.size(); i++)
+    {
+        const size_t bytes = (descs[i].n + 1) * value_size(descs[i].distribution);
+        HIP_CHECK(hipMallocHelper(&expected_data[i], bytes));
+        HIP_CHECK(hipMallocHelper(&actual_data[i], bytes));
+        const size_t offset = descs[i].misalignment * value_size(descs[i].distribution);
+        expected_requests[i] = {descs[i].distribution,
+                                expected_data[i] + offset,
+                                descs[i].n,
+                                descs[i].mean,
+                                descs[i].stddev};
+        actual_requests[i]   = {descs[i].distribution,
+                                actual_data[i] + offset,
+                                descs[i].n,
+                                descs[i].mean,
+                                descs[i].stddev};
+    }
+    // A request without output is skipped
+    actual_requests.push_back({ROCRAND_FUSED_UNIFORM_FLOAT, nullptr, 100, 0.0, 1.0});
+
+    constexpr size_t after_size = 1234;
+    float*           after_data;
+    HIP_CHECK(hipMallocHelper(&after_data, after_size * sizeof(float)));
+
+    auto run = [&](bool fused, std::vector<float>& after)
+    {
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+        ROCRAND_CHECK(rocrand_set_seed(generator, 12345ULL));
+        ROCRAND_CHECK(rocrand_set_offset(generator, 123ULL));
+        if(fused)
+        {
+            ROCRAND_CHECK(
+                rocrand_generate_fused(generator, actual_requests.data(), actual_requests.size()));
+        }
+        else
+        {
+            for(const rocrand_fused_request& request : expected_requests)
+            {
+                ROCRAND_CHECK(generate_separately(generator, request));
+            }
+        }
+        ROCRAND_CHECK(rocrand_generate_uniform(generator, after_data, after_size));
+        after.resize(after_size);
+        HIP_CHECK(
+            hipMemcpy(after.data(), after_data, after_size * sizeof(float), hipMemcpyDefault));
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    };
+
+    std::vector<float> expected_after;
+    std::vector<float> actual_after;
+    run(false, expected_after);
+    run(true, actual_after);
+    assert_eq(actual_after, expected_after);
+
+    for(size_t i = 0; i < descs.size(); i++)
+    {
+        const size_t               bytes = descs[i].n * value_size(descs[i].distribution);
+        std::vector<unsigned char> expected(bytes);
+        std::vector<unsigned char> actual(bytes);
+        HIP_CHECK(hipMemcpy(expected.data(),
+                            expected_requests[i].output_data,
+                            bytes,
+                            hipMemcpyDefault));
+        HIP_CHECK(
+            hipMemcpy(actual.data(), actual_requests[i].output_data, bytes, hipMemcpyDefault));
+        assert_eq(actual, expected);
+        HIP_CHECK(hipFree(expected_data[i]));
+        HIP_CHECK(hipFree(actual_data[i]));
+    }
+    HIP_CHECK(hipFree(after_data));
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+    EXPECT_EQ(rocrand_generate_fused(generator, nullptr, 1), ROCRAND_STATUS_OUT_OF_RANGE);
+    rocrand_fused_request invalid
+        = {static_cast<rocrand_fused_distribution>(0), nullptr, 0, 0.0, 0.0};
+    EXPECT_EQ(rocrand_generate_fused(generator, &invalid, 1), ROCRAND_STATUS_OUT_OF_RANGE);
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_fused_tests,
+                         rocrand_fused_tests,
+                         ::testing::ValuesIn(fused_rng_types));
+
+TEST(rocrand_fused_tests, unsupported_test)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, ROCRAND_RNG_PSEUDO_PHILOX4_32_10));
+
+    float                 data;
+    rocrand_fused_request request = {ROCRAND_FUSED_UNIFORM_FLOAT, &data, 1, 0.0, 1.0};
+    EXPECT_EQ(rocrand_generate_fused(generator, &request, 1), ROCRAND_STATUS_TYPE_ERROR);
+
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
@@ -0,0 +1,143 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+class rocrand_generate_beta_tests : public ::testing::TestWithParam<rocrand_rng_type>
+{};
+
+template<class T, class GenerateFunc>
+void test_beta(const rocrand_rng_type rng_type, GenerateFunc generate_func)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size = 40000;
+    T*           data;
+    HIP_CHECK(hipMallocHelper(&data, size * sizeof(T)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    if(rng_type == ROCRAND_RNG_QUASI_SOBOL32 || rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32
+       || rng_type == ROCRAND_RNG_QUASI_SOBOL64 || rng_type == ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64)
+    {
+        // Rejection sampling is not supported by quasi-random generators
+        EXPECT_EQ(generate_func(generator, data, size, T(2), T(2)), ROCRAND_STATUS_TYPE_ERROR);
+    }
+    else
+    {
+        // Any sizes
+        ROCRAND_CHECK(generate_func(generator, data, 1, T(2), T(2)));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // Any alignment
+        ROCRAND_CHECK(generate_func(generator, data + 1, 2, T(2), T(2)));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        // Shapes below 1 use a different path
+        const std::pair<double, double> params[] = {{0.5, 2.0}, {3.0, 3.0}, {1.5, 0.2}};
+        for(const auto& [alpha, beta] : params)
+        {
+            SCOPED_TRACE(testing::Message() << "with alpha = " << alpha << ", beta = " << beta);
+
+            ROCRAND_CHECK(generate_func(generator, data, size, T(alpha), T(beta)));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            std::vector<T> host_data(size);
+            HIP_CHECK(
+                hipMemcpy(host_data.data(), data, size * sizeof(T), hipMemcpyDeviceToHost));
+            HIP_CHECK(hipDeviceSynchronize());
+
+            double mean = 0.0;
+            for(const T v : host_data)
+            {
+                ASSERT_TRUE(v >= T(0) && v <= T(1));
+                mean += v;
+            }
+            mean /= size;
+
+            double var = 0.0;
+            for(const T v : host_data)
+            {
+                var += (v - mean) * (v - mean);
+            }
+            var /= size;
+
+            const double expected_mean = alpha / (alpha + beta);
+            const double expected_var
+                = alpha * beta / ((alpha + beta) * (alpha + beta) * (alpha + beta + 1));
+            EXPECT_NEAR(mean, expected_mean, expected_mean * 0.05);
+            EXPECT_NEAR(var, expected_var, expected_var * 0.1);
+        }
+
+        // No output pointer
+        ROCRAND_CHECK(generate_func(generator, nullptr, size, T(2), T(2)));
+        HIP_CHECK(hipDeviceSynchronize());
+    }
+
+    EXPECT_EQ(generate_func(generator, data, size, T(0), T(2)), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(generate_func(generator, data, size, T(2), T(-1)), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(generate_func(generator, data, size, std::numeric_limits<T>::quiet_NaN(), T(2)),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(generate_func(generator, data, size, T(2), std::numeric_limits<T>::quiet_NaN()),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_beta_tests, float_test)
+{
+    test_beta<float>(GetParam(), rocrand_generate_beta);
+}
+
+TEST_P(rocrand_generate_beta_tests, double_test)
+{
+    test_beta<double>(GetParam(), rocrand_generate_beta_double);
+}
+
+TEST(rocrand_generate_beta_tests, neg_test)
+{
+    const size_t size = 256;
+    void*        data = nullptr;
+
+    rocrand_generator generator = nullptr;
+
+    EXPECT_EQ(rocrand_generate_beta(generator, static_cast<float*>(data), size, 2.0f, 2.0f),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    EXPECT_EQ(rocrand_generate_beta_double(generator, static_cast<double*>(data), size, 2.0, 2.0),
+              ROCRAND_STATUS_NOT_CREATED);
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_generate_beta_tests,
+                         rocrand_generate_beta_tests,
+                         ::testing::ValuesIn(rng_types));
@@ -0,0 +1,134 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+#include <utility>
+#include <vector>
+
+class rocrand_generate_binomial_tests : public ::testing::TestWithParam<rocrand_rng_type>
+{};
+
+TEST_P(rocrand_generate_binomial_tests, uint_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t  size = 12564;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any sizes
+    ROCRAND_CHECK(rocrand_generate_binomial(generator, data, 1, 10, 0.5));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any alignment
+    ROCRAND_CHECK(rocrand_generate_binomial(generator, data + 1, 2, 10, 0.5));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Inversion, BTRD, and BTRD of the complementary probability
+    const std::pair<unsigned int, double> params[] = {{8, 0.25}, {200, 0.4}, {5000, 0.9}};
+    for(const auto& [trials, p] : params)
+    {
+        SCOPED_TRACE(testing::Message() << "with trials = " << trials << ", p = " << p);
+
+        ROCRAND_CHECK(rocrand_generate_binomial(generator, data, size, trials, p));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<unsigned int> host_data(size);
+        HIP_CHECK(hipMemcpy(host_data.data(),
+                            data,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        double mean = 0.0;
+        for(const unsigned int v : host_data)
+        {
+            ASSERT_LE(v, trials);
+            mean += v;
+        }
+        mean /= size;
+
+        double var = 0.0;
+        for(const unsigned int v : host_data)
+        {
+            var += (v - mean) * (v - mean);
+        }
+        var /= size;
+
+        EXPECT_NEAR(mean, trials * p, trials * p * 0.05);
+        EXPECT_NEAR(var, trials * p * (1.0 - p), trials * p * (1.0 - p) * 0.1);
+    }
+
+    // Degenerate probabilities
+    std::vector<unsigned int> host_data(size);
+    ROCRAND_CHECK(rocrand_generate_binomial(generator, data, size, 7, 1.0));
+    HIP_CHECK(
+        hipMemcpy(host_data.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    for(const unsigned int v : host_data)
+    {
+        ASSERT_EQ(v, 7U);
+    }
+    ROCRAND_CHECK(rocrand_generate_binomial(generator, data, size, 7, 0.0));
+    HIP_CHECK(
+        hipMemcpy(host_data.data(), data, size * sizeof(unsigned int), hipMemcpyDeviceToHost));
+    for(const unsigned int v : host_data)
+    {
+        ASSERT_EQ(v, 0U);
+    }
+
+    // No output pointer
+    ROCRAND_CHECK(rocrand_generate_binomial(generator, nullptr, size, 10, 0.5));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(rocrand_generate_binomial(generator, data, size, 10, -0.1),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_generate_binomial(generator, data, size, 10, 1.1),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_binomial_tests, neg_test)
+{
+    const size_t  size = 256;
+    unsigned int* data = nullptr;
+
+    rocrand_generator generator = nullptr;
+
+    EXPECT_EQ(rocrand_generate_binomial(generator, data, size, 10, 0.5),
+              ROCRAND_STATUS_NOT_CREATED);
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_generate_binomial_tests,
+                         rocrand_generate_binomial_tests,
+                         ::testing::ValuesIn(rng_types));
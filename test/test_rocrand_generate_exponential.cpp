@@ -0,0 +1,114 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+class rocrand_generate_exponential_tests : public ::testing::TestWithParam<rocrand_rng_type>
+{};
+
+template<class T, class GenerateFunc>
+void test_exponential(const rocrand_rng_type rng_type, GenerateFunc generate_func)
+{
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t size   = 12564;
+    const T      lambda = 4;
+    T*           data;
+    HIP_CHECK(hipMallocHelper(&data, size * sizeof(T)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any sizes
+    ROCRAND_CHECK(generate_func(generator, data, 1, lambda));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any alignment
+    ROCRAND_CHECK(generate_func(generator, data + 1, 2, lambda));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    ROCRAND_CHECK(generate_func(generator, data, size, lambda));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    std::vector<T> host_data(size);
+    HIP_CHECK(hipMemcpy(host_data.data(), data, size * sizeof(T), hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    double mean = 0.0;
+    for(const T v : host_data)
+    {
+        ASSERT_GE(v, T(0));
+        ASSERT_TRUE(std::isfinite(v));
+        mean += v;
+    }
+    mean /= size;
+    EXPECT_NEAR(mean, 1.0 / lambda, 0.05 / lambda);
+
+    // No output pointer
+    ROCRAND_CHECK(generate_func(generator, nullptr, size, lambda));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(generate_func(generator, data, size, T(0)), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(generate_func(generator, data, size, std::numeric_limits<T>::quiet_NaN()),
+              ROCRAND_STATUS_OUT_OF_RANGE);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST_P(rocrand_generate_exponential_tests, float_test)
+{
+    test_exponential<float>(GetParam(), rocrand_generate_exponential);
+}
+
+TEST_P(rocrand_generate_exponential_tests, double_test)
+{
+    test_exponential<double>(GetParam(), rocrand_generate_exponential_double);
+}
+
+TEST(rocrand_generate_exponential_tests, neg_test)
+{
+    const size_t size   = 256;
+    const float  lambda = 2.0f;
+    void*        data   = nullptr;
+
+    rocrand_generator generator = nullptr;
+
+    EXPECT_EQ(rocrand_generate_exponential(generator, static_cast<float*>(data), size, lambda),
+              ROCRAND_STATUS_NOT_CREATED);
+
+    EXPECT_EQ(
+        rocrand_generate_exponential_double(generator, static_cast<double*>(data), size, lambda),
+        ROCRAND_STATUS_NOT_CREATED);
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_generate_exponential_tests,
+                         rocrand_generate_exponential_tests,
+                         ::testing::ValuesIn(rng_types));
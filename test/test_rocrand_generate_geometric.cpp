@@ -0,0 +1,103 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+#include <gtest/gtest.h>
+#include <stdio.h>
+
+#include <hip/hip_runtime.h>
+#include <rocrand/rocrand.h>
+
+#include "test_common.hpp"
+#include "test_rocrand_common.hpp"
+
+#include <vector>
+
+class rocrand_generate_geometric_tests : public ::testing::TestWithParam<rocrand_rng_type>
+{};
+
+TEST_P(rocrand_generate_geometric_tests, uint_test)
+{
+    const rocrand_rng_type rng_type = GetParam();
+
+    rocrand_generator generator;
+    ROCRAND_CHECK(rocrand_create_generator(&generator, rng_type));
+
+    const size_t  size = 12564;
+    unsigned int* data;
+    HIP_CHECK(hipMallocHelper(&data, size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any sizes
+    ROCRAND_CHECK(rocrand_generate_geometric(generator, data, 1, 0.5));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    // Any alignment
+    ROCRAND_CHECK(rocrand_generate_geometric(generator, data + 1, 2, 0.5));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    for(const double p : {1.0, 0.5, 0.05})
+    {
+        SCOPED_TRACE(testing::Message() << "with p = " << p);
+
+        ROCRAND_CHECK(rocrand_generate_geometric(generator, data, size, p));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        std::vector<unsigned int> host_data(size);
+        HIP_CHECK(hipMemcpy(host_data.data(),
+                            data,
+                            size * sizeof(unsigned int),
+                            hipMemcpyDeviceToHost));
+        HIP_CHECK(hipDeviceSynchronize());
+
+        double mean = 0.0;
+        for(const unsigned int v : host_data)
+        {
+            ASSERT_GE(v, 1U);
+            mean += v;
+        }
+        mean /= size;
+
+        EXPECT_NEAR(mean, 1.0 / p, 0.05 / p);
+    }
+
+    // No output pointer
+    ROCRAND_CHECK(rocrand_generate_geometric(generator, nullptr, size, 0.5));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    EXPECT_EQ(rocrand_generate_geometric(generator, data, size, 0.0), ROCRAND_STATUS_OUT_OF_RANGE);
+    EXPECT_EQ(rocrand_generate_geometric(generator, data, size, 1.5), ROCRAND_STATUS_OUT_OF_RANGE);
+
+    HIP_CHECK(hipFree(data));
+    ROCRAND_CHECK(rocrand_destroy_generator(generator));
+}
+
+TEST(rocrand_generate_geometric_tests, neg_test)
+{
+    const size_t  size = 256;
+    unsigned int* data = nullptr;
+
+    rocrand_generator generator = nullptr;
+
+    EXPECT_EQ(rocrand_generate_geometric(generator, data, size, 0.5), ROCRAND_STATUS_NOT_CREATED);
+}
+
+INSTANTIATE_TEST_SUITE_P(rocrand_generate_geometric_tests,
+                         rocrand_generate_geometric_tests,
+                         ::testing::ValuesIn(rng_types));
@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <iomanip>
+#include <iterator>
 #include <random>
 #include <vector>
 
@@ -75,7 +76,12 @@ constexpr host_test_params host_test_params_array[] = {
     { ROCRAND_RNG_PSEUDO_THREEFRY2_64_20, false,  true},
     { ROCRAND_RNG_PSEUDO_THREEFRY4_32_20, false,  true},
     { ROCRAND_RNG_PSEUDO_THREEFRY4_64_20, false,  true},
+    {   ROCRAND_RNG_PSEUDO_PHILOX4_64_10, false,  true},
     {          ROCRAND_RNG_PSEUDO_XORWOW, false,  true},
+    {    ROCRAND_RNG_PSEUDO_XOSHIRO256PP, false,  true},
+    {  ROCRAND_RNG_PSEUDO_XOROSHIRO128SS, false,  true},
+    {      ROCRAND_RNG_PSEUDO_PCG64_DXSM, false,  true},
+    {         ROCRAND_RNG_PSEUDO_SQUARES, false,  true},
     {ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32, false,  true},
     {ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64, false,  true},
     {          ROCRAND_RNG_QUASI_SOBOL32, false,  true},
@@ -427,6 +433,173 @@ TEST_P(rocrand_generate_host_test, poisson_parity_test)
     HIP_CHECK(hipFree(output));
 }
 
+// The number of blocks launched by host generators is selected from the host hardware.
+// Check that overriding it does not change the values of the generators that support it.
+TEST_P(rocrand_generate_host_test, launch_blocks_test)
+{
+    const rocrand_rng_type rng_type = GetParam().rng_type;
+
+    rocrand_generator device_generator;
+    ROCRAND_CHECK(rocrand_create_generator(&device_generator, rng_type));
+    EXPECT_EQ(ROCRAND_STATUS_TYPE_ERROR, rocrand_set_host_launch_blocks(device_generator, 1));
+    ROCRAND_CHECK(rocrand_destroy_generator(device_generator));
+
+    rocrand_generator host_generator = get_generator();
+    const rocrand_status status = rocrand_set_host_launch_blocks(host_generator, 0);
+    if(status == ROCRAND_STATUS_TYPE_ERROR)
+    {
+        ROCRAND_CHECK(rocrand_destroy_generator(host_generator));
+        GTEST_SKIP() << "The values of the generator depend on the number of blocks";
+    }
+    EXPECT_EQ(ROCRAND_STATUS_OUT_OF_RANGE, status);
+    EXPECT_EQ(ROCRAND_STATUS_OUT_OF_RANGE, rocrand_set_host_launch_blocks(host_generator, 65537));
+
+    constexpr size_t sizes[] = {1, 12345, 100000};
+    // 0 generates the expected values with the number of blocks that is selected
+    // automatically, 65536 launches the blocks of the config
+    constexpr unsigned int blocks[] = {0, 1, 3, 1000, 65536};
+
+    std::vector<std::vector<float>> expected;
+    for(const unsigned int block_count : blocks)
+    {
+        SCOPED_TRACE(testing::Message() << "with blocks = " << block_count);
+        if(block_count != 0)
+        {
+            ROCRAND_CHECK(rocrand_set_host_launch_blocks(host_generator, block_count));
+        }
+        ROCRAND_CHECK(rocrand_set_seed(host_generator, 0xAAAAAAAAAAAULL));
+
+        for(size_t i = 0; i < std::size(sizes); i++)
+        {
+            // Odd calls start at a misaligned address to generate heads and tails
+            std::vector<float> results(sizes[i] + 1);
+            ROCRAND_CHECK(
+                rocrand_generate_uniform(host_generator, results.data() + i % 2, sizes[i]));
+            HIP_CHECK(hipDeviceSynchronize());
+            if(block_count == 0)
+            {
+                expected.push_back(results);
+            }
+            else
+            {
+                assert_eq(results, expected[i]);
+            }
+        }
+    }
+
+    ROCRAND_CHECK(rocrand_destroy_generator(host_generator));
+}
+
+// The host Sobol generators compute runs of consecutive points for tiles of dimensions,
+// while the device generators leap-frog through the sequence. Check that the results match
+// for several dimensions, offsets and sizes that are not multiples of the run length.
+TEST(rocrand_generate_host_sobol_test, dimensions_parity_test)
+{
+    constexpr rocrand_rng_type   rng_types[]  = {ROCRAND_RNG_QUASI_SOBOL32,
+                                                 ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL32,
+                                                 ROCRAND_RNG_QUASI_SOBOL64,
+                                                 ROCRAND_RNG_QUASI_SCRAMBLED_SOBOL64};
+    constexpr unsigned int       dimensions[] = {1, 3, 17, 40};
+    constexpr unsigned long long offsets[]    = {0, 5, 12345};
+    constexpr size_t             sizes[]      = {1, 4097, 10001};
+
+    for(const rocrand_rng_type rng_type : rng_types)
+    {
+        SCOPED_TRACE(testing::Message() << "with rng_type = " << rng_type);
+        for(const unsigned int dims : dimensions)
+        {
+            SCOPED_TRACE(testing::Message() << "with dimensions = " << dims);
+            for(const unsigned long long offset : offsets)
+            {
+                SCOPED_TRACE(testing::Message() << "with offset = " << offset);
+
+                rocrand_generator host_generator;
+                rocrand_generator device_generator;
+                ROCRAND_CHECK(rocrand_create_generator_host_blocking(&host_generator, rng_type));
+                ROCRAND_CHECK(rocrand_create_generator(&device_generator, rng_type));
+                ROCRAND_CHECK(rocrand_set_quasi_random_generator_dimensions(host_generator, dims));
+                ROCRAND_CHECK(
+                    rocrand_set_quasi_random_generator_dimensions(device_generator, dims));
+                ROCRAND_CHECK(rocrand_set_offset(host_generator, offset));
+                ROCRAND_CHECK(rocrand_set_offset(device_generator, offset));
+
+                for(const size_t size : sizes)
+                {
+                    SCOPED_TRACE(testing::Message() << "with size = " << size);
+
+                    std::vector<unsigned int> host_results(size * dims);
+                    std::vector<unsigned int> device_results(host_results.size());
+
+                    unsigned int* output;
+                    HIP_CHECK(
+                        hipMallocHelper(&output, host_results.size() * sizeof(unsigned int)));
+
+                    ROCRAND_CHECK(
+                        rocrand_generate(host_generator, host_results.data(), host_results.size()));
+                    ROCRAND_CHECK(rocrand_generate(device_generator, output, host_results.size()));
+
+                    HIP_CHECK(hipMemcpy(device_results.data(),
+                                        output,
+                                        host_results.size() * sizeof(unsigned int),
+                                        hipMemcpyDeviceToHost));
+                    HIP_CHECK(hipDeviceSynchronize());
+                    HIP_CHECK(hipFree(output));
+
+                    assert_eq(host_results, device_results);
+                }
+
+                ROCRAND_CHECK(rocrand_destroy_generator(host_generator));
+                ROCRAND_CHECK(rocrand_destroy_generator(device_generator));
+            }
+        }
+    }
+}
+
+// ARS has no device implementation, so its host results can't be compared with a device
+// generator. Check that generating in several calls and with an offset continues the
+// same sequence instead.
+TEST(rocrand_generate_host_ars_test, continuity_test)
+{
+    rocrand_generator device_generator;
+    EXPECT_EQ(ROCRAND_STATUS_TYPE_ERROR,
+              rocrand_create_generator(&device_generator, ROCRAND_RNG_PSEUDO_ARS));
+
+    constexpr size_t size     = 10001;
+    constexpr size_t splits[] = {1, 3, 64, 4097};
+
+    for(const unsigned long long seed : get_seeds())
+    {
+        SCOPED_TRACE(testing::Message() << "with seed = " << seed);
+
+        rocrand_generator generator;
+        ROCRAND_CHECK(rocrand_create_generator_host_blocking(&generator, ROCRAND_RNG_PSEUDO_ARS));
+        ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+
+        std::vector<unsigned int> expected(size);
+        ROCRAND_CHECK(rocrand_generate(generator, expected.data(), size));
+
+        for(const size_t split : splits)
+        {
+            SCOPED_TRACE(testing::Message() << "with split = " << split);
+
+            std::vector<unsigned int> results(size);
+            ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+            ROCRAND_CHECK(rocrand_generate(generator, results.data(), split));
+            ROCRAND_CHECK(rocrand_generate(generator, results.data() + split, size - split));
+            assert_eq(results, expected);
+
+            ROCRAND_CHECK(rocrand_set_seed(generator, seed));
+            ROCRAND_CHECK(rocrand_set_offset(generator, split));
+            ROCRAND_CHECK(rocrand_generate(generator, results.data(), size - split));
+            results.resize(size - split);
+            assert_eq(results,
+                      std::vector<unsigned int>(expected.begin() + split, expected.end()));
+        }
+
+        ROCRAND_CHECK(rocrand_destroy_generator(generator));
+    }
+}
+
 INSTANTIATE_TEST_SUITE_P(rocrand_generate_host_test,
                          rocrand_generate_host_test,
                          ::testing::ValuesIn(host_test_params_array));
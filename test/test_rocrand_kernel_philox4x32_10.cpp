@@ -23,6 +23,7 @@
 
 #include <cmath>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <hip/hip_runtime.h>
@@ -160,6 +161,25 @@ void rocrand_poisson_kernel(unsigned int* output, const size_t size, double lamb
     }
 }
 
+template<class GeneratorState>
+__global__
+void rocrand_binomial_kernel(unsigned int* output, const size_t size, unsigned int n, double p)
+{
+    const unsigned int state_id    = blockIdx.x * blockDim.x + threadIdx.x;
+    const unsigned int global_size = gridDim.x * blockDim.x;
+
+    GeneratorState     state;
+    const unsigned int subsequence = state_id;
+    rocrand_init(456, subsequence, 234ULL, &state);
+
+    unsigned int index = state_id;
+    while(index < size)
+    {
+        output[index] = rocrand_binomial(&state, n, p);
+        index += global_size;
+    }
+}
+
 template<class GeneratorState>
 __global__
 void rocrand_discrete_kernel(unsigned int*                 output,
@@ -525,3 +545,66 @@ const double lambdas[] = {1.0, 5.5, 20.0, 100.0, 1234.5, 5000.0};
 INSTANTIATE_TEST_SUITE_P(rocrand_kernel_philox4x32_10_poisson,
                          rocrand_kernel_philox4x32_10_poisson,
                          ::testing::ValuesIn(lambdas));
+
+class rocrand_kernel_philox4x32_10_binomial
+    : public ::testing::TestWithParam<std::pair<unsigned int, double>>
+{};
+
+TEST_P(rocrand_kernel_philox4x32_10_binomial, rocrand_binomial)
+{
+    typedef rocrand_state_philox4x32_10 state_type;
+
+    const unsigned int n = GetParam().first;
+    const double       p = GetParam().second;
+
+    const size_t  output_size = 8192;
+    unsigned int* output;
+    HIP_CHECK(hipMallocHelper(&output, output_size * sizeof(unsigned int)));
+    HIP_CHECK(hipDeviceSynchronize());
+
+    hipLaunchKernelGGL(HIP_KERNEL_NAME(rocrand_binomial_kernel<state_type>),
+                       dim3(4),
+                       dim3(64),
+                       0,
+                       0,
+                       output,
+                       output_size,
+                       n,
+                       p);
+    HIP_CHECK(hipGetLastError());
+
+    std::vector<unsigned int> output_host(output_size);
+    HIP_CHECK(hipMemcpy(output_host.data(),
+                        output,
+                        output_size * sizeof(unsigned int),
+                        hipMemcpyDeviceToHost));
+    HIP_CHECK(hipDeviceSynchronize());
+    HIP_CHECK(hipFree(output));
+
+    double mean = 0;
+    for(auto v : output_host)
+    {
+        ASSERT_LE(v, n);
+        mean += static_cast<double>(v);
+    }
+    mean = mean / output_size;
+
+    double variance = 0;
+    for(auto v : output_host)
+    {
+        variance += std::pow(v - mean, 2);
+    }
+    variance = variance / output_size;
+
+    const double expected_mean     = n * p;
+    const double expected_variance = n * p * (1.0 - p);
+    EXPECT_NEAR(mean, expected_mean, std::max(0.1, expected_mean * 1e-1));
+    EXPECT_NEAR(variance, expected_variance, std::max(0.1, expected_variance * 1e-1));
+}
+
+const std::pair<unsigned int, double> binomial_params[]
+    = {{1, 0.5}, {20, 0.1}, {50, 0.3}, {1000, 0.5}, {100000, 0.95}};
+
+INSTANTIATE_TEST_SUITE_P(rocrand_kernel_philox4x32_10_binomial,
+                         rocrand_kernel_philox4x32_10_binomial,
+                         ::testing::ValuesIn(binomial_params));
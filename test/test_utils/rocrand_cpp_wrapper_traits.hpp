@@ -41,6 +41,21 @@ template<>
 struct supports_offset<rocrand_cpp::philox4x32_10> : std::true_type
 {};
 template<>
+struct supports_offset<rocrand_cpp::philox4x64_10> : std::true_type
+{};
+template<>
+struct supports_offset<rocrand_cpp::xoshiro256pp> : std::true_type
+{};
+template<>
+struct supports_offset<rocrand_cpp::xoroshiro128ss> : std::true_type
+{};
+template<>
+struct supports_offset<rocrand_cpp::pcg64_dxsm> : std::true_type
+{};
+template<>
+struct supports_offset<rocrand_cpp::squares> : std::true_type
+{};
+template<>
 struct supports_offset<rocrand_cpp::threefry2x32> : std::true_type
 {};
 template<>
@@ -117,6 +132,21 @@ template<>
 struct is_qrng<rocrand_cpp::philox4x32_10> : std::false_type
 {};
 template<>
+struct is_qrng<rocrand_cpp::philox4x64_10> : std::false_type
+{};
+template<>
+struct is_qrng<rocrand_cpp::xoshiro256pp> : std::false_type
+{};
+template<>
+struct is_qrng<rocrand_cpp::xoroshiro128ss> : std::false_type
+{};
+template<>
+struct is_qrng<rocrand_cpp::pcg64_dxsm> : std::false_type
+{};
+template<>
+struct is_qrng<rocrand_cpp::squares> : std::false_type
+{};
+template<>
 struct is_qrng<rocrand_cpp::threefry2x32> : std::false_type
 {};
 template<>
@@ -158,6 +188,21 @@ template<>
 struct is_64bit<rocrand_cpp::philox4x32_10> : std::false_type
 {};
 template<>
+struct is_64bit<rocrand_cpp::philox4x64_10> : std::true_type
+{};
+template<>
+struct is_64bit<rocrand_cpp::xoshiro256pp> : std::true_type
+{};
+template<>
+struct is_64bit<rocrand_cpp::xoroshiro128ss> : std::true_type
+{};
+template<>
+struct is_64bit<rocrand_cpp::pcg64_dxsm> : std::true_type
+{};
+template<>
+struct is_64bit<rocrand_cpp::squares> : std::false_type
+{};
+template<>
 struct is_64bit<rocrand_cpp::sobol32> : std::false_type
 {};
 template<>
@@ -0,0 +1,327 @@
+// Copyright (c) 2025 Advanced Micro Devices, Inc. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+
+// Computes the jump polynomials used by the xoshiro256++ and xoroshiro128** engines.
+//
+// The state transition of both engines is linear over GF(2). Jumping ahead by n steps
+// is done by evaluating the polynomial x^n mod P(x) at the transition matrix, where P
+// is the characteristic polynomial of the transition. The published JUMP and LONG_JUMP
+// constants are x^(2^128) mod P and x^(2^192) mod P for xoshiro256, and x^(2^64) mod P
+// and x^(2^96) mod P for xoroshiro128.
+//
+// For every kind of skip (single numbers, subsequences and sequences) the tool emits
+// the polynomials for the 64 consecutive powers of two, so an arbitrary 64-bit count
+// can be skipped by at most 64 polynomial evaluations.
+
+#include "utils.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+constexpr int jump_polynomials = 64;
+
+inline uint64_t rotl(const uint64_t x, const int k)
+{
+    return (x << k) | (x >> (64 - k));
+}
+
+// Polynomial over GF(2), bit i of word i / 64 is the coefficient of x^i.
+using polynomial = std::vector<uint64_t>;
+
+bool get_bit(const polynomial& p, const int i)
+{
+    return (p[i / 64] >> (i % 64)) & 1;
+}
+
+void flip_bit(polynomial& p, const int i)
+{
+    p[i / 64] ^= uint64_t(1) << (i % 64);
+}
+
+// Returns a * b mod m, where m has degree `degree` and a and b are reduced.
+polynomial mul_mod(const polynomial& a, const polynomial& b, const polynomial& m, const int degree)
+{
+    const int  words = degree / 64;
+    polynomial product(2 * words + 1, 0);
+    for(int i = 0; i < degree; i++)
+    {
+        if(get_bit(a, i))
+        {
+            for(int j = 0; j < degree; j++)
+            {
+                if(get_bit(b, j))
+                {
+                    flip_bit(product, i + j);
+                }
+            }
+        }
+    }
+    for(int i = 2 * degree - 2; i >= degree; i--)
+    {
+        if(get_bit(product, i))
+        {
+            for(int j = 0; j <= degree; j++)
+            {
+                if(get_bit(m, j))
+                {
+                    flip_bit(product, i - degree + j);
+                }
+            }
+        }
+    }
+    product.resize(words);
+    return product;
+}
+
+// Berlekamp-Massey over GF(2). Returns the characteristic polynomial
+// (degree `degree`, words + 1 words) of the bit sequence.
+polynomial minimal_polynomial(const std::vector<int>& s, const int degree)
+{
+    const int        n = static_cast<int>(s.size());
+    std::vector<int> c(n + 1, 0), b(n + 1, 0);
+    c[0] = b[0] = 1;
+    int l = 0, m = -1;
+    for(int i = 0; i < n; i++)
+    {
+        int d = s[i];
+        for(int j = 1; j <= l; j++)
+        {
+            d ^= c[j] & s[i - j];
+        }
+        if(d != 0)
+        {
+            const std::vector<int> t = c;
+            for(int j = 0; j + i - m <= n; j++)
+            {
+                c[j + i - m] ^= b[j];
+            }
+            if(2 * l <= i)
+            {
+                l = i + 1 - l;
+                m = i;
+                b = t;
+            }
+        }
+    }
+    if(l != degree)
+    {
+        std::cerr << "Unexpected degree of the minimal polynomial: " << l << std::endl;
+        std::exit(-1);
+    }
+    // The characteristic polynomial is the reciprocal of the connection polynomial
+    polynomial p(degree / 64 + 1, 0);
+    for(int i = 0; i <= l; i++)
+    {
+        if(c[i])
+        {
+            flip_bit(p, l - i);
+        }
+    }
+    return p;
+}
+
+struct xoshiro256_state
+{
+    static constexpr int      words            = 4;
+    static constexpr uint64_t jump[words]      = {0x180ec6d33cfd0abaULL,
+                                                  0xd5a61266f0c9392cULL,
+                                                  0xa9582618e03fc9aaULL,
+                                                  0x39abdc4529b1661cULL};
+    static constexpr uint64_t long_jump[words] = {0x76e15d3efefdcbbfULL,
+                                                  0xc5004e441c522fb3ULL,
+                                                  0x77710069854ee241ULL,
+                                                  0x39109bb02acbe635ULL};
+    static constexpr int      jump_log2        = 128;
+    static constexpr int      long_jump_log2   = 192;
+
+    uint64_t s[words];
+
+    void discard()
+    {
+        const uint64_t t = s[1] << 17;
+        s[2] ^= s[0];
+        s[3] ^= s[1];
+        s[1] ^= s[2];
+        s[0] ^= s[3];
+        s[2] ^= t;
+        s[3] = rotl(s[3], 45);
+    }
+};
+
+struct xoroshiro128_state
+{
+    static constexpr int      words            = 2;
+    static constexpr uint64_t jump[words]      = {0xdf900294d8f554a5ULL, 0x170865df4b3201fcULL};
+    static constexpr uint64_t long_jump[words] = {0xd2a98b26625eee7bULL, 0xdddf9b1090aa7ac1ULL};
+    static constexpr int      jump_log2        = 64;
+    static constexpr int      long_jump_log2   = 96;
+
+    uint64_t s[words];
+
+    void discard()
+    {
+        const uint64_t s0 = s[0];
+        const uint64_t s1 = s[1] ^ s0;
+        s[0]              = rotl(s0, 24) ^ s1 ^ (s1 << 16);
+        s[1]              = rotl(s1, 37);
+    }
+};
+
+template<class State>
+struct jump_tables
+{
+    std::vector<polynomial> offset;
+    std::vector<polynomial> subsequence;
+    std::vector<polynomial> sequence;
+};
+
+template<class State>
+jump_tables<State> generate_jump_tables()
+{
+    constexpr int degree = State::words * 64;
+
+    State state{};
+    for(int i = 0; i < State::words; i++)
+    {
+        state.s[i] = 0x9E3779B97F4A7C15ULL * (i + 1);
+    }
+    std::vector<int> bits(2 * degree);
+    for(int i = 0; i < 2 * degree; i++)
+    {
+        bits[i] = state.s[0] & 1;
+        state.discard();
+    }
+    const polynomial m = minimal_polynomial(bits, degree);
+
+    // powers[k] = x^(2^k) mod m
+    const int               count = State::long_jump_log2 + jump_polynomials;
+    std::vector<polynomial> powers;
+    polynomial              x(State::words, 0);
+    flip_bit(x, 1);
+    powers.push_back(x);
+    for(int k = 1; k < count; k++)
+    {
+        powers.push_back(mul_mod(powers.back(), powers.back(), m, degree));
+    }
+
+    // Check the computed polynomials against the published constants
+    if(!std::equal(State::jump, State::jump + State::words, powers[State::jump_log2].begin())
+       || !std::equal(State::long_jump,
+                      State::long_jump + State::words,
+                      powers[State::long_jump_log2].begin()))
+    {
+        std::cerr << "Computed jump polynomials do not match the published ones" << std::endl;
+        std::exit(-1);
+    }
+
+    jump_tables<State> tables;
+    tables.offset.assign(powers.begin(), powers.begin() + jump_polynomials);
+    tables.subsequence.assign(powers.begin() + State::jump_log2,
+                              powers.begin() + State::jump_log2 + jump_polynomials);
+    tables.sequence.assign(powers.begin() + State::long_jump_log2,
+                           powers.begin() + State::long_jump_log2 + jump_polynomials);
+    return tables;
+}
+
+void write_polynomials(std::ofstream&                 fout,
+                       const std::string&             name,
+                       const std::string&             generator,
+                       const std::vector<polynomial>& polynomials,
+                       bool                           is_device)
+{
+    fout << "// clang-format off" << std::endl;
+    fout << "static const " << (is_device ? "__device__ " : "") << "unsigned long long " << name
+         << "[" << generator << "_JUMP_POLYNOMIALS][" << generator << "_WORDS] = {" << std::endl;
+    for(const polynomial& p : polynomials)
+    {
+        fout << "    {";
+        for(size_t i = 0; i < p.size(); i++)
+        {
+            fout << "0x" << std::hex << std::setw(16) << std::setfill('0') << p[i] << std::dec
+                 << "ULL" << (i + 1 < p.size() ? ", " : "");
+        }
+        fout << "}," << std::endl;
+    }
+    fout << "};" << std::endl;
+    fout << "// clang-format on" << std::endl;
+    fout << std::endl;
+}
+
+template<class State>
+void write_tables(std::ofstream& fout, const std::string& name, const std::string& generator)
+{
+    const jump_tables<State> tables = generate_jump_tables<State>();
+
+    fout << "#define " << generator << "_WORDS " << State::words << std::endl;
+    fout << "#define " << generator << "_JUMP_POLYNOMIALS " << jump_polynomials << std::endl;
+    fout << std::endl;
+
+    for(bool is_device : {true, false})
+    {
+        const std::string prefix = is_device ? "d_" : "h_";
+        write_polynomials(fout, prefix + name + "_jump", generator, tables.offset, is_device);
+        write_polynomials(fout,
+                          prefix + name + "_subsequence_jump",
+                          generator,
+                          tables.subsequence,
+                          is_device);
+        write_polynomials(fout,
+                          prefix + name + "_sequence_jump",
+                          generator,
+                          tables.sequence,
+                          is_device);
+    }
+}
+
+} // namespace
+
+int main(int argc, char const* argv[])
+{
+    if(argc != 2 || std::string(argv[1]) == "--help")
+    {
+        std::cout << "Usage:" << std::endl;
+        std::cout << "  ./xoshiro_precomputed_generator "
+                     "../../library/include/rocrand/rocrand_xoshiro_precomputed.h"
+                  << std::endl;
+        return -1;
+    }
+
+    const std::string file_path(argv[1]);
+    std::ofstream     fout(file_path, std::ios_base::out | std::ios_base::trunc);
+    rocrand_tools::write_preamble(fout, "xoshiro_precomputed_generator");
+    fout << "#ifndef ROCRAND_XOSHIRO_PRECOMPUTED_H_" << std::endl;
+    fout << "#define ROCRAND_XOSHIRO_PRECOMPUTED_H_" << std::endl;
+    fout << std::endl;
+
+    write_tables<xoshiro256_state>(fout, "xoshiro256pp", "XOSHIRO256");
+    write_tables<xoroshiro128_state>(fout, "xoroshiro128ss", "XOROSHIRO128");
+
+    fout << "#endif // ROCRAND_XOSHIRO_PRECOMPUTED_H_" << std::endl;
+
+    return 0;
+}